@@ -0,0 +1,134 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Benchmarks
+{
+    // A benchmark returns false when its built-in validation fails so CI can flag the run.
+    using BenchmarkFunction = std::function<bool()>;
+
+    struct BenchmarkEntry
+    {
+        std::string Name;
+        std::string Description;
+        BenchmarkFunction Function;
+    };
+
+    std::vector<BenchmarkEntry>& GetBenchmarkRegistry();
+
+    // Registers a benchmark during static initialization; see REGISTER_BENCHMARK.
+    struct BenchmarkRegistrar
+    {
+        BenchmarkRegistrar(const char* name, const char* description, BenchmarkFunction function);
+    };
+
+    // Command line options shared by every scenario.
+    struct BenchmarkSettings
+    {
+        // Untimed runs before measuring, so caches, page tables and lazily built tables are warm.
+        uint32_t WarmupRuns = 1;
+
+        // Timed runs per measurement; the summary is computed over these.
+        uint32_t Repetitions = 5;
+
+        std::string JsonPath;
+        std::string CsvPath;
+    };
+
+    const BenchmarkSettings& GetBenchmarkSettings();
+
+    // Order statistics and moments of a set of samples.
+    struct SampleSummary
+    {
+        uint32_t Count = 0;
+        double Min = 0.0;
+        double Max = 0.0;
+        double Mean = 0.0;
+        double Median = 0.0;
+        double P90 = 0.0;
+        double StdDev = 0.0;
+    };
+
+    SampleSummary Summarize(std::vector<double> samples);
+
+    // Print a single named result for the benchmark that is currently running.
+    void ReportMetric(const std::string& metric, double value, const char* unit);
+
+    // Print and record the summary of repeated measurements; the median is the headline value.
+    void ReportSamples(const std::string& metric, const std::vector<double>& samples, const char* unit);
+
+    // Minimal wall-clock timer for measuring scenario phases.
+    class Stopwatch
+    {
+    public:
+        Stopwatch() : m_Start(std::chrono::steady_clock::now())
+        {
+
+        }
+
+        void Reset() { m_Start = std::chrono::steady_clock::now(); }
+
+        double GetElapsedSeconds() const
+        {
+            return std::chrono::duration<double>(std::chrono::steady_clock::now() - m_Start).count();
+        }
+
+    private:
+        std::chrono::steady_clock::time_point m_Start;
+    };
+
+    // Run body WarmupRuns times untimed, then Repetitions times timed; returns the seconds of each timed run.
+    template<typename F>
+    std::vector<double> MeasureRepeated(F&& body)
+    {
+        const BenchmarkSettings& l_Settings = GetBenchmarkSettings();
+        for (uint32_t i = 0; i < l_Settings.WarmupRuns; ++i)
+        {
+            body();
+        }
+
+        std::vector<double> l_Seconds;
+        l_Seconds.reserve(l_Settings.Repetitions);
+        for (uint32_t i = 0; i < l_Settings.Repetitions; ++i)
+        {
+            Stopwatch l_Stopwatch;
+            body();
+            l_Seconds.push_back(l_Stopwatch.GetElapsedSeconds());
+        }
+
+        return l_Seconds;
+    }
+
+    // Same warmup/repetition contract as MeasureRepeated, for bodies that measure a phase themselves and return it.
+    template<typename F>
+    std::vector<double> CollectRepeated(F&& body)
+    {
+        const BenchmarkSettings& l_Settings = GetBenchmarkSettings();
+        for (uint32_t i = 0; i < l_Settings.WarmupRuns; ++i)
+        {
+            body();
+        }
+
+        std::vector<double> l_Values;
+        l_Values.reserve(l_Settings.Repetitions);
+        for (uint32_t i = 0; i < l_Settings.Repetitions; ++i)
+        {
+            l_Values.push_back(body());
+        }
+
+        return l_Values;
+    }
+
+    // Convert per-run seconds into a rate (items per second, times scale) or a cost per item (seconds times scale).
+    std::vector<double> ToRates(const std::vector<double>& seconds, double itemsPerRun, double scale = 1.0);
+    std::vector<double> ToPerItem(const std::vector<double>& seconds, double itemsPerRun, double scale = 1.0);
+}
+
+#define BENCHMARK_CONCAT_INNER(a, b) a##b
+#define BENCHMARK_CONCAT(a, b) BENCHMARK_CONCAT_INNER(a, b)
+#define REGISTER_BENCHMARK(name, description, function) \
+    static ::Benchmarks::BenchmarkRegistrar BENCHMARK_CONCAT(s_BenchmarkRegistrar, __LINE__)(name, description, function)
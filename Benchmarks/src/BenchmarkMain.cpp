@@ -0,0 +1,338 @@
+#include "Benchmark.h"
+
+#include "Engine/Core/Log.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <thread>
+
+namespace Benchmarks
+{
+    namespace
+    {
+        // One line of the machine-readable output.
+        struct MetricRecord
+        {
+            std::string Benchmark;
+            std::string Metric;
+            std::string Unit;
+            SampleSummary Summary;
+        };
+
+        struct ScenarioRecord
+        {
+            std::string Name;
+            bool HasPassed = false;
+            double Seconds = 0.0;
+        };
+
+        const BenchmarkEntry* s_CurrentBenchmark = nullptr;
+        BenchmarkSettings s_Settings;
+        std::vector<MetricRecord> s_Metrics;
+        std::vector<ScenarioRecord> s_Scenarios;
+
+        void RecordMetric(const std::string& metric, const char* unit, const SampleSummary& summary)
+        {
+            const std::string l_BenchmarkName = s_CurrentBenchmark != nullptr ? s_CurrentBenchmark->Name : "?";
+            s_Metrics.push_back({ l_BenchmarkName, metric, unit, summary });
+        }
+
+        void WriteJsonString(std::FILE* file, const std::string& text)
+        {
+            std::fputc('"', file);
+            for (const char it_Character : text)
+            {
+                if (it_Character == '"' || it_Character == '\\')
+                {
+                    std::fputc('\\', file);
+                }
+
+                std::fputc(it_Character, file);
+            }
+            std::fputc('"', file);
+        }
+
+        // JSON has no representation for infinities or NaN.
+        double FiniteOrZero(double value)
+        {
+            return std::isfinite(value) ? value : 0.0;
+        }
+
+        bool WriteJson(const std::string& path)
+        {
+            std::FILE* l_File = std::fopen(path.c_str(), "w");
+            if (l_File == nullptr)
+            {
+                std::printf("Failed to open %s\n", path.c_str());
+
+                return false;
+            }
+
+            char l_Timestamp[32] = {};
+            const std::time_t l_Now = std::time(nullptr);
+            std::strftime(l_Timestamp, sizeof(l_Timestamp), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&l_Now));
+
+#ifdef NDEBUG
+            const char* l_BuildType = "release";
+#else
+            const char* l_BuildType = "debug";
+#endif
+
+            std::fprintf(l_File, "{\n  \"context\": {\"timestamp\": \"%s\", \"build\": \"%s\", \"hardware_threads\": %u, \"warmup_runs\": %u, \"repetitions\": %u},\n",
+                l_Timestamp, l_BuildType, std::thread::hardware_concurrency(), s_Settings.WarmupRuns, s_Settings.Repetitions);
+
+            std::fputs("  \"scenarios\": [", l_File);
+            for (size_t i = 0; i < s_Scenarios.size(); ++i)
+            {
+                std::fputs(i == 0 ? "\n    {\"name\": " : ",\n    {\"name\": ", l_File);
+                WriteJsonString(l_File, s_Scenarios[i].Name);
+                std::fprintf(l_File, ", \"passed\": %s, \"seconds\": %.6f}", s_Scenarios[i].HasPassed ? "true" : "false", s_Scenarios[i].Seconds);
+            }
+            std::fputs("\n  ],\n  \"metrics\": [", l_File);
+
+            for (size_t i = 0; i < s_Metrics.size(); ++i)
+            {
+                const MetricRecord& l_Record = s_Metrics[i];
+                const SampleSummary& l_Summary = l_Record.Summary;
+                std::fputs(i == 0 ? "\n    {\"benchmark\": " : ",\n    {\"benchmark\": ", l_File);
+                WriteJsonString(l_File, l_Record.Benchmark);
+                std::fputs(", \"metric\": ", l_File);
+                WriteJsonString(l_File, l_Record.Metric);
+                std::fputs(", \"unit\": ", l_File);
+                WriteJsonString(l_File, l_Record.Unit);
+                std::fprintf(l_File, ", \"samples\": %u, \"median\": %.9g, \"mean\": %.9g, \"min\": %.9g, \"max\": %.9g, \"p90\": %.9g, \"stddev\": %.9g}",
+                    l_Summary.Count, FiniteOrZero(l_Summary.Median), FiniteOrZero(l_Summary.Mean), FiniteOrZero(l_Summary.Min), FiniteOrZero(l_Summary.Max),
+                    FiniteOrZero(l_Summary.P90), FiniteOrZero(l_Summary.StdDev));
+            }
+            std::fputs("\n  ]\n}\n", l_File);
+
+            return std::fclose(l_File) == 0;
+        }
+
+        bool WriteCsv(const std::string& path)
+        {
+            std::FILE* l_File = std::fopen(path.c_str(), "w");
+            if (l_File == nullptr)
+            {
+                std::printf("Failed to open %s\n", path.c_str());
+
+                return false;
+            }
+
+            // Names never contain commas, so no quoting is needed.
+            std::fputs("benchmark,metric,unit,samples,median,mean,min,max,p90,stddev\n", l_File);
+            for (const MetricRecord& it_Record : s_Metrics)
+            {
+                const SampleSummary& l_Summary = it_Record.Summary;
+                std::fprintf(l_File, "%s,%s,%s,%u,%.9g,%.9g,%.9g,%.9g,%.9g,%.9g\n", it_Record.Benchmark.c_str(), it_Record.Metric.c_str(), it_Record.Unit.c_str(),
+                    l_Summary.Count, l_Summary.Median, l_Summary.Mean, l_Summary.Min, l_Summary.Max, l_Summary.P90, l_Summary.StdDev);
+            }
+
+            return std::fclose(l_File) == 0;
+        }
+    }
+
+    std::vector<BenchmarkEntry>& GetBenchmarkRegistry()
+    {
+        // Function-local static so registration order across translation units does not matter.
+        static std::vector<BenchmarkEntry> s_Registry;
+
+        return s_Registry;
+    }
+
+    BenchmarkRegistrar::BenchmarkRegistrar(const char* name, const char* description, BenchmarkFunction function)
+    {
+        GetBenchmarkRegistry().push_back({ name, description, std::move(function) });
+    }
+
+    const BenchmarkSettings& GetBenchmarkSettings()
+    {
+        return s_Settings;
+    }
+
+    SampleSummary Summarize(std::vector<double> samples)
+    {
+        SampleSummary l_Summary;
+        l_Summary.Count = static_cast<uint32_t>(samples.size());
+        if (samples.empty())
+        {
+            return l_Summary;
+        }
+
+        std::sort(samples.begin(), samples.end());
+
+        double l_Total = 0.0;
+        for (const double it_Sample : samples)
+        {
+            l_Total += it_Sample;
+        }
+
+        const size_t l_Count = samples.size();
+        l_Summary.Min = samples.front();
+        l_Summary.Max = samples.back();
+        l_Summary.Mean = l_Total / static_cast<double>(l_Count);
+        l_Summary.Median = l_Count % 2 == 1 ? samples[l_Count / 2] : 0.5 * (samples[l_Count / 2 - 1] + samples[l_Count / 2]);
+
+        // Nearest-rank percentile.
+        l_Summary.P90 = samples[(l_Count * 90 + 99) / 100 - 1];
+
+        double l_SquaredDeviation = 0.0;
+        for (const double it_Sample : samples)
+        {
+            l_SquaredDeviation += (it_Sample - l_Summary.Mean) * (it_Sample - l_Summary.Mean);
+        }
+        l_Summary.StdDev = l_Count > 1 ? std::sqrt(l_SquaredDeviation / static_cast<double>(l_Count - 1)) : 0.0;
+
+        return l_Summary;
+    }
+
+    void ReportMetric(const std::string& metric, double value, const char* unit)
+    {
+        const char* l_BenchmarkName = s_CurrentBenchmark != nullptr ? s_CurrentBenchmark->Name.c_str() : "?";
+        std::printf("  %-24s %-36s %16.3f %s\n", l_BenchmarkName, metric.c_str(), value, unit);
+
+        SampleSummary l_Summary;
+        l_Summary.Count = 1;
+        l_Summary.Min = l_Summary.Max = l_Summary.Mean = l_Summary.Median = l_Summary.P90 = value;
+        RecordMetric(metric, unit, l_Summary);
+    }
+
+    void ReportSamples(const std::string& metric, const std::vector<double>& samples, const char* unit)
+    {
+        const SampleSummary l_Summary = Summarize(samples);
+        const char* l_BenchmarkName = s_CurrentBenchmark != nullptr ? s_CurrentBenchmark->Name.c_str() : "?";
+
+        // Relative spread next to the median tells at a glance whether a change is inside the noise.
+        const double l_Spread = l_Summary.Median != 0.0 ? 100.0 * l_Summary.StdDev / std::fabs(l_Summary.Median) : 0.0;
+        std::printf("  %-24s %-36s %16.3f %s (n=%u, min %.3f, max %.3f, +/-%.1f%%)\n", l_BenchmarkName, metric.c_str(), l_Summary.Median, unit,
+            l_Summary.Count, l_Summary.Min, l_Summary.Max, l_Spread);
+
+        RecordMetric(metric, unit, l_Summary);
+    }
+
+    std::vector<double> ToRates(const std::vector<double>& seconds, double itemsPerRun, double scale)
+    {
+        std::vector<double> l_Rates;
+        l_Rates.reserve(seconds.size());
+        for (const double it_Seconds : seconds)
+        {
+            l_Rates.push_back(it_Seconds > 0.0 ? itemsPerRun / it_Seconds * scale : 0.0);
+        }
+
+        return l_Rates;
+    }
+
+    std::vector<double> ToPerItem(const std::vector<double>& seconds, double itemsPerRun, double scale)
+    {
+        std::vector<double> l_Costs;
+        l_Costs.reserve(seconds.size());
+        for (const double it_Seconds : seconds)
+        {
+            l_Costs.push_back(it_Seconds / itemsPerRun * scale);
+        }
+
+        return l_Costs;
+    }
+}
+
+namespace
+{
+    void PrintUsage()
+    {
+        std::printf("Usage: Benchmarks [--warmup N] [--repetitions N] [--json FILE] [--csv FILE] [--list] [name filters...]\n");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Engine::Utilities::Log::Initialize();
+
+    // Options first; any other positional arguments act as substring filters on benchmark names.
+    std::vector<const char*> l_Filters;
+    bool l_IsListOnly = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--warmup") == 0 && i + 1 < argc)
+        {
+            Benchmarks::s_Settings.WarmupRuns = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (std::strcmp(argv[i], "--repetitions") == 0 && i + 1 < argc)
+        {
+            Benchmarks::s_Settings.Repetitions = std::max<uint32_t>(1, static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10)));
+        }
+        else if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+        {
+            Benchmarks::s_Settings.JsonPath = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--csv") == 0 && i + 1 < argc)
+        {
+            Benchmarks::s_Settings.CsvPath = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--list") == 0)
+        {
+            l_IsListOnly = true;
+        }
+        else if (std::strcmp(argv[i], "--help") == 0 || argv[i][0] == '-')
+        {
+            PrintUsage();
+
+            return argv[i][1] == '-' && std::strcmp(argv[i], "--help") == 0 ? 0 : 2;
+        }
+        else
+        {
+            l_Filters.push_back(argv[i]);
+        }
+    }
+
+    int l_FailureCount = 0;
+    for (const Benchmarks::BenchmarkEntry& it_Entry : Benchmarks::GetBenchmarkRegistry())
+    {
+        bool l_IsSelected = l_Filters.empty();
+        for (const char* it_Filter : l_Filters)
+        {
+            l_IsSelected = l_IsSelected || std::strstr(it_Entry.Name.c_str(), it_Filter) != nullptr;
+        }
+
+        if (!l_IsSelected)
+        {
+            continue;
+        }
+
+        std::printf("[%s] %s\n", it_Entry.Name.c_str(), it_Entry.Description.c_str());
+        if (l_IsListOnly)
+        {
+            continue;
+        }
+
+        Benchmarks::s_CurrentBenchmark = &it_Entry;
+        Benchmarks::Stopwatch l_Stopwatch;
+        const bool l_HasPassed = it_Entry.Function();
+        Benchmarks::s_Scenarios.push_back({ it_Entry.Name, l_HasPassed, l_Stopwatch.GetElapsedSeconds() });
+        if (!l_HasPassed)
+        {
+            std::printf("  FAILED: %s\n", it_Entry.Name.c_str());
+            ++l_FailureCount;
+        }
+        Benchmarks::s_CurrentBenchmark = nullptr;
+
+        // Keep engine log lines from interleaving with the next scenario's results.
+        Engine::Utilities::Log::Flush();
+        std::fflush(stdout);
+    }
+
+    if (!Benchmarks::s_Settings.JsonPath.empty() && !Benchmarks::WriteJson(Benchmarks::s_Settings.JsonPath))
+    {
+        ++l_FailureCount;
+    }
+
+    if (!Benchmarks::s_Settings.CsvPath.empty() && !Benchmarks::WriteCsv(Benchmarks::s_Settings.CsvPath))
+    {
+        ++l_FailureCount;
+    }
+
+    return l_FailureCount == 0 ? 0 : 1;
+}
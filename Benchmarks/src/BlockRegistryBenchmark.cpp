@@ -0,0 +1,142 @@
+#include "Benchmark.h"
+
+#include "Engine/World/BlockRegistry.h"
+#include "Engine/World/Chunk.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Benchmarks
+{
+    namespace
+    {
+        // Roughly the size of a large content pack.
+        constexpr uint32_t s_DefinitionCount = 4096;
+
+        uint32_t NextRandom(uint32_t& state)
+        {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+
+            return state;
+        }
+
+        // Every fourth block is see-through, every sixteenth glows, and tiles vary per face on half of them.
+        std::string CreateDefinitions()
+        {
+            std::string l_Yaml = "Blocks:\n";
+            for (uint32_t i = 0; i < s_DefinitionCount; ++i)
+            {
+                l_Yaml += "  - Name: block_" + std::to_string(i) + "\n";
+                if (i % 4 == 0)
+                {
+                    l_Yaml += "    Opaque: false\n    Solid: false\n    LightOpacity: " + std::to_string(i % 3) + "\n    RenderLayer: Translucent\n";
+                }
+                if (i % 16 == 0)
+                {
+                    l_Yaml += "    LightEmission: " + std::to_string(1 + i % 15) + "\n";
+                }
+                l_Yaml += (i % 2 == 0) ? "    Tiles: " + std::to_string(i % 624) + "\n"
+                    : "    Tiles: { Sides: " + std::to_string(i % 624) + ", Top: " + std::to_string((i + 1) % 624) + " }\n";
+            }
+
+            return l_Yaml;
+        }
+
+        bool RunBlockRegistryBenchmark()
+        {
+            const std::string l_Yaml = CreateDefinitions();
+
+            // Startup cost: parse once and fill the tables.
+            const std::vector<double> l_LoadSeconds = MeasureRepeated([&l_Yaml]()
+                {
+                    Engine::BlockRegistry l_Registry;
+                    l_Registry.LoadFromString(l_Yaml, "benchmark");
+                });
+            ReportSamples("load_ms", ToPerItem(l_LoadSeconds, 1.0, 1000.0), "ms");
+
+            Engine::BlockRegistry l_Registry;
+            const bool l_HasLoaded = l_Registry.LoadFromString(l_Yaml, "benchmark") && l_Registry.GetBlockCount() == s_DefinitionCount + 1;
+            ReportMetric("block_types", l_Registry.GetBlockCount(), "blocks");
+            ReportMetric("table_bytes", static_cast<double>(l_Registry.GetTableSize()), "bytes");
+            ReportMetric("light_opacity_table_bytes", l_Registry.GetBlockCount(), "bytes");
+
+            // Pointer-per-block layout with inline names: what a registry of heap objects costs per query.
+            // Allocated in shuffled order so neighbouring ids do not sit next to each other in memory.
+            uint32_t l_RandomState = 0x9E3779B9u;
+            std::vector<uint32_t> l_AllocationOrder(l_Registry.GetBlockCount());
+            for (uint32_t i = 0; i < l_AllocationOrder.size(); ++i)
+            {
+                l_AllocationOrder[i] = i;
+            }
+            for (uint32_t i = static_cast<uint32_t>(l_AllocationOrder.size()) - 1; i > 0; --i)
+            {
+                std::swap(l_AllocationOrder[i], l_AllocationOrder[NextRandom(l_RandomState) % (i + 1)]);
+            }
+
+            std::vector<std::unique_ptr<Engine::BlockDefinition>> l_Definitions(l_Registry.GetBlockCount());
+            for (uint32_t it_Id : l_AllocationOrder)
+            {
+                l_Definitions[it_Id] = std::make_unique<Engine::BlockDefinition>();
+                l_Definitions[it_Id]->Name = l_Registry.GetName(static_cast<Engine::BlockId>(it_Id));
+                l_Definitions[it_Id]->LightOpacity = l_Registry.GetLightOpacity(static_cast<Engine::BlockId>(it_Id));
+                l_Definitions[it_Id]->Solid = l_Registry.IsSolid(static_cast<Engine::BlockId>(it_Id));
+            }
+
+            // A chunk's worth of ids drawn from the whole pack: the worst case for cache residency.
+            std::vector<Engine::BlockId> l_Blocks(Engine::Chunk::Volume);
+            for (Engine::BlockId& it_Block : l_Blocks)
+            {
+                it_Block = static_cast<Engine::BlockId>(NextRandom(l_RandomState) % l_Registry.GetBlockCount());
+            }
+
+            // The two properties lighting and physics ask for on every step.
+            uint64_t l_TableSum = 0;
+            const std::vector<double> l_TableSeconds = MeasureRepeated([&l_Registry, &l_Blocks, &l_TableSum]()
+                {
+                    uint64_t l_Sum = 0;
+                    for (Engine::BlockId it_Block : l_Blocks)
+                    {
+                        l_Sum += l_Registry.GetLightOpacity(it_Block) + (l_Registry.IsSolid(it_Block) ? 1 : 0);
+                    }
+                    l_TableSum = l_Sum;
+                });
+            ReportSamples("tables.query_ns", ToPerItem(l_TableSeconds, static_cast<double>(l_Blocks.size()), 1.0e9), "ns");
+
+            uint64_t l_PointerSum = 0;
+            const std::vector<double> l_PointerSeconds = MeasureRepeated([&l_Definitions, &l_Blocks, &l_PointerSum]()
+                {
+                    uint64_t l_Sum = 0;
+                    for (Engine::BlockId it_Block : l_Blocks)
+                    {
+                        const Engine::BlockDefinition& l_Definition = *l_Definitions[it_Block];
+                        l_Sum += l_Definition.LightOpacity + (l_Definition.Solid ? 1 : 0);
+                    }
+                    l_PointerSum = l_Sum;
+                });
+            ReportSamples("pointers.query_ns", ToPerItem(l_PointerSeconds, static_cast<double>(l_Blocks.size()), 1.0e9), "ns");
+
+            ReportMetric("speedup", Summarize(l_PointerSeconds).Median / Summarize(l_TableSeconds).Median, "x");
+
+            // Spot-check what the YAML asked for against the tables.
+            const Engine::BlockId l_Glowing = l_Registry.FindBlock("block_16");
+            const Engine::BlockId l_Split = l_Registry.FindBlock("block_1");
+            const bool l_TablesMatch = l_Glowing != Engine::BlockRegistry::InvalidBlockId && l_Registry.GetLightEmission(l_Glowing) == 2
+                && !l_Registry.IsOpaque(l_Glowing) && l_Registry.GetRenderLayer(l_Glowing) == Engine::BlockRenderLayer::Translucent
+                && l_Registry.GetFaceTile(l_Split, Engine::BlockFace::PositiveX) == 1 && l_Registry.GetFaceTile(l_Split, Engine::BlockFace::PositiveY) == 2
+                && l_Registry.GetFaceTile(l_Split, Engine::BlockFace::NegativeY) == 0 && !l_Registry.IsSolid(Engine::AirBlockId);
+            ReportMetric("tables_match", l_TablesMatch ? 1.0 : 0.0, "bool");
+
+            const bool l_SumsMatch = l_TableSum == l_PointerSum;
+            ReportMetric("sums_match", l_SumsMatch ? 1.0 : 0.0, "bool");
+
+            return l_HasLoaded && l_TablesMatch && l_SumsMatch;
+        }
+    }
+
+    REGISTER_BENCHMARK("BlockRegistry", "YAML load of a 4096-type pack and per-block property queries from flat tables versus per-block heap objects", RunBlockRegistryBenchmark);
+}
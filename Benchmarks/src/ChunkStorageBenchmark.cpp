@@ -0,0 +1,122 @@
+#include "Benchmark.h"
+
+#include "Engine/World/Chunk.h"
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Benchmarks
+{
+    namespace
+    {
+        uint32_t HashIndex(uint32_t value)
+        {
+            value ^= value >> 16;
+            value *= 0x7FEB352Du;
+            value ^= value >> 15;
+            value *= 0x846CA68Bu;
+            value ^= value >> 16;
+
+            return value;
+        }
+
+        struct TerrainPattern
+        {
+            const char* Name;
+            std::function<Engine::BlockId(int32_t, int32_t, int32_t)> Generate;
+        };
+
+        bool RunChunkStorageBenchmark()
+        {
+            const std::vector<TerrainPattern> l_Patterns =
+            {
+                { "all_air", [](int32_t, int32_t, int32_t) -> Engine::BlockId { return Engine::AirBlockId; } },
+                { "all_stone", [](int32_t, int32_t, int32_t) -> Engine::BlockId { return 1; } },
+                { "layered", [](int32_t, int32_t y, int32_t) -> Engine::BlockId { return y < 12 ? 1 : (y < 15 ? 2 : (y == 15 ? 3 : Engine::AirBlockId)); } },
+                { "ores_40", [](int32_t x, int32_t y, int32_t z) -> Engine::BlockId
+                    {
+                        const uint32_t l_Hash = HashIndex(static_cast<uint32_t>(Engine::Chunk::GetIndex(x, y, z)));
+                        return (l_Hash & 15) == 0 ? static_cast<Engine::BlockId>(2 + (l_Hash >> 8) % 40) : 1;
+                    } },
+                { "random_4096", [](int32_t x, int32_t y, int32_t z) -> Engine::BlockId
+                    {
+                        return static_cast<Engine::BlockId>(HashIndex(Engine::Chunk::GetIndex(x, y, z)) % 4096);
+                    } },
+            };
+
+            constexpr uint32_t l_AccessCount = 1u << 22;
+            bool l_IsValid = true;
+
+            for (const TerrainPattern& it_Pattern : l_Patterns)
+            {
+                const std::string l_Prefix = it_Pattern.Name;
+
+                // Fill through the public setter so palette growth and repacking are part of the measurement.
+                std::vector<Engine::BlockId> l_Reference(Engine::Chunk::Volume);
+                for (int32_t y = 0; y < Engine::Chunk::Size; ++y)
+                {
+                    for (int32_t z = 0; z < Engine::Chunk::Size; ++z)
+                    {
+                        for (int32_t x = 0; x < Engine::Chunk::Size; ++x)
+                        {
+                            l_Reference[Engine::Chunk::GetIndex(x, y, z)] = it_Pattern.Generate(x, y, z);
+                        }
+                    }
+                }
+
+                Engine::Chunk l_Chunk({ 0, 0, 0 });
+                const std::vector<double> l_FillSeconds = MeasureRepeated([&l_Chunk, &l_Reference]()
+                    {
+                        l_Chunk.Fill(Engine::AirBlockId);
+                        for (uint32_t i = 0; i < Engine::Chunk::Volume; ++i)
+                        {
+                            l_Chunk.SetBlock(i, l_Reference[i]);
+                        }
+                    });
+                l_Chunk.Compact();
+
+                for (uint32_t i = 0; i < Engine::Chunk::Volume; ++i)
+                {
+                    l_IsValid = l_IsValid && l_Chunk.GetBlock(i) == l_Reference[i];
+                }
+
+                ReportMetric(l_Prefix + ".bytes_per_chunk", static_cast<double>(l_Chunk.GetMemoryUsage()), "bytes");
+                ReportMetric(l_Prefix + ".bits_per_block", static_cast<double>(l_Chunk.GetStorage().GetBitsPerEntry()), "bits");
+                ReportSamples(l_Prefix + ".fill", ToRates(l_FillSeconds, Engine::Chunk::Volume, 1.0e-6), "Mset/s");
+
+                // Random reads: the access pattern of lighting and collision queries.
+                uint64_t l_Checksum = 0;
+                const std::vector<double> l_GetSeconds = MeasureRepeated([&l_Chunk, &l_Checksum]()
+                    {
+                        for (uint32_t i = 0; i < l_AccessCount; ++i)
+                        {
+                            l_Checksum += l_Chunk.GetBlock(HashIndex(i) & (Engine::Chunk::Volume - 1));
+                        }
+                    });
+                ReportSamples(l_Prefix + ".random_get", ToRates(l_GetSeconds, l_AccessCount, 1.0e-6), "Mget/s");
+
+                // Random writes of values already in the palette: the block-edit path.
+                const std::vector<double> l_SetSeconds = MeasureRepeated([&l_Chunk, &l_Reference]()
+                    {
+                        for (uint32_t i = 0; i < l_AccessCount; ++i)
+                        {
+                            const uint32_t l_Index = HashIndex(i) & (Engine::Chunk::Volume - 1);
+                            l_Chunk.SetBlock(l_Index, l_Reference[(l_Index * 7) & (Engine::Chunk::Volume - 1)]);
+                        }
+                    });
+                ReportSamples(l_Prefix + ".random_set", ToRates(l_SetSeconds, l_AccessCount, 1.0e-6), "Mset/s");
+
+                // Keep the reads observable so the optimizer cannot drop the loop.
+                l_IsValid = l_IsValid && l_Checksum != UINT64_MAX;
+            }
+
+            ReportMetric("raw_uint16.bytes_per_chunk", static_cast<double>(Engine::Chunk::Volume * sizeof(Engine::BlockId)), "bytes");
+
+            return l_IsValid;
+        }
+    }
+
+    REGISTER_BENCHMARK("ChunkStorage", "Palette-compressed chunk memory footprint and get/set throughput", RunChunkStorageBenchmark);
+}
@@ -0,0 +1,282 @@
+#include "Benchmark.h"
+
+#include "Engine/World/ChunkMap.h"
+#include "Engine/World/ChunkStreamer.h"
+#include "Engine/World/World.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Benchmarks
+{
+    namespace
+    {
+        constexpr int32_t s_MapExtent = 32;
+        constexpr int32_t s_MapLayers = 8;
+
+        // Loads and evictions summed over a run of frames.
+        struct StreamingTotals
+        {
+            uint32_t Loads = 0;
+            uint32_t Evictions = 0;
+            uint32_t Frames = 0;
+            size_t MaxResidentBytes = 0;
+            double UpdateSeconds = 0.0;
+        };
+
+        // One frame as a game would run it, with chunks that load instantly.
+        void StepStreaming(Engine::World& world, Engine::ChunkStreamer& streamer, const glm::vec3& focus, StreamingTotals& totals)
+        {
+            Stopwatch l_Stopwatch;
+            streamer.Update(focus);
+            totals.UpdateSeconds += l_Stopwatch.GetElapsedSeconds();
+
+            for (const Engine::ChunkCoord& it_Coord : streamer.GetEvictions())
+            {
+                world.RemoveChunk(it_Coord);
+            }
+
+            for (const Engine::ChunkCoord& it_Coord : streamer.TakeRequests(256))
+            {
+                // A few distinct blocks so every chunk carries a real palette, like generated terrain.
+                std::unique_ptr<Engine::Chunk> l_Chunk = std::make_unique<Engine::Chunk>(it_Coord);
+                for (int32_t i = 0; i < 4; ++i)
+                {
+                    l_Chunk->SetBlock(i, i, i, static_cast<Engine::BlockId>(i + 1));
+                }
+                world.InsertChunk(std::move(l_Chunk));
+                streamer.OnChunkLoaded(it_Coord);
+            }
+
+            const Engine::ChunkStreamerStats& l_Stats = streamer.GetLastFrameStats();
+            totals.Loads += l_Stats.LoadedCount;
+            totals.Evictions += l_Stats.EvictedCount + l_Stats.BudgetEvictedCount;
+            totals.MaxResidentBytes = std::max(totals.MaxResidentBytes, l_Stats.ResidentBytes);
+            ++totals.Frames;
+        }
+
+        // Runs frames at a fixed focus until nothing is requested, in flight or evicted any more.
+        void SettleStreaming(Engine::World& world, Engine::ChunkStreamer& streamer, const glm::vec3& focus)
+        {
+            StreamingTotals l_Totals;
+            for (int32_t i = 0; i < 1000; ++i)
+            {
+                StepStreaming(world, streamer, focus, l_Totals);
+                if (streamer.IsIdle() && streamer.GetEvictions().empty())
+                {
+                    break;
+                }
+            }
+        }
+
+        Engine::ChunkStreamerSettings CreateStreamerSettings(int32_t unloadMargin)
+        {
+            Engine::ChunkStreamerSettings l_Settings;
+            l_Settings.LoadRadius = 8;
+            l_Settings.UnloadRadius = 8 + unloadMargin;
+            l_Settings.MinChunkY = 0;
+            l_Settings.MaxChunkY = 5;
+
+            return l_Settings;
+        }
+
+        bool RunChunkMapScenario()
+        {
+            std::vector<Engine::ChunkCoord> l_Coords;
+            for (int32_t y = 0; y < s_MapLayers; ++y)
+            {
+                for (int32_t z = 0; z < s_MapExtent; ++z)
+                {
+                    for (int32_t x = 0; x < s_MapExtent; ++x)
+                    {
+                        l_Coords.push_back({ x - s_MapExtent / 2, y, z - s_MapExtent / 2 });
+                    }
+                }
+            }
+
+            Engine::ChunkMap l_Map;
+            std::unordered_map<Engine::ChunkCoord, std::unique_ptr<Engine::Chunk>, Engine::ChunkCoordHash> l_HashMap;
+            for (const Engine::ChunkCoord& it_Coord : l_Coords)
+            {
+                l_Map.Insert(std::make_unique<Engine::Chunk>(it_Coord));
+                l_HashMap[it_Coord] = std::make_unique<Engine::Chunk>(it_Coord);
+            }
+
+            // Random probes, a third of them at chunks that are not there.
+            std::mt19937 l_Random(42);
+            std::uniform_int_distribution<int32_t> l_Horizontal(-s_MapExtent * 2 / 3, s_MapExtent * 2 / 3);
+            std::uniform_int_distribution<int32_t> l_Vertical(0, s_MapLayers - 1);
+            std::vector<Engine::ChunkCoord> l_Probes(1 << 16);
+            for (Engine::ChunkCoord& it_Probe : l_Probes)
+            {
+                it_Probe = { l_Horizontal(l_Random), l_Vertical(l_Random), l_Horizontal(l_Random) };
+            }
+
+            bool l_IsValid = true;
+            for (const Engine::ChunkCoord& it_Probe : l_Probes)
+            {
+                const Engine::Chunk* l_Chunk = l_Map.Find(it_Probe);
+                l_IsValid = l_IsValid && (l_Chunk != nullptr) == (l_HashMap.count(it_Probe) != 0) && (l_Chunk == nullptr || l_Chunk->GetCoord() == it_Probe);
+            }
+
+            size_t l_Hits = 0;
+            const std::vector<double> l_MapSeconds = MeasureRepeated([&]()
+                {
+                    for (const Engine::ChunkCoord& it_Probe : l_Probes)
+                    {
+                        l_Hits += l_Map.Find(it_Probe) != nullptr ? 1 : 0;
+                    }
+                });
+            const std::vector<double> l_HashMapSeconds = MeasureRepeated([&]()
+                {
+                    for (const Engine::ChunkCoord& it_Probe : l_Probes)
+                    {
+                        l_Hits += l_HashMap.find(it_Probe) != l_HashMap.end() ? 1 : 0;
+                    }
+                });
+            ReportSamples("map.chunk_map.lookups_per_second", ToRates(l_MapSeconds, static_cast<double>(l_Probes.size())), "lookups/s");
+            ReportSamples("map.unordered_map.lookups_per_second", ToRates(l_HashMapSeconds, static_cast<double>(l_Probes.size())), "lookups/s");
+            ReportMetric("map.lookup_speedup", Summarize(l_HashMapSeconds).Median / Summarize(l_MapSeconds).Median, "x");
+
+            // 27-chunk neighbourhoods, the access pattern of meshing and lighting.
+            std::array<const Engine::Chunk*, 27> l_Neighbours{};
+            const std::vector<double> l_NeighbourhoodSeconds = MeasureRepeated([&]()
+                {
+                    for (size_t i = 0; i < l_Probes.size(); i += 16)
+                    {
+                        l_Map.GetNeighbourhood(l_Probes[i], l_Neighbours);
+                        l_Hits += l_Neighbours[13] != nullptr ? 1 : 0;
+                    }
+                });
+            ReportSamples("map.neighbourhoods_per_second", ToRates(l_NeighbourhoodSeconds, static_cast<double>(l_Probes.size() / 16)), "neighbourhoods/s");
+
+            // Remove every other chunk and put half of them back: the probe runs must survive backward-shift deletion.
+            Stopwatch l_ChurnStopwatch;
+            for (size_t i = 0; i < l_Coords.size(); i += 2)
+            {
+                l_IsValid = l_IsValid && l_Map.Erase(l_Coords[i]);
+            }
+            for (size_t i = 0; i < l_Coords.size(); i += 4)
+            {
+                l_Map.Insert(std::make_unique<Engine::Chunk>(l_Coords[i]));
+            }
+            ReportMetric("map.churn_us_per_chunk", l_ChurnStopwatch.GetElapsedSeconds() * 1.0e6 / static_cast<double>(l_Coords.size() / 2 + l_Coords.size() / 4), "us");
+
+            for (size_t i = 0; i < l_Coords.size(); ++i)
+            {
+                const bool l_ShouldExist = (i % 2) == 1 || (i % 4) == 0;
+                l_IsValid = l_IsValid && (l_Map.Find(l_Coords[i]) != nullptr) == l_ShouldExist;
+            }
+            l_IsValid = l_IsValid && l_Map.GetSize() == l_Coords.size() / 2 + l_Coords.size() / 4 && l_Hits > 0;
+            ReportMetric("map.load_factor", static_cast<double>(l_Map.GetSize()) / static_cast<double>(l_Map.GetCapacity()), "fraction");
+            ReportMetric("map_consistent", l_IsValid ? 1.0 : 0.0, "bool");
+
+            return l_IsValid;
+        }
+
+        bool RunStreamingScenarios()
+        {
+            bool l_IsValid = true;
+
+            // Walking in a straight line: every frame loads the leading edge and evicts the trailing one.
+            {
+                Engine::World l_World;
+                Engine::ChunkStreamer l_Streamer(l_World, CreateStreamerSettings(2));
+                SettleStreaming(l_World, l_Streamer, glm::vec3(0.5f, 80.0f, 0.5f));
+
+                StreamingTotals l_Totals;
+                for (int32_t l_Frame = 0; l_Frame < 512; ++l_Frame)
+                {
+                    StepStreaming(l_World, l_Streamer, glm::vec3(0.5f + l_Frame * 2.0f, 80.0f, 0.5f), l_Totals);
+                }
+                ReportMetric("walk.loads", l_Totals.Loads, "chunks");
+                ReportMetric("walk.evictions", l_Totals.Evictions, "chunks");
+                ReportMetric("walk.update_us", l_Totals.UpdateSeconds * 1.0e6 / l_Totals.Frames, "us");
+                ReportMetric("walk.resident_chunks", static_cast<double>(l_World.GetChunkCount()), "chunks");
+                ReportMetric("walk.resident_kb", static_cast<double>(l_Streamer.GetLastFrameStats().ResidentBytes) / 1024.0, "KB");
+                l_IsValid = l_IsValid && l_Totals.Loads > 0 && l_Totals.Evictions > 0;
+            }
+
+            // Pacing back and forth across a chunk border: only the hysteresis band keeps chunks from cycling.
+            // The first step loads the far edge of the new column's range either way; evictions are the thrash.
+            uint32_t l_ThrashWithout = 0;
+            uint32_t l_ThrashWith = 0;
+            for (int32_t l_Margin : { 0, 2 })
+            {
+                Engine::World l_World;
+                Engine::ChunkStreamer l_Streamer(l_World, CreateStreamerSettings(l_Margin));
+                SettleStreaming(l_World, l_Streamer, glm::vec3(30.0f, 80.0f, 0.5f));
+
+                StreamingTotals l_Totals;
+                for (int32_t l_Frame = 0; l_Frame < 200; ++l_Frame)
+                {
+                    StepStreaming(l_World, l_Streamer, glm::vec3((l_Frame & 1) != 0 ? 34.0f : 30.0f, 80.0f, 0.5f), l_Totals);
+                }
+
+                const std::string l_Prefix = "boundary.margin_" + std::to_string(l_Margin);
+                ReportMetric(l_Prefix + ".loads", l_Totals.Loads, "chunks");
+                ReportMetric(l_Prefix + ".evictions", l_Totals.Evictions, "chunks");
+                (l_Margin == 0 ? l_ThrashWithout : l_ThrashWith) = l_Totals.Evictions;
+            }
+            l_IsValid = l_IsValid && l_ThrashWithout > 0 && l_ThrashWith == 0;
+
+            // A budget below what the full radius needs: the farthest rings go, and stay gone while standing still.
+            {
+                size_t l_FullBytes = 0;
+                {
+                    Engine::World l_World;
+                    Engine::ChunkStreamer l_Streamer(l_World, CreateStreamerSettings(2));
+                    SettleStreaming(l_World, l_Streamer, glm::vec3(0.5f, 80.0f, 0.5f));
+                    l_Streamer.Update(glm::vec3(0.5f, 80.0f, 0.5f));
+                    l_FullBytes = l_Streamer.GetLastFrameStats().ResidentBytes;
+                }
+
+                Engine::ChunkStreamerSettings l_Settings = CreateStreamerSettings(2);
+                l_Settings.MemoryBudgetBytes = l_FullBytes * 6 / 10;
+                Engine::World l_World;
+                Engine::ChunkStreamer l_Streamer(l_World, l_Settings);
+                SettleStreaming(l_World, l_Streamer, glm::vec3(0.5f, 80.0f, 0.5f));
+
+                StreamingTotals l_Stationary;
+                for (int32_t l_Frame = 0; l_Frame < 100; ++l_Frame)
+                {
+                    StepStreaming(l_World, l_Streamer, glm::vec3(0.5f, 80.0f, 0.5f), l_Stationary);
+                }
+
+                StreamingTotals l_Totals = l_Stationary;
+                for (int32_t l_Frame = 0; l_Frame < 256; ++l_Frame)
+                {
+                    StepStreaming(l_World, l_Streamer, glm::vec3(0.5f + l_Frame * 2.0f, 80.0f, 0.5f), l_Totals);
+                }
+
+                ReportMetric("budget.full_radius_kb", static_cast<double>(l_FullBytes) / 1024.0, "KB");
+                ReportMetric("budget.limit_kb", static_cast<double>(l_Settings.MemoryBudgetBytes) / 1024.0, "KB");
+                ReportMetric("budget.max_resident_kb", static_cast<double>(l_Totals.MaxResidentBytes) / 1024.0, "KB");
+                ReportMetric("budget.resident_chunks", static_cast<double>(l_World.GetChunkCount()), "chunks");
+                ReportMetric("budget.stationary_reloads", l_Stationary.Loads, "chunks");
+
+                const bool l_WithinBudget = l_Totals.MaxResidentBytes <= l_Settings.MemoryBudgetBytes && l_World.GetChunkCount() > 0 && l_Stationary.Loads == 0;
+                ReportMetric("budget_respected", l_WithinBudget ? 1.0 : 0.0, "bool");
+                l_IsValid = l_IsValid && l_WithinBudget;
+            }
+
+            return l_IsValid;
+        }
+
+        bool RunChunkStreamingBenchmark()
+        {
+            const bool l_MapValid = RunChunkMapScenario();
+            const bool l_StreamingValid = RunStreamingScenarios();
+
+            return l_MapValid && l_StreamingValid;
+        }
+    }
+
+    REGISTER_BENCHMARK("ChunkStreaming", "Open-addressed chunk map lookups vs std::unordered_map, and load/unload rings with hysteresis and a memory budget", RunChunkStreamingBenchmark);
+}
@@ -0,0 +1,257 @@
+#include "Benchmark.h"
+
+#include "Engine/Jobs/JobSystem.h"
+#include "Engine/World/BlockRegistry.h"
+#include "Engine/World/ChunkMesher.h"
+#include "Engine/World/ChunkVisibility.h"
+#include "Engine/World/World.h"
+#include "Engine/World/WorldGenerator.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace Benchmarks
+{
+    namespace
+    {
+        constexpr int32_t s_RegionSize = 16;
+        constexpr int32_t s_ChunkLayers = 6;
+
+        struct CameraScenario
+        {
+            const char* Name;
+            glm::vec3 Position;
+            glm::vec3 Target;
+        };
+
+        std::vector<Engine::ChunkMesh> MeshWorld(const Engine::World& world, const std::vector<Engine::ChunkCoord>& coords, const Engine::MeshingBlockTable& table,
+            bool computeConnectivity, double& outSeconds)
+        {
+            Engine::ChunkMesherSettings l_Settings;
+            l_Settings.ComputeConnectivity = computeConnectivity;
+            Engine::ChunkMesher l_Mesher(l_Settings);
+            Engine::PaddedChunkView l_View;
+
+            std::vector<Engine::ChunkMesh> l_Meshes(coords.size());
+            outSeconds = 0.0;
+            for (size_t i = 0; i < coords.size(); ++i)
+            {
+                std::array<const Engine::Chunk*, 27> l_Neighbours{};
+                for (int32_t y = -1; y <= 1; ++y)
+                {
+                    for (int32_t z = -1; z <= 1; ++z)
+                    {
+                        for (int32_t x = -1; x <= 1; ++x)
+                        {
+                            l_Neighbours[(y + 1) * 9 + (z + 1) * 3 + (x + 1)] = world.FindChunk({ coords[i].X + x, coords[i].Y + y, coords[i].Z + z });
+                        }
+                    }
+                }
+                l_View.Build(l_Neighbours);
+
+                // Only the mesher is timed; building the padded view is the same either way.
+                Stopwatch l_Stopwatch;
+                l_Mesher.Mesh(l_View, table, l_Meshes[i]);
+                outSeconds += l_Stopwatch.GetElapsedSeconds();
+            }
+
+            return l_Meshes;
+        }
+
+        int32_t FindSurface(const Engine::World& world, int32_t worldX, int32_t worldZ)
+        {
+            for (int32_t y = s_ChunkLayers * Engine::Chunk::Size - 1; y >= 0; --y)
+            {
+                if (world.GetBlock(worldX, y, worldZ) != Engine::AirBlockId)
+                {
+                    return y;
+                }
+            }
+
+            return 0;
+        }
+
+        bool RunChunkVisibilityBenchmark()
+        {
+            Engine::BlockRegistry l_Registry;
+            if (!l_Registry.LoadFromFile(std::filesystem::path(BENCHMARK_ASSET_DIRECTORY) / "Blocks" / "Blocks.yaml"))
+            {
+                return false;
+            }
+
+            std::vector<Engine::ChunkCoord> l_Coords;
+            for (int32_t y = 0; y < s_ChunkLayers; ++y)
+            {
+                for (int32_t z = 0; z < s_RegionSize; ++z)
+                {
+                    for (int32_t x = 0; x < s_RegionSize; ++x)
+                    {
+                        l_Coords.push_back({ x - s_RegionSize / 2, y, z - s_RegionSize / 2 });
+                    }
+                }
+            }
+
+            Engine::WorldGeneratorSettings l_Settings;
+            l_Settings.Seed = 20240611;
+            const Engine::WorldGenerator l_Generator(l_Settings);
+            Engine::World l_World;
+            {
+                Engine::JobSystem l_JobSystem(std::max(std::thread::hardware_concurrency(), 2u) - 1);
+                std::shared_ptr<Engine::WorldGenerationBatch> l_Batch = l_Generator.GenerateAsync(l_JobSystem, l_Coords);
+                l_JobSystem.WaitForCounter(l_Batch->GetCounter());
+                for (std::unique_ptr<Engine::Chunk>& it_Chunk : l_Batch->GetChunks())
+                {
+                    l_World.InsertChunk(std::move(it_Chunk));
+                }
+            }
+
+            // A small room deep in the rock under the middle of the region, for the underground camera.
+            const int32_t l_SurfaceY = FindSurface(l_World, 0, 0);
+            const int32_t l_CaveY = std::max(l_SurfaceY - 40, 8);
+            for (int32_t y = -2; y <= 2; ++y)
+            {
+                for (int32_t z = -3; z <= 3; ++z)
+                {
+                    for (int32_t x = -3; x <= 3; ++x)
+                    {
+                        l_World.SetBlock(x, l_CaveY + y, z, Engine::AirBlockId);
+                    }
+                }
+            }
+
+            // Meshing cost of the connectivity flood.
+            double l_PlainSeconds = 0.0;
+            double l_ConnectedSeconds = 0.0;
+            MeshWorld(l_World, l_Coords, l_Registry.GetMeshingTable(), false, l_PlainSeconds);
+            const std::vector<Engine::ChunkMesh> l_Meshes = MeshWorld(l_World, l_Coords, l_Registry.GetMeshingTable(), true, l_ConnectedSeconds);
+            ReportMetric("mesh.chunks_per_second", static_cast<double>(l_Coords.size()) / l_PlainSeconds, "chunks/s");
+            ReportMetric("mesh.with_connectivity.chunks_per_second", static_cast<double>(l_Coords.size()) / l_ConnectedSeconds, "chunks/s");
+            ReportMetric("mesh.connectivity_overhead", (l_ConnectedSeconds / l_PlainSeconds - 1.0) * 100.0, "%");
+
+            uint32_t l_SealedCount = 0;
+            for (const Engine::ChunkMesh& it_Mesh : l_Meshes)
+            {
+                l_SealedCount += it_Mesh.Connectivity.Bits == 0 ? 1 : 0;
+            }
+            ReportMetric("sealed_sections", l_SealedCount, "sections");
+
+            const glm::mat4 l_Projection = glm::perspective(glm::radians(70.0f), 16.0f / 9.0f, 0.1f, 1000.0f);
+            const std::vector<CameraScenario> l_Scenarios =
+            {
+                { "surface", glm::vec3(0.5f, l_SurfaceY + 3.5f, 0.5f), glm::vec3(64.0f, l_SurfaceY - 4.0f, 24.0f) },
+                { "underground", glm::vec3(0.5f, l_CaveY + 0.5f, 0.5f), glm::vec3(64.0f, l_CaveY + 8.0f, 24.0f) },
+                { "high_above", glm::vec3(0.5f, s_ChunkLayers * Engine::Chunk::Size + 96.0f, 0.5f), glm::vec3(16.0f, 0.0f, 8.0f) },
+            };
+
+            bool l_IsValid = l_SealedCount > 0;
+            for (const CameraScenario& it_Scenario : l_Scenarios)
+            {
+                const glm::mat4 l_ViewProjection = l_Projection * glm::lookAt(it_Scenario.Position, it_Scenario.Target, glm::vec3(0.0f, 1.0f, 0.0f));
+
+                std::unordered_set<Engine::ChunkCoord, Engine::ChunkCoordHash> l_FrustumVisible;
+                uint32_t l_OcclusionVisibleCount = 0;
+                for (bool l_UseOcclusion : { false, true })
+                {
+                    Engine::ChunkVisibilitySettings l_VisibilitySettings;
+                    l_VisibilitySettings.OcclusionCulling = l_UseOcclusion;
+                    Engine::ChunkVisibility l_Visibility(l_VisibilitySettings);
+                    for (const Engine::ChunkMesh& it_Mesh : l_Meshes)
+                    {
+                        l_Visibility.SetSection(it_Mesh);
+                    }
+
+                    const std::vector<double> l_Seconds = MeasureRepeated([&]()
+                        {
+                            l_Visibility.Update(l_ViewProjection, it_Scenario.Position);
+                        });
+
+                    const Engine::ChunkVisibilityStats& l_Stats = l_Visibility.GetLastFrameStats();
+                    const std::string l_Prefix = std::string(it_Scenario.Name) + (l_UseOcclusion ? ".occlusion" : ".frustum");
+                    ReportSamples(l_Prefix + ".update_us", ToPerItem(l_Seconds, 1.0, 1.0e6), "us");
+                    ReportMetric(l_Prefix + ".visited", l_Stats.VisitedCount, "sections");
+                    ReportMetric(l_Prefix + ".frustum_culled", l_Stats.FrustumCulledCount, "sections");
+                    ReportMetric(l_Prefix + ".occlusion_culled", l_Stats.OcclusionCulledCount, "sections");
+                    ReportMetric(l_Prefix + ".visible", l_Stats.VisibleCount, "sections");
+
+                    // Cave culling may only remove sections from what the frustum alone keeps.
+                    if (!l_UseOcclusion)
+                    {
+                        l_FrustumVisible.insert(l_Visibility.GetVisibleSections().begin(), l_Visibility.GetVisibleSections().end());
+                        continue;
+                    }
+
+                    l_OcclusionVisibleCount = l_Stats.VisibleCount;
+                    for (const Engine::ChunkCoord& it_Coord : l_Visibility.GetVisibleSections())
+                    {
+                        l_IsValid = l_IsValid && l_FrustumVisible.count(it_Coord) != 0;
+                    }
+                }
+
+                l_IsValid = l_IsValid && l_OcclusionVisibleCount > 0;
+                ReportMetric(std::string(it_Scenario.Name) + ".visible_reduction", l_FrustumVisible.empty() ? 0.0
+                    : (1.0 - static_cast<double>(l_OcclusionVisibleCount) / static_cast<double>(l_FrustumVisible.size())) * 100.0, "%");
+            }
+
+            // SSE and scalar plane tests over random section-sized boxes around the surface camera.
+            {
+                const Engine::ViewFrustum l_Frustum = Engine::ViewFrustum::FromMatrix(l_Projection
+                    * glm::lookAt(l_Scenarios[0].Position, l_Scenarios[0].Target, glm::vec3(0.0f, 1.0f, 0.0f)));
+
+                std::mt19937 l_Random(1234);
+                std::uniform_real_distribution<float> l_Offset(-400.0f, 400.0f);
+                std::vector<glm::vec3> l_Centers(4096);
+                for (glm::vec3& it_Center : l_Centers)
+                {
+                    it_Center = l_Scenarios[0].Position + glm::vec3(l_Offset(l_Random), l_Offset(l_Random) * 0.25f, l_Offset(l_Random));
+                }
+
+                const glm::vec3 l_Extents(Engine::Chunk::Size * 0.5f);
+                uint32_t l_Agreements = 0;
+                uint32_t l_InsideCount = 0;
+                for (const glm::vec3& it_Center : l_Centers)
+                {
+                    const bool l_Inside = l_Frustum.IntersectsAabb(it_Center, l_Extents);
+                    l_Agreements += l_Inside == l_Frustum.IntersectsAabbScalar(it_Center, l_Extents) ? 1 : 0;
+                    l_InsideCount += l_Inside ? 1 : 0;
+                }
+
+                uint32_t l_Sink = 0;
+                const std::vector<double> l_SimdSeconds = MeasureRepeated([&]()
+                    {
+                        for (const glm::vec3& it_Center : l_Centers)
+                        {
+                            l_Sink += l_Frustum.IntersectsAabb(it_Center, l_Extents) ? 1 : 0;
+                        }
+                    });
+                const std::vector<double> l_ScalarSeconds = MeasureRepeated([&]()
+                    {
+                        for (const glm::vec3& it_Center : l_Centers)
+                        {
+                            l_Sink += l_Frustum.IntersectsAabbScalar(it_Center, l_Extents) ? 1 : 0;
+                        }
+                    });
+                ReportSamples("aabb.simd_ns", ToPerItem(l_SimdSeconds, static_cast<double>(l_Centers.size()), 1.0e9), "ns");
+                ReportSamples("aabb.scalar_ns", ToPerItem(l_ScalarSeconds, static_cast<double>(l_Centers.size()), 1.0e9), "ns");
+                ReportMetric("aabb.inside_fraction", static_cast<double>(l_InsideCount) / static_cast<double>(l_Centers.size()), "fraction");
+
+                const bool l_Agrees = l_Agreements == l_Centers.size() && l_Sink > 0;
+                ReportMetric("aabb.simd_matches_scalar", l_Agrees ? 1.0 : 0.0, "bool");
+                l_IsValid = l_IsValid && l_Agrees;
+            }
+
+            return l_IsValid;
+        }
+    }
+
+    REGISTER_BENCHMARK("ChunkVisibility", "Frustum-only vs cave-occlusion section culling from surface, underground and high cameras, plus SIMD plane tests", RunChunkVisibilityBenchmark);
+}
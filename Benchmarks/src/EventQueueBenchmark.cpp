@@ -0,0 +1,253 @@
+#include "Benchmark.h"
+
+#include "Engine/Events/EventQueue.h"
+#include "Engine/Events/Events.h"
+#include "Engine/Input/Input.h"
+
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace Benchmarks
+{
+    namespace
+    {
+        // 8 kHz mouse polling against a 60 Hz frame loop, with a scroll burst and a key tap every few frames.
+        constexpr uint32_t s_MouseRate = 8000;
+        constexpr uint32_t s_FrameRate = 60;
+        constexpr uint32_t s_SamplesPerFrame = s_MouseRate / s_FrameRate;
+        constexpr uint32_t s_FrameCount = 3000;
+
+        struct FrameInput
+        {
+            float MouseX = 0.0f;
+            float MouseY = 0.0f;
+            float DeltaX = 0.0f;
+            float DeltaY = 0.0f;
+            float ScrollY = 0.0f;
+            bool KeyPressed = false;
+        };
+
+        // Stand-ins for a game layer: the legacy one pays a virtual call per event, the batched one per frame.
+        class CountingListener
+        {
+        public:
+            virtual ~CountingListener() = default;
+
+            virtual void OnEvent(const Engine::Event& event)
+            {
+                m_MouseEventCount += event.GetEventType() == Engine::EventType::MouseMoved ? 1 : 0;
+            }
+
+            virtual void OnEvents(const Engine::EventQueue& events)
+            {
+                events.ForEach(Engine::EventType::MouseMoved, [this](const Engine::EventRecord& record)
+                    {
+                        m_MouseEventCount += record.SampleCount;
+                    });
+            }
+
+            uint64_t GetMouseEventCount() const { return m_MouseEventCount; }
+
+        private:
+            uint64_t m_MouseEventCount = 0;
+        };
+
+        // Cursor path precomputed once so the timed loops measure dispatch, not trigonometry.
+        const std::vector<float>& GetCursorPath()
+        {
+            static const std::vector<float> s_Path = []()
+                {
+                    std::vector<float> l_Path;
+                    l_Path.reserve(size_t{ s_FrameCount } * s_SamplesPerFrame * 2);
+                    for (uint32_t i = 0; i < s_FrameCount * s_SamplesPerFrame; ++i)
+                    {
+                        const float l_Time = static_cast<float>(i) / static_cast<float>(s_MouseRate);
+                        l_Path.push_back(960.0f + 400.0f * std::sin(l_Time * 1.7f));
+                        l_Path.push_back(540.0f + 300.0f * std::cos(l_Time * 2.3f));
+                    }
+
+                    return l_Path;
+                }();
+
+            return s_Path;
+        }
+
+        // Emit one frame of synthetic input through the supplied sinks in device order.
+        template<typename MouseSink, typename ScrollSink, typename KeySink>
+        void GenerateFrame(uint32_t frameIndex, MouseSink&& mouse, ScrollSink&& scroll, KeySink&& key)
+        {
+            const float* l_Path = GetCursorPath().data() + size_t{ frameIndex } * s_SamplesPerFrame * 2;
+            for (uint32_t i = 0; i < s_SamplesPerFrame; ++i)
+            {
+                mouse(l_Path[i * 2], l_Path[i * 2 + 1]);
+
+                if (frameIndex % 4 == 0 && i % 16 == 0)
+                {
+                    scroll(0.0f, 0.25f);
+                }
+            }
+
+            if (frameIndex % 10 == 0)
+            {
+                key(frameIndex % 20 == 0);
+            }
+        }
+
+        FrameInput CaptureFrame()
+        {
+            FrameInput l_Frame;
+            l_Frame.MouseX = Engine::Input::GetMousePosition().first;
+            l_Frame.MouseY = Engine::Input::GetMousePosition().second;
+            l_Frame.DeltaX = Engine::Input::GetMouseDelta().first;
+            l_Frame.DeltaY = Engine::Input::GetMouseDelta().second;
+            l_Frame.ScrollY = Engine::Input::GetScrollDelta().second;
+            l_Frame.KeyPressed = Engine::Input::WasKeyPressedThisFrame(32);
+
+            return l_Frame;
+        }
+
+        // Today's path before the queue: every sample becomes an Event pushed through a std::function callback.
+        double RunLegacyPath(std::vector<FrameInput>& frames, uint64_t& mouseEventCount)
+        {
+            CountingListener l_Listener;
+            CountingListener* l_Layer = &l_Listener;
+            const std::function<void(const Engine::Event&)> l_Callback = [l_Layer](const Engine::Event& event)
+                {
+                    Engine::Input::OnEvent(event);
+                    l_Layer->OnEvent(event);
+                };
+
+            Engine::Input::ResetMouseTracking();
+            frames.clear();
+
+            Stopwatch l_Stopwatch;
+            for (uint32_t it_Frame = 0; it_Frame < s_FrameCount; ++it_Frame)
+            {
+                Engine::Input::BeginFrame();
+                GenerateFrame(it_Frame,
+                    [&l_Callback](float x, float y) { l_Callback(Engine::MouseMovedEvent(x, y)); },
+                    [&l_Callback](float x, float y) { l_Callback(Engine::MouseScrolledEvent(x, y)); },
+                    [&l_Callback](bool isPress)
+                    {
+                        if (isPress)
+                        {
+                            l_Callback(Engine::KeyPressedEvent(32, 0));
+                        }
+                        else
+                        {
+                            l_Callback(Engine::KeyReleasedEvent(32));
+                        }
+                    });
+                frames.push_back(CaptureFrame());
+            }
+            const double l_Seconds = l_Stopwatch.GetElapsedSeconds();
+
+            mouseEventCount = l_Listener.GetMouseEventCount();
+
+            return l_Seconds;
+        }
+
+        double RunQueuedPath(std::vector<FrameInput>& frames, uint64_t& mouseEventCount, uint64_t& recordCount)
+        {
+            CountingListener l_Listener;
+            CountingListener* l_Layer = &l_Listener;
+            Engine::EventQueue l_Queue;
+
+            Engine::Input::ResetMouseTracking();
+            frames.clear();
+            recordCount = 0;
+
+            Stopwatch l_Stopwatch;
+            for (uint32_t it_Frame = 0; it_Frame < s_FrameCount; ++it_Frame)
+            {
+                Engine::Input::BeginFrame();
+                GenerateFrame(it_Frame,
+                    [&l_Queue](float x, float y) { l_Queue.PushMouseMoved(x, y); },
+                    [&l_Queue](float x, float y) { l_Queue.PushMouseScrolled(x, y); },
+                    [&l_Queue](bool isPress)
+                    {
+                        if (isPress)
+                        {
+                            l_Queue.PushKeyPressed(32, 0);
+                        }
+                        else
+                        {
+                            l_Queue.PushKeyReleased(32);
+                        }
+                    });
+
+                // Mirrors Application::ProcessEvents.
+                l_Queue.ForEach([](const Engine::EventRecord& record)
+                    {
+                        Engine::Input::OnEvent(record);
+                    });
+                l_Layer->OnEvents(l_Queue);
+                recordCount += l_Queue.GetCount();
+                l_Queue.Clear();
+
+                frames.push_back(CaptureFrame());
+            }
+            const double l_Seconds = l_Stopwatch.GetElapsedSeconds();
+
+            mouseEventCount = l_Listener.GetMouseEventCount();
+
+            return l_Seconds;
+        }
+
+        bool IsClose(float a, float b)
+        {
+            return std::fabs(a - b) <= 1e-3f * (1.0f + std::fabs(a));
+        }
+
+        bool RunEventQueueBenchmark()
+        {
+            std::vector<FrameInput> l_LegacyFrames;
+            std::vector<FrameInput> l_QueuedFrames;
+            uint64_t l_LegacyMouseCount = 0;
+            uint64_t l_QueuedMouseCount = 0;
+            uint64_t l_RecordCount = 0;
+
+            // The two paths alternate within each repetition so drift in machine load hits both equally.
+            const BenchmarkSettings& l_Settings = GetBenchmarkSettings();
+            std::vector<double> l_LegacySeconds;
+            std::vector<double> l_QueuedSeconds;
+            std::vector<double> l_Speedups;
+            GetCursorPath();
+            for (uint32_t it_Run = 0; it_Run < l_Settings.WarmupRuns + l_Settings.Repetitions; ++it_Run)
+            {
+                const double l_Legacy = RunLegacyPath(l_LegacyFrames, l_LegacyMouseCount);
+                const double l_Queued = RunQueuedPath(l_QueuedFrames, l_QueuedMouseCount, l_RecordCount);
+                if (it_Run >= l_Settings.WarmupRuns)
+                {
+                    l_LegacySeconds.push_back(l_Legacy);
+                    l_QueuedSeconds.push_back(l_Queued);
+                    l_Speedups.push_back(l_Legacy / l_Queued);
+                }
+            }
+
+            const double l_SampleCount = static_cast<double>(s_FrameCount) * s_SamplesPerFrame;
+            ReportSamples("legacy.ns_per_mouse_sample", ToPerItem(l_LegacySeconds, l_SampleCount, 1e9), "ns");
+            ReportSamples("queued.ns_per_mouse_sample", ToPerItem(l_QueuedSeconds, l_SampleCount, 1e9), "ns");
+            ReportSamples("speedup", l_Speedups, "x");
+            ReportMetric("queued.records_per_frame", static_cast<double>(l_RecordCount) / s_FrameCount, "records");
+
+            // Both paths must leave Input in the same state at the end of every frame.
+            bool l_IsValid = l_LegacyMouseCount == l_QueuedMouseCount && l_LegacyFrames.size() == l_QueuedFrames.size();
+            for (size_t i = 0; l_IsValid && i < l_LegacyFrames.size(); ++i)
+            {
+                const FrameInput& l_Legacy = l_LegacyFrames[i];
+                const FrameInput& l_Queued = l_QueuedFrames[i];
+                l_IsValid = l_Legacy.MouseX == l_Queued.MouseX && l_Legacy.MouseY == l_Queued.MouseY
+                    && IsClose(l_Legacy.DeltaX, l_Queued.DeltaX) && IsClose(l_Legacy.DeltaY, l_Queued.DeltaY)
+                    && IsClose(l_Legacy.ScrollY, l_Queued.ScrollY) && l_Legacy.KeyPressed == l_Queued.KeyPressed;
+            }
+            ReportMetric("input_state_matches", l_IsValid ? 1.0 : 0.0, "bool");
+
+            return l_IsValid;
+        }
+    }
+
+    REGISTER_BENCHMARK("EventQueue", "8 kHz mouse input through per-event std::function dispatch versus the coalescing event queue", RunEventQueueBenchmark);
+}
@@ -0,0 +1,241 @@
+#include "Benchmark.h"
+
+#include "Engine/Application.h"
+#include "Engine/Events/Events.h"
+#include "Engine/Input/Input.h"
+#include "Engine/World/ChunkMeshPipeline.h"
+#include "Engine/World/World.h"
+#include "Engine/World/WorldGenerator.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Benchmarks
+{
+    namespace
+    {
+        constexpr uint64_t s_FrameCount = 600;
+        constexpr int32_t s_AreaRadius = 2;
+        constexpr int32_t s_ChunkLayers = 3;
+        constexpr uint32_t s_EditsPerTick = 24;
+
+        // GLFW codes for W and the left mouse button, spelled out because the benchmark does not see GLFW headers.
+        constexpr int s_ForwardKey = 87;
+        constexpr int s_DigButton = 0;
+
+        // Totals one run reports back to the scenario.
+        struct FrameLoopCounters
+        {
+            uint64_t RenderedFrameCount = 0;
+            uint64_t EditCount = 0;
+            uint64_t UploadedMeshCount = 0;
+            uint64_t UploadedVertexCount = 0;
+        };
+
+        // A cut-down game layer: generates a small area up front, then every tick edits blocks under the scripted
+        // cursor while the dig button is held and every frame dispatches the resulting remeshes.
+        class FrameLoopLayer : public Engine::Layer
+        {
+        public:
+            FrameLoopLayer(Engine::Application& application, FrameLoopCounters& counters) : m_Application(application), m_Counters(counters)
+            {
+
+            }
+
+            bool Initialize() override
+            {
+                std::vector<Engine::ChunkCoord> l_Coords;
+                for (int32_t z = -s_AreaRadius; z <= s_AreaRadius; ++z)
+                {
+                    for (int32_t x = -s_AreaRadius; x <= s_AreaRadius; ++x)
+                    {
+                        for (int32_t y = 0; y < s_ChunkLayers; ++y)
+                        {
+                            l_Coords.push_back({ x, y, z });
+                        }
+                    }
+                }
+
+                Engine::JobSystem& l_JobSystem = m_Application.GetJobSystem();
+                const Engine::WorldGenerator l_Generator;
+                std::shared_ptr<Engine::WorldGenerationBatch> l_Batch = l_Generator.GenerateAsync(l_JobSystem, l_Coords);
+                l_JobSystem.WaitForCounter(l_Batch->GetCounter());
+                for (std::unique_ptr<Engine::Chunk>& it_Chunk : l_Batch->GetChunks())
+                {
+                    m_World.InsertChunk(std::move(it_Chunk));
+                }
+
+                // Unknown ids default to visible and opaque, so only air needs an entry.
+                m_BlockTable.BlockFlags = { 0 };
+                m_Pipeline = std::make_unique<Engine::ChunkMeshPipeline>(l_JobSystem, m_World, m_BlockTable);
+                m_Pipeline->SetUploadCallback([this](const Engine::ChunkCoord&, Engine::ChunkMesh& mesh)
+                    {
+                        ++m_Counters.UploadedMeshCount;
+                        m_Counters.UploadedVertexCount += mesh.Vertices.size();
+                    });
+
+                m_DigAction = Engine::Input::RegisterAction("FrameLoop.Dig", { { s_ForwardKey } });
+
+                return true;
+            }
+
+            void Update(const Engine::TickTiming&) override
+            {
+                if (!Engine::Input::IsActionDown(m_DigAction) && !Engine::Input::IsMouseButtonDown(s_DigButton))
+                {
+                    return;
+                }
+
+                // The cursor picks the column; edits walk down and around it so neighbouring chunks are touched too.
+                const std::pair<float, float> l_Cursor = Engine::Input::GetMousePosition();
+                const int32_t l_Extent = (2 * s_AreaRadius + 1) * Engine::Chunk::Size;
+                const int32_t l_BaseX = static_cast<int32_t>(l_Cursor.first) % l_Extent - s_AreaRadius * Engine::Chunk::Size;
+                const int32_t l_BaseZ = static_cast<int32_t>(l_Cursor.second) % l_Extent - s_AreaRadius * Engine::Chunk::Size;
+                for (uint32_t i = 0; i < s_EditsPerTick; ++i)
+                {
+                    m_RandomState = m_RandomState * 1664525u + 1013904223u;
+                    const int32_t l_X = l_BaseX + static_cast<int32_t>((m_RandomState >> 8) % 5) - 2;
+                    const int32_t l_Y = static_cast<int32_t>((m_RandomState >> 12) % (s_ChunkLayers * Engine::Chunk::Size));
+                    const int32_t l_Z = l_BaseZ + static_cast<int32_t>((m_RandomState >> 16) % 5) - 2;
+                    const Engine::BlockId l_Block = (m_RandomState >> 20) % 3 == 0 ? Engine::BlockId{ 1 } : Engine::AirBlockId;
+                    if (m_World.SetBlock(l_X, l_Y, l_Z, l_Block))
+                    {
+                        m_Pipeline->NotifyBlockChanged(l_X, l_Y, l_Z);
+                        ++m_Counters.EditCount;
+                    }
+                }
+            }
+
+            void Render(const Engine::FrameTiming&) override
+            {
+                m_Pipeline->Dispatch();
+                ++m_Counters.RenderedFrameCount;
+            }
+
+            void OnEvent(const Engine::Event&) override {}
+
+            void Shutdown() override
+            {
+                // In-flight jobs mesh snapshots and hold their own state, so the pipeline may go before they finish.
+                m_Pipeline.reset();
+            }
+
+        private:
+            Engine::Application& m_Application;
+            FrameLoopCounters& m_Counters;
+
+            Engine::World m_World;
+            Engine::MeshingBlockTable m_BlockTable;
+            std::unique_ptr<Engine::ChunkMeshPipeline> m_Pipeline;
+            Engine::ActionHandle m_DigAction = Engine::InvalidActionHandle;
+            uint32_t m_RandomState = 0x2545F491u;
+        };
+
+        // Scripted session: the cursor sweeps the area, the forward key and dig button toggle in bursts.
+        void EmitFrameInput(uint64_t frameIndex, const Engine::Window::EventCallbackFn& callback)
+        {
+            for (uint32_t i = 0; i < 8; ++i)
+            {
+                const float l_Step = static_cast<float>(frameIndex * 8 + i);
+                Engine::MouseMovedEvent l_Event(l_Step * 0.75f, l_Step * 0.4f);
+                callback(l_Event);
+            }
+
+            if (frameIndex % 60 == 0)
+            {
+                Engine::KeyPressedEvent l_Event(s_ForwardKey, 0);
+                callback(l_Event);
+            }
+            else if (frameIndex % 60 == 40)
+            {
+                Engine::KeyReleasedEvent l_Event(s_ForwardKey);
+                callback(l_Event);
+            }
+
+            if (frameIndex % 90 == 45)
+            {
+                Engine::MouseButtonPressedEvent l_Event(s_DigButton);
+                callback(l_Event);
+            }
+            else if (frameIndex % 90 == 75)
+            {
+                Engine::MouseButtonReleasedEvent l_Event(s_DigButton);
+                callback(l_Event);
+            }
+        }
+
+        bool RunFrameLoopBenchmark()
+        {
+            // A fixed 60 Hz delta keeps the tick count per frame, and with it the simulated work, identical every run.
+            Engine::ApplicationSpecification l_Specification;
+            l_Specification.Headless = true;
+            l_Specification.MaxFrames = s_FrameCount;
+            l_Specification.FixedFrameDeltaTime = 1.0 / 60.0;
+
+            const BenchmarkSettings& l_Settings = GetBenchmarkSettings();
+            std::vector<double> l_FrameMilliseconds;
+            std::vector<double> l_EventMilliseconds;
+            std::vector<double> l_UpdateMilliseconds;
+            std::vector<double> l_RenderMilliseconds;
+            std::vector<double> l_FrameArenaBytes;
+            std::vector<double> l_RunSeconds;
+            FrameLoopCounters l_Reference;
+            bool l_IsValid = true;
+
+            for (uint32_t it_Run = 0; it_Run < l_Settings.WarmupRuns + l_Settings.Repetitions; ++it_Run)
+            {
+                FrameLoopCounters l_Counters;
+                Engine::Application l_Application(l_Specification);
+                l_Application.GetWindow().SetSyntheticEventSource([&l_Application](const Engine::Window::EventCallbackFn& callback)
+                    {
+                        EmitFrameInput(l_Application.GetFrameIndex(), callback);
+                    });
+                l_Application.RegisterGameLayer(std::make_unique<FrameLoopLayer>(l_Application, l_Counters));
+
+                Stopwatch l_Stopwatch;
+                l_Application.Run();
+                const double l_Seconds = l_Stopwatch.GetElapsedSeconds();
+
+                // Edits are seeded and the delta is fixed, so every run must do exactly the same gameplay work.
+                l_IsValid = l_IsValid && l_Counters.RenderedFrameCount == s_FrameCount && l_Counters.EditCount > 0 && l_Counters.UploadedMeshCount > 0;
+                if (it_Run == 0)
+                {
+                    l_Reference = l_Counters;
+                }
+                l_IsValid = l_IsValid && l_Counters.EditCount == l_Reference.EditCount;
+
+                if (it_Run < l_Settings.WarmupRuns)
+                {
+                    continue;
+                }
+
+                // Frames are pooled across repetitions so the percentiles describe the frame time distribution.
+                l_RunSeconds.push_back(l_Seconds);
+                for (const Engine::FrameTimingSample& it_Sample : l_Application.GetFrameTimingLog().GetSamples())
+                {
+                    l_FrameMilliseconds.push_back(it_Sample.FrameMilliseconds);
+                    l_EventMilliseconds.push_back(it_Sample.EventsMilliseconds);
+                    l_UpdateMilliseconds.push_back(it_Sample.UpdateMilliseconds);
+                    l_RenderMilliseconds.push_back(it_Sample.RenderMilliseconds);
+                    l_FrameArenaBytes.push_back(static_cast<double>(it_Sample.FrameArenaBytes));
+                }
+            }
+
+            ReportSamples("frame_ms", l_FrameMilliseconds, "ms");
+            ReportMetric("frame_ms.p90", Summarize(l_FrameMilliseconds).P90, "ms");
+            ReportMetric("frame_ms.max", Summarize(l_FrameMilliseconds).Max, "ms");
+            ReportSamples("events_ms", l_EventMilliseconds, "ms");
+            ReportSamples("update_ms", l_UpdateMilliseconds, "ms");
+            ReportSamples("render_ms", l_RenderMilliseconds, "ms");
+            ReportMetric("frame_arena_bytes.max", Summarize(l_FrameArenaBytes).Max, "bytes");
+            ReportSamples("frames_per_second", ToRates(l_RunSeconds, static_cast<double>(s_FrameCount)), "frames/s");
+            ReportMetric("edits_per_run", static_cast<double>(l_Reference.EditCount), "edits");
+            ReportMetric("meshes_per_run", static_cast<double>(l_Reference.UploadedMeshCount), "meshes");
+
+            return l_IsValid;
+        }
+    }
+
+    REGISTER_BENCHMARK("FrameLoop", "Headless 600-frame scripted session: input, block edits and asynchronous remeshing through Application::Run", RunFrameLoopBenchmark);
+}
@@ -0,0 +1,257 @@
+#include "Benchmark.h"
+
+#include "Engine/Input/Input.h"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace Benchmarks
+{
+    namespace
+    {
+        // The hash-container implementation Input used before the bitset rewrite, kept as the baseline.
+        class LegacyInput
+        {
+        public:
+            void BeginFrame()
+            {
+                m_KeysPressedThisFrame.clear();
+                m_KeysReleasedThisFrame.clear();
+            }
+
+            void OnKey(int keyCode, bool isDown)
+            {
+                m_KeyStates[keyCode] = isDown;
+                if (isDown)
+                {
+                    m_KeysPressedThisFrame.insert(keyCode);
+                }
+                else
+                {
+                    m_KeysReleasedThisFrame.insert(keyCode);
+                }
+            }
+
+            void RegisterActionMapping(const std::string& actionName, const std::vector<int>& keyCombination)
+            {
+                m_ActionMappings[actionName] = { keyCombination };
+            }
+
+            bool IsKeyDown(int keyCode) const
+            {
+                const auto l_Found = m_KeyStates.find(keyCode);
+
+                return l_Found != m_KeyStates.end() && l_Found->second;
+            }
+
+            bool IsActionDown(const std::string& actionName) const
+            {
+                const auto l_Found = m_ActionMappings.find(actionName);
+                if (l_Found == m_ActionMappings.end())
+                {
+                    return false;
+                }
+
+                for (const std::vector<int>& it_Combination : l_Found->second)
+                {
+                    bool l_AllDown = !it_Combination.empty();
+                    for (int it_Key : it_Combination)
+                    {
+                        l_AllDown = l_AllDown && IsKeyDown(it_Key);
+                    }
+
+                    if (l_AllDown)
+                    {
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+
+            bool WasActionPressedThisFrame(const std::string& actionName) const
+            {
+                const auto l_Found = m_ActionMappings.find(actionName);
+                if (l_Found == m_ActionMappings.end())
+                {
+                    return false;
+                }
+
+                for (const std::vector<int>& it_Combination : l_Found->second)
+                {
+                    bool l_AllDown = true;
+                    bool l_Edge = false;
+                    for (int it_Key : it_Combination)
+                    {
+                        l_AllDown = l_AllDown && IsKeyDown(it_Key);
+                        l_Edge = l_Edge || m_KeysPressedThisFrame.find(it_Key) != m_KeysPressedThisFrame.end();
+                    }
+
+                    if (l_AllDown && l_Edge && !it_Combination.empty())
+                    {
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+
+        private:
+            std::unordered_map<int, bool> m_KeyStates;
+            std::unordered_set<int> m_KeysPressedThisFrame;
+            std::unordered_set<int> m_KeysReleasedThisFrame;
+            std::unordered_map<std::string, std::vector<std::vector<int>>> m_ActionMappings;
+        };
+
+        constexpr uint32_t s_ActionCount = 48;
+        constexpr uint32_t s_TickCount = 20000;
+
+        // Deterministic key traffic: a few keys change state every tick, spread across the GLFW key range.
+        template<typename F>
+        void ForEachKeyChange(uint32_t tick, F&& function)
+        {
+            uint32_t l_State = tick * 2654435761u + 12345u;
+            for (uint32_t i = 0; i < 3; ++i)
+            {
+                l_State = l_State * 1664525u + 1013904223u;
+                const int l_Key = 32 + static_cast<int>((l_State >> 8) % 316);
+                function(l_Key, ((l_State >> 4) & 1) != 0);
+            }
+        }
+
+        bool RunInputBenchmark()
+        {
+            // Actions of one to three keys, named the way gameplay code names them.
+            std::vector<std::string> l_Names;
+            std::vector<std::vector<int>> l_Combinations;
+            for (uint32_t i = 0; i < s_ActionCount; ++i)
+            {
+                l_Names.push_back("Gameplay.Action" + std::to_string(i));
+                std::vector<int> l_Combination = { 32 + static_cast<int>((i * 37) % 316) };
+                if (i % 3 == 1)
+                {
+                    l_Combination.push_back(340);
+                }
+                if (i % 5 == 2)
+                {
+                    l_Combination.push_back(32 + static_cast<int>((i * 91) % 316));
+                }
+                l_Combinations.push_back(l_Combination);
+            }
+
+            LegacyInput l_Legacy;
+            std::vector<Engine::ActionHandle> l_Handles;
+            for (uint32_t i = 0; i < s_ActionCount; ++i)
+            {
+                l_Legacy.RegisterActionMapping(l_Names[i], l_Combinations[i]);
+                l_Handles.push_back(Engine::Input::RegisterAction(l_Names[i], { l_Combinations[i] }));
+            }
+
+            // Results are folded into checksums so the compiler cannot skip the queries, and so the paths can be compared.
+            uint64_t l_LegacyChecksum = 0;
+            uint64_t l_NamedChecksum = 0;
+            uint64_t l_HandleChecksum = 0;
+            std::vector<double> l_LegacySeconds;
+            std::vector<double> l_NamedSeconds;
+            std::vector<double> l_HandleSeconds;
+
+            // Both implementations see the same key traffic every run, so their states never diverge.
+            const BenchmarkSettings& l_Settings = GetBenchmarkSettings();
+            for (uint32_t it_Run = 0; it_Run < l_Settings.WarmupRuns + l_Settings.Repetitions; ++it_Run)
+            {
+                double l_LegacyRunSeconds = 0.0;
+                double l_NamedRunSeconds = 0.0;
+                double l_HandleRunSeconds = 0.0;
+                for (uint32_t it_Tick = 0; it_Tick < s_TickCount; ++it_Tick)
+                {
+                    l_Legacy.BeginFrame();
+                    Engine::Input::BeginFrame();
+                    ForEachKeyChange(it_Tick, [&l_Legacy](int key, bool isDown)
+                        {
+                            l_Legacy.OnKey(key, isDown);
+
+                            Engine::EventRecord l_Record;
+                            l_Record.Type = isDown ? Engine::EventType::KeyPressed : Engine::EventType::KeyReleased;
+                            l_Record.Key = { key, 0 };
+                            Engine::Input::OnEvent(l_Record);
+                        });
+
+                    Stopwatch l_Stopwatch;
+                    for (uint32_t i = 0; i < s_ActionCount; ++i)
+                    {
+                        l_LegacyChecksum = l_LegacyChecksum * 3 + (l_Legacy.IsActionDown(l_Names[i]) ? 1 : 0) + (l_Legacy.WasActionPressedThisFrame(l_Names[i]) ? 2 : 0);
+                    }
+                    l_LegacyRunSeconds += l_Stopwatch.GetElapsedSeconds();
+
+                    l_Stopwatch.Reset();
+                    for (uint32_t i = 0; i < s_ActionCount; ++i)
+                    {
+                        l_NamedChecksum = l_NamedChecksum * 3 + (Engine::Input::IsActionDown(l_Names[i]) ? 1 : 0) + (Engine::Input::WasActionPressedThisFrame(l_Names[i]) ? 2 : 0);
+                    }
+                    l_NamedRunSeconds += l_Stopwatch.GetElapsedSeconds();
+
+                    l_Stopwatch.Reset();
+                    for (uint32_t i = 0; i < s_ActionCount; ++i)
+                    {
+                        l_HandleChecksum = l_HandleChecksum * 3 + (Engine::Input::IsActionDown(l_Handles[i]) ? 1 : 0) + (Engine::Input::WasActionPressedThisFrame(l_Handles[i]) ? 2 : 0);
+                    }
+                    l_HandleRunSeconds += l_Stopwatch.GetElapsedSeconds();
+                }
+
+                if (it_Run >= l_Settings.WarmupRuns)
+                {
+                    l_LegacySeconds.push_back(l_LegacyRunSeconds);
+                    l_NamedSeconds.push_back(l_NamedRunSeconds);
+                    l_HandleSeconds.push_back(l_HandleRunSeconds);
+                }
+            }
+
+            // Each loop iteration issues two queries.
+            const double l_QueryCount = 2.0 * s_ActionCount * s_TickCount;
+            ReportSamples("legacy.ns_per_query", ToPerItem(l_LegacySeconds, l_QueryCount, 1e9), "ns");
+            ReportSamples("named.ns_per_query", ToPerItem(l_NamedSeconds, l_QueryCount, 1e9), "ns");
+            ReportSamples("handle.ns_per_query", ToPerItem(l_HandleSeconds, l_QueryCount, 1e9), "ns");
+
+            std::vector<double> l_Speedups;
+            for (size_t i = 0; i < l_HandleSeconds.size(); ++i)
+            {
+                l_Speedups.push_back(l_LegacySeconds[i] / l_HandleSeconds[i]);
+            }
+            ReportSamples("handle.speedup", l_Speedups, "x");
+
+            // Frame reset: clearing hash sets against zeroing a few words.
+            const std::vector<double> l_LegacyResetSeconds = MeasureRepeated([&l_Legacy]()
+                {
+                    for (uint32_t i = 0; i < s_TickCount; ++i)
+                    {
+                        l_Legacy.OnKey(65, true);
+                        l_Legacy.BeginFrame();
+                    }
+                });
+            ReportSamples("legacy.ns_per_begin_frame", ToPerItem(l_LegacyResetSeconds, s_TickCount, 1e9), "ns");
+
+            const std::vector<double> l_BitsetResetSeconds = MeasureRepeated([]()
+                {
+                    for (uint32_t i = 0; i < s_TickCount; ++i)
+                    {
+                        Engine::EventRecord l_Record;
+                        l_Record.Type = Engine::EventType::KeyPressed;
+                        l_Record.Key = { 65, 0 };
+                        Engine::Input::OnEvent(l_Record);
+                        Engine::Input::BeginFrame();
+                    }
+                });
+            ReportSamples("bitset.ns_per_begin_frame", ToPerItem(l_BitsetResetSeconds, s_TickCount, 1e9), "ns");
+
+            const bool l_Matches = l_LegacyChecksum == l_NamedChecksum && l_LegacyChecksum == l_HandleChecksum;
+            ReportMetric("results_match", l_Matches ? 1.0 : 0.0, "bool");
+
+            return l_Matches;
+        }
+    }
+
+    REGISTER_BENCHMARK("Input", "Action polling through string-keyed hash maps versus precompiled bitmask handles", RunInputBenchmark);
+}
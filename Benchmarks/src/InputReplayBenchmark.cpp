@@ -0,0 +1,225 @@
+#include "Benchmark.h"
+
+#include "Engine/Application.h"
+#include "Engine/Events/Events.h"
+#include "Engine/Input/Input.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <system_error>
+#include <tuple>
+#include <vector>
+
+namespace Benchmarks
+{
+    namespace
+    {
+        constexpr uint64_t s_FrameCount = 2000;
+        constexpr uint32_t s_MouseSamplesPerFrame = 32;
+
+        // GLFW codes for W, A, S, D and space, spelled out because the benchmark does not see GLFW headers.
+        constexpr int s_Keys[] = { 87, 65, 83, 68, 32 };
+        constexpr int s_KeyCount = static_cast<int>(sizeof(s_Keys) / sizeof(s_Keys[0]));
+
+        // Everything gameplay can observe about input and timing in one frame.
+        struct ObservedFrame
+        {
+            double DeltaTime = 0.0;
+            uint32_t KeysDown = 0;
+            uint32_t KeysPressed = 0;
+            uint32_t KeysReleased = 0;
+            uint32_t ButtonsDown = 0;
+            float MouseX = 0.0f;
+            float MouseY = 0.0f;
+            float MouseDeltaX = 0.0f;
+            float MouseDeltaY = 0.0f;
+            float ScrollY = 0.0f;
+            uint32_t TicksThisFrame = 0;
+        };
+
+        // Frames are compared with memcmp, so there must be no uninitialized padding.
+        static_assert(sizeof(ObservedFrame) == 48, "ObservedFrame must not contain padding");
+
+        // Records what Input reports during every Render so two runs can be compared bit for bit.
+        class ObserverLayer : public Engine::Layer
+        {
+        public:
+            explicit ObserverLayer(std::vector<ObservedFrame>& frames) : m_Frames(frames)
+            {
+
+            }
+
+            bool Initialize() override { return true; }
+            void Update(const Engine::TickTiming&) override {}
+            void OnEvent(const Engine::Event&) override {}
+            void Shutdown() override {}
+
+            void Render(const Engine::FrameTiming& frameTiming) override
+            {
+                ObservedFrame l_Frame;
+                for (int i = 0; i < s_KeyCount; ++i)
+                {
+                    l_Frame.KeysDown |= Engine::Input::IsKeyDown(s_Keys[i]) ? 1u << i : 0u;
+                    l_Frame.KeysPressed |= Engine::Input::WasKeyPressedThisFrame(s_Keys[i]) ? 1u << i : 0u;
+                    l_Frame.KeysReleased |= Engine::Input::WasKeyReleasedThisFrame(s_Keys[i]) ? 1u << i : 0u;
+                }
+
+                for (int i = 0; i < 3; ++i)
+                {
+                    l_Frame.ButtonsDown |= Engine::Input::IsMouseButtonDown(i) ? 1u << i : 0u;
+                }
+
+                std::tie(l_Frame.MouseX, l_Frame.MouseY) = Engine::Input::GetMousePosition();
+                std::tie(l_Frame.MouseDeltaX, l_Frame.MouseDeltaY) = Engine::Input::GetMouseDelta();
+                l_Frame.ScrollY = Engine::Input::GetScrollDelta().second;
+                l_Frame.DeltaTime = frameTiming.DeltaTime;
+                l_Frame.TicksThisFrame = frameTiming.TicksThisFrame;
+                m_Frames.push_back(l_Frame);
+            }
+
+        private:
+            std::vector<ObservedFrame>& m_Frames;
+        };
+
+        // Pseudo-random but seeded play session: mouse bursts, key taps and holds, clicks and scrolling.
+        void EmitFrameInput(uint64_t frameIndex, uint32_t& randomState, const Engine::Window::EventCallbackFn& callback)
+        {
+            const auto a_Next = [&randomState]()
+                {
+                    randomState = randomState * 1664525u + 1013904223u;
+
+                    return randomState >> 8;
+                };
+
+            for (uint32_t i = 0; i < s_MouseSamplesPerFrame; ++i)
+            {
+                const float l_X = static_cast<float>(a_Next() % 1920u) + 0.25f;
+                const float l_Y = static_cast<float>(a_Next() % 1080u) + 0.5f;
+                Engine::MouseMovedEvent l_Event(l_X, l_Y);
+                callback(l_Event);
+            }
+
+            const uint32_t l_Roll = a_Next();
+            const int l_Key = s_Keys[l_Roll % s_KeyCount];
+            if ((l_Roll & 0x300) == 0)
+            {
+                Engine::KeyPressedEvent l_Event(l_Key, 0);
+                callback(l_Event);
+            }
+            else if ((l_Roll & 0x300) == 0x100)
+            {
+                Engine::KeyReleasedEvent l_Event(l_Key);
+                callback(l_Event);
+            }
+
+            if (frameIndex % 7 == 0)
+            {
+                Engine::MouseButtonPressedEvent l_Event(static_cast<int>(a_Next() % 3));
+                callback(l_Event);
+            }
+            else if (frameIndex % 7 == 3)
+            {
+                Engine::MouseButtonReleasedEvent l_Event(static_cast<int>(a_Next() % 3));
+                callback(l_Event);
+            }
+
+            if (frameIndex % 5 == 0)
+            {
+                Engine::MouseScrolledEvent l_Event(0.0f, 1.0f);
+                callback(l_Event);
+                callback(l_Event);
+            }
+        }
+
+        double GetAverageFrameMilliseconds(const Engine::FrameTimingLog& timings)
+        {
+            double l_Total = 0.0;
+            for (const Engine::FrameTimingSample& it_Sample : timings.GetSamples())
+            {
+                l_Total += it_Sample.FrameMilliseconds;
+            }
+
+            return timings.GetSamples().empty() ? 0.0 : l_Total / static_cast<double>(timings.GetSamples().size());
+        }
+
+        bool RunInputReplayBenchmark()
+        {
+            const std::filesystem::path l_Directory = std::filesystem::temp_directory_path() / "InputReplayBenchmark";
+            std::error_code l_Error;
+            std::filesystem::create_directories(l_Directory, l_Error);
+            const std::filesystem::path l_RecordingPath = l_Directory / "session.mcinput";
+
+            Engine::ApplicationSpecification l_Specification;
+            l_Specification.Headless = true;
+            l_Specification.WorkerThreadCount = 1;
+
+            // The live run uses the wall clock so the replay has to reproduce genuinely irregular deltas. Every run
+            // records over the same file, so the replays below play back the last live session.
+            std::vector<ObservedFrame> l_LiveFrames;
+            const std::vector<double> l_LiveFrameMilliseconds = CollectRepeated([&l_Specification, &l_Directory, &l_RecordingPath, &l_LiveFrames]()
+                {
+                    Engine::ApplicationSpecification l_LiveSpecification = l_Specification;
+                    l_LiveSpecification.MaxFrames = s_FrameCount;
+                    l_LiveSpecification.InputRecordPath = l_RecordingPath.string();
+                    l_LiveSpecification.FrameTimingPath = (l_Directory / "live.csv").string();
+
+                    l_LiveFrames.clear();
+                    Engine::Application l_Application(l_LiveSpecification);
+                    uint32_t l_RandomState = 0x5EED;
+                    l_Application.GetWindow().SetSyntheticEventSource([&l_Application, &l_RandomState](const Engine::Window::EventCallbackFn& callback)
+                        {
+                            EmitFrameInput(l_Application.GetFrameIndex(), l_RandomState, callback);
+                        });
+                    l_Application.RegisterGameLayer(std::make_unique<ObserverLayer>(l_LiveFrames));
+                    l_Application.Run();
+
+                    return GetAverageFrameMilliseconds(l_Application.GetFrameTimingLog());
+                });
+
+            // Every replay must match the recording frame for frame, not just the first one.
+            std::vector<ObservedFrame> l_ReplayFrames;
+            uint64_t l_MismatchCount = 0;
+            bool l_ReplayCountsMatch = true;
+            const std::vector<double> l_ReplayFrameMilliseconds = CollectRepeated([&l_Specification, &l_Directory, &l_RecordingPath, &l_LiveFrames,
+                &l_ReplayFrames, &l_MismatchCount, &l_ReplayCountsMatch]()
+                {
+                    Engine::ApplicationSpecification l_ReplaySpecification = l_Specification;
+                    l_ReplaySpecification.InputReplayPath = l_RecordingPath.string();
+                    l_ReplaySpecification.FrameTimingPath = (l_Directory / "replay.csv").string();
+
+                    l_ReplayFrames.clear();
+                    Engine::Application l_Application(l_ReplaySpecification);
+                    l_Application.RegisterGameLayer(std::make_unique<ObserverLayer>(l_ReplayFrames));
+                    l_Application.Run();
+
+                    for (size_t i = 0; i < std::min(l_LiveFrames.size(), l_ReplayFrames.size()); ++i)
+                    {
+                        l_MismatchCount += std::memcmp(&l_LiveFrames[i], &l_ReplayFrames[i], sizeof(ObservedFrame)) != 0 ? 1 : 0;
+                    }
+                    l_ReplayCountsMatch = l_ReplayCountsMatch && l_ReplayFrames.size() == l_LiveFrames.size();
+
+                    return GetAverageFrameMilliseconds(l_Application.GetFrameTimingLog());
+                });
+
+            const uint64_t l_RecordingBytes = std::filesystem::file_size(l_RecordingPath, l_Error);
+            const bool l_IsValid = l_LiveFrames.size() == s_FrameCount && l_ReplayCountsMatch && l_MismatchCount == 0;
+
+            ReportMetric("frames_recorded", static_cast<double>(l_LiveFrames.size()), "frames");
+            ReportMetric("frames_replayed", static_cast<double>(l_ReplayFrames.size()), "frames");
+            ReportMetric("recording_bytes_per_frame", static_cast<double>(l_RecordingBytes) / s_FrameCount, "B");
+            ReportSamples("live.avg_frame_ms", l_LiveFrameMilliseconds, "ms");
+            ReportSamples("replay.avg_frame_ms", l_ReplayFrameMilliseconds, "ms");
+            ReportMetric("mismatched_frames", static_cast<double>(l_MismatchCount), "frames");
+            ReportMetric("replay_matches", l_IsValid ? 1.0 : 0.0, "bool");
+
+            std::filesystem::remove_all(l_Directory, l_Error);
+
+            return l_IsValid;
+        }
+    }
+
+    REGISTER_BENCHMARK("InputReplay", "Record a headless session's input and replay it, checking every frame observes identical input and timing", RunInputReplayBenchmark);
+}
@@ -0,0 +1,196 @@
+#include "Benchmark.h"
+
+#include "Engine/Jobs/JobSystem.h"
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Benchmarks
+{
+    namespace
+    {
+        // Throughput is summarized over every timed run; steal ratios describe the last one.
+        void ReportSchedulerStats(const std::string& prefix, const std::vector<double>& seconds, double jobsPerRun, const Engine::JobSystemStats& stats)
+        {
+            const double l_Executed = static_cast<double>(stats.ExecutedJobCount);
+            ReportSamples(prefix + ".throughput", ToRates(seconds, jobsPerRun), "jobs/s");
+            ReportMetric(prefix + ".steal_rate", l_Executed > 0.0 ? static_cast<double>(stats.StealCount) / l_Executed : 0.0, "steals/job");
+            ReportMetric(prefix + ".steal_success", stats.StealAttemptCount > 0 ? static_cast<double>(stats.StealCount) / static_cast<double>(stats.StealAttemptCount) : 0.0, "ratio");
+        }
+
+        bool RunJobSystemBenchmark()
+        {
+            constexpr uint32_t l_FlatJobCount = 1u << 20;
+            constexpr uint32_t l_ParentCount = 1024;
+            constexpr uint32_t l_ChildrenPerParent = 256;
+
+            // The owning thread helps while waiting, so the largest run uses every hardware thread.
+            const uint32_t l_MaxWorkerCount = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+
+            bool l_IsValid = true;
+            for (uint32_t l_WorkerCount = 1; ; l_WorkerCount = std::min(l_WorkerCount * 2, l_MaxWorkerCount))
+            {
+                Engine::JobSystem l_JobSystem(l_WorkerCount);
+                const std::string l_Prefix = "workers_" + std::to_string(l_WorkerCount);
+
+                // Flat submission from the main thread: measures push/steal overhead for tiny jobs.
+                {
+                    const std::vector<double> l_Seconds = MeasureRepeated([&l_JobSystem, &l_IsValid]()
+                        {
+                            std::atomic<uint32_t> l_Executed{ 0 };
+                            Engine::JobCounter l_Counter;
+
+                            l_JobSystem.ResetStats();
+                            for (uint32_t i = 0; i < l_FlatJobCount; ++i)
+                            {
+                                l_JobSystem.Submit([&l_Executed]()
+                                    {
+                                        l_Executed.fetch_add(1, std::memory_order_relaxed);
+                                    }, &l_Counter);
+                            }
+                            l_JobSystem.WaitForCounter(l_Counter);
+
+                            l_IsValid = l_IsValid && l_Executed.load() == l_FlatJobCount;
+                        });
+
+                    ReportSchedulerStats(l_Prefix + ".flat", l_Seconds, l_FlatJobCount, l_JobSystem.GetStats());
+                }
+
+                // Nested fan-out: workers spawn children, which is the shape chunk pipelines produce.
+                {
+                    const std::vector<double> l_Seconds = MeasureRepeated([&l_JobSystem, &l_IsValid]()
+                        {
+                            std::atomic<uint32_t> l_Executed{ 0 };
+                            Engine::JobCounter l_Counter;
+
+                            l_JobSystem.ResetStats();
+                            for (uint32_t i = 0; i < l_ParentCount; ++i)
+                            {
+                                l_JobSystem.Submit([&l_JobSystem, &l_Executed, &l_Counter]()
+                                    {
+                                        for (uint32_t j = 0; j < l_ChildrenPerParent; ++j)
+                                        {
+                                            l_JobSystem.Submit([&l_Executed]()
+                                                {
+                                                    l_Executed.fetch_add(1, std::memory_order_relaxed);
+                                                }, &l_Counter);
+                                        }
+                                    }, &l_Counter);
+                            }
+                            l_JobSystem.WaitForCounter(l_Counter);
+
+                            l_IsValid = l_IsValid && l_Executed.load() == l_ParentCount * l_ChildrenPerParent;
+                        });
+
+                    ReportSchedulerStats(l_Prefix + ".nested", l_Seconds, l_ParentCount * (l_ChildrenPerParent + 1), l_JobSystem.GetStats());
+                }
+
+                // Dependency chains: each stage waits on the previous stage's counter.
+                {
+                    constexpr uint32_t l_StageCount = 64;
+                    constexpr uint32_t l_JobsPerStage = 1024;
+                    constexpr uint32_t l_BatchSize = 16;
+
+                    const std::vector<double> l_Seconds = MeasureRepeated([&l_JobSystem, &l_IsValid]()
+                        {
+                            std::atomic<uint32_t> l_Executed{ 0 };
+                            Engine::JobCounter l_Counters[l_StageCount];
+
+                            l_JobSystem.ResetStats();
+                            l_JobSystem.ParallelFor(l_JobsPerStage, l_BatchSize, [&l_Executed](uint32_t begin, uint32_t end)
+                                {
+                                    l_Executed.fetch_add(end - begin, std::memory_order_relaxed);
+                                }, &l_Counters[0]);
+                            for (uint32_t l_Stage = 1; l_Stage < l_StageCount; ++l_Stage)
+                            {
+                                l_JobSystem.SubmitAfter(l_Counters[l_Stage - 1], [&l_JobSystem, &l_Executed, &l_Counters, l_Stage]()
+                                    {
+                                        l_JobSystem.ParallelFor(l_JobsPerStage, l_BatchSize, [&l_Executed](uint32_t begin, uint32_t end)
+                                            {
+                                                l_Executed.fetch_add(end - begin, std::memory_order_relaxed);
+                                            }, &l_Counters[l_Stage]);
+                                    }, &l_Counters[l_Stage]);
+                            }
+                            l_JobSystem.WaitForCounter(l_Counters[l_StageCount - 1]);
+
+                            l_IsValid = l_IsValid && l_Executed.load() == l_StageCount * l_JobsPerStage;
+                        });
+
+                    ReportSchedulerStats(l_Prefix + ".dependencies", l_Seconds, l_StageCount * (l_JobsPerStage / l_BatchSize) + l_StageCount - 1, l_JobSystem.GetStats());
+                }
+
+                // Counter lifetime: short-lived stack counters are waited on and destroyed immediately, which
+                // races the last completing worker. A waiter returning early shows up as a wrong count or a crash.
+                {
+                    constexpr uint32_t l_RoundCount = 1u << 14;
+                    constexpr uint32_t l_JobsPerRound = 4;
+
+                    const std::vector<double> l_Seconds = MeasureRepeated([&l_JobSystem, &l_IsValid]()
+                        {
+                            uint32_t l_MismatchCount = 0;
+
+                            l_JobSystem.ResetStats();
+                            for (uint32_t l_Round = 0; l_Round < l_RoundCount; ++l_Round)
+                            {
+                                std::atomic<uint32_t> l_Executed{ 0 };
+                                Engine::JobCounter l_Counter;
+                                for (uint32_t i = 0; i < l_JobsPerRound; ++i)
+                                {
+                                    l_JobSystem.Submit([&l_Executed]()
+                                        {
+                                            l_Executed.fetch_add(1, std::memory_order_relaxed);
+                                        }, &l_Counter);
+                                }
+                                l_JobSystem.WaitForCounter(l_Counter);
+
+                                l_MismatchCount += l_Executed.load(std::memory_order_relaxed) != l_JobsPerRound ? 1 : 0;
+                            }
+
+                            l_IsValid = l_IsValid && l_MismatchCount == 0;
+                        });
+
+                    ReportSchedulerStats(l_Prefix + ".counter_lifetime", l_Seconds, l_RoundCount * l_JobsPerRound, l_JobSystem.GetStats());
+                }
+
+                if (l_WorkerCount == l_MaxWorkerCount)
+                {
+                    break;
+                }
+            }
+
+            // Shutdown with work still queued: the destructor runs it, so the counter and its continuation complete.
+            {
+                constexpr uint32_t l_QueuedJobCount = 4096;
+
+                std::atomic<uint32_t> l_Executed{ 0 };
+                std::atomic<bool> l_IsContinuationRun{ false };
+                Engine::JobCounter l_Counter;
+                {
+                    Engine::JobSystem l_JobSystem(l_MaxWorkerCount);
+                    for (uint32_t i = 0; i < l_QueuedJobCount; ++i)
+                    {
+                        l_JobSystem.Submit([&l_Executed]()
+                            {
+                                l_Executed.fetch_add(1, std::memory_order_relaxed);
+                            }, &l_Counter);
+                    }
+                    l_JobSystem.SubmitAfter(l_Counter, [&l_IsContinuationRun]()
+                        {
+                            l_IsContinuationRun.store(true, std::memory_order_relaxed);
+                        });
+                }
+
+                const bool l_IsDrained = l_Executed.load() == l_QueuedJobCount && l_Counter.IsComplete() && l_IsContinuationRun.load();
+                ReportMetric("shutdown.queued_jobs_run", l_IsDrained ? 1.0 : 0.0, "bool");
+                l_IsValid = l_IsValid && l_IsDrained;
+            }
+
+            return l_IsValid;
+        }
+    }
+
+    REGISTER_BENCHMARK("JobSystem", "Job throughput and steal rates from 1 worker up to all hardware threads", RunJobSystemBenchmark);
+}
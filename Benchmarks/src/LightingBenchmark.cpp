@@ -0,0 +1,255 @@
+#include "Benchmark.h"
+
+#include "Engine/Jobs/JobSystem.h"
+#include "Engine/World/BlockRegistry.h"
+#include "Engine/World/LightEngine.h"
+#include "Engine/World/World.h"
+#include "Engine/World/WorldGenerator.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Benchmarks
+{
+    namespace
+    {
+        constexpr int32_t s_RegionSize = 8;
+        constexpr int32_t s_ChunkLayers = 6;
+
+        // FNV-1a over every light byte in coordinate order; equal hashes mean identical light.
+        uint64_t HashLight(const Engine::World& world, const std::vector<Engine::ChunkCoord>& coords)
+        {
+            uint64_t l_Hash = 0xCBF29CE484222325ull;
+            for (const Engine::ChunkCoord& it_Coord : coords)
+            {
+                const Engine::Chunk* l_Chunk = world.FindChunk(it_Coord);
+                if (l_Chunk == nullptr || !l_Chunk->GetLight().IsLit())
+                {
+                    return 0;
+                }
+
+                for (uint32_t i = 0; i < Engine::Chunk::Volume; ++i)
+                {
+                    l_Hash = (l_Hash ^ l_Chunk->GetLight().Get(i)) * 0x100000001B3ull;
+                }
+            }
+
+            return l_Hash;
+        }
+
+        // Fresh unlit copies of the generated chunks, so every run starts from the same blocks.
+        void FillWorld(Engine::World& world, const std::vector<std::unique_ptr<Engine::Chunk>>& chunks)
+        {
+            for (const std::unique_ptr<Engine::Chunk>& it_Chunk : chunks)
+            {
+                std::unique_ptr<Engine::Chunk> l_Copy = std::make_unique<Engine::Chunk>(*it_Chunk);
+                l_Copy->GetLight() = Engine::LightStorage();
+                world.InsertChunk(std::move(l_Copy));
+            }
+        }
+
+        void LightWorld(Engine::LightEngine& lightEngine, Engine::JobSystem& jobSystem, const std::vector<Engine::ChunkCoord>& coords)
+        {
+            std::shared_ptr<Engine::LightBatch> l_Batch = lightEngine.LightChunksAsync(jobSystem, coords);
+            jobSystem.WaitForCounter(l_Batch->GetCounter());
+            lightEngine.Merge(*l_Batch);
+        }
+
+        int32_t FindSurface(const Engine::World& world, int32_t worldX, int32_t worldZ)
+        {
+            for (int32_t y = s_ChunkLayers * Engine::Chunk::Size - 1; y >= 0; --y)
+            {
+                if (world.GetBlock(worldX, y, worldZ) != Engine::AirBlockId)
+                {
+                    return y;
+                }
+            }
+
+            return 0;
+        }
+
+        bool RunLightingBenchmark()
+        {
+            Engine::BlockRegistry l_Registry;
+            if (!l_Registry.LoadFromFile(std::filesystem::path(BENCHMARK_ASSET_DIRECTORY) / "Blocks" / "Blocks.yaml"))
+            {
+                return false;
+            }
+
+            const Engine::BlockId l_Torch = l_Registry.FindBlock("torch");
+            const Engine::BlockId l_Stone = l_Registry.FindBlock("stone");
+            if (l_Torch == Engine::BlockRegistry::InvalidBlockId || l_Stone == Engine::BlockRegistry::InvalidBlockId)
+            {
+                return false;
+            }
+
+            std::vector<Engine::ChunkCoord> l_Coords;
+            for (int32_t z = 0; z < s_RegionSize; ++z)
+            {
+                for (int32_t x = 0; x < s_RegionSize; ++x)
+                {
+                    for (int32_t y = 0; y < s_ChunkLayers; ++y)
+                    {
+                        l_Coords.push_back({ x - s_RegionSize / 2, y, z - s_RegionSize / 2 });
+                    }
+                }
+            }
+
+            const uint32_t l_MaxWorkerCount = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+
+            // Default generator ids match the file order of Blocks.yaml.
+            Engine::WorldGeneratorSettings l_Settings;
+            l_Settings.Seed = 20240611;
+            const Engine::WorldGenerator l_Generator(l_Settings);
+            std::vector<std::unique_ptr<Engine::Chunk>> l_Generated;
+            {
+                Engine::JobSystem l_JobSystem(l_MaxWorkerCount);
+                std::shared_ptr<Engine::WorldGenerationBatch> l_Batch = l_Generator.GenerateAsync(l_JobSystem, l_Coords);
+                l_JobSystem.WaitForCounter(l_Batch->GetCounter());
+                l_Generated = std::move(l_Batch->GetChunks());
+            }
+
+            // Initial lighting of the whole region: isolated chunks on workers, then the border merge.
+            bool l_IsValid = true;
+            uint64_t l_ReferenceHash = 0;
+            double l_FullLightSeconds = 0.0;
+            for (uint32_t l_WorkerCount : { 1u, l_MaxWorkerCount })
+            {
+                Engine::JobSystem l_JobSystem(l_WorkerCount);
+                const std::string l_Prefix = "workers_" + std::to_string(l_WorkerCount);
+
+                std::vector<double> l_Seconds;
+                uint64_t l_Hash = 0;
+                for (uint32_t i = 0; i < GetBenchmarkSettings().Repetitions; ++i)
+                {
+                    Engine::World l_World;
+                    Engine::LightEngine l_LightEngine(l_World, l_Registry);
+                    FillWorld(l_World, l_Generated);
+
+                    Stopwatch l_Stopwatch;
+                    LightWorld(l_LightEngine, l_JobSystem, l_Coords);
+                    l_Seconds.push_back(l_Stopwatch.GetElapsedSeconds());
+                    l_Hash = HashLight(l_World, l_Coords);
+                }
+                ReportSamples(l_Prefix + ".initial_ms", ToPerItem(l_Seconds, 1.0, 1000.0), "ms");
+                ReportSamples(l_Prefix + ".chunks_per_second", ToRates(l_Seconds, static_cast<double>(l_Coords.size())), "chunks/s");
+                l_FullLightSeconds = Summarize(l_Seconds).Median;
+
+                // Worker count must never change the light.
+                if (l_ReferenceHash == 0)
+                {
+                    l_ReferenceHash = l_Hash;
+                }
+                l_IsValid = l_IsValid && l_Hash != 0 && l_Hash == l_ReferenceHash;
+
+                if (l_MaxWorkerCount == 1)
+                {
+                    break;
+                }
+            }
+
+            Engine::JobSystem l_JobSystem(l_MaxWorkerCount);
+            Engine::World l_World;
+            Engine::LightEngine l_LightEngine(l_World, l_Registry);
+            FillWorld(l_World, l_Generated);
+            LightWorld(l_LightEngine, l_JobSystem, l_Coords);
+
+            size_t l_LightBytes = 0;
+            for (const Engine::ChunkCoord& it_Coord : l_Coords)
+            {
+                l_LightBytes += l_World.FindChunk(it_Coord)->GetLight().GetMemoryUsage();
+            }
+            ReportMetric("light_bytes_per_chunk", static_cast<double>(l_LightBytes) / static_cast<double>(l_Coords.size()), "bytes");
+
+            // A torch placed in open air above the middle of the region and taken away again.
+            const int32_t l_SurfaceY = FindSurface(l_World, 0, 0);
+            const int32_t l_TorchY = l_SurfaceY + 3;
+            const uint64_t l_LitHash = HashLight(l_World, l_Coords);
+            uint8_t l_TorchLevel = 0;
+            Engine::LightPropagationStats l_PlaceStats;
+            Engine::LightPropagationStats l_RemoveStats;
+            const std::vector<double> l_TorchSeconds = MeasureRepeated([&]()
+                {
+                    l_World.SetBlock(0, l_TorchY, 0, l_Torch);
+                    l_LightEngine.OnBlockChanged(0, l_TorchY, 0);
+                    l_PlaceStats = l_LightEngine.Propagate();
+                    l_TorchLevel = l_LightEngine.GetBlockLight(1, l_TorchY, 0);
+
+                    l_World.SetBlock(0, l_TorchY, 0, Engine::AirBlockId);
+                    l_LightEngine.OnBlockChanged(0, l_TorchY, 0);
+                    l_RemoveStats = l_LightEngine.Propagate();
+                });
+            ReportSamples("torch.edit_us", ToPerItem(l_TorchSeconds, 2.0, 1.0e6), "us");
+            ReportMetric("torch.place_voxels_visited", l_PlaceStats.VoxelsVisited, "voxels");
+            ReportMetric("torch.remove_voxels_visited", l_RemoveStats.VoxelsVisited, "voxels");
+            ReportMetric("full_relight_vs_edit", l_FullLightSeconds / (Summarize(l_TorchSeconds).Median / 2.0), "x");
+
+            const bool l_TorchRestores = l_TorchLevel == 13 && HashLight(l_World, l_Coords) == l_LitHash;
+            ReportMetric("torch_restores_light", l_TorchRestores ? 1.0 : 0.0, "bool");
+            l_IsValid = l_IsValid && l_TorchRestores;
+
+            // A 16x16 roof casting a shadow, then one ceiling block broken to let a shaft of sky back in.
+            int32_t l_RoofY = 0;
+            for (int32_t z = -8; z < 8; ++z)
+            {
+                for (int32_t x = -8; x < 8; ++x)
+                {
+                    l_RoofY = std::max(l_RoofY, FindSurface(l_World, x, z) + 4);
+                }
+            }
+            l_RoofY = std::min(l_RoofY, s_ChunkLayers * Engine::Chunk::Size - 2);
+
+            Stopwatch l_RoofStopwatch;
+            for (int32_t z = -8; z < 8; ++z)
+            {
+                for (int32_t x = -8; x < 8; ++x)
+                {
+                    l_World.SetBlock(x, l_RoofY, z, l_Stone);
+                    l_LightEngine.OnBlockChanged(x, l_RoofY, z);
+                }
+            }
+            const Engine::LightPropagationStats l_RoofStats = l_LightEngine.Propagate();
+            ReportMetric("roof.place_ms", l_RoofStopwatch.GetElapsedSeconds() * 1000.0, "ms");
+            ReportMetric("roof.voxels_visited", l_RoofStats.VoxelsVisited, "voxels");
+            const uint8_t l_ShadedSky = l_LightEngine.GetSkyLight(0, l_RoofY - 1, 0);
+
+            Stopwatch l_BreakStopwatch;
+            l_World.SetBlock(0, l_RoofY, 0, Engine::AirBlockId);
+            l_LightEngine.OnBlockChanged(0, l_RoofY, 0);
+            const Engine::LightPropagationStats l_BreakStats = l_LightEngine.Propagate();
+            ReportMetric("roof.break_us", l_BreakStopwatch.GetElapsedSeconds() * 1.0e6, "us");
+            ReportMetric("roof.break_voxels_visited", l_BreakStats.VoxelsVisited, "voxels");
+
+            const bool l_ShaftLit = l_ShadedSky < Engine::MaxLightLevel && l_LightEngine.GetSkyLight(0, l_RoofY - 1, 0) == Engine::MaxLightLevel;
+            ReportMetric("roof_shades_and_reopens", l_ShaftLit ? 1.0 : 0.0, "bool");
+            l_IsValid = l_IsValid && l_ShaftLit;
+
+            // After all those edits the light must equal lighting the edited blocks from scratch.
+            {
+                std::vector<std::unique_ptr<Engine::Chunk>> l_Edited;
+                for (const Engine::ChunkCoord& it_Coord : l_Coords)
+                {
+                    l_Edited.push_back(std::make_unique<Engine::Chunk>(*l_World.FindChunk(it_Coord)));
+                }
+
+                Engine::World l_Reference;
+                Engine::LightEngine l_ReferenceEngine(l_Reference, l_Registry);
+                FillWorld(l_Reference, l_Edited);
+                LightWorld(l_ReferenceEngine, l_JobSystem, l_Coords);
+
+                const bool l_Matches = HashLight(l_Reference, l_Coords) == HashLight(l_World, l_Coords);
+                ReportMetric("incremental_matches_full", l_Matches ? 1.0 : 0.0, "bool");
+                l_IsValid = l_IsValid && l_Matches;
+            }
+
+            return l_IsValid;
+        }
+    }
+
+    REGISTER_BENCHMARK("Lighting", "Initial sky and block light for an 8x8 column region, then incremental torch and roof edits checked against a full relight", RunLightingBenchmark);
+}
@@ -0,0 +1,208 @@
+#include "Benchmark.h"
+
+#include "Engine/Core/AsyncLogSink.h"
+#include "Engine/Core/Log.h"
+
+#include <spdlog/sinks/basic_file_sink.h>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace Benchmarks
+{
+    namespace
+    {
+        constexpr uint32_t s_ThreadCount = 4;
+        constexpr uint32_t s_MessagesPerThread = 20000;
+
+        uint64_t CountLines(const std::filesystem::path& path)
+        {
+            std::ifstream l_Stream(path);
+            uint64_t l_LineCount = 0;
+            std::string l_Line;
+            while (std::getline(l_Stream, l_Line))
+            {
+                ++l_LineCount;
+            }
+
+            return l_LineCount;
+        }
+
+        // Worker threads log like meshing and generation jobs do.
+        void RunProducers(spdlog::logger& logger)
+        {
+            std::vector<std::thread> l_Threads;
+            for (uint32_t it_Thread = 0; it_Thread < s_ThreadCount; ++it_Thread)
+            {
+                l_Threads.emplace_back([&logger, it_Thread]()
+                    {
+                        for (uint32_t i = 0; i < s_MessagesPerThread; ++i)
+                        {
+                            logger.info("Worker {} meshed chunk ({}, {}, {}) into {} quads", it_Thread, i & 31, (i >> 5) & 7, i >> 8, i * 7 % 4096);
+                        }
+                    });
+            }
+
+            for (std::thread& it_Thread : l_Threads)
+            {
+                it_Thread.join();
+            }
+        }
+
+        bool RunLoggingBenchmark()
+        {
+            const std::filesystem::path l_Directory = std::filesystem::temp_directory_path() / "LoggingBenchmark";
+            std::error_code l_Error;
+            std::filesystem::remove_all(l_Directory, l_Error);
+            std::filesystem::create_directories(l_Directory, l_Error);
+
+            // Every section keeps one sink across its runs, so files and drop counts accumulate over all of them.
+            const BenchmarkSettings& l_Settings = GetBenchmarkSettings();
+            const uint64_t l_MessageCount = uint64_t{ s_ThreadCount } * s_MessagesPerThread;
+            const uint64_t l_TotalMessageCount = l_MessageCount * (l_Settings.WarmupRuns + l_Settings.Repetitions);
+            bool l_IsValid = true;
+
+            // The previous configuration: a mutex-guarded file sink flushed after every message.
+            {
+                const std::filesystem::path l_Path = l_Directory / "sync.txt";
+                auto a_Sink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(l_Path.string(), true);
+                spdlog::logger l_Logger("SYNC", a_Sink);
+                l_Logger.flush_on(spdlog::level::trace);
+
+                const std::vector<double> l_Seconds = MeasureRepeated([&l_Logger]()
+                    {
+                        RunProducers(l_Logger);
+                    });
+                l_Logger.flush();
+
+                ReportSamples("sync.ns_per_message", ToPerItem(l_Seconds, static_cast<double>(l_MessageCount), 1e9), "ns");
+                l_IsValid = l_IsValid && CountLines(l_Path) == l_TotalMessageCount;
+            }
+
+            // Async with the blocking policy: producers only format and enqueue, nothing may be lost.
+            {
+                const std::filesystem::path l_Path = l_Directory / "async.txt";
+                auto a_File = std::make_shared<spdlog::sinks::basic_file_sink_mt>(l_Path.string(), true);
+                auto a_Sink = std::make_shared<Engine::AsyncLogSink>(std::vector<spdlog::sink_ptr>{ a_File }, 8192, Engine::LogOverflowPolicy::Block);
+                spdlog::logger l_Logger("ASYNC", a_Sink);
+                l_Logger.flush_on(spdlog::level::err);
+
+                // Each run is timed twice: once the producers return, and once everything has reached the file.
+                std::vector<double> l_DrainedSeconds;
+                const std::vector<double> l_ProducerSeconds = CollectRepeated([&l_Logger, &l_DrainedSeconds]()
+                    {
+                        Stopwatch l_Stopwatch;
+                        RunProducers(l_Logger);
+                        const double l_Seconds = l_Stopwatch.GetElapsedSeconds();
+                        l_Logger.flush();
+                        l_DrainedSeconds.push_back(l_Stopwatch.GetElapsedSeconds());
+
+                        return l_Seconds;
+                    });
+                l_DrainedSeconds.erase(l_DrainedSeconds.begin(), l_DrainedSeconds.end() - l_ProducerSeconds.size());
+
+                ReportSamples("async_block.ns_per_message", ToPerItem(l_ProducerSeconds, static_cast<double>(l_MessageCount), 1e9), "ns");
+                ReportSamples("async_block.ms_until_on_disk", ToPerItem(l_DrainedSeconds, 1.0, 1e3), "ms");
+                l_IsValid = l_IsValid && CountLines(l_Path) == l_TotalMessageCount;
+            }
+
+            // Async with a deliberately small queue and the drop policy: producers never wait, and every message
+            // is either written or counted as dropped.
+            {
+                const std::filesystem::path l_Path = l_Directory / "drop.txt";
+                auto a_File = std::make_shared<spdlog::sinks::basic_file_sink_mt>(l_Path.string(), true);
+                auto a_Sink = std::make_shared<Engine::AsyncLogSink>(std::vector<spdlog::sink_ptr>{ a_File }, 256, Engine::LogOverflowPolicy::Drop);
+                spdlog::logger l_Logger("DROP", a_Sink);
+
+                const std::vector<double> l_Seconds = MeasureRepeated([&l_Logger]()
+                    {
+                        RunProducers(l_Logger);
+                    });
+                a_Sink->Stop();
+
+                const uint64_t l_DroppedCount = a_Sink->GetDroppedCount();
+                const uint64_t l_LineCount = CountLines(l_Path);
+
+                // Each drop report adds one line of its own.
+                const uint64_t l_WrittenCount = l_TotalMessageCount - l_DroppedCount;
+                ReportSamples("async_drop.ns_per_message", ToPerItem(l_Seconds, static_cast<double>(l_MessageCount), 1e9), "ns");
+                ReportMetric("async_drop.dropped_fraction", static_cast<double>(l_DroppedCount) / l_TotalMessageCount, "ratio");
+                l_IsValid = l_IsValid && l_LineCount >= l_WrittenCount && l_LineCount - l_WrittenCount <= l_TotalMessageCount;
+            }
+
+            // Stopping the sink while producers are blocked on a full queue neither hangs them nor loses messages.
+            {
+                const std::filesystem::path l_Path = l_Directory / "stop.txt";
+                auto a_File = std::make_shared<spdlog::sinks::basic_file_sink_mt>(l_Path.string(), true);
+                auto a_Sink = std::make_shared<Engine::AsyncLogSink>(std::vector<spdlog::sink_ptr>{ a_File }, 16, Engine::LogOverflowPolicy::Block);
+                spdlog::logger l_Logger("STOP", a_Sink);
+
+                std::thread l_Producers([&l_Logger]()
+                    {
+                        RunProducers(l_Logger);
+                    });
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                a_Sink->Stop();
+                l_Producers.join();
+                l_Logger.flush();
+
+                l_IsValid = l_IsValid && CountLines(l_Path) == l_MessageCount;
+            }
+
+            // A message longer than a queue cell is written whole and after the ones queued before it.
+            {
+                const std::filesystem::path l_Path = l_Directory / "oversized.txt";
+                auto a_File = std::make_shared<spdlog::sinks::basic_file_sink_mt>(l_Path.string(), true);
+                a_File->set_pattern("%v");
+                auto a_Sink = std::make_shared<Engine::AsyncLogSink>(std::vector<spdlog::sink_ptr>{ a_File }, 256, Engine::LogOverflowPolicy::Block);
+                spdlog::logger l_Logger("OVERSIZED", a_Sink);
+
+                const std::string l_LongText(Engine::AsyncLogSink::MaxPayloadSize * 3, 'x');
+                l_Logger.info("before");
+                l_Logger.info(l_LongText);
+                l_Logger.info("after");
+                a_Sink->Stop();
+
+                std::ifstream l_Stream(l_Path);
+                std::string l_First;
+                std::string l_Second;
+                std::string l_Third;
+                std::getline(l_Stream, l_First);
+                std::getline(l_Stream, l_Second);
+                std::getline(l_Stream, l_Third);
+                l_IsValid = l_IsValid && l_First == "before" && l_Second == l_LongText && l_Third == "after";
+            }
+
+            // A call below the runtime level costs one atomic load and no formatting.
+            {
+                auto a_File = std::make_shared<spdlog::sinks::basic_file_sink_mt>((l_Directory / "filtered.txt").string(), true);
+                spdlog::logger l_Logger("FILTERED", a_File);
+                l_Logger.set_level(spdlog::level::info);
+
+                constexpr uint32_t l_CallCount = 10000000;
+                const std::vector<double> l_Seconds = MeasureRepeated([&l_Logger]()
+                    {
+                        for (uint32_t i = 0; i < l_CallCount; ++i)
+                        {
+                            l_Logger.trace("Mouse moved to ({}, {})", i, i + 1);
+                        }
+                    });
+                ReportSamples("filtered_trace.ns_per_call", ToPerItem(l_Seconds, l_CallCount, 1e9), "ns");
+            }
+
+            ReportMetric("all_messages_accounted", l_IsValid ? 1.0 : 0.0, "bool");
+            std::filesystem::remove_all(l_Directory, l_Error);
+
+            return l_IsValid;
+        }
+    }
+
+    REGISTER_BENCHMARK("Logging", "Four worker threads logging through a flush-per-message file sink versus the async queue sink", RunLoggingBenchmark);
+}
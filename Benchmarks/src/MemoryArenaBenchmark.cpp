@@ -0,0 +1,134 @@
+#include "Benchmark.h"
+
+#include "Engine/Memory/FrameAllocator.h"
+#include "Engine/Memory/LinearArena.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <memory_resource>
+#include <vector>
+
+namespace Benchmarks
+{
+    namespace
+    {
+        // Roughly what one frame of temporary lists costs: many small arrays of mixed sizes.
+        constexpr uint32_t s_AllocationsPerFrame = 4096;
+        constexpr uint32_t s_FrameCount = 256;
+
+        size_t GetAllocationSize(uint32_t index)
+        {
+            return 16 + (index * 37) % 240;
+        }
+
+        bool RunMemoryArenaBenchmark()
+        {
+            constexpr double l_AllocationsPerRun = static_cast<double>(s_AllocationsPerFrame) * s_FrameCount;
+            bool l_IsValid = true;
+
+            // Bump allocation reset once per frame, the frame arena's steady state.
+            Engine::LinearArena l_Arena(1024 * 1024);
+            uintptr_t l_Checksum = 0;
+            const std::vector<double> l_ArenaSeconds = MeasureRepeated([&l_Arena, &l_Checksum]()
+                {
+                    for (uint32_t l_Frame = 0; l_Frame < s_FrameCount; ++l_Frame)
+                    {
+                        for (uint32_t i = 0; i < s_AllocationsPerFrame; ++i)
+                        {
+                            l_Checksum += reinterpret_cast<uintptr_t>(l_Arena.Allocate(GetAllocationSize(i), 16));
+                        }
+                        l_Arena.Reset();
+                    }
+                });
+            ReportSamples("arena.allocate", ToPerItem(l_ArenaSeconds, l_AllocationsPerRun, 1.0e9), "ns/alloc");
+
+            // The same pattern through malloc/free, which is what the arena replaces.
+            std::vector<void*> l_Pointers(s_AllocationsPerFrame);
+            const std::vector<double> l_HeapSeconds = MeasureRepeated([&l_Pointers, &l_Checksum]()
+                {
+                    for (uint32_t l_Frame = 0; l_Frame < s_FrameCount; ++l_Frame)
+                    {
+                        for (uint32_t i = 0; i < s_AllocationsPerFrame; ++i)
+                        {
+                            l_Pointers[i] = std::malloc(GetAllocationSize(i));
+                            l_Checksum += reinterpret_cast<uintptr_t>(l_Pointers[i]);
+                        }
+                        for (void* it_Pointer : l_Pointers)
+                        {
+                            std::free(it_Pointer);
+                        }
+                    }
+                });
+            ReportSamples("heap.allocate", ToPerItem(l_HeapSeconds, l_AllocationsPerRun, 1.0e9), "ns/alloc");
+
+            // Growth: a frame that overflows chains blocks, and Reset merges them so the next frame fits in one.
+            {
+                Engine::LinearArena l_Growing(4096);
+                size_t l_Requested = 0;
+                for (uint32_t i = 0; i < s_AllocationsPerFrame; ++i)
+                {
+                    l_Growing.Allocate(GetAllocationSize(i), 16);
+                    l_Requested += GetAllocationSize(i);
+                }
+
+                const size_t l_HighWater = l_Growing.GetHighWaterBytes();
+                l_IsValid = l_IsValid && l_Growing.GetBlockCount() > 1 && l_HighWater >= l_Requested;
+
+                l_Growing.Reset();
+                l_IsValid = l_IsValid && l_Growing.GetBlockCount() == 1 && l_Growing.GetUsedBytes() == 0 && l_Growing.GetCapacity() >= l_HighWater;
+
+                for (uint32_t i = 0; i < s_AllocationsPerFrame; ++i)
+                {
+                    l_Growing.Allocate(GetAllocationSize(i), 16);
+                }
+                l_IsValid = l_IsValid && l_Growing.GetBlockCount() == 1;
+
+                ReportMetric("growth.high_water", static_cast<double>(l_HighWater), "bytes");
+                ReportMetric("growth.capacity_after_reset", static_cast<double>(l_Growing.GetCapacity()), "bytes");
+            }
+
+            // Scratch scopes roll back on exit, including nested ones.
+            {
+                Engine::LinearArena& l_Scratch = Engine::GetThreadScratchArena();
+                const size_t l_UsedBefore = l_Scratch.GetUsedBytes();
+                {
+                    Engine::ScratchScope l_Outer;
+                    std::pmr::vector<uint32_t> l_Values(l_Outer.GetMemoryResource());
+                    l_Values.resize(1024, 7);
+                    {
+                        Engine::ScratchScope l_Inner;
+                        l_Inner.GetArena().AllocateArray<uint64_t>(4096);
+                    }
+                    l_IsValid = l_IsValid && l_Values.back() == 7;
+                }
+                l_IsValid = l_IsValid && l_Scratch.GetUsedBytes() == l_UsedBefore;
+            }
+
+            // Frame allocator telemetry: a spike frame is counted as an overflow and raises the peak.
+            {
+                Engine::FrameAllocator::Initialize(64 * 1024);
+                for (uint32_t l_Frame = 0; l_Frame < 4; ++l_Frame)
+                {
+                    Engine::FrameAllocator::BeginFrame();
+                    std::pmr::vector<uint8_t> l_Bytes = Engine::MakeFrameVector<uint8_t>(l_Frame == 2 ? 256 * 1024 : 1024);
+                    l_Checksum += l_Bytes.capacity();
+                }
+                Engine::FrameAllocator::BeginFrame();
+
+                const Engine::FrameMemoryStats l_Stats = Engine::FrameAllocator::GetStats();
+                l_IsValid = l_IsValid && l_Stats.OverflowFrameCount == 1 && l_Stats.PeakFrameBytes >= 256 * 1024 && l_Stats.LastFrameBytes < 64 * 1024;
+
+                ReportMetric("frame.peak_bytes", static_cast<double>(l_Stats.PeakFrameBytes), "bytes");
+                ReportMetric("frame.capacity", static_cast<double>(l_Stats.CapacityBytes), "bytes");
+                Engine::FrameAllocator::Shutdown();
+            }
+
+            // Keep the pointers observable so the optimizer cannot drop the loops.
+            l_IsValid = l_IsValid && l_Checksum != 0;
+
+            return l_IsValid;
+        }
+    }
+
+    REGISTER_BENCHMARK("MemoryArena", "Frame and scratch arena allocation against malloc, plus reset, growth and rollback checks", RunMemoryArenaBenchmark);
+}
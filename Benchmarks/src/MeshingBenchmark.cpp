@@ -0,0 +1,172 @@
+#include "Benchmark.h"
+
+#include "Engine/World/ChunkMesher.h"
+
+#include <array>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Benchmarks
+{
+    namespace
+    {
+        using TerrainFunction = std::function<Engine::BlockId(int32_t, int32_t, int32_t)>;
+
+        Engine::MeshingBlockTable CreateBlockTable()
+        {
+            // Air, stone, dirt, grass and glass: enough to exercise opaque, multi-tile and transparent paths.
+            Engine::MeshingBlockTable l_Table;
+            l_Table.BlockFlags = { 0, 3, 3, 3, Engine::MeshingBlockTable::FlagVisible };
+            l_Table.FaceTiles =
+            {
+                0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1,
+                2, 2, 2, 2, 2, 2,
+                3, 3, 0, 2, 3, 3,
+                4, 4, 4, 4, 4, 4
+            };
+
+            return l_Table;
+        }
+
+        // Fill the 3x3x3 neighbourhood around chunk (0, 0, 0) and return the chunks in neighbour order.
+        std::vector<std::unique_ptr<Engine::Chunk>> CreateNeighbourhood(const TerrainFunction& terrain)
+        {
+            std::vector<std::unique_ptr<Engine::Chunk>> l_Chunks;
+            for (int32_t l_ChunkY = -1; l_ChunkY <= 1; ++l_ChunkY)
+            {
+                for (int32_t l_ChunkZ = -1; l_ChunkZ <= 1; ++l_ChunkZ)
+                {
+                    for (int32_t l_ChunkX = -1; l_ChunkX <= 1; ++l_ChunkX)
+                    {
+                        auto l_Chunk = std::make_unique<Engine::Chunk>(Engine::ChunkCoord{ l_ChunkX, l_ChunkY, l_ChunkZ });
+                        for (int32_t y = 0; y < Engine::Chunk::Size; ++y)
+                        {
+                            for (int32_t z = 0; z < Engine::Chunk::Size; ++z)
+                            {
+                                for (int32_t x = 0; x < Engine::Chunk::Size; ++x)
+                                {
+                                    l_Chunk->SetBlock(x, y, z, terrain(l_ChunkX * Engine::Chunk::Size + x, l_ChunkY * Engine::Chunk::Size + y, l_ChunkZ * Engine::Chunk::Size + z));
+                                }
+                            }
+                        }
+                        l_Chunk->Compact();
+                        l_Chunks.push_back(std::move(l_Chunk));
+                    }
+                }
+            }
+
+            return l_Chunks;
+        }
+
+        Engine::BlockId LayeredColumn(int32_t y, int32_t height)
+        {
+            if (y > height)
+            {
+                return Engine::AirBlockId;
+            }
+
+            return y == height ? 3 : (y > height - 4 ? 2 : 1);
+        }
+
+        // Total face area covered by the mesh; corner 2 of every quad carries its (width, height) texture extent.
+        uint32_t GetCoveredFaceCount(const Engine::ChunkMesh& mesh)
+        {
+            uint32_t l_Area = 0;
+            for (size_t l_Vertex = 2; l_Vertex < mesh.Vertices.size(); l_Vertex += 4)
+            {
+                const uint32_t l_TextureData = mesh.Vertices[l_Vertex].TextureData;
+                l_Area += ((l_TextureData >> 16) & 63) * ((l_TextureData >> 22) & 63);
+            }
+
+            return l_Area;
+        }
+
+        bool RunMeshingBenchmark()
+        {
+            const std::vector<std::pair<const char*, TerrainFunction>> l_Terrains =
+            {
+                { "flat", [](int32_t, int32_t y, int32_t) { return LayeredColumn(y, 8); } },
+                { "hills", [](int32_t x, int32_t y, int32_t z)
+                    {
+                        const int32_t l_Height = static_cast<int32_t>(8.0 + 12.0 * std::sin(x * 0.11) * std::cos(z * 0.07));
+                        return LayeredColumn(y, l_Height);
+                    } },
+                { "caves", [](int32_t x, int32_t y, int32_t z) -> Engine::BlockId
+                    {
+                        const double l_Density = std::sin(x * 0.19) + std::sin(y * 0.23 + 1.0) + std::sin(z * 0.17 + 2.0);
+                        return l_Density > 0.4 ? Engine::AirBlockId : (l_Density > 0.2 ? 4 : 1);
+                    } },
+                { "checkerboard", [](int32_t x, int32_t y, int32_t z) -> Engine::BlockId
+                    {
+                        return ((x + y + z) & 1) != 0 ? 1 : Engine::AirBlockId;
+                    } },
+            };
+
+            const Engine::MeshingBlockTable l_Table = CreateBlockTable();
+            // Chunks meshed per timed repetition.
+            constexpr int32_t l_Iterations = 16;
+            bool l_IsValid = true;
+
+            for (const auto& [it_Name, it_Terrain] : l_Terrains)
+            {
+                const std::vector<std::unique_ptr<Engine::Chunk>> l_Chunks = CreateNeighbourhood(it_Terrain);
+                std::array<const Engine::Chunk*, 27> l_Neighbours{};
+                for (size_t i = 0; i < l_Chunks.size(); ++i)
+                {
+                    l_Neighbours[i] = l_Chunks[i].get();
+                }
+
+                Engine::PaddedChunkView l_View;
+                const std::vector<double> l_ViewSeconds = MeasureRepeated([&l_View, &l_Neighbours]()
+                    {
+                        for (int32_t i = 0; i < l_Iterations; ++i)
+                        {
+                            l_View.Build(l_Neighbours);
+                        }
+                    });
+                ReportSamples(std::string(it_Name) + ".padded_view", ToRates(l_ViewSeconds, l_Iterations), "views/s");
+
+                uint32_t l_GreedyQuads = 0;
+                uint32_t l_CulledQuads = 0;
+                uint32_t l_GreedyArea = 0;
+                for (bool l_IsGreedy : { false, true })
+                {
+                    Engine::ChunkMesherSettings l_Settings;
+                    l_Settings.Greedy = l_IsGreedy;
+                    Engine::ChunkMesher l_Mesher(l_Settings);
+                    Engine::ChunkMesh l_Mesh;
+
+                    const std::vector<double> l_Seconds = MeasureRepeated([&l_Mesher, &l_View, &l_Table, &l_Mesh]()
+                        {
+                            for (int32_t i = 0; i < l_Iterations; ++i)
+                            {
+                                l_Mesher.Mesh(l_View, l_Table, l_Mesh);
+                            }
+                        });
+
+                    const std::string l_Prefix = std::string(it_Name) + (l_IsGreedy ? ".greedy" : ".culled");
+                    ReportSamples(l_Prefix + ".chunks_per_second", ToRates(l_Seconds, l_Iterations), "chunks/s");
+                    ReportMetric(l_Prefix + ".vertices_per_chunk", static_cast<double>(l_Mesh.Vertices.size()), "vertices");
+                    ReportMetric(l_Prefix + ".bytes_per_chunk", static_cast<double>(l_Mesh.Vertices.size() * sizeof(Engine::PackedChunkVertex)), "bytes");
+
+                    (l_IsGreedy ? l_GreedyQuads : l_CulledQuads) = l_Mesh.GetQuadCount();
+                    if (l_IsGreedy)
+                    {
+                        l_GreedyArea = GetCoveredFaceCount(l_Mesh);
+                    }
+                }
+
+                // Greedy quads must cover exactly the faces the per-face mesher emits, never more quads.
+                l_IsValid = l_IsValid && l_GreedyQuads <= l_CulledQuads && l_CulledQuads > 0 && l_GreedyArea == l_CulledQuads;
+            }
+
+            return l_IsValid;
+        }
+    }
+
+    REGISTER_BENCHMARK("Meshing", "Greedy vs per-face chunk meshing throughput and vertex counts over synthetic terrains", RunMeshingBenchmark);
+}
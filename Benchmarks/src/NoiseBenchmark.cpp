@@ -0,0 +1,181 @@
+#include "Benchmark.h"
+
+#include "Engine/Noise/NoiseGenerator.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace Benchmarks
+{
+    namespace
+    {
+        struct NoiseScenario
+        {
+            const char* Name;
+            Engine::NoiseSettings Settings;
+            bool Is3D;
+        };
+
+        std::vector<NoiseScenario> GetNoiseScenarios()
+        {
+            std::vector<NoiseScenario> l_Scenarios;
+
+            Engine::NoiseSettings l_Heightmap;
+            l_Heightmap.Type = Engine::NoiseType::Simplex;
+            l_Heightmap.Frequency = 0.004f;
+            l_Heightmap.Octaves = 5;
+            l_Scenarios.push_back({ "simplex2_fbm5", l_Heightmap, false });
+
+            Engine::NoiseSettings l_Warped = l_Heightmap;
+            l_Warped.WarpAmplitude = 40.0f;
+            l_Scenarios.push_back({ "simplex2_fbm5_warp", l_Warped, false });
+
+            Engine::NoiseSettings l_Perlin2 = l_Heightmap;
+            l_Perlin2.Type = Engine::NoiseType::Perlin;
+            l_Scenarios.push_back({ "perlin2_fbm5", l_Perlin2, false });
+
+            Engine::NoiseSettings l_Caves;
+            l_Caves.Type = Engine::NoiseType::Perlin;
+            l_Caves.Frequency = 0.02f;
+            l_Caves.Octaves = 3;
+            l_Scenarios.push_back({ "perlin3_fbm3", l_Caves, true });
+
+            Engine::NoiseSettings l_Ridged;
+            l_Ridged.Type = Engine::NoiseType::Simplex;
+            l_Ridged.Fractal = Engine::FractalType::Ridged;
+            l_Ridged.Frequency = 0.01f;
+            l_Ridged.Octaves = 3;
+            l_Scenarios.push_back({ "simplex3_ridged3", l_Ridged, true });
+
+            Engine::NoiseSettings l_Single;
+            l_Single.Type = Engine::NoiseType::Simplex;
+            l_Single.Fractal = Engine::FractalType::None;
+            l_Single.Frequency = 0.05f;
+            l_Scenarios.push_back({ "simplex3_single", l_Single, true });
+
+            return l_Scenarios;
+        }
+
+        void Generate(const Engine::NoiseGenerator& generator, bool is3D, std::vector<float>& out, int32_t startX, int32_t startY, int32_t startZ,
+            uint32_t size, int32_t stride)
+        {
+            if (is3D)
+            {
+                out.resize(static_cast<size_t>(size) * size * size);
+                generator.GenerateGrid3D(out.data(), startX, startY, startZ, size, size, size, stride);
+            }
+            else
+            {
+                out.resize(static_cast<size_t>(size) * size);
+                generator.GenerateGrid2D(out.data(), startX, startZ, size, size, stride);
+            }
+        }
+
+        // Every backend must match the scalar reference bit for bit, including ragged rows, negative
+        // coordinates and strides, and single-point sampling at the same positions.
+        bool CheckDeterminism(const NoiseScenario& scenario)
+        {
+            Engine::NoiseGenerator l_Reference(scenario.Settings);
+            l_Reference.SetBackend(Engine::NoiseBackend::Scalar);
+
+            struct GridCase { int32_t X, Y, Z; uint32_t Size; int32_t Stride; };
+            const GridCase l_Cases[] = { { 0, 0, 0, 32, 1 }, { -1000037, -77, 523, 13, 1 }, { 4099, -300, -65, 37, 3 }, { -17, 5, -2000003, 34, 8 } };
+
+            bool l_IsValid = true;
+            std::vector<float> l_Expected;
+            std::vector<float> l_Actual;
+            for (const GridCase& it_Case : l_Cases)
+            {
+                Generate(l_Reference, scenario.Is3D, l_Expected, it_Case.X, it_Case.Y, it_Case.Z, it_Case.Size, it_Case.Stride);
+
+                // Spot-check the point API against the grid at the far corner of the region.
+                const uint32_t l_Last = it_Case.Size - 1;
+                const float l_X = static_cast<float>(it_Case.X + static_cast<int32_t>(l_Last) * it_Case.Stride);
+                const float l_Y = static_cast<float>(it_Case.Y + static_cast<int32_t>(l_Last) * it_Case.Stride);
+                const float l_Z = static_cast<float>(it_Case.Z + static_cast<int32_t>(l_Last) * it_Case.Stride);
+                const float l_Point = scenario.Is3D ? l_Reference.Sample3D(l_X, l_Y, l_Z) : l_Reference.Sample2D(l_X, l_Z);
+                l_IsValid = l_IsValid && std::memcmp(&l_Point, &l_Expected.back(), sizeof(float)) == 0;
+
+                for (uint32_t it_Backend = 0; it_Backend < static_cast<uint32_t>(Engine::NoiseBackend::Count); ++it_Backend)
+                {
+                    Engine::NoiseGenerator l_Generator(scenario.Settings);
+                    if (!l_Generator.SetBackend(static_cast<Engine::NoiseBackend>(it_Backend)))
+                    {
+                        continue;
+                    }
+
+                    Generate(l_Generator, scenario.Is3D, l_Actual, it_Case.X, it_Case.Y, it_Case.Z, it_Case.Size, it_Case.Stride);
+                    l_IsValid = l_IsValid && std::memcmp(l_Actual.data(), l_Expected.data(), l_Expected.size() * sizeof(float)) == 0;
+                }
+            }
+
+            return l_IsValid;
+        }
+
+        bool RunNoiseBenchmark()
+        {
+            bool l_IsValid = true;
+
+            for (const NoiseScenario& it_Scenario : GetNoiseScenarios())
+            {
+                const bool l_IsDeterministic = CheckDeterminism(it_Scenario);
+                ReportMetric(std::string(it_Scenario.Name) + ".deterministic", l_IsDeterministic ? 1.0 : 0.0, "bool");
+                l_IsValid = l_IsValid && l_IsDeterministic;
+
+                // Chunk-sized grids at varying positions, the shape world generation asks for.
+                const uint32_t l_GridCount = it_Scenario.Is3D ? 64 : 4096;
+                double l_ScalarRate = 0.0;
+                for (uint32_t it_Backend = 0; it_Backend < static_cast<uint32_t>(Engine::NoiseBackend::Count); ++it_Backend)
+                {
+                    const Engine::NoiseBackend l_Backend = static_cast<Engine::NoiseBackend>(it_Backend);
+                    Engine::NoiseGenerator l_Generator(it_Scenario.Settings);
+                    if (!l_Generator.SetBackend(l_Backend))
+                    {
+                        continue;
+                    }
+
+                    std::vector<float> l_Output;
+                    float l_Minimum = 0.0f;
+                    float l_Maximum = 0.0f;
+                    const std::vector<double> l_Seconds = MeasureRepeated([&]()
+                        {
+                            for (uint32_t i = 0; i < l_GridCount; ++i)
+                            {
+                                const int32_t l_ChunkX = static_cast<int32_t>(i % 64) - 32;
+                                const int32_t l_ChunkZ = static_cast<int32_t>(i / 64) - 32;
+                                Generate(l_Generator, it_Scenario.Is3D, l_Output, l_ChunkX * 32, static_cast<int32_t>(i % 4) * 32, l_ChunkZ * 32, 32, 1);
+
+                                const auto [l_Low, l_High] = std::minmax_element(l_Output.begin(), l_Output.end());
+                                l_Minimum = std::min(l_Minimum, *l_Low);
+                                l_Maximum = std::max(l_Maximum, *l_High);
+                            }
+                        });
+
+                    // Every grid is 32 samples on a side.
+                    const double l_SamplesPerRun = static_cast<double>(l_GridCount) * (it_Scenario.Is3D ? 32.0 * 32.0 * 32.0 : 32.0 * 32.0);
+                    const std::vector<double> l_Rates = ToRates(l_Seconds, l_SamplesPerRun);
+                    const double l_Rate = Summarize(l_Rates).Median;
+                    const std::string l_Prefix = std::string(it_Scenario.Name) + "." + Engine::NoiseGenerator::GetBackendName(l_Backend);
+                    ReportSamples(l_Prefix + ".samples_per_second", l_Rates, "samples/s");
+                    if (l_Backend == Engine::NoiseBackend::Scalar)
+                    {
+                        l_ScalarRate = l_Rate;
+                        ReportMetric(l_Prefix + ".min", l_Minimum, "value");
+                        ReportMetric(l_Prefix + ".max", l_Maximum, "value");
+                    }
+                    else if (l_ScalarRate > 0.0)
+                    {
+                        ReportMetric(l_Prefix + ".speedup", l_Rate / l_ScalarRate, "x");
+                    }
+                }
+            }
+
+            return l_IsValid;
+        }
+    }
+
+    REGISTER_BENCHMARK("Noise", "Single-core noise throughput per backend (scalar/SSE2/AVX2) and cross-backend determinism", RunNoiseBenchmark);
+}
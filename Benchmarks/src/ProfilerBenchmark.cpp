@@ -0,0 +1,133 @@
+#include "Benchmark.h"
+
+#include "Engine/Core/Profiler.h"
+#include "Engine/Jobs/JobSystem.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#if ENGINE_PROFILING_ENABLED
+
+namespace Benchmarks
+{
+    namespace
+    {
+        constexpr uint32_t s_ScopeCount = 2000000;
+        constexpr uint32_t s_FrameCount = 120;
+        constexpr uint32_t s_JobsPerFrame = 64;
+
+        // Keeps the profiled bodies from being optimized away.
+        volatile uint64_t s_Sink = 0;
+
+        void SpinWork(uint32_t iterations)
+        {
+            uint64_t l_Value = s_Sink;
+            for (uint32_t i = 0; i < iterations; ++i)
+            {
+                l_Value = l_Value * 6364136223846793005ull + 1442695040888963407ull;
+            }
+            s_Sink = l_Value;
+        }
+
+        uint64_t CountOccurrences(const std::string& text, const std::string& pattern)
+        {
+            uint64_t l_Count = 0;
+            for (size_t l_Position = text.find(pattern); l_Position != std::string::npos; l_Position = text.find(pattern, l_Position + pattern.size()))
+            {
+                ++l_Count;
+            }
+
+            return l_Count;
+        }
+
+        bool RunProfilerBenchmark()
+        {
+            bool l_IsValid = true;
+
+            // Raw cost of an empty scope, collected often enough that the ring never fills.
+            {
+                const std::vector<double> l_Seconds = MeasureRepeated([]()
+                    {
+                        for (uint32_t i = 0; i < s_ScopeCount; ++i)
+                        {
+                            ENGINE_PROFILE_SCOPE("Benchmark::EmptyScope");
+
+                            if ((i & 4095) == 4095)
+                            {
+                                Engine::Profiler::EndFrame();
+                            }
+                        }
+                    });
+                Engine::Profiler::EndFrame();
+
+                ReportSamples("ns_per_scope", ToPerItem(l_Seconds, s_ScopeCount, 1e9), "ns");
+            }
+
+            const std::filesystem::path l_Path = std::filesystem::temp_directory_path() / "ProfilerBenchmark.json";
+            const uint64_t l_DroppedBefore = Engine::Profiler::GetDroppedZoneCount();
+
+            // Frames of nested main-thread zones plus jobs on four workers, captured to a Chrome trace.
+            Engine::Profiler::BeginCapture();
+            {
+                Engine::JobSystem l_JobSystem(4);
+                for (uint32_t it_Frame = 0; it_Frame < s_FrameCount; ++it_Frame)
+                {
+                    ENGINE_PROFILE_SCOPE("Benchmark::Frame");
+                    {
+                        ENGINE_PROFILE_SCOPE("Benchmark::Update");
+                        SpinWork(2000);
+                        {
+                            ENGINE_PROFILE_SCOPE("Benchmark::Physics");
+                            SpinWork(1000 + (it_Frame % 10 == 0 ? 20000 : 0));
+                        }
+                    }
+
+                    Engine::JobCounter l_Counter;
+                    l_JobSystem.ParallelFor(s_JobsPerFrame, 1, [](uint32_t, uint32_t)
+                        {
+                            ENGINE_PROFILE_SCOPE("Benchmark::Job");
+                            SpinWork(500);
+                        }, &l_Counter);
+                    l_JobSystem.WaitForCounter(l_Counter);
+
+                    Engine::Profiler::EndFrame();
+                }
+            }
+            l_IsValid = Engine::Profiler::EndCapture(l_Path) && l_IsValid;
+
+            std::ifstream l_Stream(l_Path);
+            const std::string l_Json((std::istreambuf_iterator<char>(l_Stream)), std::istreambuf_iterator<char>());
+            const uint64_t l_BenchmarkJobCount = CountOccurrences(l_Json, "\"name\":\"Benchmark::Job\"");
+            const uint64_t l_FrameZoneCount = CountOccurrences(l_Json, "\"name\":\"Benchmark::Frame\"");
+            l_IsValid = l_IsValid && l_BenchmarkJobCount == uint64_t{ s_FrameCount } * s_JobsPerFrame && l_FrameZoneCount == s_FrameCount;
+            l_IsValid = l_IsValid && Engine::Profiler::GetDroppedZoneCount() == l_DroppedBefore;
+
+            // A nested zone can never take longer than its parent, and the rolling statistics must be ordered.
+            Engine::ProfileZoneStats l_Update;
+            Engine::ProfileZoneStats l_Physics;
+            l_IsValid = l_IsValid && Engine::Profiler::GetZoneStats("Benchmark::Update", l_Update) && Engine::Profiler::GetZoneStats("Benchmark::Physics", l_Physics);
+            l_IsValid = l_IsValid && l_Physics.MaxMilliseconds <= l_Update.MaxMilliseconds && l_Physics.AverageMilliseconds <= l_Update.AverageMilliseconds;
+            l_IsValid = l_IsValid && l_Physics.MinMilliseconds <= l_Physics.AverageMilliseconds && l_Physics.AverageMilliseconds <= l_Physics.P99Milliseconds
+                && l_Physics.P99Milliseconds <= l_Physics.MaxMilliseconds;
+
+            ReportMetric("capture_bytes", static_cast<double>(l_Json.size()), "B");
+            ReportMetric("physics.avg_ms", l_Physics.AverageMilliseconds, "ms");
+            ReportMetric("physics.p99_ms", l_Physics.P99Milliseconds, "ms");
+            ReportMetric("trace_valid", l_IsValid ? 1.0 : 0.0, "bool");
+
+            std::error_code l_Error;
+            std::filesystem::remove(l_Path, l_Error);
+
+            return l_IsValid;
+        }
+    }
+
+    REGISTER_BENCHMARK("Profiler", "Per-scope cost of the CPU profiler and a captured multi-threaded trace with rolling zone statistics", RunProfilerBenchmark);
+}
+
+#endif
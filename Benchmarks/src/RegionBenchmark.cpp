@@ -0,0 +1,211 @@
+#include "Benchmark.h"
+
+#include "Engine/Jobs/JobSystem.h"
+#include "Engine/World/RegionStore.h"
+#include "Engine/World/WorldGenerator.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace Benchmarks
+{
+    namespace
+    {
+        uint64_t HashChunks(const std::vector<std::unique_ptr<Engine::Chunk>>& chunks)
+        {
+            uint64_t l_Hash = 0xCBF29CE484222325ull;
+            for (const std::unique_ptr<Engine::Chunk>& it_Chunk : chunks)
+            {
+                if (it_Chunk == nullptr)
+                {
+                    return 0;
+                }
+
+                for (uint32_t i = 0; i < Engine::Chunk::Volume; ++i)
+                {
+                    l_Hash = (l_Hash ^ it_Chunk->GetBlock(i)) * 0x100000001B3ull;
+                }
+            }
+
+            return l_Hash;
+        }
+
+        uint64_t GetDirectorySize(const std::filesystem::path& directory)
+        {
+            uint64_t l_Size = 0;
+            for (const std::filesystem::directory_entry& it_Entry : std::filesystem::directory_iterator(directory))
+            {
+                l_Size += it_Entry.file_size();
+            }
+
+            return l_Size;
+        }
+
+        // Loads every coordinate through a fresh store (so files are reopened and remapped) and hashes the result.
+        uint64_t LoadAndHash(Engine::JobSystem& jobSystem, const std::filesystem::path& directory, const std::vector<Engine::ChunkCoord>& coords, double& seconds)
+        {
+            Engine::RegionStore l_Store(directory);
+
+            Stopwatch l_Stopwatch;
+            std::shared_ptr<Engine::RegionLoadBatch> l_Batch = l_Store.LoadAsync(jobSystem, coords);
+            jobSystem.WaitForCounter(l_Batch->GetCounter());
+            seconds = l_Stopwatch.GetElapsedSeconds();
+
+            return HashChunks(l_Batch->GetChunks());
+        }
+
+        bool RunRegionBenchmark()
+        {
+            constexpr int32_t l_RegionSize = 16;
+            constexpr int32_t l_ChunkLayers = 6;
+
+            std::vector<Engine::ChunkCoord> l_Coords;
+            for (int32_t z = 0; z < l_RegionSize; ++z)
+            {
+                for (int32_t x = 0; x < l_RegionSize; ++x)
+                {
+                    for (int32_t y = 0; y < l_ChunkLayers; ++y)
+                    {
+                        l_Coords.push_back({ x - l_RegionSize / 2, y, z - l_RegionSize / 2 });
+                    }
+                }
+            }
+
+            const uint32_t l_WorkerCount = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+            Engine::JobSystem l_JobSystem(l_WorkerCount);
+
+            // Generated terrain gives realistic palettes: uniform air and stone chunks next to busy surface chunks.
+            const Engine::WorldGenerator l_Generator;
+            std::shared_ptr<Engine::WorldGenerationBatch> l_Generation = l_Generator.GenerateAsync(l_JobSystem, l_Coords);
+            l_JobSystem.WaitForCounter(l_Generation->GetCounter());
+            std::vector<std::unique_ptr<Engine::Chunk>>& l_Chunks = l_Generation->GetChunks();
+
+            std::vector<const Engine::Chunk*> l_ChunkPointers;
+            uint64_t l_PaletteBytes = 0;
+            for (const std::unique_ptr<Engine::Chunk>& it_Chunk : l_Chunks)
+            {
+                l_ChunkPointers.push_back(it_Chunk.get());
+                l_PaletteBytes += it_Chunk->GetStorage().GetPalette().size() * sizeof(Engine::BlockId) + it_Chunk->GetStorage().GetPackedIndices().size() * sizeof(uint64_t);
+            }
+            const uint64_t l_ReferenceHash = HashChunks(l_Chunks);
+
+            const std::filesystem::path l_Directory = std::filesystem::temp_directory_path() / "MinecraftCloneRegionBenchmark";
+            std::error_code l_Error;
+            std::filesystem::remove_all(l_Directory, l_Error);
+
+            bool l_IsValid = true;
+            const double l_ChunkCount = static_cast<double>(l_Coords.size());
+            const BenchmarkSettings& l_Settings = GetBenchmarkSettings();
+
+            // Each save repetition starts from an empty directory so every run pays for file creation and growth.
+            std::vector<double> l_SnapshotMilliseconds;
+            std::vector<double> l_SaveSeconds;
+            uint64_t l_EncodedBytes = 0;
+            for (uint32_t it_Run = 0; it_Run < l_Settings.WarmupRuns + l_Settings.Repetitions; ++it_Run)
+            {
+                std::filesystem::remove_all(l_Directory, l_Error);
+                Engine::RegionStore l_Store(l_Directory);
+
+                // Autosave path: only the snapshot runs on the calling thread.
+                Stopwatch l_Stopwatch;
+                std::shared_ptr<Engine::RegionSaveBatch> l_Save = l_Store.SaveAsync(l_JobSystem, l_ChunkPointers);
+                const double l_SnapshotSeconds = l_Stopwatch.GetElapsedSeconds();
+                l_JobSystem.WaitForCounter(l_Save->GetCounter());
+                if (it_Run >= l_Settings.WarmupRuns)
+                {
+                    l_SnapshotMilliseconds.push_back(l_SnapshotSeconds * 1000.0);
+                    l_SaveSeconds.push_back(l_Stopwatch.GetElapsedSeconds());
+                }
+
+                l_EncodedBytes = l_Save->GetEncodedBytes();
+                l_IsValid = l_IsValid && l_Save->HasSucceeded();
+            }
+
+            ReportSamples("save.snapshot_ms", l_SnapshotMilliseconds, "ms");
+            ReportSamples("save.chunks_per_second", ToRates(l_SaveSeconds, l_ChunkCount), "chunks/s");
+            ReportMetric("save.bytes_per_chunk", static_cast<double>(l_EncodedBytes) / l_ChunkCount, "B");
+            ReportMetric("save.compression_ratio", static_cast<double>(l_PaletteBytes) / static_cast<double>(l_EncodedBytes), "x");
+
+            {
+                Engine::RegionStore l_Store(l_Directory);
+
+                // Saving everything again leaves the first copies as dead space for compaction to reclaim.
+                std::shared_ptr<Engine::RegionSaveBatch> l_Save = l_Store.SaveAsync(l_JobSystem, l_ChunkPointers);
+                l_JobSystem.WaitForCounter(l_Save->GetCounter());
+                l_IsValid = l_IsValid && l_Save->HasSucceeded();
+
+                const uint64_t l_SizeBefore = GetDirectorySize(l_Directory);
+                Stopwatch l_Stopwatch;
+                const uint32_t l_CompactedCount = l_Store.CompactRegions(0.25f);
+                ReportMetric("compact.ms", l_Stopwatch.GetElapsedSeconds() * 1000.0, "ms");
+                ReportMetric("compact.regions", l_CompactedCount, "regions");
+                ReportMetric("compact.size_ratio", static_cast<double>(GetDirectorySize(l_Directory)) / static_cast<double>(l_SizeBefore), "x");
+                l_IsValid = l_IsValid && l_CompactedCount > 0;
+            }
+
+            // Every load goes through a fresh store, so files are reopened and remapped each time.
+            double l_LoadSeconds = 0.0;
+            bool l_RoundTrips = true;
+            std::vector<double> l_LoadSamples;
+            for (uint32_t it_Run = 0; it_Run < l_Settings.WarmupRuns + l_Settings.Repetitions; ++it_Run)
+            {
+                l_RoundTrips = l_RoundTrips && LoadAndHash(l_JobSystem, l_Directory, l_Coords, l_LoadSeconds) == l_ReferenceHash;
+                if (it_Run >= l_Settings.WarmupRuns)
+                {
+                    l_LoadSamples.push_back(l_LoadSeconds);
+                }
+            }
+            ReportSamples("load.chunks_per_second", ToRates(l_LoadSamples, l_ChunkCount), "chunks/s");
+            ReportMetric("round_trip_matches", l_RoundTrips ? 1.0 : 0.0, "bool");
+            l_IsValid = l_IsValid && l_RoundTrips;
+
+            // A crash during an append leaves unreferenced bytes at the end of a file; they must not affect loading.
+            {
+                const std::filesystem::path l_Region = std::filesystem::directory_iterator(l_Directory)->path();
+                std::ofstream l_Stream(l_Region, std::ios::binary | std::ios::app);
+                const std::vector<char> l_Garbage(1000, '\x5A');
+                l_Stream.write(l_Garbage.data(), static_cast<std::streamsize>(l_Garbage.size()));
+            }
+
+            const bool l_SurvivesTornAppend = LoadAndHash(l_JobSystem, l_Directory, l_Coords, l_LoadSeconds) == l_ReferenceHash;
+            ReportMetric("torn_append_recovers", l_SurvivesTornAppend ? 1.0 : 0.0, "bool");
+            l_IsValid = l_IsValid && l_SurvivesTornAppend;
+
+            // A small save submitted right behind a large one finishes encoding first, but its region write must
+            // still land last, the way an eviction save follows an autosave of the same chunks.
+            {
+                std::filesystem::remove_all(l_Directory, l_Error);
+                Engine::RegionStore l_Store(l_Directory);
+
+                Engine::Chunk l_Edited = *l_Chunks.front();
+                l_Edited.SetBlock(0u, static_cast<Engine::BlockId>(l_Edited.GetBlock(0u) + 1));
+                const std::vector<const Engine::Chunk*> l_EditedPointers{ &l_Edited };
+
+                std::shared_ptr<Engine::RegionSaveBatch> l_Autosave = l_Store.SaveAsync(l_JobSystem, l_ChunkPointers);
+                std::shared_ptr<Engine::RegionSaveBatch> l_Eviction = l_Store.SaveAsync(l_JobSystem, l_EditedPointers);
+                l_JobSystem.WaitForCounter(l_Eviction->GetCounter());
+                const bool l_IsAutosaveDone = l_Autosave->IsComplete();
+                l_JobSystem.WaitForCounter(l_Autosave->GetCounter());
+
+                Engine::RegionStore l_Reader(l_Directory);
+                const std::unique_ptr<Engine::Chunk> l_Loaded = l_Reader.LoadChunk(l_Edited.GetCoord());
+                const bool l_IsOrdered = l_IsAutosaveDone && l_Loaded != nullptr && l_Loaded->GetBlock(0u) == l_Edited.GetBlock(0u);
+                ReportMetric("saves_keep_submission_order", l_IsOrdered ? 1.0 : 0.0, "bool");
+                l_IsValid = l_IsValid && l_IsOrdered && l_Autosave->HasSucceeded() && l_Eviction->HasSucceeded();
+            }
+
+            std::filesystem::remove_all(l_Directory, l_Error);
+
+            return l_IsValid;
+        }
+    }
+
+    REGISTER_BENCHMARK("Region", "Region-file save, compaction and load of a generated 16x16 column area, validated by round trip", RunRegionBenchmark);
+}
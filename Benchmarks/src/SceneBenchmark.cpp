@@ -0,0 +1,280 @@
+#include "Benchmark.h"
+
+#include "Engine/Jobs/JobSystem.h"
+#include "Engine/Scene/Scene.h"
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Benchmarks
+{
+    namespace
+    {
+        constexpr uint32_t s_EntityCounts[] = { 2000, 20000 };
+        constexpr uint32_t s_TickCount = 100;
+        constexpr double s_FixedDeltaTime = 1.0 / 20.0;
+
+        // Mob-like components: each system below touches a few of them.
+        struct Transform
+        {
+            glm::vec3 Position{ 0.0f };
+            float Heading = 0.0f;
+        };
+
+        struct Velocity
+        {
+            glm::vec3 Value{ 0.0f };
+        };
+
+        struct Wander
+        {
+            uint32_t Seed = 1;
+            float Timer = 0.0f;
+        };
+
+        struct Health
+        {
+            float Current = 20.0f;
+            float Max = 20.0f;
+            float Regeneration = 0.5f;
+        };
+
+        struct Lifetime
+        {
+            float Remaining = 0.0f;
+        };
+
+        struct Animation
+        {
+            float Phase = 0.0f;
+            float Speed = 1.0f;
+        };
+
+        uint32_t NextRandom(uint32_t& state)
+        {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+
+            return state;
+        }
+
+        float NextUnit(uint32_t& state)
+        {
+            return static_cast<float>(NextRandom(state) >> 8) * (1.0f / 16777216.0f);
+        }
+
+        void SpawnMob(entt::registry& registry, uint32_t seed)
+        {
+            uint32_t l_State = seed * 2654435761u + 1u;
+            const entt::entity l_Entity = registry.create();
+            registry.emplace<Transform>(l_Entity, glm::vec3(NextUnit(l_State) * 256.0f - 128.0f, 64.0f, NextUnit(l_State) * 256.0f - 128.0f), 0.0f);
+            registry.emplace<Velocity>(l_Entity);
+            registry.emplace<Wander>(l_Entity, l_State, NextUnit(l_State) * 2.0f);
+            registry.emplace<Health>(l_Entity, 10.0f + NextUnit(l_State) * 10.0f, 20.0f, 0.5f);
+            registry.emplace<Lifetime>(l_Entity, 2.0f + NextUnit(l_State) * 18.0f);
+            registry.emplace<Animation>(l_Entity, 0.0f, 0.5f + NextUnit(l_State));
+        }
+
+        // Six systems in three phases: steering, regeneration and ageing together; then movement and animation,
+        // which need this tick's velocities; then the structural despawn and respawn on its own.
+        void AddMobSystems(Engine::Scene& scene, uint32_t& spawnCounter)
+        {
+            scene.AddSystem("Wander", Engine::SystemAccess().Read<Transform>().Write<Velocity, Wander>(), [](const Engine::SystemContext& context)
+                {
+                    const float l_DeltaTime = static_cast<float>(context.Timing.FixedDeltaTime);
+                    context.Registry.group<Velocity, Wander>(entt::get<Transform>).each([l_DeltaTime](Velocity& velocity, Wander& wander, const Transform& transform)
+                        {
+                            wander.Timer -= l_DeltaTime;
+                            if (wander.Timer <= 0.0f)
+                            {
+                                // New heading; mobs far from home lean back towards it.
+                                const float l_Angle = NextUnit(wander.Seed) * 6.2831853f;
+                                glm::vec3 l_Direction(std::cos(l_Angle), 0.0f, std::sin(l_Angle));
+                                const float l_Distance = std::sqrt(transform.Position.x * transform.Position.x + transform.Position.z * transform.Position.z);
+                                if (l_Distance > 96.0f)
+                                {
+                                    l_Direction = l_Direction * 0.3f - glm::vec3(transform.Position.x, 0.0f, transform.Position.z) * (0.7f / l_Distance);
+                                }
+
+                                velocity.Value = l_Direction * (1.0f + NextUnit(wander.Seed) * 3.0f);
+                                wander.Timer = 1.0f + NextUnit(wander.Seed) * 4.0f;
+                            }
+                        });
+                });
+
+            scene.AddSystem("Regenerate", Engine::SystemAccess().Write<Health>(), [](const Engine::SystemContext& context)
+                {
+                    const float l_DeltaTime = static_cast<float>(context.Timing.FixedDeltaTime);
+                    context.Registry.view<Health>().each([l_DeltaTime](Health& health)
+                        {
+                            health.Current = std::min(health.Max, health.Current + health.Regeneration * l_DeltaTime);
+                        });
+                });
+
+            scene.AddSystem("Age", Engine::SystemAccess().Write<Lifetime>(), [](const Engine::SystemContext& context)
+                {
+                    const float l_DeltaTime = static_cast<float>(context.Timing.FixedDeltaTime);
+                    context.Registry.view<Lifetime>().each([l_DeltaTime](Lifetime& lifetime)
+                        {
+                            lifetime.Remaining -= l_DeltaTime;
+                        });
+                });
+
+            scene.AddSystem("Move", Engine::SystemAccess().Read<Velocity>().Write<Transform>(), [](const Engine::SystemContext& context)
+                {
+                    const float l_DeltaTime = static_cast<float>(context.Timing.FixedDeltaTime);
+                    context.Registry.group<Transform>(entt::get<Velocity>).each([l_DeltaTime](Transform& transform, const Velocity& velocity)
+                        {
+                            transform.Position += velocity.Value * l_DeltaTime;
+                            if (velocity.Value.x != 0.0f || velocity.Value.z != 0.0f)
+                            {
+                                transform.Heading = std::atan2(velocity.Value.z, velocity.Value.x);
+                            }
+                        });
+                });
+
+            scene.AddSystem("Animate", Engine::SystemAccess().Read<Velocity>().Write<Animation>(), [](const Engine::SystemContext& context)
+                {
+                    const float l_DeltaTime = static_cast<float>(context.Timing.FixedDeltaTime);
+                    context.Registry.group<Animation>(entt::get<Velocity>).each([l_DeltaTime](Animation& animation, const Velocity& velocity)
+                        {
+                            animation.Phase = std::fmod(animation.Phase + glm::length(velocity.Value) * animation.Speed * l_DeltaTime, 6.2831853f);
+                        });
+                });
+
+            scene.AddSystem("Despawn", Engine::SystemAccess().Structural(), [&spawnCounter](const Engine::SystemContext& context)
+                {
+                    std::vector<entt::entity> l_Expired;
+                    context.Registry.view<Lifetime>().each([&l_Expired](entt::entity entity, const Lifetime& lifetime)
+                        {
+                            if (lifetime.Remaining <= 0.0f)
+                            {
+                                l_Expired.push_back(entity);
+                            }
+                        });
+
+                    // Replacements keep the population steady.
+                    for (const entt::entity it_Entity : l_Expired)
+                    {
+                        context.Registry.destroy(it_Entity);
+                        SpawnMob(context.Registry, spawnCounter++);
+                    }
+                });
+        }
+
+        struct SimulationResult
+        {
+            std::vector<double> Seconds;
+            double Checksum = 0.0;
+            double BusyThreads = 0.0;
+            uint32_t PhaseCount = 0;
+            uint32_t EntityCount = 0;
+        };
+
+        SimulationResult Simulate(Engine::JobSystem& jobSystem, uint32_t entityCount, bool runInParallel)
+        {
+            SimulationResult l_Result;
+            double l_SystemMilliseconds = 0.0;
+            double l_TickMilliseconds = 0.0;
+
+            l_Result.Seconds = MeasureRepeated([&]()
+                {
+                    Engine::SystemSchedulerSettings l_Settings;
+                    l_Settings.RunInParallel = runInParallel;
+                    Engine::Scene l_Scene(jobSystem, l_Settings);
+
+                    uint32_t l_SpawnCounter = 0;
+                    AddMobSystems(l_Scene, l_SpawnCounter);
+                    entt::registry& l_Registry = l_Scene.GetRegistry();
+                    l_Registry.group<Velocity, Wander>(entt::get<Transform>);
+                    l_Registry.group<Transform>(entt::get<Velocity>);
+                    l_Registry.group<Animation>(entt::get<Velocity>);
+                    for (; l_SpawnCounter < entityCount; )
+                    {
+                        SpawnMob(l_Registry, l_SpawnCounter++);
+                    }
+
+                    l_SystemMilliseconds = 0.0;
+                    l_TickMilliseconds = 0.0;
+                    Engine::TickTiming l_Timing;
+                    l_Timing.FixedDeltaTime = s_FixedDeltaTime;
+                    for (uint32_t l_Tick = 0; l_Tick < s_TickCount; ++l_Tick)
+                    {
+                        l_Timing.TickIndex = l_Tick;
+                        l_Timing.SimulationTime = l_Tick * s_FixedDeltaTime;
+                        l_Scene.Tick(l_Timing);
+                        l_SystemMilliseconds += l_Scene.GetScheduler().GetLastTickStats().SystemMilliseconds;
+                        l_TickMilliseconds += l_Scene.GetScheduler().GetLastTickStats().TickMilliseconds;
+                    }
+
+                    l_Result.Checksum = 0.0;
+                    l_Result.EntityCount = 0;
+                    l_Registry.view<Transform, Animation>().each([&l_Result](const Transform& transform, const Animation& animation)
+                        {
+                            l_Result.Checksum += transform.Position.x + transform.Position.z * 3.0 + transform.Heading + animation.Phase;
+                            ++l_Result.EntityCount;
+                        });
+                    l_Result.PhaseCount = l_Scene.GetScheduler().GetPhaseCount();
+                });
+
+            l_Result.BusyThreads = l_TickMilliseconds > 0.0 ? l_SystemMilliseconds / l_TickMilliseconds : 0.0;
+
+            return l_Result;
+        }
+
+        bool RunSceneBenchmark()
+        {
+            Engine::JobSystem l_JobSystem(std::max(std::thread::hardware_concurrency(), 2u) - 1);
+            const double l_ThreadCount = static_cast<double>(l_JobSystem.GetWorkerCount() + 1);
+
+            bool l_IsValid = true;
+
+            // Conflict rules on their own.
+            {
+                const Engine::SystemAccess l_ReadsA = Engine::SystemAccess().Read<Transform>();
+                const Engine::SystemAccess l_WritesA = Engine::SystemAccess().Write<Transform>();
+                const Engine::SystemAccess l_WritesB = Engine::SystemAccess().Read<Transform>().Write<Health>();
+                const Engine::SystemAccess l_Structural = Engine::SystemAccess().Structural();
+                const bool l_RulesHold = !l_ReadsA.ConflictsWith(l_ReadsA) && l_ReadsA.ConflictsWith(l_WritesA) && l_WritesA.ConflictsWith(l_WritesA)
+                    && !l_WritesB.ConflictsWith(l_ReadsA) && l_WritesB.ConflictsWith(l_WritesA) && l_Structural.ConflictsWith(l_ReadsA)
+                    && l_Structural.ConflictsWith(Engine::SystemAccess());
+                ReportMetric("access.rules_hold", l_RulesHold ? 1.0 : 0.0, "bool");
+                l_IsValid = l_IsValid && l_RulesHold;
+            }
+
+            for (const uint32_t it_EntityCount : s_EntityCounts)
+            {
+                const SimulationResult l_Serial = Simulate(l_JobSystem, it_EntityCount, false);
+                const SimulationResult l_Parallel = Simulate(l_JobSystem, it_EntityCount, true);
+
+                const double l_SerialMedian = Summarize(l_Serial.Seconds).Median;
+                const double l_ParallelMedian = Summarize(l_Parallel.Seconds).Median;
+                const double l_EntityTicks = static_cast<double>(it_EntityCount) * s_TickCount;
+                const std::string l_Prefix = "entities_" + std::to_string(it_EntityCount);
+                ReportMetric(l_Prefix + ".serial.tick_us", l_SerialMedian / s_TickCount * 1.0e6, "us");
+                ReportMetric(l_Prefix + ".parallel.tick_us", l_ParallelMedian / s_TickCount * 1.0e6, "us");
+                ReportMetric(l_Prefix + ".serial.entity_ticks_per_second", l_EntityTicks / l_SerialMedian, "entities/s");
+                ReportMetric(l_Prefix + ".parallel.entity_ticks_per_second_per_core", l_EntityTicks / l_ParallelMedian / l_ThreadCount, "entities/s");
+                ReportMetric(l_Prefix + ".parallel.entities_per_core_at_20_tps", l_EntityTicks / l_ParallelMedian / l_ThreadCount / 20.0, "entities");
+                ReportMetric(l_Prefix + ".parallel.busy_threads", l_Parallel.BusyThreads, "threads");
+                ReportMetric(l_Prefix + ".phases", l_Parallel.PhaseCount, "phases");
+
+                // Systems sharing a phase touch disjoint data, so running them in parallel must not change a thing.
+                const bool l_Matches = l_Serial.Checksum == l_Parallel.Checksum && l_Serial.EntityCount == it_EntityCount && l_Parallel.EntityCount == it_EntityCount;
+                ReportMetric(l_Prefix + ".parallel_matches_serial", l_Matches ? 1.0 : 0.0, "bool");
+                l_IsValid = l_IsValid && l_Matches && l_Parallel.PhaseCount == 3;
+            }
+
+            return l_IsValid;
+        }
+    }
+
+    REGISTER_BENCHMARK("Scene", "Entity simulation over an EnTT registry: six mob systems in three phases, serial vs parallel scheduling", RunSceneBenchmark);
+}
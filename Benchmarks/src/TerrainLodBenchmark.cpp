@@ -0,0 +1,459 @@
+#include "Benchmark.h"
+
+#include "Engine/Jobs/JobSystem.h"
+#include "Engine/World/BlockRegistry.h"
+#include "Engine/World/ChunkMesher.h"
+#include "Engine/World/TerrainLod.h"
+#include "Engine/World/World.h"
+#include "Engine/World/WorldGenerator.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace Benchmarks
+{
+    namespace
+    {
+        // Full detail out to 4 columns, then rings one section wide: levels reach 6, 10 and 18 columns.
+        constexpr int32_t s_DetailRadius = 4;
+        constexpr int32_t s_ChunkLayers = 4;
+
+        const glm::vec3 s_Focus(16.0f, 90.0f, 16.0f);
+
+        Engine::TerrainLodSettings CreateLodSettings(const Engine::BlockRegistry& registry)
+        {
+            Engine::TerrainLodSettings l_Settings;
+            l_Settings.LevelCount = 3;
+            l_Settings.DetailRadius = s_DetailRadius;
+            l_Settings.RingSections = 1;
+            l_Settings.MinChunkY = 0;
+            l_Settings.MaxChunkY = s_ChunkLayers - 1;
+            l_Settings.MaterialPriorities.assign(registry.GetBlockCount(), 1);
+            for (const char* it_Name : { "grass", "snow", "sand" })
+            {
+                const Engine::BlockId l_Block = registry.FindBlock(it_Name);
+                if (l_Block != Engine::BlockRegistry::InvalidBlockId)
+                {
+                    l_Settings.MaterialPriorities[l_Block] = 3;
+                }
+            }
+
+            return l_Settings;
+        }
+
+        int64_t GetColumnDistanceSquared(const Engine::ChunkCoord& coord)
+        {
+            const int64_t l_DX = coord.X - Engine::WorldToChunk(static_cast<int32_t>(s_Focus.x));
+            const int64_t l_DZ = coord.Z - Engine::WorldToChunk(static_cast<int32_t>(s_Focus.z));
+
+            return l_DX * l_DX + l_DZ * l_DZ;
+        }
+
+        // Mesh one chunk (or section) of a provider with its padded neighbours; returns the vertex count.
+        size_t MeshOne(const Engine::ChunkProvider& provider, const Engine::ChunkCoord& coord, const Engine::MeshingBlockTable& table,
+            Engine::ChunkMesher& mesher, Engine::PaddedChunkView& view, Engine::ChunkMesh& mesh)
+        {
+            std::array<const Engine::Chunk*, 27> l_Neighbours{};
+            for (int32_t y = -1; y <= 1; ++y)
+            {
+                for (int32_t z = -1; z <= 1; ++z)
+                {
+                    for (int32_t x = -1; x <= 1; ++x)
+                    {
+                        l_Neighbours[(y + 1) * 9 + (z + 1) * 3 + (x + 1)] = provider.FindChunk({ coord.X + x, coord.Y + y, coord.Z + z });
+                    }
+                }
+            }
+            if (l_Neighbours[13] == nullptr)
+            {
+                return 0;
+            }
+
+            view.Build(l_Neighbours);
+            mesher.Mesh(view, table, mesh);
+
+            return mesh.Vertices.size();
+        }
+
+        // The active sections of one level, as the level's own mesher sees them.
+        class ActiveSectionProvider : public Engine::ChunkProvider
+        {
+        public:
+            ActiveSectionProvider(const Engine::TerrainLod& lod, uint32_t level) : m_Lod(lod), m_Level(level),
+                m_Active(lod.GetActiveSections(level).begin(), lod.GetActiveSections(level).end())
+            {
+
+            }
+
+            const Engine::Chunk* FindChunk(const Engine::ChunkCoord& coord) const override
+            {
+                return m_Active.count(coord) > 0 ? m_Lod.FindSection(m_Level, coord) : nullptr;
+            }
+
+        private:
+            const Engine::TerrainLod& m_Lod;
+            uint32_t m_Level;
+            std::unordered_set<Engine::ChunkCoord, Engine::ChunkCoordHash> m_Active;
+        };
+
+        // Sources merged and the worker time spent filtering them, summed over frames.
+        struct DownsampleTotals
+        {
+            uint32_t Count = 0;
+            double Milliseconds = 0.0;
+        };
+
+        // Runs frames until the LOD has every source it wants and nothing left to downsample or mesh. Sources
+        // come from the world when it has them and are generated (and kept) otherwise.
+        bool PumpUntilIdle(Engine::JobSystem& jobSystem, Engine::TerrainLod& lod, Engine::World& world, const Engine::WorldGenerator& generator,
+            DownsampleTotals& totals)
+        {
+            for (uint32_t l_Frame = 0; l_Frame < 100000; ++l_Frame)
+            {
+                lod.Update(s_Focus);
+                totals.Count += lod.GetLastFrameStats().DownsampledCount;
+                totals.Milliseconds += lod.GetLastFrameStats().DownsampleMilliseconds;
+
+                std::vector<Engine::ChunkCoord> l_Generate;
+                for (const Engine::ChunkCoord& it_Coord : lod.TakeMissingSources(256))
+                {
+                    if (const Engine::Chunk* l_Chunk = world.FindChunk(it_Coord))
+                    {
+                        lod.OnChunkChanged(*l_Chunk);
+                    }
+                    else
+                    {
+                        l_Generate.push_back(it_Coord);
+                    }
+                }
+
+                if (!l_Generate.empty())
+                {
+                    std::shared_ptr<Engine::WorldGenerationBatch> l_Batch = generator.GenerateAsync(jobSystem, l_Generate);
+                    jobSystem.WaitForCounter(l_Batch->GetCounter());
+                    for (std::unique_ptr<Engine::Chunk>& it_Chunk : l_Batch->GetChunks())
+                    {
+                        lod.OnChunkChanged(world.InsertChunk(std::move(it_Chunk)));
+                    }
+                }
+
+                jobSystem.DrainMainThreadQueue();
+                if (lod.IsIdle())
+                {
+                    return true;
+                }
+                std::this_thread::yield();
+            }
+
+            return false;
+        }
+
+        // Hand-made cells with known answers for both filters.
+        bool CheckFilters(const Engine::BlockRegistry& registry, const Engine::TerrainLodSettings& settings)
+        {
+            const Engine::BlockId l_Stone = registry.FindBlock("stone");
+            const Engine::BlockId l_Dirt = registry.FindBlock("dirt");
+            const Engine::BlockId l_Grass = registry.FindBlock("grass");
+
+            std::vector<Engine::BlockId> l_Blocks(Engine::Chunk::Volume, Engine::AirBlockId);
+            const auto a_FillCell = [&l_Blocks](int32_t cellX, const std::vector<Engine::BlockId>& blocks)
+                {
+                    for (size_t i = 0; i < blocks.size(); ++i)
+                    {
+                        const int32_t l_X = cellX * 2 + static_cast<int32_t>(i & 1);
+                        const int32_t l_Z = static_cast<int32_t>((i >> 1) & 1);
+                        const int32_t l_Y = static_cast<int32_t>((i >> 2) & 1);
+                        l_Blocks[Engine::Chunk::GetIndex(l_X, l_Y, l_Z)] = blocks[i];
+                    }
+                };
+
+            // Cell 0: five stone, three air. Cell 1: three stone, five air. Cell 2: three dirt under one grass, four air.
+            a_FillCell(0, { l_Stone, l_Stone, l_Stone, l_Stone, l_Stone, 0, 0, 0 });
+            a_FillCell(1, { l_Stone, l_Stone, l_Stone, 0, 0, 0, 0, 0 });
+            a_FillCell(2, { l_Dirt, l_Dirt, l_Dirt, l_Grass, 0, 0, 0, 0 });
+
+            std::vector<Engine::BlockId> l_Majority(16 * 16 * 16);
+            std::vector<Engine::BlockId> l_Priority(16 * 16 * 16);
+            Engine::TerrainLod::Downsample(l_Blocks.data(), 1, Engine::LodFilter::Majority, registry.GetMeshingTable(), settings.MaterialPriorities, l_Majority.data());
+            Engine::TerrainLod::Downsample(l_Blocks.data(), 1, Engine::LodFilter::MaterialPriority, registry.GetMeshingTable(), settings.MaterialPriorities, l_Priority.data());
+
+            return l_Majority[0] == l_Stone && l_Majority[1] == Engine::AirBlockId && l_Majority[2] == Engine::AirBlockId && l_Majority[3] == Engine::AirBlockId
+                && l_Priority[0] == l_Stone && l_Priority[1] == Engine::AirBlockId && l_Priority[2] == l_Grass && l_Priority[3] == Engine::AirBlockId;
+        }
+
+        bool RunTerrainLodBenchmark()
+        {
+            Engine::BlockRegistry l_Registry;
+            if (!l_Registry.LoadFromFile(std::filesystem::path(BENCHMARK_ASSET_DIRECTORY) / "Blocks" / "Blocks.yaml"))
+            {
+                return false;
+            }
+            const Engine::MeshingBlockTable& l_Table = l_Registry.GetMeshingTable();
+            const Engine::TerrainLodSettings l_LodSettings = CreateLodSettings(l_Registry);
+
+            const bool l_FiltersValid = CheckFilters(l_Registry, l_LodSettings);
+            ReportMetric("filters_valid", l_FiltersValid ? 1.0 : 0.0, "bool");
+
+            Engine::WorldGeneratorSettings l_GeneratorSettings;
+            l_GeneratorSettings.Seed = 20240611;
+            const Engine::WorldGenerator l_Generator(l_GeneratorSettings);
+            Engine::JobSystem l_JobSystem(std::max(std::thread::hardware_concurrency(), 2u) - 1);
+
+            // The detail area, as chunk streaming would have loaded it.
+            std::vector<Engine::ChunkCoord> l_DetailCoords;
+            for (int32_t z = -s_DetailRadius; z <= s_DetailRadius; ++z)
+            {
+                for (int32_t x = -s_DetailRadius; x <= s_DetailRadius; ++x)
+                {
+                    for (int32_t y = 0; y < s_ChunkLayers && x * x + z * z <= s_DetailRadius * s_DetailRadius; ++y)
+                    {
+                        l_DetailCoords.push_back({ x, y, z });
+                    }
+                }
+            }
+
+            // Build every ring from nothing, generating the far sources on demand. Those sources stay in the world,
+            // so each run starts over from a freshly generated detail area; the last run's world and LOD are kept.
+            std::unique_ptr<Engine::World> l_World;
+            std::unique_ptr<Engine::TerrainLod> l_Lod;
+            std::array<uint32_t, Engine::TerrainLodMaxLevels + 1> l_UploadCounts{};
+            DownsampleTotals l_BuildTotals;
+            bool l_IsValid = l_FiltersValid;
+            const std::vector<double> l_BuildMilliseconds = CollectRepeated([&]()
+                {
+                    l_Lod.reset();
+                    l_World = std::make_unique<Engine::World>();
+                    std::shared_ptr<Engine::WorldGenerationBatch> l_Batch = l_Generator.GenerateAsync(l_JobSystem, l_DetailCoords);
+                    l_JobSystem.WaitForCounter(l_Batch->GetCounter());
+                    for (std::unique_ptr<Engine::Chunk>& it_Chunk : l_Batch->GetChunks())
+                    {
+                        l_World->InsertChunk(std::move(it_Chunk));
+                    }
+
+                    l_Lod = std::make_unique<Engine::TerrainLod>(l_JobSystem, l_Table, l_LodSettings);
+                    l_UploadCounts = {};
+                    l_Lod->SetUploadCallback([&l_UploadCounts](uint32_t level, Engine::ChunkMesh&)
+                        {
+                            ++l_UploadCounts[level];
+                        });
+
+                    for (const Engine::ChunkCoord& it_Coord : l_DetailCoords)
+                    {
+                        l_Lod->OnChunkChanged(*l_World->FindChunk(it_Coord));
+                    }
+                    l_BuildTotals = DownsampleTotals();
+                    Stopwatch l_Stopwatch;
+                    l_IsValid = PumpUntilIdle(l_JobSystem, *l_Lod, *l_World, l_Generator, l_BuildTotals) && l_IsValid;
+
+                    return l_Stopwatch.GetElapsedSeconds() * 1000.0;
+                });
+            ReportSamples("initial_build_ms", l_BuildMilliseconds, "ms");
+            ReportMetric("downsample_us_per_chunk", l_BuildTotals.Count > 0 ? l_BuildTotals.Milliseconds * 1000.0 / l_BuildTotals.Count : 0.0, "us");
+            ReportMetric("source_chunks", static_cast<double>(l_World->GetChunkCount()), "chunks");
+
+            // Every column within the outermost reach belongs to exactly one of: detail chunks or one shown section.
+            const uint32_t l_TopLevel = l_LodSettings.LevelCount;
+            const int32_t l_Reach = l_Lod->GetReach(l_TopLevel);
+            uint32_t l_CoverageErrors = 0;
+            for (int32_t z = -l_Reach; z <= l_Reach; ++z)
+            {
+                for (int32_t x = -l_Reach; x <= l_Reach; ++x)
+                {
+                    if (x * x + z * z > l_Reach * l_Reach)
+                    {
+                        continue;
+                    }
+
+                    uint32_t l_Owners = l_Lod->IsDetailColumn({ x, 0, z }) ? 1 : 0;
+                    for (uint32_t l_Level = 1; l_Level <= l_TopLevel; ++l_Level)
+                    {
+                        const Engine::ChunkCoord l_Section = Engine::TerrainLod::GetSectionCoord(l_Level, { x, 0, z });
+                        const std::vector<Engine::ChunkCoord>& l_Active = l_Lod->GetActiveSections(l_Level);
+                        l_Owners += std::find(l_Active.begin(), l_Active.end(), l_Section) != l_Active.end() ? 1 : 0;
+                    }
+                    l_CoverageErrors += l_Owners == 1 ? 0 : 1;
+                }
+            }
+            ReportMetric("coverage_errors", l_CoverageErrors, "columns");
+            l_IsValid = l_IsValid && l_CoverageErrors == 0;
+
+            // Per-level cost, meshed synchronously here so the figures do not depend on worker scheduling.
+            Engine::ChunkMesherSettings l_MesherSettings;
+            l_MesherSettings.ComputeConnectivity = false;
+            Engine::ChunkMesher l_Mesher(l_MesherSettings);
+            Engine::PaddedChunkView l_View;
+            Engine::ChunkMesh l_Mesh;
+
+            // One idle frame, so the stats include the meshes published during the last one.
+            l_Lod->Update(s_Focus);
+            const Engine::TerrainLodStats& l_Stats = l_Lod->GetLastFrameStats();
+            uint64_t l_LodVertices = 0;
+            size_t l_LodBytes = 0;
+            for (uint32_t l_Level = 1; l_Level <= l_TopLevel; ++l_Level)
+            {
+                const ActiveSectionProvider l_Provider(*l_Lod, l_Level);
+                uint64_t l_Vertices = 0;
+                const std::vector<double> l_Seconds = MeasureRepeated([&]()
+                    {
+                        l_Vertices = 0;
+                        for (const Engine::ChunkCoord& it_Section : l_Lod->GetActiveSections(l_Level))
+                        {
+                            l_Vertices += MeshOne(l_Provider, it_Section, l_Table, l_Mesher, l_View, l_Mesh);
+                        }
+                    });
+
+                const Engine::TerrainLodLevelStats& l_LevelStats = l_Stats.Levels[l_Level - 1];
+                const std::string l_Prefix = "level" + std::to_string(l_Level);
+                ReportMetric(l_Prefix + ".active_sections", l_LevelStats.ActiveCount, "sections");
+                ReportMetric(l_Prefix + ".vertices", static_cast<double>(l_Vertices), "vertices");
+                ReportSamples(l_Prefix + ".mesh_ms", ToPerItem(l_Seconds, 1.0, 1000.0), "ms");
+                ReportMetric(l_Prefix + ".cell_kb", l_LevelStats.MemoryBytes / 1024.0, "KB");
+
+                // Every shown section was meshed, and the resident meshes match meshing the final cells directly.
+                l_IsValid = l_IsValid && l_Vertices == l_LevelStats.VertexCount && l_UploadCounts[l_Level] >= l_LevelStats.ActiveCount;
+                l_LodVertices += l_Vertices;
+                l_LodBytes += l_LevelStats.MemoryBytes;
+            }
+
+            // Full detail for comparison: the detail area alone, and everything out to the outermost reach.
+            uint64_t l_DetailVertices = 0;
+            uint64_t l_ReachVertices = 0;
+            size_t l_DetailBytes = 0;
+            size_t l_ReachBytes = 0;
+            const std::vector<double> l_ReachMeshSeconds = MeasureRepeated([&]()
+                {
+                    l_DetailVertices = 0;
+                    l_ReachVertices = 0;
+                    l_DetailBytes = 0;
+                    l_ReachBytes = 0;
+                    l_World->ForEachChunk([&](const Engine::Chunk& chunk)
+                        {
+                            const Engine::ChunkCoord& l_Coord = chunk.GetCoord();
+                            if (GetColumnDistanceSquared(l_Coord) > static_cast<int64_t>(l_Reach) * l_Reach)
+                            {
+                                return;
+                            }
+
+                            const size_t l_Vertices = MeshOne(*l_World, l_Coord, l_Table, l_Mesher, l_View, l_Mesh);
+                            l_ReachVertices += l_Vertices;
+                            l_ReachBytes += chunk.GetMemoryUsage();
+                            if (l_Lod->IsDetailColumn(l_Coord))
+                            {
+                                l_DetailVertices += l_Vertices;
+                                l_DetailBytes += chunk.GetMemoryUsage();
+                            }
+                        });
+                });
+
+            const uint64_t l_TotalVertices = l_DetailVertices + l_LodVertices;
+            const size_t l_TotalBytes = l_DetailBytes + l_LodBytes + l_TotalVertices * sizeof(Engine::PackedChunkVertex);
+            const size_t l_FullBytes = l_ReachBytes + l_ReachVertices * sizeof(Engine::PackedChunkVertex);
+            ReportMetric("reach_multiplier", static_cast<double>(l_Reach) / s_DetailRadius, "x");
+            ReportMetric("detail.vertices", static_cast<double>(l_DetailVertices), "vertices");
+            ReportMetric("lod.total_vertices", static_cast<double>(l_TotalVertices), "vertices");
+            ReportMetric("full_reach.vertices", static_cast<double>(l_ReachVertices), "vertices");
+            ReportSamples("full_reach.mesh_ms", ToPerItem(l_ReachMeshSeconds, 1.0, 1000.0), "ms");
+            ReportMetric("lod.total_mb", l_TotalBytes / (1024.0 * 1024.0), "MB");
+            ReportMetric("full_reach.total_mb", l_FullBytes / (1024.0 * 1024.0), "MB");
+            ReportMetric("lod.vertices_vs_detail_only", static_cast<double>(l_TotalVertices) / static_cast<double>(std::max<uint64_t>(l_DetailVertices, 1)), "x");
+            ReportMetric("lod.vertices_vs_full_reach", static_cast<double>(l_TotalVertices) / static_cast<double>(std::max<uint64_t>(l_ReachVertices, 1)), "x");
+
+            // The far rings have to be far cheaper than meshing them at full detail.
+            l_IsValid = l_IsValid && l_LodVertices > 0 && l_TotalVertices * 3 < l_ReachVertices && l_TotalBytes * 3 < l_FullBytes;
+
+            // An edit in a coarse ring: raise a 24-block stone cube inside a source under a level-2 section.
+            const std::vector<Engine::ChunkCoord>& l_LevelTwo = l_Lod->GetActiveSections(2);
+            if (l_LevelTwo.empty())
+            {
+                return false;
+            }
+            const Engine::ChunkCoord l_EditSource{ l_LevelTwo.front().X * 4 + 1, 2, l_LevelTwo.front().Z * 4 + 2 };
+            Engine::Chunk* l_EditChunk = l_World->FindChunk(l_EditSource);
+            if (l_EditChunk == nullptr)
+            {
+                return false;
+            }
+
+            // Alternate the cube between two materials so every run is a real change that rebuilds the same sections.
+            const Engine::BlockId l_Stone = l_Registry.FindBlock("stone");
+            const Engine::BlockId l_Dirt = l_Registry.FindBlock("dirt");
+            uint32_t l_EditRun = 0;
+            const std::vector<double> l_EditMilliseconds = CollectRepeated([&]()
+                {
+                    const Engine::BlockId l_Block = (l_EditRun++ & 1) == 0 ? l_Stone : l_Dirt;
+                    for (int32_t y = 4; y < 28; ++y)
+                    {
+                        for (int32_t z = 4; z < 28; ++z)
+                        {
+                            for (int32_t x = 4; x < 28; ++x)
+                            {
+                                l_EditChunk->SetBlock(x, y, z, l_Block);
+                            }
+                        }
+                    }
+
+                    l_UploadCounts = {};
+                    DownsampleTotals l_EditTotals;
+                    Stopwatch l_Stopwatch;
+                    l_Lod->OnChunkChanged(*l_EditChunk);
+                    l_IsValid = PumpUntilIdle(l_JobSystem, *l_Lod, *l_World, l_Generator, l_EditTotals) && l_IsValid;
+
+                    return l_Stopwatch.GetElapsedSeconds() * 1000.0;
+                });
+            ReportSamples("edit.rebuild_ms", l_EditMilliseconds, "ms");
+            ReportMetric("edit.remeshed_sections", l_UploadCounts[1] + l_UploadCounts[2] + l_UploadCounts[3], "sections");
+            l_IsValid = l_IsValid && l_UploadCounts[2] > 0;
+
+            // The incremental result must match downsampling the edited world from scratch.
+            std::unique_ptr<Engine::TerrainLod> l_Reference;
+            const std::vector<double> l_FullSeconds = MeasureRepeated([&]()
+                {
+                    l_Reference = std::make_unique<Engine::TerrainLod>(l_JobSystem, l_Table, l_LodSettings);
+                    DownsampleTotals l_FullTotals;
+                    l_World->ForEachChunk([&l_Reference](const Engine::Chunk& chunk)
+                        {
+                            l_Reference->OnChunkChanged(chunk);
+                        });
+                    l_IsValid = PumpUntilIdle(l_JobSystem, *l_Reference, *l_World, l_Generator, l_FullTotals) && l_IsValid;
+                });
+            ReportSamples("full_rebuild_ms", ToPerItem(l_FullSeconds, 1.0, 1000.0), "ms");
+
+            uint32_t l_Mismatches = 0;
+            for (uint32_t l_Level = 1; l_Level <= l_TopLevel; ++l_Level)
+            {
+                for (const Engine::ChunkCoord& it_Section : l_Lod->GetActiveSections(l_Level))
+                {
+                    const Engine::Chunk* l_Incremental = l_Lod->FindSection(l_Level, it_Section);
+                    const Engine::Chunk* l_Full = l_Reference->FindSection(l_Level, it_Section);
+                    if (l_Incremental == nullptr || l_Full == nullptr)
+                    {
+                        l_Mismatches += l_Incremental != l_Full ? 1 : 0;
+                        continue;
+                    }
+
+                    for (uint32_t i = 0; i < Engine::Chunk::Volume; ++i)
+                    {
+                        if (l_Incremental->GetBlock(i) != l_Full->GetBlock(i))
+                        {
+                            ++l_Mismatches;
+                            break;
+                        }
+                    }
+                }
+            }
+            ReportMetric("incremental_mismatched_sections", l_Mismatches, "sections");
+            l_IsValid = l_IsValid && l_Mismatches == 0;
+
+            return l_IsValid;
+        }
+    }
+
+    REGISTER_BENCHMARK("TerrainLod", "Downsampled terrain rings at 2x/4x/8x out to 4.5x the detail distance: vertices, memory and build time per level vs full detail", RunTerrainLodBenchmark);
+}
@@ -0,0 +1,103 @@
+#include "Benchmark.h"
+
+#include "Engine/Assets/TextureAtlas.h"
+#include "Engine/Assets/TextureAtlasBuilder.h"
+#include "Engine/IO/MappedFile.h"
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+#include <vector>
+
+namespace Benchmarks
+{
+    namespace
+    {
+        bool RunTextureAtlasBenchmark()
+        {
+            Engine::TextureAtlasDescriptor l_Descriptor;
+            l_Descriptor.SourcePath = std::filesystem::path(BENCHMARK_ASSET_DIRECTORY) / "Textures" / "Atlas.png";
+            l_Descriptor.TileSize = 16;
+
+            const std::filesystem::path l_Directory = std::filesystem::temp_directory_path() / "TextureAtlasBenchmark";
+            const std::filesystem::path l_CachePath = l_Directory / "Atlas.mcatlas";
+            std::error_code l_Error;
+            std::filesystem::remove_all(l_Directory, l_Error);
+
+            Engine::MappedFile l_Source;
+            if (!l_Source.Open(l_Descriptor.SourcePath))
+            {
+                ReportMetric("source_missing", 1.0, "bool");
+
+                return false;
+            }
+
+            // The startup cost the cache removes: PNG decode, then slicing, deduplication and mip filtering.
+            Engine::TextureAtlasBuilder::AtlasImage l_Image;
+            const std::vector<double> l_DecodeSeconds = MeasureRepeated([&l_Source, &l_Image]()
+                {
+                    Engine::TextureAtlasBuilder::DecodeImage(l_Source.GetData(), l_Source.GetSize(), l_Image);
+                });
+            ReportSamples("cold.decode_ms", ToPerItem(l_DecodeSeconds, 1.0, 1000.0), "ms");
+
+            std::vector<uint8_t> l_Blob;
+            bool l_HasCooked = true;
+            const std::vector<double> l_CookSeconds = MeasureRepeated([&l_Image, &l_Descriptor, &l_Blob, &l_HasCooked]()
+                {
+                    l_HasCooked = Engine::TextureAtlasBuilder::Cook(l_Image, l_Descriptor, 0, l_Blob) && l_HasCooked;
+                });
+            ReportSamples("cold.cook_ms", ToPerItem(l_CookSeconds, 1.0, 1000.0), "ms");
+
+            // First start: hashes the source, misses, cooks and writes the cache.
+            Stopwatch l_Stopwatch;
+            Engine::TextureAtlas l_ColdAtlas;
+            const bool l_HasBuilt = l_ColdAtlas.LoadOrBuild(l_Descriptor, l_CachePath);
+            ReportMetric("cold.load_or_build_ms", l_Stopwatch.GetElapsedSeconds() * 1000.0, "ms");
+
+            // Every later start: hash the source, map the cache, check the tables.
+            const std::vector<double> l_WarmSeconds = MeasureRepeated([&l_Descriptor, &l_CachePath]()
+                {
+                    Engine::TextureAtlas l_Atlas;
+                    l_Atlas.LoadOrBuild(l_Descriptor, l_CachePath);
+                });
+            ReportSamples("warm.load_ms", ToPerItem(l_WarmSeconds, 1.0, 1000.0), "ms");
+
+            const bool l_IsValid = l_HasBuilt && l_HasCooked && l_ColdAtlas.IsOpen();
+            if (!l_IsValid)
+            {
+                return false;
+            }
+
+            ReportMetric("source_tiles", l_ColdAtlas.GetSourceTileCount(), "tiles");
+            ReportMetric("layers", l_ColdAtlas.GetLayerCount(), "layers");
+            ReportMetric("mip_levels", l_ColdAtlas.GetMipLevelCount(), "levels");
+            ReportMetric("cache_bytes", static_cast<double>(l_ColdAtlas.GetBlobSize()), "bytes");
+
+            // The in-memory cook and the cached file must hold the same texels (the hash field aside).
+            Engine::TextureAtlasBuilder::Cook(l_Image, l_Descriptor, l_ColdAtlas.GetSourceHash(), l_Blob);
+            Engine::MappedFile l_Cache;
+            const bool l_Matches = l_Cache.Open(l_CachePath) && l_Cache.GetSize() == l_Blob.size()
+                && std::memcmp(l_Cache.GetData(), l_Blob.data(), l_Blob.size()) == 0;
+            ReportMetric("cache_matches_cook", l_Matches ? 1.0 : 0.0, "bool");
+
+            // Every mapped tile must point at a real layer, and the chain must end at 1x1.
+            bool l_HasValidTables = l_ColdAtlas.GetMipExtent(l_ColdAtlas.GetMipLevelCount() - 1) == 1;
+            for (uint32_t i = 0; i < l_ColdAtlas.GetSourceTileCount(); ++i)
+            {
+                const bool l_IsEmpty = (l_ColdAtlas.GetTileFlags(i) & Engine::TileFlagEmpty) != 0;
+                const uint16_t l_Layer = l_ColdAtlas.GetLayer(i);
+                l_HasValidTables = l_HasValidTables && (l_IsEmpty ? l_Layer == Engine::TextureAtlas::InvalidLayer : l_Layer < l_ColdAtlas.GetLayerCount());
+            }
+            ReportMetric("tables_valid", l_HasValidTables ? 1.0 : 0.0, "bool");
+
+            l_Cache.Close();
+            l_ColdAtlas.Close();
+            std::filesystem::remove_all(l_Directory, l_Error);
+
+            return l_Matches && l_HasValidTables;
+        }
+    }
+
+    REGISTER_BENCHMARK("TextureAtlas", "Cold atlas cook (PNG decode, tile dedupe, linear-light mip chains) versus a warm start that maps the cache", RunTextureAtlasBenchmark);
+}
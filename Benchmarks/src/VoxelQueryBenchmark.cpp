@@ -0,0 +1,438 @@
+#include "Benchmark.h"
+
+#include "Engine/Jobs/JobSystem.h"
+#include "Engine/World/BlockRegistry.h"
+#include "Engine/World/VoxelQuery.h"
+#include "Engine/World/World.h"
+#include "Engine/World/WorldGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Benchmarks
+{
+    namespace
+    {
+        constexpr int32_t s_RegionSize = 8;
+        constexpr int32_t s_ChunkLayers = 6;
+        constexpr uint32_t s_RayCount = 16384;
+        constexpr uint32_t s_EntityCount = 4096;
+        constexpr uint32_t s_TickCount = 40;
+
+        // Player-sized box: 0.6 wide, 1.8 tall.
+        constexpr float s_EntityHalfWidth = 0.3f;
+        constexpr float s_EntityHeight = 1.8f;
+
+        struct RayScenario
+        {
+            const char* Name;
+
+            // Origins are drawn this far above (or, when negative, below) the surface.
+            float MinHeight;
+            float MaxHeight;
+            float MaxDistance;
+            uint8_t HitFlags;
+        };
+
+        int32_t FindSurface(const Engine::World& world, const Engine::BlockRegistry& registry, int32_t worldX, int32_t worldZ)
+        {
+            for (int32_t y = s_ChunkLayers * Engine::Chunk::Size - 1; y >= 0; --y)
+            {
+                if (registry.IsSolid(world.GetBlock(worldX, y, worldZ)))
+                {
+                    return y;
+                }
+            }
+
+            return 0;
+        }
+
+        // A hit must be a matching block whose entry face the ray actually crosses at the reported distance, and
+        // points sampled finely along the ray before it must not be inside a matching block.
+        bool IsHitConsistent(const Engine::World& world, const Engine::BlockRegistry& registry, const Engine::VoxelRay& ray, const Engine::VoxelRayHit& hit,
+            uint8_t hitFlags)
+        {
+            const glm::vec3 l_Direction = glm::normalize(ray.Direction);
+            const float l_End = hit.IsHit ? hit.Distance : ray.MaxDistance;
+            for (float l_Distance = 0.0f; l_Distance < l_End - 0.01f; l_Distance += 0.05f)
+            {
+                const glm::vec3 l_Point = ray.Origin + l_Direction * l_Distance;
+                const Engine::BlockId l_Block = world.GetBlock(static_cast<int32_t>(std::floor(l_Point.x)), static_cast<int32_t>(std::floor(l_Point.y)),
+                    static_cast<int32_t>(std::floor(l_Point.z)));
+
+                // Points right on a block boundary may round into either block.
+                const bool l_IsOnBoundary = std::fabs(l_Point.x - std::round(l_Point.x)) < 0.01f || std::fabs(l_Point.y - std::round(l_Point.y)) < 0.01f
+                    || std::fabs(l_Point.z - std::round(l_Point.z)) < 0.01f;
+                if (!l_IsOnBoundary && (registry.GetFlags(l_Block) & hitFlags) != 0)
+                {
+                    return false;
+                }
+            }
+
+            if (!hit.IsHit)
+            {
+                return true;
+            }
+
+            if (hit.Distance > ray.MaxDistance || (registry.GetFlags(hit.Block) & hitFlags) == 0
+                || world.GetBlock(hit.Position.x, hit.Position.y, hit.Position.z) != hit.Block)
+            {
+                return false;
+            }
+
+            // The entry point lies on the reported face of the hit block.
+            const glm::vec3 l_Entry = ray.Origin + l_Direction * hit.Distance;
+            const glm::vec3 l_Local = l_Entry - glm::vec3(static_cast<float>(hit.Position.x), static_cast<float>(hit.Position.y), static_cast<float>(hit.Position.z));
+            switch (hit.Face)
+            {
+            case Engine::BlockFace::PositiveX: return std::fabs(l_Local.x - 1.0f) < 1.0e-3f;
+            case Engine::BlockFace::NegativeX: return std::fabs(l_Local.x) < 1.0e-3f;
+            case Engine::BlockFace::PositiveY: return std::fabs(l_Local.y - 1.0f) < 1.0e-3f;
+            case Engine::BlockFace::NegativeY: return std::fabs(l_Local.y) < 1.0e-3f;
+            case Engine::BlockFace::PositiveZ: return std::fabs(l_Local.z - 1.0f) < 1.0e-3f;
+            case Engine::BlockFace::NegativeZ: return std::fabs(l_Local.z) < 1.0e-3f;
+            default: return hit.Distance == 0.0f;
+            }
+        }
+
+        // Whether a box overlaps any solid block by more than the query's skin.
+        bool IsBoxInsideSolid(const Engine::World& world, const Engine::BlockRegistry& registry, const Engine::VoxelBox& box)
+        {
+            const float l_Tolerance = 2.0e-3f;
+            for (int32_t y = static_cast<int32_t>(std::floor(box.Min.y + l_Tolerance)); y <= static_cast<int32_t>(std::floor(box.Max.y - l_Tolerance)); ++y)
+            {
+                for (int32_t z = static_cast<int32_t>(std::floor(box.Min.z + l_Tolerance)); z <= static_cast<int32_t>(std::floor(box.Max.z - l_Tolerance)); ++z)
+                {
+                    for (int32_t x = static_cast<int32_t>(std::floor(box.Min.x + l_Tolerance)); x <= static_cast<int32_t>(std::floor(box.Max.x - l_Tolerance)); ++x)
+                    {
+                        if (registry.IsSolid(world.GetBlock(x, y, z)))
+                        {
+                            return true;
+                        }
+                    }
+                }
+            }
+
+            return false;
+        }
+
+        bool RunVoxelQueryBenchmark()
+        {
+            Engine::BlockRegistry l_Registry;
+            if (!l_Registry.LoadFromFile(std::filesystem::path(BENCHMARK_ASSET_DIRECTORY) / "Blocks" / "Blocks.yaml"))
+            {
+                return false;
+            }
+
+            std::vector<Engine::ChunkCoord> l_Coords;
+            for (int32_t y = 0; y < s_ChunkLayers; ++y)
+            {
+                for (int32_t z = 0; z < s_RegionSize; ++z)
+                {
+                    for (int32_t x = 0; x < s_RegionSize; ++x)
+                    {
+                        l_Coords.push_back({ x - s_RegionSize / 2, y, z - s_RegionSize / 2 });
+                    }
+                }
+            }
+
+            Engine::WorldGeneratorSettings l_Settings;
+            l_Settings.Seed = 20240611;
+            const Engine::WorldGenerator l_Generator(l_Settings);
+
+            Engine::JobSystem l_JobSystem(std::max(std::thread::hardware_concurrency(), 2u) - 1);
+            const double l_ThreadCount = static_cast<double>(l_JobSystem.GetWorkerCount() + 1);
+            Engine::World l_World;
+            {
+                std::shared_ptr<Engine::WorldGenerationBatch> l_Batch = l_Generator.GenerateAsync(l_JobSystem, l_Coords);
+                l_JobSystem.WaitForCounter(l_Batch->GetCounter());
+                for (std::unique_ptr<Engine::Chunk>& it_Chunk : l_Batch->GetChunks())
+                {
+                    it_Chunk->Compact();
+                    l_World.InsertChunk(std::move(it_Chunk));
+                }
+            }
+
+            const Engine::VoxelQuery l_Query(l_World, l_Registry);
+            bool l_IsValid = true;
+
+            // Hand-checked cases on a flat stone floor in the air above the terrain.
+            {
+                const int32_t l_FloorY = s_ChunkLayers * Engine::Chunk::Size - 8;
+                const Engine::BlockId l_Stone = l_Registry.FindBlock("stone");
+                for (int32_t z = -4; z <= 4; ++z)
+                {
+                    for (int32_t x = -4; x <= 4; ++x)
+                    {
+                        l_World.SetBlock(x, l_FloorY, z, l_Stone);
+                    }
+                }
+                l_World.SetBlock(2, l_FloorY + 1, 0, l_Stone);
+
+                const Engine::VoxelRayHit l_Down = l_Query.Raycast({ glm::vec3(0.5f, l_FloorY + 3.5f, 0.5f), glm::vec3(0.0f, -1.0f, 0.0f), 8.0f });
+                const Engine::VoxelRayHit l_Side = l_Query.Raycast({ glm::vec3(0.5f, l_FloorY + 1.5f, 0.5f), glm::vec3(1.0f, 0.0f, 0.0f), 8.0f });
+                const Engine::VoxelRayHit l_Short = l_Query.Raycast({ glm::vec3(0.5f, l_FloorY + 3.5f, 0.5f), glm::vec3(0.0f, -1.0f, 0.0f), 2.0f });
+                const bool l_RaysAgree = l_Down.IsHit && l_Down.Position == glm::ivec3(0, l_FloorY, 0) && l_Down.Face == Engine::BlockFace::PositiveY
+                    && std::fabs(l_Down.Distance - 2.5f) < 1.0e-4f && l_Side.IsHit && l_Side.Position == glm::ivec3(2, l_FloorY + 1, 0)
+                    && l_Side.Face == Engine::BlockFace::NegativeX && std::fabs(l_Side.Distance - 1.5f) < 1.0e-4f && !l_Short.IsHit;
+
+                // A falling box lands flush on the floor, and walking into the step stops at its side.
+                const Engine::VoxelBox l_Box{ glm::vec3(0.2f, l_FloorY + 1.5f, 0.2f), glm::vec3(0.8f, l_FloorY + 3.3f, 0.8f) };
+                const Engine::VoxelSweepResult l_Fall = l_Query.SweepBox({ l_Box, glm::vec3(0.0f, -4.0f, 0.0f) });
+                const Engine::VoxelBox l_Landed{ l_Box.Min + l_Fall.Motion, l_Box.Max + l_Fall.Motion };
+                const Engine::VoxelSweepResult l_Walk = l_Query.SweepBox({ l_Landed, glm::vec3(3.0f, -0.1f, 0.0f) });
+                const bool l_SweepsAgree = l_Fall.IsOnGround && std::fabs(l_Landed.Min.y - (l_FloorY + 1.0f)) < 1.0e-4f && l_Walk.IsOnGround
+                    && l_Walk.IsBlocked(0) && std::fabs(l_Landed.Max.x + l_Walk.Motion.x - 2.0f) < 1.0e-4f && l_Walk.Motion.y == 0.0f;
+
+                ReportMetric("cases.rays_correct", l_RaysAgree ? 1.0 : 0.0, "bool");
+                ReportMetric("cases.sweeps_correct", l_SweepsAgree ? 1.0 : 0.0, "bool");
+                l_IsValid = l_IsValid && l_RaysAgree && l_SweepsAgree;
+
+                for (int32_t z = -4; z <= 4; ++z)
+                {
+                    for (int32_t x = -4; x <= 4; ++x)
+                    {
+                        l_World.SetBlock(x, l_FloorY, z, Engine::AirBlockId);
+                    }
+                }
+                l_World.SetBlock(2, l_FloorY + 1, 0, Engine::AirBlockId);
+            }
+
+            // Origins stay within the middle half of the region so rays and entities never leave it sideways.
+            const float l_Extent = s_RegionSize * Engine::Chunk::Size * 0.25f;
+            std::mt19937 l_Random(4242);
+            std::uniform_real_distribution<float> l_Horizontal(-l_Extent, l_Extent);
+            std::uniform_real_distribution<float> l_Unit(-1.0f, 1.0f);
+
+            // Picking from eye height, long rays from the sky over open terrain, and x-ray rays through the rock
+            // that never stop, so every step reads a mixed chunk.
+            const RayScenario l_Scenarios[] =
+            {
+                { "pick", 1.6f, 1.6f, 8.0f, Engine::BlockRegistry::FlagSolid },
+                { "sparse", 16.0f, 48.0f, 96.0f, Engine::BlockRegistry::FlagSolid },
+                { "dense", -40.0f, -8.0f, 64.0f, 0 }
+            };
+
+            for (const RayScenario& it_Scenario : l_Scenarios)
+            {
+                std::uniform_real_distribution<float> l_Height(it_Scenario.MinHeight, it_Scenario.MaxHeight);
+                std::vector<Engine::VoxelRay> l_Rays(s_RayCount);
+                for (Engine::VoxelRay& it_Ray : l_Rays)
+                {
+                    const float l_X = l_Horizontal(l_Random);
+                    const float l_Z = l_Horizontal(l_Random);
+                    const int32_t l_Surface = FindSurface(l_World, l_Registry, static_cast<int32_t>(std::floor(l_X)), static_cast<int32_t>(std::floor(l_Z)));
+                    it_Ray.Origin = glm::vec3(l_X, static_cast<float>(l_Surface + 1) + l_Height(l_Random), l_Z);
+
+                    // Picks and sky rays look downwards more often than not, like a player would.
+                    glm::vec3 l_Direction(l_Unit(l_Random), l_Unit(l_Random), l_Unit(l_Random));
+                    if (it_Scenario.HitFlags != 0)
+                    {
+                        l_Direction.y = -std::fabs(l_Direction.y) * 0.75f;
+                    }
+                    it_Ray.Direction = glm::length(l_Direction) > 0.01f ? l_Direction : glm::vec3(1.0f, 0.0f, 0.0f);
+                    it_Ray.MaxDistance = it_Scenario.MaxDistance;
+                }
+
+                std::vector<Engine::VoxelRayHit> l_Hits(l_Rays.size());
+                uint32_t l_LookupCount = 0;
+                const std::vector<double> l_SingleSeconds = MeasureRepeated([&]()
+                    {
+                        Engine::BlockCursor l_Cursor(l_World);
+                        for (size_t i = 0; i < l_Rays.size(); ++i)
+                        {
+                            l_Hits[i] = l_Query.Raycast(l_Rays[i], l_Cursor, it_Scenario.HitFlags);
+                        }
+                        l_LookupCount = l_Cursor.GetLookupCount();
+                    });
+
+                std::vector<Engine::VoxelRayHit> l_BatchHits;
+                const std::vector<double> l_BatchSeconds = MeasureRepeated([&]()
+                    {
+                        l_Query.RaycastBatch(l_JobSystem, l_Rays, l_BatchHits, it_Scenario.HitFlags);
+                    });
+
+                uint64_t l_StepCount = 0;
+                uint32_t l_HitCount = 0;
+                uint32_t l_Mismatches = 0;
+                for (size_t i = 0; i < l_Rays.size(); ++i)
+                {
+                    l_StepCount += l_Hits[i].StepCount;
+                    l_HitCount += l_Hits[i].IsHit ? 1 : 0;
+                    const bool l_SameHit = l_Hits[i].IsHit == l_BatchHits[i].IsHit && l_Hits[i].Position == l_BatchHits[i].Position
+                        && l_Hits[i].Distance == l_BatchHits[i].Distance && l_Hits[i].StepCount == l_BatchHits[i].StepCount;
+                    l_Mismatches += l_SameHit ? 0 : 1;
+                }
+
+                // The sampled check is slow, so only a slice of the rays goes through it.
+                uint32_t l_Inconsistent = 0;
+                for (size_t i = 0; i < l_Rays.size(); i += 16)
+                {
+                    l_Inconsistent += IsHitConsistent(l_World, l_Registry, l_Rays[i], l_Hits[i], it_Scenario.HitFlags) ? 0 : 1;
+                }
+
+                const double l_SingleMedian = Summarize(l_SingleSeconds).Median;
+                const double l_BatchMedian = Summarize(l_BatchSeconds).Median;
+                const std::string l_Prefix = std::string("ray.") + it_Scenario.Name;
+                ReportMetric(l_Prefix + ".rays_per_second", static_cast<double>(l_Rays.size()) / l_SingleMedian, "rays/s");
+                ReportMetric(l_Prefix + ".batch.rays_per_second", static_cast<double>(l_Rays.size()) / l_BatchMedian, "rays/s");
+                ReportMetric(l_Prefix + ".batch.rays_per_second_per_thread", static_cast<double>(l_Rays.size()) / l_BatchMedian / l_ThreadCount, "rays/s");
+                ReportMetric(l_Prefix + ".blocks_per_second", static_cast<double>(l_StepCount) / l_SingleMedian, "blocks/s");
+                ReportMetric(l_Prefix + ".blocks_per_ray", static_cast<double>(l_StepCount) / static_cast<double>(l_Rays.size()), "blocks");
+                ReportMetric(l_Prefix + ".chunk_lookups_per_ray", static_cast<double>(l_LookupCount) / static_cast<double>(l_Rays.size()), "lookups");
+                ReportMetric(l_Prefix + ".hit_fraction", static_cast<double>(l_HitCount) / static_cast<double>(l_Rays.size()), "fraction");
+                ReportMetric(l_Prefix + ".batch_mismatches", l_Mismatches, "rays");
+                ReportMetric(l_Prefix + ".inconsistent_hits", l_Inconsistent, "rays");
+
+                // Cached chunk pointers must keep lookups far below one per block visited.
+                l_IsValid = l_IsValid && l_Mismatches == 0 && l_Inconsistent == 0 && l_LookupCount * 4 < l_StepCount;
+                l_IsValid = l_IsValid && (it_Scenario.HitFlags == 0 ? l_HitCount == 0 : l_HitCount > 0);
+            }
+
+            // Entities dropped above the terrain wander and fall under gravity for a couple of seconds of ticks.
+            {
+                std::vector<Engine::VoxelSweep> l_Start(s_EntityCount);
+                std::vector<glm::vec3> l_Velocities(s_EntityCount);
+                for (uint32_t i = 0; i < s_EntityCount; ++i)
+                {
+                    const float l_X = l_Horizontal(l_Random);
+                    const float l_Z = l_Horizontal(l_Random);
+                    // The box spans up to four columns; start above the highest of them.
+                    int32_t l_Surface = 0;
+                    for (float l_CornerX : { l_X - s_EntityHalfWidth, l_X + s_EntityHalfWidth })
+                    {
+                        for (float l_CornerZ : { l_Z - s_EntityHalfWidth, l_Z + s_EntityHalfWidth })
+                        {
+                            l_Surface = std::max(l_Surface, FindSurface(l_World, l_Registry, static_cast<int32_t>(std::floor(l_CornerX)), static_cast<int32_t>(std::floor(l_CornerZ))));
+                        }
+                    }
+                    const float l_Bottom = static_cast<float>(l_Surface + 1) + 6.0f * (l_Unit(l_Random) + 1.0f);
+                    l_Start[i].Box = { glm::vec3(l_X - s_EntityHalfWidth, l_Bottom, l_Z - s_EntityHalfWidth), glm::vec3(l_X + s_EntityHalfWidth, l_Bottom + s_EntityHeight, l_Z + s_EntityHalfWidth) };
+                    l_Velocities[i] = glm::vec3(l_Unit(l_Random) * 0.2f, 0.0f, l_Unit(l_Random) * 0.2f);
+                }
+
+                // Runs every tick through either path; the result of each tick feeds the next.
+                const auto a_Simulate = [&](bool useBatch, std::vector<Engine::VoxelSweep>& sweeps, uint32_t& outGrounded)
+                    {
+                        sweeps = l_Start;
+                        std::vector<glm::vec3> l_Velocity = l_Velocities;
+                        std::vector<Engine::VoxelSweepResult> l_Results(sweeps.size());
+                        for (uint32_t l_Tick = 0; l_Tick < s_TickCount; ++l_Tick)
+                        {
+                            for (size_t i = 0; i < sweeps.size(); ++i)
+                            {
+                                l_Velocity[i].y = std::max(l_Velocity[i].y - 0.08f, -3.0f);
+                                sweeps[i].Motion = l_Velocity[i];
+                            }
+
+                            if (useBatch)
+                            {
+                                l_Query.SweepBatch(l_JobSystem, sweeps, l_Results);
+                            }
+                            else
+                            {
+                                Engine::BlockCursor l_Cursor = l_Query.CreateCollisionCursor();
+                                for (size_t i = 0; i < sweeps.size(); ++i)
+                                {
+                                    l_Results[i] = l_Query.SweepBox(sweeps[i], l_Cursor);
+                                }
+                            }
+
+                            outGrounded = 0;
+                            for (size_t i = 0; i < sweeps.size(); ++i)
+                            {
+                                sweeps[i].Box.Min += l_Results[i].Motion;
+                                sweeps[i].Box.Max += l_Results[i].Motion;
+                                if (l_Results[i].IsOnGround)
+                                {
+                                    l_Velocity[i].y = 0.0f;
+                                    ++outGrounded;
+                                }
+
+                                // Walk into a wall, turn around.
+                                for (int32_t l_Axis : { 0, 2 })
+                                {
+                                    l_Velocity[i][l_Axis] = l_Results[i].IsBlocked(static_cast<uint32_t>(l_Axis)) ? -l_Velocity[i][l_Axis] : l_Velocity[i][l_Axis];
+                                }
+                            }
+                        }
+                    };
+
+                std::vector<Engine::VoxelSweep> l_Single;
+                std::vector<Engine::VoxelSweep> l_Batch;
+                uint32_t l_SingleGrounded = 0;
+                uint32_t l_BatchGrounded = 0;
+                const std::vector<double> l_SingleSeconds = MeasureRepeated([&]()
+                    {
+                        a_Simulate(false, l_Single, l_SingleGrounded);
+                    });
+                const std::vector<double> l_BatchSeconds = MeasureRepeated([&]()
+                    {
+                        a_Simulate(true, l_Batch, l_BatchGrounded);
+                    });
+
+                uint32_t l_Mismatches = 0;
+                uint32_t l_Embedded = 0;
+                for (size_t i = 0; i < l_Single.size(); ++i)
+                {
+                    l_Mismatches += l_Single[i].Box.Min == l_Batch[i].Box.Min ? 0 : 1;
+                    l_Embedded += IsBoxInsideSolid(l_World, l_Registry, l_Single[i].Box) ? 1 : 0;
+                }
+
+                const double l_SweepCount = static_cast<double>(s_EntityCount) * s_TickCount;
+                const double l_BatchMedian = Summarize(l_BatchSeconds).Median;
+                ReportMetric("sweep.sweeps_per_second", l_SweepCount / Summarize(l_SingleSeconds).Median, "sweeps/s");
+                ReportMetric("sweep.batch.sweeps_per_second", l_SweepCount / l_BatchMedian, "sweeps/s");
+                ReportMetric("sweep.batch.sweeps_per_second_per_thread", l_SweepCount / l_BatchMedian / l_ThreadCount, "sweeps/s");
+                ReportMetric("sweep.batch.tick_us", l_BatchMedian / s_TickCount * 1.0e6, "us");
+                ReportMetric("sweep.grounded_fraction", static_cast<double>(l_SingleGrounded) / s_EntityCount, "fraction");
+                ReportMetric("sweep.batch_mismatches", l_Mismatches, "entities");
+                ReportMetric("sweep.embedded", l_Embedded, "entities");
+
+                // Everything dropped from at most 12 blocks has landed after 40 ticks of gravity; the ones in the air
+                // have just walked off a step.
+                l_IsValid = l_IsValid && l_Mismatches == 0 && l_Embedded == 0 && l_SingleGrounded == l_BatchGrounded && l_SingleGrounded * 4 >= s_EntityCount * 3;
+            }
+
+            // Single-block queries through the world's own lookup, for scale: one hash probe per block.
+            {
+                uint64_t l_Sink = 0;
+                const std::vector<double> l_Seconds = MeasureRepeated([&]()
+                    {
+                        for (int32_t x = -64; x < 64; ++x)
+                        {
+                            for (int32_t y = 64; y < 128; ++y)
+                            {
+                                l_Sink += l_World.GetBlock(x, y, 5);
+                            }
+                        }
+                    });
+                Engine::BlockCursor l_Cursor(l_World);
+                const std::vector<double> l_CursorSeconds = MeasureRepeated([&]()
+                    {
+                        for (int32_t x = -64; x < 64; ++x)
+                        {
+                            for (int32_t y = 64; y < 128; ++y)
+                            {
+                                l_Sink += l_Cursor.GetBlock(x, y, 5);
+                            }
+                        }
+                    });
+                ReportSamples("block_read.world_ns", ToPerItem(l_Seconds, 128.0 * 64.0, 1.0e9), "ns");
+                ReportSamples("block_read.cursor_ns", ToPerItem(l_CursorSeconds, 128.0 * 64.0, 1.0e9), "ns");
+                l_IsValid = l_IsValid && l_Sink > 0;
+            }
+
+            return l_IsValid;
+        }
+    }
+
+    REGISTER_BENCHMARK("VoxelQuery", "DDA raycasts through picking, sparse and dense terrain plus swept-box entity collision, single-threaded and batched", RunVoxelQueryBenchmark);
+}
@@ -0,0 +1,127 @@
+#include "Benchmark.h"
+
+#include "Engine/Jobs/JobSystem.h"
+#include "Engine/World/WorldGenerator.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Benchmarks
+{
+    namespace
+    {
+        // FNV-1a over every block in request order; equal hashes mean bit-identical worlds.
+        uint64_t HashChunks(const std::vector<std::unique_ptr<Engine::Chunk>>& chunks)
+        {
+            uint64_t l_Hash = 0xCBF29CE484222325ull;
+            for (const std::unique_ptr<Engine::Chunk>& it_Chunk : chunks)
+            {
+                if (it_Chunk == nullptr)
+                {
+                    return 0;
+                }
+
+                for (uint32_t i = 0; i < Engine::Chunk::Volume; ++i)
+                {
+                    l_Hash = (l_Hash ^ it_Chunk->GetBlock(i)) * 0x100000001B3ull;
+                }
+            }
+
+            return l_Hash;
+        }
+
+        bool RunWorldGenBenchmark()
+        {
+            // An N x N column region, tall enough to cover oceans, caves and mountain tops.
+            constexpr int32_t l_RegionSize = 16;
+            constexpr int32_t l_ChunkLayers = 6;
+
+            std::vector<Engine::ChunkCoord> l_Coords;
+            for (int32_t z = 0; z < l_RegionSize; ++z)
+            {
+                for (int32_t x = 0; x < l_RegionSize; ++x)
+                {
+                    for (int32_t y = 0; y < l_ChunkLayers; ++y)
+                    {
+                        l_Coords.push_back({ x - l_RegionSize / 2, y, z - l_RegionSize / 2 });
+                    }
+                }
+            }
+
+            Engine::WorldGeneratorSettings l_Settings;
+            l_Settings.Seed = 20240611;
+            const Engine::WorldGenerator l_Generator(l_Settings);
+
+            const uint32_t l_MaxWorkerCount = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+
+            bool l_IsValid = true;
+            uint64_t l_ReferenceHash = 0;
+            double l_SingleWorkerRate = 0.0;
+            for (uint32_t l_WorkerCount = 1; ; l_WorkerCount = std::min(l_WorkerCount * 2, l_MaxWorkerCount))
+            {
+                Engine::JobSystem l_JobSystem(l_WorkerCount);
+                const std::string l_Prefix = "workers_" + std::to_string(l_WorkerCount);
+
+                std::shared_ptr<Engine::WorldGenerationBatch> l_Batch;
+                const std::vector<double> l_Seconds = MeasureRepeated([&l_Generator, &l_JobSystem, &l_Coords, &l_Batch]()
+                    {
+                        l_Batch = l_Generator.GenerateAsync(l_JobSystem, l_Coords);
+                        l_JobSystem.WaitForCounter(l_Batch->GetCounter());
+                    });
+
+                const std::vector<double> l_Rates = ToRates(l_Seconds, static_cast<double>(l_Coords.size()));
+                const double l_Rate = Summarize(l_Rates).Median;
+                ReportSamples(l_Prefix + ".chunks_per_second", l_Rates, "chunks/s");
+                if (l_SingleWorkerRate == 0.0)
+                {
+                    l_SingleWorkerRate = l_Rate;
+                }
+                else
+                {
+                    ReportMetric(l_Prefix + ".scaling", l_Rate / l_SingleWorkerRate, "x");
+                }
+
+                // Thread count must never change the output.
+                const uint64_t l_Hash = HashChunks(l_Batch->GetChunks());
+                if (l_ReferenceHash == 0)
+                {
+                    l_ReferenceHash = l_Hash;
+                }
+                l_IsValid = l_IsValid && l_Hash != 0 && l_Hash == l_ReferenceHash;
+
+                if (l_WorkerCount == l_MaxWorkerCount)
+                {
+                    break;
+                }
+            }
+
+            // The synchronous single-chunk path must agree with the batched one, including chunks at the region
+            // edge whose trees come from columns the batch only generated as neighbours.
+            {
+                Engine::JobSystem l_JobSystem(1);
+                std::shared_ptr<Engine::WorldGenerationBatch> l_Batch = l_Generator.GenerateAsync(l_JobSystem, l_Coords);
+                l_JobSystem.WaitForCounter(l_Batch->GetCounter());
+
+                std::vector<std::unique_ptr<Engine::Chunk>> l_Batched;
+                std::vector<std::unique_ptr<Engine::Chunk>> l_Synchronous;
+                for (size_t i = 0; i < l_Coords.size(); i += 37)
+                {
+                    l_Batched.push_back(std::move(l_Batch->GetChunks()[i]));
+                    l_Synchronous.push_back(l_Generator.GenerateChunk(l_Coords[i]));
+                }
+
+                const bool l_Matches = HashChunks(l_Batched) == HashChunks(l_Synchronous);
+                ReportMetric("sync_matches_batched", l_Matches ? 1.0 : 0.0, "bool");
+                l_IsValid = l_IsValid && l_Matches;
+            }
+
+            return l_IsValid;
+        }
+    }
+
+    REGISTER_BENCHMARK("WorldGen", "Staged world generation of a 16x16 column region, scaling from 1 worker to all hardware threads", RunWorldGenBenchmark);
+}
@@ -1,15 +1,19 @@
 #include "Application.h"
 
+#include <chrono>
 #include <iostream>
 
-#include <GLFW/glfw3.h>
 #include <glad/glad.h>
+#include <GLFW/glfw3.h>
 
+#include "Engine/Core/Profiler.h"
 #include "Engine/Input/Input.h"
+#include "Engine/Memory/FrameAllocator.h"
 
 namespace Engine
 {
-    Application::Application()
+    Application::Application(const ApplicationSpecification& specification)
+        : m_Specification(specification), m_Timestep(specification.TickRate, specification.MaxTicksPerFrame)
     {
         m_IsInitialized = Initialize();
 
@@ -47,9 +51,36 @@ namespace Engine
 
     bool Application::Initialize()
     {
+        // Loggers must exist before the first message; Game does not initialize them itself.
+        Engine::Utilities::Log::Initialize(m_Specification.Logging);
+
         ENGINE_INFO("Application initialization starting");
 
-        Engine::Utilities::Log::Initialize();
+        // Workers start before the window so layers can submit background work from Initialize onwards.
+        m_JobSystem = std::make_unique<JobSystem>(m_Specification.WorkerThreadCount);
+        m_AssetManager = std::make_unique<AssetManager>(*m_JobSystem, m_Specification.AssetDirectory, m_Specification.AssetCacheDirectory, m_Specification.AssetReloadInterval);
+        FrameAllocator::Initialize(m_Specification.FrameArenaCapacity);
+
+        WindowSpecification l_WindowSpecification;
+        l_WindowSpecification.Title = m_Specification.Name;
+        l_WindowSpecification.Width = m_Specification.WindowWidth;
+        l_WindowSpecification.Height = m_Specification.WindowHeight;
+        l_WindowSpecification.Headless = m_Specification.Headless;
+
+        if (m_Specification.Headless)
+        {
+            // Headless runs skip GLFW and GLAD entirely so they work on machines without a display or GPU.
+            if (!m_Window.Initialize(l_WindowSpecification))
+            {
+                ENGINE_ERROR("Failed to initialize headless window");
+
+                return false;
+            }
+
+            ENGINE_INFO("Application initialization completed successfully (headless)");
+
+            return true;
+        }
 
         bool l_IsGlfwInitialized = glfwInit();
         if (!l_IsGlfwInitialized)
@@ -67,7 +98,7 @@ namespace Engine
 
         m_IsGlfwInitialized = true;
 
-        bool l_IsWindowInitialized = m_Window.Initialize();
+        bool l_IsWindowInitialized = m_Window.Initialize(l_WindowSpecification);
 
         // If the window fails to initialize, mark application initialization as failed for safety.
         if (!l_IsWindowInitialized)
@@ -77,12 +108,6 @@ namespace Engine
             return false;
         }
 
-        // Dispatch input and window events to the active layer before per-frame work executes.
-        m_Window.SetEventCallback([this](const Event& event)
-            {
-                OnEvent(event);
-            });
-
         // Configure the viewport to the current framebuffer size for accurate presentation.
         int l_FramebufferWidth = 0;
         int l_FramebufferHeight = 0;
@@ -104,6 +129,11 @@ namespace Engine
         // Ensure the gameplay layer is shut down before the renderer and window are destroyed.
         ShutdownGameLayer();
 
+        // Joining the workers after the layer guarantees no job outlives the state it references.
+        m_AssetManager.reset();
+        m_JobSystem.reset();
+        FrameAllocator::Shutdown();
+
         // Terminate GLFW if it was ever initialized to keep the shutdown path explicit.
         if (m_IsGlfwInitialized)
         {
@@ -132,6 +162,9 @@ namespace Engine
             return false;
         }
 
+        m_GameLayer->m_JobSystem = m_JobSystem.get();
+        m_GameLayer->m_AssetManager = m_AssetManager.get();
+
         // Let the gameplay layer prepare its resources and report failures clearly.
         if (!m_GameLayer->Initialize())
         {
@@ -175,55 +208,245 @@ namespace Engine
 
         ENGINE_INFO("Application main loop starting");
 
+        // Every run starts from released keys and an unknown cursor so recordings replay against the same history.
+        Input::ResetState();
+
+        if (!BeginInputCapture())
+        {
+            return;
+        }
+
         if (!InitializeGameLayer())
         {
+            EndInputCapture();
+
             return;
         }
 
+        m_FrameIndex = 0;
+        m_TickIndex = 0;
+        m_Timestep.Reset();
+
+        using Clock = std::chrono::steady_clock;
+        const auto a_Milliseconds = [](Clock::time_point begin, Clock::time_point end)
+            {
+                return std::chrono::duration<double, std::milli>(end - begin).count();
+            };
+
+        ENGINE_PROFILE_THREAD("Main Thread");
+
+#if ENGINE_PROFILING_ENABLED
+        if (!m_Specification.ProfileCapturePath.empty())
+        {
+            Profiler::BeginCapture();
+        }
+#endif
+
+        std::chrono::steady_clock::time_point l_LastFrameTime = std::chrono::steady_clock::now();
+
         while (!m_Window.ShouldWindowClose())
         {
+            // Collect the zones every thread recorded during the previous frame.
+            ENGINE_PROFILE_FRAME_END();
+            ENGINE_PROFILE_SCOPE("Frame");
+
+            // Measure the previous frame, or use the scripted delta so headless runs are reproducible.
+            const std::chrono::steady_clock::time_point l_FrameStartTime = std::chrono::steady_clock::now();
+            double l_FrameDeltaTime = std::chrono::duration<double>(l_FrameStartTime - l_LastFrameTime).count();
+            l_LastFrameTime = l_FrameStartTime;
+            if (m_Specification.FixedFrameDeltaTime > 0.0)
+            {
+                l_FrameDeltaTime = m_Specification.FixedFrameDeltaTime;
+            }
+
             // Reset per-frame input caches before processing new events.
             Input::BeginFrame();
 
-            // Process OS-level events first so input informs the next Update call.
-            glfwPollEvents();
+            // Everything allocated from the frame arena last frame is released here.
+            FrameAllocator::BeginFrame();
+
+            // Process OS-level (or synthetic) events first so input informs the next Update call.
+            {
+                ENGINE_PROFILE_SCOPE("Window::PollEvents");
+                m_Window.PollEvents();
+            }
+
+            // A replay swaps the polled input for the recorded frame, including the delta time it ran with.
+            if (m_InputReplayer.IsOpen() && !m_InputReplayer.ReplayFrame(m_Window.GetEventQueue(), l_FrameDeltaTime))
+            {
+                ENGINE_INFO("Input replay finished after {} frames", m_InputReplayer.GetReplayedFrameCount());
+
+                break;
+            }
+
+            m_InputRecorder.RecordFrame(m_FrameIndex, l_FrameDeltaTime, m_Window.GetEventQueue());
+
+            const uint32_t l_EventCount = m_Window.GetEventQueue().GetCount();
+            ProcessEvents();
+            const Clock::time_point l_EventsEndTime = Clock::now();
+
+            // Publish background results (meshes, generated chunks, loads) before gameplay reads them.
+            {
+                ENGINE_PROFILE_SCOPE("JobSystem::DrainMainThreadQueue");
+                m_JobSystem->DrainMainThreadQueue();
+            }
+
+            // Finished imports and hot reloads become visible here, never in the middle of a tick.
+            m_AssetManager->Update(l_FrameDeltaTime);
+
+            // Run as many fixed ticks as the elapsed time allows (capped) before rendering the latest state.
+            const uint32_t l_TickCount = m_Timestep.Advance(l_FrameDeltaTime);
+            for (uint32_t i = 0; i < l_TickCount; ++i)
+            {
+                ENGINE_PROFILE_SCOPE("Layer::Update");
+
+                TickTiming l_TickTiming;
+                l_TickTiming.FixedDeltaTime = m_Timestep.GetFixedDeltaTime();
+                l_TickTiming.TickIndex = m_TickIndex;
+                l_TickTiming.SimulationTime = static_cast<double>(m_TickIndex) * m_Timestep.GetFixedDeltaTime();
 
-            // Update the game state before rendering to ensure visuals reflect the latest logic.
-            m_GameLayer->Update();
+                m_GameLayer->Update(l_TickTiming);
 
-            // Render the current frame from the game layer.
-            m_GameLayer->Render();
+                ++m_TickIndex;
+            }
+
+            // Render the current frame from the game layer, blending between ticks with the leftover fraction.
+            FrameTiming l_FrameTiming;
+            l_FrameTiming.DeltaTime = l_FrameDeltaTime;
+            l_FrameTiming.InterpolationAlpha = m_Timestep.GetInterpolationAlpha();
+            l_FrameTiming.TicksThisFrame = l_TickCount;
+            l_FrameTiming.FrameIndex = m_FrameIndex;
+
+            const Clock::time_point l_UpdateEndTime = Clock::now();
+            {
+                ENGINE_PROFILE_SCOPE("Layer::Render");
+                m_GameLayer->Render(l_FrameTiming);
+            }
+            const Clock::time_point l_RenderEndTime = Clock::now();
 
             // Present the rendered frame to the screen.
-            glfwSwapBuffers(m_Window.GetNativeWindow());
+            {
+                ENGINE_PROFILE_SCOPE("Window::SwapBuffers");
+                m_Window.SwapBuffers();
+            }
+            const Clock::time_point l_PresentEndTime = Clock::now();
+
+            FrameTimingSample l_Sample;
+            l_Sample.FrameIndex = m_FrameIndex;
+            l_Sample.DeltaTime = l_FrameDeltaTime;
+            l_Sample.TickCount = l_TickCount;
+            l_Sample.EventCount = l_EventCount;
+            l_Sample.EventsMilliseconds = a_Milliseconds(l_FrameStartTime, l_EventsEndTime);
+            l_Sample.UpdateMilliseconds = a_Milliseconds(l_EventsEndTime, l_UpdateEndTime);
+            l_Sample.RenderMilliseconds = a_Milliseconds(l_UpdateEndTime, l_RenderEndTime);
+            l_Sample.PresentMilliseconds = a_Milliseconds(l_RenderEndTime, l_PresentEndTime);
+            l_Sample.FrameMilliseconds = a_Milliseconds(l_FrameStartTime, l_PresentEndTime);
+            l_Sample.FrameArenaBytes = FrameAllocator::GetCurrentFrameHighWaterBytes();
+            m_FrameTimingLog.Add(l_Sample);
 
             // Allow the input system to finalize any per-frame bookkeeping.
             Input::EndFrame();
+
+            ++m_FrameIndex;
+
+            // Bounded runs (benchmarks, CI smoke tests) stop once the requested frame count is reached.
+            if (m_Specification.MaxFrames != 0 && m_FrameIndex >= m_Specification.MaxFrames)
+            {
+                ENGINE_INFO("Reached frame limit ({})", m_Specification.MaxFrames);
+
+                break;
+            }
         }
 
         // Ensure the gameplay layer shuts down cleanly after the main loop ends.
         ShutdownGameLayer();
+        EndInputCapture();
+
+#if ENGINE_PROFILING_ENABLED
+        if (!m_Specification.ProfileCapturePath.empty())
+        {
+            Profiler::EndCapture(m_Specification.ProfileCapturePath);
+        }
+#endif
 
         ENGINE_INFO("Application main loop exited");
     }
 
-    void Application::OnEvent(const Event& event)
+    bool Application::BeginInputCapture()
     {
+        m_FrameTimingLog.Clear();
+        if (m_Specification.MaxFrames != 0)
+        {
+            m_FrameTimingLog.Reserve(m_Specification.MaxFrames);
+        }
+
+        if (!m_Specification.InputReplayPath.empty() && !m_InputReplayer.Open(m_Specification.InputReplayPath))
+        {
+            // A replay that cannot be read would silently become a live run, which defeats its purpose.
+            ENGINE_ERROR("Input replay could not be started");
+
+            return false;
+        }
+
+        if (!m_Specification.InputRecordPath.empty() && !m_InputRecorder.Open(m_Specification.InputRecordPath))
+        {
+            m_InputReplayer.Close();
+
+            return false;
+        }
+
+        return true;
+    }
+
+    void Application::EndInputCapture()
+    {
+        m_InputRecorder.Close();
+        m_InputReplayer.Close();
+
+        if (!m_Specification.FrameTimingPath.empty())
+        {
+            m_FrameTimingLog.WriteCsv(m_Specification.FrameTimingPath);
+        }
+    }
+
+    void Application::Close()
+    {
+        m_Window.RequestClose();
+    }
+
+    void Application::ProcessEvents()
+    {
+        ENGINE_PROFILE_SCOPE("Application::ProcessEvents");
+
+        EventQueue& l_Events = m_Window.GetEventQueue();
+
         // Cache input-centric events before forwarding to gameplay so query APIs stay coherent.
-        Input::OnEvent(event);
+        l_Events.ForEach([](const EventRecord& record)
+            {
+                Input::OnEvent(record);
+            });
 
         // Update renderer state immediately when the framebuffer changes size so rendering stays aligned.
-        if (event.GetEventType() == EventType::WindowResize)
+        if (l_Events.GetCount(EventType::WindowResize) > 0 && !m_Window.IsHeadless())
         {
-            const WindowResizeEvent& l_ResizeEvent = static_cast<const WindowResizeEvent&>(event);
-            const int l_NewWidth = l_ResizeEvent.GetWidth();
-            const int l_NewHeight = l_ResizeEvent.GetHeight();
+            l_Events.ForEach(EventType::WindowResize, [](const EventRecord& record)
+                {
+                    glViewport(0, 0, record.Resize.Width, record.Resize.Height);
+                });
         }
 
-        // Safely forward the event to the gameplay layer when it exists and is ready.
-        if (m_IsGameLayerInitialized && m_GameLayer != nullptr)
+        // Synthetic close events have no GLFW flag behind them, so route them through the window explicitly.
+        if (l_Events.GetCount(EventType::WindowClose) > 0)
         {
-            m_GameLayer->OnEvent(event);
+            m_Window.RequestClose();
         }
+
+        // Safely forward the batch to the gameplay layer when it exists and is ready.
+        if (m_IsGameLayerInitialized && m_GameLayer != nullptr && !l_Events.IsEmpty())
+        {
+            m_GameLayer->OnEvents(l_Events);
+        }
+
+        l_Events.Clear();
     }
 }
\ No newline at end of file
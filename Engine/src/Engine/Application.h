@@ -1,20 +1,78 @@
 #pragma once
 
 #include "Engine/Core/Core.h"
+#include "Engine/Assets/AssetManager.h"
+#include "Engine/Core/FrameTimingLog.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Core/Timestep.h"
 #include "Engine/Events/Events.h"
+#include "Engine/Input/InputRecording.h"
+#include "Engine/Jobs/JobSystem.h"
 #include "Engine/Window/Window.h"
 #include "Engine/Layer/Layer.h"
 
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <string>
 
 namespace Engine
 {
+    // Construction-time options for the application and its window.
+    struct ApplicationSpecification
+    {
+        std::string Name = "Minecraft-Clone";
+        int WindowWidth = 1920;
+        int WindowHeight = 1080;
+
+        // Run without GLFW, a window or a GL context; layers still receive Update/Render every frame.
+        bool Headless = false;
+
+        // Stop the main loop after this many frames; zero runs until the window is closed.
+        uint64_t MaxFrames = 0;
+
+        // Fixed simulation rate in ticks per second and the catch-up limit applied after slow frames.
+        double TickRate = 20.0;
+        uint32_t MaxTicksPerFrame = 5;
+
+        // When positive every frame advances by exactly this many seconds instead of the wall clock,
+        // which lets headless runs simulate at full CPU speed and stay reproducible.
+        double FixedFrameDeltaTime = 0.0;
+
+        // Background job workers; zero picks one per hardware thread minus the main thread.
+        uint32_t WorkerThreadCount = 0;
+
+        // Initial size of the per-frame arena; it grows automatically after a frame overflows it.
+        size_t FrameArenaCapacity = 4 * 1024 * 1024;
+
+        // Asset sources are loaded from AssetDirectory; their processed outputs are cached under AssetCacheDirectory.
+        std::string AssetDirectory = "Assets";
+        std::string AssetCacheDirectory = "Cache/Assets";
+
+        // Seconds between checks for edited asset sources, which are then reloaded in place; zero disables it.
+        double AssetReloadInterval = 0.5;
+
+        // Write every frame's input and delta time to this file so the run can be replayed exactly.
+        std::string InputRecordPath;
+
+        // Drive the run from a recording instead of live input; the main loop ends when the recording does.
+        std::string InputReplayPath;
+
+        // Write per-frame phase timings as CSV to this file when the main loop exits.
+        std::string FrameTimingPath;
+
+        // Record every profiler zone of the run and write them as Chrome trace JSON to this file on exit.
+        // Ignored in shipping builds, which compile the profiler out.
+        std::string ProfileCapturePath;
+
+        // Applied by the first application to initialize logging; later ones reuse the running loggers.
+        Utilities::LogSpecification Logging;
+    };
+
     class ENGINE_API Application
     {
     public:
-        Application();
+        explicit Application(const ApplicationSpecification& specification = ApplicationSpecification());
         ~Application();
 
         // Register a gameplay layer so the engine can drive its lifecycle.
@@ -25,6 +83,17 @@ namespace Engine
 
         void Run();
 
+        // Request the main loop to exit after the current frame.
+        void Close();
+
+        const ApplicationSpecification& GetSpecification() const { return m_Specification; }
+        Window& GetWindow() { return m_Window; }
+        uint64_t GetFrameIndex() const { return m_FrameIndex; }
+        FixedTimestep& GetTimestep() { return m_Timestep; }
+        JobSystem& GetJobSystem() { return *m_JobSystem; }
+        AssetManager& GetAssetManager() { return *m_AssetManager; }
+        const FrameTimingLog& GetFrameTimingLog() const { return m_FrameTimingLog; }
+
     private:
         bool Initialize();
         void Shutdown();
@@ -33,16 +102,32 @@ namespace Engine
         bool InitializeGameLayer();
         void ShutdownGameLayer();
 
-        // Forward events from the window into the active game layer when available.
-        void OnEvent(const Event& event);
+        // Consume the events queued by the last poll: input state first, then window bookkeeping, then the game layer.
+        void ProcessEvents();
+
+        // Open the recorder, replayer and timing log requested by the specification.
+        bool BeginInputCapture();
+        void EndInputCapture();
 
     private:
+        ApplicationSpecification m_Specification;
         Window m_Window;
         std::unique_ptr<Layer> m_GameLayer;
         std::function<std::unique_ptr<Layer>()> m_GameLayerFactory;
 
+        FixedTimestep m_Timestep;
+        std::unique_ptr<JobSystem> m_JobSystem;
+        std::unique_ptr<AssetManager> m_AssetManager;
+
+        InputRecorder m_InputRecorder;
+        InputReplayer m_InputReplayer;
+        FrameTimingLog m_FrameTimingLog;
+
         bool m_IsInitialized = false;
         bool m_IsGlfwInitialized = false;
         bool m_IsGameLayerInitialized = false;
+
+        uint64_t m_FrameIndex = 0;
+        uint64_t m_TickIndex = 0;
     };
 }
\ No newline at end of file
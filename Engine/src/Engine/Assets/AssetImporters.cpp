@@ -0,0 +1,52 @@
+#include "Engine/Assets/AssetImporters.h"
+
+#include "Engine/Assets/TextureAtlasBuilder.h"
+#include "Engine/IO/Compression.h"
+
+#include <cstring>
+
+namespace Engine
+{
+    bool TextureImporter::Import(const uint8_t* data, size_t size, std::vector<uint8_t>& output) const
+    {
+        TextureAtlasBuilder::AtlasImage l_Image;
+        if (!TextureAtlasBuilder::DecodeImage(data, size, l_Image))
+        {
+            return false;
+        }
+
+        TextureAssetHeader l_Header;
+        l_Header.Width = l_Image.Width;
+        l_Header.Height = l_Image.Height;
+
+        output.resize(sizeof(l_Header) + l_Image.Pixels.size());
+        std::memcpy(output.data(), &l_Header, sizeof(l_Header));
+        std::memcpy(output.data() + sizeof(l_Header), l_Image.Pixels.data(), l_Image.Pixels.size());
+
+        return true;
+    }
+
+    TextureAtlasImporter::TextureAtlasImporter(uint32_t tileSize, uint32_t mipLevelCount)
+    {
+        m_Descriptor.TileSize = tileSize;
+        m_Descriptor.MipLevelCount = mipLevelCount;
+    }
+
+    uint32_t TextureAtlasImporter::GetVersion() const
+    {
+        const uint32_t l_Settings[3] = { TextureAtlasBuilder::FormatVersion, m_Descriptor.TileSize, m_Descriptor.MipLevelCount };
+
+        return Compression::ComputeCrc32(l_Settings, sizeof(l_Settings));
+    }
+
+    bool TextureAtlasImporter::Import(const uint8_t* data, size_t size, std::vector<uint8_t>& output) const
+    {
+        TextureAtlasBuilder::AtlasImage l_Image;
+        if (!TextureAtlasBuilder::DecodeImage(data, size, l_Image))
+        {
+            return false;
+        }
+
+        return TextureAtlasBuilder::Cook(l_Image, m_Descriptor, TextureAtlasBuilder::ComputeSourceHash(data, size, m_Descriptor), output);
+    }
+}
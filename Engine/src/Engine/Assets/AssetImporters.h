@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/Assets/AssetManager.h"
+#include "Engine/Assets/TextureAtlas.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Engine
+{
+    // Header of a "Texture" asset; width * height RGBA8 texels follow it, rows from top to bottom.
+    struct TextureAssetHeader
+    {
+        uint32_t Width = 0;
+        uint32_t Height = 0;
+    };
+
+    // Decodes a PNG once so later runs map the texels instead of inflating the file again.
+    class ENGINE_API TextureImporter : public AssetImporter
+    {
+    public:
+        const char* GetName() const override { return "Texture"; }
+        uint32_t GetVersion() const override { return 1; }
+        bool Import(const uint8_t* data, size_t size, std::vector<uint8_t>& output) const override;
+    };
+
+    // Cooks a tile atlas PNG into the texture-array blob TextureAtlas::Attach reads.
+    class ENGINE_API TextureAtlasImporter : public AssetImporter
+    {
+    public:
+        explicit TextureAtlasImporter(uint32_t tileSize = 16, uint32_t mipLevelCount = 0);
+
+        const char* GetName() const override { return "TextureAtlas"; }
+
+        // Covers the blob format version and both settings.
+        uint32_t GetVersion() const override;
+        bool Import(const uint8_t* data, size_t size, std::vector<uint8_t>& output) const override;
+
+    private:
+        TextureAtlasDescriptor m_Descriptor;
+    };
+}
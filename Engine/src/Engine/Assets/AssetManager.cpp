@@ -0,0 +1,350 @@
+#include "Engine/Assets/AssetManager.h"
+
+#include "Engine/Assets/AssetImporters.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Profiler.h"
+#include "Engine/IO/Compression.h"
+#include "Engine/IO/WritableFile.h"
+
+#include <cstdio>
+#include <system_error>
+#include <utility>
+
+namespace Engine
+{
+    AssetManager::AssetManager(JobSystem& jobSystem, const std::filesystem::path& assetDirectory, const std::filesystem::path& cacheDirectory, double reloadInterval)
+        : m_JobSystem(jobSystem), m_AssetDirectory(assetDirectory), m_CacheDirectory(cacheDirectory), m_ReloadInterval(reloadInterval)
+    {
+        RegisterImporter(std::make_unique<TextureImporter>());
+        RegisterImporter(std::make_unique<TextureAtlasImporter>());
+    }
+
+    AssetManager::~AssetManager()
+    {
+        // Import jobs write into this object, so none may outlive it.
+        m_JobSystem.WaitForCounter(m_ImportCounter);
+    }
+
+    void AssetManager::RegisterImporter(std::unique_ptr<AssetImporter> importer)
+    {
+        const std::string l_Name = importer->GetName();
+        m_Importers[l_Name] = std::move(importer);
+    }
+
+    AssetHandle AssetManager::Load(const std::filesystem::path& relativePath, std::string_view importerName)
+    {
+        const auto it_Importer = m_Importers.find(std::string(importerName));
+        if (it_Importer == m_Importers.end())
+        {
+            ENGINE_CHANNEL_ERROR(Assets, "No importer named {} for {}", importerName, relativePath.string());
+
+            return {};
+        }
+
+        std::string l_Key = std::string(importerName) + ":" + relativePath.generic_string();
+        const auto it_Existing = m_SlotsByKey.find(l_Key);
+        if (it_Existing != m_SlotsByKey.end())
+        {
+            AssetSlot& l_Slot = m_Slots[it_Existing->second];
+            ++l_Slot.ReferenceCount;
+
+            return { it_Existing->second, l_Slot.Generation };
+        }
+
+        uint32_t l_Index = 0;
+        if (!m_FreeSlots.empty())
+        {
+            l_Index = m_FreeSlots.back();
+            m_FreeSlots.pop_back();
+        }
+        else
+        {
+            l_Index = static_cast<uint32_t>(m_Slots.size());
+            m_Slots.emplace_back();
+        }
+
+        AssetSlot& l_Slot = m_Slots[l_Index];
+        l_Slot.Key = l_Key;
+        l_Slot.SourcePath = m_AssetDirectory / relativePath;
+        l_Slot.Importer = it_Importer->second.get();
+        l_Slot.ReferenceCount = 1;
+        l_Slot.State = AssetState::Loading;
+        m_SlotsByKey.emplace(std::move(l_Key), l_Index);
+
+        SubmitImport(l_Index);
+
+        return { l_Index, l_Slot.Generation };
+    }
+
+    void AssetManager::Retain(AssetHandle handle)
+    {
+        if (FindSlot(handle) != nullptr)
+        {
+            ++m_Slots[handle.Index].ReferenceCount;
+        }
+    }
+
+    void AssetManager::Release(AssetHandle handle)
+    {
+        if (FindSlot(handle) == nullptr)
+        {
+            return;
+        }
+
+        AssetSlot& l_Slot = m_Slots[handle.Index];
+        if (--l_Slot.ReferenceCount != 0)
+        {
+            return;
+        }
+
+        // Invalidate outstanding handles now; a running import notices the new generation and drops its result.
+        m_SlotsByKey.erase(l_Slot.Key);
+        ++l_Slot.Generation;
+        l_Slot.State = AssetState::Unloaded;
+        l_Slot.Data.reset();
+        if (!l_Slot.IsImporting)
+        {
+            FreeSlot(handle.Index);
+        }
+    }
+
+    AssetState AssetManager::GetState(AssetHandle handle) const
+    {
+        const AssetSlot* l_Slot = FindSlot(handle);
+
+        return l_Slot != nullptr ? l_Slot->State : AssetState::Unloaded;
+    }
+
+    std::shared_ptr<const AssetData> AssetManager::GetData(AssetHandle handle) const
+    {
+        const AssetSlot* l_Slot = FindSlot(handle);
+
+        return l_Slot != nullptr ? l_Slot->Data : nullptr;
+    }
+
+    uint32_t AssetManager::GetVersion(AssetHandle handle) const
+    {
+        const AssetSlot* l_Slot = FindSlot(handle);
+
+        return l_Slot != nullptr && l_Slot->Data != nullptr ? l_Slot->Data->Version : 0;
+    }
+
+    void AssetManager::Update(double deltaTime)
+    {
+        ENGINE_PROFILE_SCOPE("AssetManager::Update");
+
+        PublishResults();
+
+        if (m_ReloadInterval <= 0.0)
+        {
+            return;
+        }
+
+        m_TimeSinceCheck += deltaTime;
+        if (m_TimeSinceCheck >= m_ReloadInterval)
+        {
+            m_TimeSinceCheck = 0.0;
+            CheckForChanges();
+        }
+    }
+
+    void AssetManager::WaitForIdle()
+    {
+        m_JobSystem.WaitForCounter(m_ImportCounter);
+        PublishResults();
+    }
+
+    void AssetManager::CheckForChanges()
+    {
+        ENGINE_PROFILE_SCOPE("AssetManager::CheckForChanges");
+
+        for (uint32_t i = 0; i < m_Slots.size(); ++i)
+        {
+            AssetSlot& l_Slot = m_Slots[i];
+            if (l_Slot.ReferenceCount == 0 || l_Slot.IsImporting)
+            {
+                continue;
+            }
+
+            // A source that disappeared keeps its last data until it comes back.
+            const SourceStamp l_Stamp = ReadStamp(l_Slot.SourcePath);
+            if (l_Stamp.Exists && l_Stamp != l_Slot.Stamp)
+            {
+                ENGINE_CHANNEL_INFO(Assets, "{} changed on disk; reimporting it as {}", l_Slot.SourcePath.string(), l_Slot.Importer->GetName());
+                SubmitImport(i);
+            }
+        }
+    }
+
+    AssetManagerStats AssetManager::GetStats() const
+    {
+        AssetManagerStats l_Stats = m_Stats;
+        l_Stats.LoadedCount = static_cast<uint32_t>(m_SlotsByKey.size());
+        l_Stats.PendingCount = m_ImportCounter.GetPendingCount();
+
+        return l_Stats;
+    }
+
+    AssetManager::SourceStamp AssetManager::ReadStamp(const std::filesystem::path& path)
+    {
+        SourceStamp l_Stamp;
+        std::error_code l_Error;
+        const std::filesystem::file_time_type l_WriteTime = std::filesystem::last_write_time(path, l_Error);
+        if (l_Error)
+        {
+            return l_Stamp;
+        }
+
+        const uintmax_t l_Size = std::filesystem::file_size(path, l_Error);
+        if (l_Error)
+        {
+            return l_Stamp;
+        }
+
+        l_Stamp.WriteTime = static_cast<int64_t>(l_WriteTime.time_since_epoch().count());
+        l_Stamp.Size = static_cast<uint64_t>(l_Size);
+        l_Stamp.Exists = true;
+
+        return l_Stamp;
+    }
+
+    void AssetManager::SubmitImport(uint32_t index)
+    {
+        AssetSlot& l_Slot = m_Slots[index];
+        l_Slot.IsImporting = true;
+
+        const uint32_t l_Generation = l_Slot.Generation;
+        const AssetImporter* l_Importer = l_Slot.Importer;
+        m_JobSystem.Submit([this, index, l_Generation, l_Importer, l_SourcePath = l_Slot.SourcePath]()
+            {
+                ImportResult l_Result;
+                l_Result.Index = index;
+                l_Result.Generation = l_Generation;
+                RunImport(l_Result, l_SourcePath, *l_Importer);
+
+                std::lock_guard<std::mutex> l_Lock(m_ResultMutex);
+                m_Results.push_back(std::move(l_Result));
+            }, &m_ImportCounter);
+    }
+
+    void AssetManager::RunImport(ImportResult& result, const std::filesystem::path& sourcePath, const AssetImporter& importer) const
+    {
+        ENGINE_PROFILE_SCOPE("AssetManager::Import");
+
+        // Stamp first: if the file changes while it is read, the next check sees a newer stamp and imports again.
+        result.Stamp = ReadStamp(sourcePath);
+
+        MappedFile l_Source;
+        if (!result.Stamp.Exists || !l_Source.Open(sourcePath) || l_Source.GetSize() == 0)
+        {
+            ENGINE_CHANNEL_ERROR(Assets, "Failed to read asset {}", sourcePath.string());
+
+            return;
+        }
+
+        // Content, size and importer version make the key; identical files share one cache entry.
+        const uint32_t l_ContentHash = Compression::ComputeCrc32(l_Source.GetData(), l_Source.GetSize());
+        char l_FileName[64];
+        std::snprintf(l_FileName, sizeof(l_FileName), "%08x-%llx-%08x.bin", l_ContentHash, static_cast<unsigned long long>(l_Source.GetSize()), importer.GetVersion());
+        const std::filesystem::path l_CachePath = m_CacheDirectory / importer.GetName() / l_FileName;
+
+        std::shared_ptr<AssetData> l_Data = std::make_shared<AssetData>();
+        std::error_code l_Error;
+        if (std::filesystem::exists(l_CachePath, l_Error) && l_Data->File.Open(l_CachePath) && l_Data->File.GetSize() != 0)
+        {
+            result.Data = std::move(l_Data);
+            result.WasCacheHit = true;
+
+            return;
+        }
+        l_Data->File.Close();
+
+        std::vector<uint8_t> l_Output;
+        if (!importer.Import(l_Source.GetData(), l_Source.GetSize(), l_Output) || l_Output.empty())
+        {
+            ENGINE_CHANNEL_ERROR(Assets, "{} importer rejected {}", importer.GetName(), sourcePath.string());
+
+            return;
+        }
+
+        if (WritableFile::WriteAtomically(l_CachePath, l_Output.data(), l_Output.size()) && l_Data->File.Open(l_CachePath))
+        {
+            result.Data = std::move(l_Data);
+
+            return;
+        }
+
+        // Read-only installs still run; they just import again on every start.
+        ENGINE_CHANNEL_WARN(Assets, "Could not cache {} at {}; keeping it in memory", sourcePath.string(), l_CachePath.string());
+        l_Data->Buffer = std::move(l_Output);
+        result.Data = std::move(l_Data);
+    }
+
+    void AssetManager::PublishResults()
+    {
+        std::vector<ImportResult> l_Results;
+        {
+            std::lock_guard<std::mutex> l_Lock(m_ResultMutex);
+            l_Results.swap(m_Results);
+        }
+
+        for (ImportResult& it_Result : l_Results)
+        {
+            AssetSlot& l_Slot = m_Slots[it_Result.Index];
+            l_Slot.IsImporting = false;
+
+            // Released while the import ran: nobody can reach the result any more.
+            if (l_Slot.Generation != it_Result.Generation)
+            {
+                FreeSlot(it_Result.Index);
+                continue;
+            }
+
+            l_Slot.Stamp = it_Result.Stamp;
+            if (it_Result.Data == nullptr)
+            {
+                ++m_Stats.FailureCount;
+                if (l_Slot.State != AssetState::Ready)
+                {
+                    l_Slot.State = AssetState::Failed;
+                }
+
+                continue;
+            }
+
+            ++(it_Result.WasCacheHit ? m_Stats.CacheHitCount : m_Stats.CacheMissCount);
+            it_Result.Data->Version = l_Slot.Data != nullptr ? l_Slot.Data->Version + 1 : 1;
+            if (it_Result.Data->Version > 1)
+            {
+                ++m_Stats.ReloadCount;
+                ENGINE_CHANNEL_INFO(Assets, "Reloaded {} as {} (version {})", l_Slot.SourcePath.string(), l_Slot.Importer->GetName(), it_Result.Data->Version);
+            }
+
+            l_Slot.Data = std::move(it_Result.Data);
+            l_Slot.State = AssetState::Ready;
+        }
+    }
+
+    void AssetManager::FreeSlot(uint32_t index)
+    {
+        AssetSlot& l_Slot = m_Slots[index];
+        l_Slot.Key.clear();
+        l_Slot.SourcePath.clear();
+        l_Slot.Importer = nullptr;
+        l_Slot.Data.reset();
+        l_Slot.Stamp = {};
+        m_FreeSlots.push_back(index);
+    }
+
+    const AssetManager::AssetSlot* AssetManager::FindSlot(AssetHandle handle) const
+    {
+        if (handle.Index >= m_Slots.size())
+        {
+            return nullptr;
+        }
+
+        const AssetSlot& l_Slot = m_Slots[handle.Index];
+
+        return l_Slot.Generation == handle.Generation && l_Slot.ReferenceCount != 0 ? &l_Slot : nullptr;
+    }
+}
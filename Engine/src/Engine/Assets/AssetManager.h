@@ -0,0 +1,209 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/IO/MappedFile.h"
+#include "Engine/Jobs/JobSystem.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine
+{
+    // Refers to one loaded asset. The generation changes whenever a slot is released, so a handle kept past
+    // its last Release reads as unloaded instead of aliasing whatever asset reuses the slot.
+    struct AssetHandle
+    {
+        static constexpr uint32_t InvalidIndex = 0xFFFFFFFF;
+
+        uint32_t Index = InvalidIndex;
+        uint32_t Generation = 0;
+
+        bool IsValid() const { return Index != InvalidIndex; }
+        bool operator==(const AssetHandle& other) const { return Index == other.Index && Generation == other.Generation; }
+        bool operator!=(const AssetHandle& other) const { return !(*this == other); }
+    };
+
+    enum class AssetState : uint8_t
+    {
+        Unloaded,   // Invalid or released handle.
+        Loading,    // First import still running; GetData returns null.
+        Ready,      // Data available. Stays ready while a hot reload runs and if that reload fails.
+        Failed      // The first import failed; a later edit of the source retries it.
+    };
+
+    // Processed bytes of one version of an asset, mapped straight from the cache file. Shared so a reader can
+    // keep using the old version for the rest of its frame while a reload publishes the next one.
+    struct AssetData
+    {
+        // The cache entry. When the cache directory cannot be written the bytes are kept in Buffer instead.
+        MappedFile File;
+        std::vector<uint8_t> Buffer;
+
+        // Starts at 1 and increases every time a changed source is re-imported.
+        uint32_t Version = 0;
+
+        const uint8_t* GetData() const { return File.IsOpen() ? File.GetData() : Buffer.data(); }
+        size_t GetSize() const { return File.IsOpen() ? File.GetSize() : Buffer.size(); }
+    };
+
+    // Turns a source file into the blob the engine consumes. Importers must be stateless: Import runs on
+    // worker threads, possibly for several assets at once.
+    class ENGINE_API AssetImporter
+    {
+    public:
+        virtual ~AssetImporter() = default;
+
+        // Passed to AssetManager::Load, and the cache subdirectory holding this importer's outputs.
+        virtual const char* GetName() const = 0;
+
+        // Part of every cache key. Change it whenever the same source would now import differently,
+        // whether the output format or one of the importer's settings changed.
+        virtual uint32_t GetVersion() const = 0;
+
+        // Replaces output with the processed form of the source bytes; returns false when the source is unusable.
+        virtual bool Import(const uint8_t* data, size_t size, std::vector<uint8_t>& output) const = 0;
+    };
+
+    struct AssetManagerStats
+    {
+        uint32_t LoadedCount = 0;
+        uint32_t PendingCount = 0;
+        uint64_t CacheHitCount = 0;
+        uint64_t CacheMissCount = 0;
+        uint64_t ReloadCount = 0;
+        uint64_t FailureCount = 0;
+    };
+
+    // Reference-counted, asynchronously imported assets with an on-disk cache of processed outputs.
+    //
+    // Load only records the request; a job then hashes the source and maps the cached output for that hash,
+    // importing and writing it first on a miss. The key covers the content, size and importer version,
+    // never the path or timestamp, so renames, fresh checkouts and copied folders still hit the cache.
+    // Cache files are written through a temporary file and renamed into place, so a crash never leaves a
+    // truncated entry behind.
+    //
+    // The file watcher compares each loaded source's size and write time at a fixed interval and re-imports
+    // the ones that changed without a restart. Everything except the jobs runs on the thread that owns the
+    // job system: results are published by Update, so state never changes in the middle of a tick.
+    class ENGINE_API AssetManager
+    {
+    public:
+        // Sources are resolved against assetDirectory; processed outputs go to cacheDirectory/<importer>/.
+        // A reload interval of zero disables the file watcher. Registers the built-in importers.
+        AssetManager(JobSystem& jobSystem, const std::filesystem::path& assetDirectory, const std::filesystem::path& cacheDirectory, double reloadInterval);
+        ~AssetManager();
+
+        AssetManager(const AssetManager&) = delete;
+        AssetManager& operator=(const AssetManager&) = delete;
+
+        // Makes an importer available to Load under its name, replacing any importer with the same name.
+        // Only valid before the first Load that uses it.
+        void RegisterImporter(std::unique_ptr<AssetImporter> importer);
+
+        // Returns a handle immediately and imports in the background. Loading a path already loaded with the
+        // same importer shares that asset and adds a reference. Returns an invalid handle for unknown importers.
+        AssetHandle Load(const std::filesystem::path& relativePath, std::string_view importerName);
+
+        // Adds a reference to a live handle.
+        void Retain(AssetHandle handle);
+
+        // Drops a reference; the last one unloads the asset, although readers holding its data keep it mapped.
+        void Release(AssetHandle handle);
+
+        AssetState GetState(AssetHandle handle) const;
+
+        // Null until the first import completes or once the handle is released.
+        std::shared_ptr<const AssetData> GetData(AssetHandle handle) const;
+
+        // Zero while nothing is loaded; compare against a stored value to notice hot reloads.
+        uint32_t GetVersion(AssetHandle handle) const;
+
+        // Publishes finished imports and, every reload interval, checks loaded sources for changes.
+        void Update(double deltaTime);
+
+        // Blocks until every import submitted so far has finished, then publishes them. Meant for loading screens,
+        // tools and tests; helps run jobs while it waits.
+        void WaitForIdle();
+
+        // Runs the change check now instead of waiting for the interval.
+        void CheckForChanges();
+
+        AssetManagerStats GetStats() const;
+
+    private:
+        // Size and write time of a source file when it was last imported.
+        struct SourceStamp
+        {
+            int64_t WriteTime = 0;
+            uint64_t Size = 0;
+            bool Exists = false;
+
+            bool operator==(const SourceStamp& other) const { return WriteTime == other.WriteTime && Size == other.Size && Exists == other.Exists; }
+            bool operator!=(const SourceStamp& other) const { return !(*this == other); }
+        };
+
+        struct AssetSlot
+        {
+            std::string Key;
+            std::filesystem::path SourcePath;
+            const AssetImporter* Importer = nullptr;
+
+            uint32_t Generation = 0;
+            uint32_t ReferenceCount = 0;
+            AssetState State = AssetState::Unloaded;
+            std::shared_ptr<const AssetData> Data;
+            SourceStamp Stamp;
+
+            // One import per slot at a time. The stamp is read before the source is, so an edit made while an
+            // import runs is still seen by the next change check.
+            bool IsImporting = false;
+        };
+
+        // Produced by an import job and consumed by Update on the owning thread.
+        struct ImportResult
+        {
+            uint32_t Index = 0;
+            uint32_t Generation = 0;
+            std::shared_ptr<AssetData> Data;
+            SourceStamp Stamp;
+            bool WasCacheHit = false;
+        };
+
+        static SourceStamp ReadStamp(const std::filesystem::path& path);
+
+        void SubmitImport(uint32_t index);
+
+        // Job body: everything it touches is passed in or immutable, never the slot table.
+        void RunImport(ImportResult& result, const std::filesystem::path& sourcePath, const AssetImporter& importer) const;
+        void PublishResults();
+        void FreeSlot(uint32_t index);
+        const AssetSlot* FindSlot(AssetHandle handle) const;
+
+    private:
+        JobSystem& m_JobSystem;
+        std::filesystem::path m_AssetDirectory;
+        std::filesystem::path m_CacheDirectory;
+        double m_ReloadInterval = 0.0;
+        double m_TimeSinceCheck = 0.0;
+
+        std::unordered_map<std::string, std::unique_ptr<AssetImporter>> m_Importers;
+
+        // Indexed by AssetHandle::Index; released slots are recycled through the free list.
+        std::vector<AssetSlot> m_Slots;
+        std::vector<uint32_t> m_FreeSlots;
+        std::unordered_map<std::string, uint32_t> m_SlotsByKey;
+
+        JobCounter m_ImportCounter;
+        std::mutex m_ResultMutex;
+        std::vector<ImportResult> m_Results;
+
+        AssetManagerStats m_Stats;
+    };
+}
@@ -0,0 +1,156 @@
+#include "Engine/Assets/TextureAtlas.h"
+
+#include "Engine/Assets/TextureAtlasBuilder.h"
+#include "Engine/Assets/TextureAtlasFormat.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Profiler.h"
+#include "Engine/IO/Compression.h"
+
+#include <cstddef>
+#include <cstring>
+#include <system_error>
+#include <utility>
+
+namespace Engine
+{
+    bool TextureAtlas::Open(const std::filesystem::path& path)
+    {
+        Close();
+
+        std::error_code l_Error;
+        if (!std::filesystem::exists(path, l_Error) || !m_File.Open(path))
+        {
+            return false;
+        }
+
+        MappedFile l_File = std::move(m_File);
+        if (!Attach(l_File.GetData(), l_File.GetSize()))
+        {
+            ENGINE_CHANNEL_WARN(Assets, "Atlas cache {} is unusable", path.string());
+
+            return false;
+        }
+        m_File = std::move(l_File);
+
+        return true;
+    }
+
+    bool TextureAtlas::Attach(const uint8_t* data, size_t size)
+    {
+        Close();
+
+        TextureAtlasFormat::FileHeader l_Header;
+        if (data == nullptr || size < sizeof(l_Header))
+        {
+            return false;
+        }
+        std::memcpy(&l_Header, data, sizeof(l_Header));
+
+        if (l_Header.Magic != TextureAtlasFormat::Magic || l_Header.Version != TextureAtlasBuilder::FormatVersion || l_Header.TileSize == 0
+            || l_Header.MipLevelCount == 0 || l_Header.MipLevelCount > MaxMipLevels || (l_Header.TileSize >> (l_Header.MipLevelCount - 1)) == 0)
+        {
+            ENGINE_CHANNEL_WARN(Assets, "Atlas blob has an unsupported header");
+
+            return false;
+        }
+
+        const uint64_t l_TablesSize = TextureAtlasFormat::GetTablesSize(l_Header.SourceTileCount);
+        if (size < sizeof(l_Header) + l_TablesSize || TextureAtlasFormat::ComputeMipOffsets(l_Header, m_MipOffsets) != size)
+        {
+            ENGINE_CHANNEL_WARN(Assets, "Atlas blob is truncated");
+            Close();
+
+            return false;
+        }
+
+        const uint8_t* l_Tables = data + sizeof(l_Header);
+        const uint32_t l_Crc = Compression::ComputeCrc32(&l_Header, offsetof(TextureAtlasFormat::FileHeader, TableCrc));
+        if (Compression::ComputeCrc32(l_Tables, l_TablesSize, l_Crc) != l_Header.TableCrc)
+        {
+            ENGINE_CHANNEL_WARN(Assets, "Atlas blob failed its checksum");
+            Close();
+
+            return false;
+        }
+
+        // The header is 32 bytes, so the u16 table that follows it is naturally aligned inside the blob.
+        m_Data = data;
+        m_Size = size;
+        m_Layers = reinterpret_cast<const uint16_t*>(l_Tables);
+        m_Flags = l_Tables + uint64_t{ l_Header.SourceTileCount } * sizeof(uint16_t);
+        m_TileSize = l_Header.TileSize;
+        m_SourceTileCount = l_Header.SourceTileCount;
+        m_LayerCount = l_Header.LayerCount;
+        m_MipLevelCount = l_Header.MipLevelCount;
+        m_SourceHash = l_Header.SourceHash;
+
+        return true;
+    }
+
+    void TextureAtlas::Close()
+    {
+        m_File.Close();
+        m_Data = nullptr;
+        m_Size = 0;
+        m_Layers = nullptr;
+        m_Flags = nullptr;
+        std::memset(m_MipOffsets, 0, sizeof(m_MipOffsets));
+        m_TileSize = 0;
+        m_SourceTileCount = 0;
+        m_LayerCount = 0;
+        m_MipLevelCount = 0;
+        m_SourceHash = 0;
+    }
+
+    bool TextureAtlas::LoadOrBuild(const TextureAtlasDescriptor& descriptor, const std::filesystem::path& cachePath)
+    {
+        ENGINE_PROFILE_SCOPE("TextureAtlas::LoadOrBuild");
+
+        // Hashing the encoded file costs a read of a few hundred KB; decoding is what the cache avoids.
+        uint32_t l_SourceHash = 0;
+        bool l_HasSource = false;
+        {
+            MappedFile l_Source;
+            if (l_Source.Open(descriptor.SourcePath) && l_Source.GetSize() != 0)
+            {
+                l_SourceHash = TextureAtlasBuilder::ComputeSourceHash(l_Source.GetData(), l_Source.GetSize(), descriptor);
+                l_HasSource = true;
+            }
+        }
+
+        if (Open(cachePath))
+        {
+            if (l_HasSource && m_SourceHash == l_SourceHash)
+            {
+                return true;
+            }
+
+            // Builds shipped without sources keep using whatever was cooked last.
+            if (!l_HasSource)
+            {
+                ENGINE_CHANNEL_WARN(Assets, "Atlas source {} is missing; using the cooked copy in {}", descriptor.SourcePath.string(), cachePath.string());
+
+                return true;
+            }
+
+            Close();
+        }
+
+        if (!l_HasSource)
+        {
+            ENGINE_CHANNEL_ERROR(Assets, "Atlas source {} is missing and {} holds no usable cache", descriptor.SourcePath.string(), cachePath.string());
+
+            return false;
+        }
+
+        ENGINE_CHANNEL_INFO(Assets, "Cooking atlas {} into {}", descriptor.SourcePath.string(), cachePath.string());
+        if (!TextureAtlasBuilder::Build(descriptor, cachePath) || !Open(cachePath))
+        {
+            return false;
+        }
+
+        ENGINE_CHANNEL_INFO(Assets, "Atlas cooked: {} tiles in {} layers, {} mip levels, {} bytes", m_SourceTileCount, m_LayerCount, m_MipLevelCount, m_Size);
+
+        return true;
+    }
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/IO/MappedFile.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+namespace Engine
+{
+    // How a hand-made atlas image is cut into tiles.
+    struct TextureAtlasDescriptor
+    {
+        std::filesystem::path SourcePath;
+
+        // Tiles are square and laid out row-major from the top-left corner; partial tiles at the edges are ignored.
+        uint32_t TileSize = 16;
+
+        // Mip levels kept per layer, base level included; zero builds the full chain down to 1x1.
+        uint32_t MipLevelCount = 0;
+    };
+
+    // Per-tile properties derived from the base level's alpha channel.
+    enum TextureAtlasTileFlags : uint8_t
+    {
+        TileFlagEmpty = 1 << 0,         // Fully transparent; the tile has no layer.
+        TileFlagCutout = 1 << 1,        // Alpha is only ever 0 or 255, so alpha testing is enough.
+        TileFlagTranslucent = 1 << 2    // Has partially transparent texels and needs blending.
+    };
+
+    // Cooked atlas: every distinct, non-empty tile is one layer of a texture array with its own mip chain,
+    // so filtering never samples a neighbouring tile. Source tile indices (what PackedChunkVertex carries)
+    // map to layers through a lookup table; identical tiles share a layer.
+    //
+    // Blob layout, little-endian:
+    //   header (32 bytes)
+    //   u16 layer per source tile (InvalidLayer for empty tiles), u8 flags per source tile
+    //   mip levels from largest to smallest, each 16-byte aligned and holding every layer's RGBA8 texels
+    //   back to back, which is the order glTexSubImage3D takes a whole level in
+    // The header and tables carry a CRC; texel data is trusted once the sizes match so opening stays O(1).
+    class ENGINE_API TextureAtlas
+    {
+    public:
+        static constexpr uint16_t InvalidLayer = 0xFFFF;
+        static constexpr uint32_t MaxMipLevels = 16;
+
+        TextureAtlas() = default;
+        TextureAtlas(const TextureAtlas&) = delete;
+        TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+        // Maps a cooked blob; returns false when it is missing, truncated, corrupt or an older format.
+        bool Open(const std::filesystem::path& path);
+
+        // Validates a cooked blob owned by someone else, such as the asset manager, and reads from it in place.
+        // The memory must outlive the atlas or the next Close/Attach.
+        bool Attach(const uint8_t* data, size_t size);
+        void Close();
+
+        // Maps the cache when it was cooked from the current source and descriptor, otherwise cooks it first.
+        // Only a cache miss decodes the image.
+        bool LoadOrBuild(const TextureAtlasDescriptor& descriptor, const std::filesystem::path& cachePath);
+
+        bool IsOpen() const { return m_Data != nullptr; }
+
+        uint32_t GetTileSize() const { return m_TileSize; }
+        uint32_t GetSourceTileCount() const { return m_SourceTileCount; }
+        uint32_t GetLayerCount() const { return m_LayerCount; }
+        uint32_t GetMipLevelCount() const { return m_MipLevelCount; }
+
+        // Hash of the source image and descriptor the blob was cooked from.
+        uint32_t GetSourceHash() const { return m_SourceHash; }
+
+        uint16_t GetLayer(uint32_t sourceTile) const { return sourceTile < m_SourceTileCount ? m_Layers[sourceTile] : InvalidLayer; }
+        uint8_t GetTileFlags(uint32_t sourceTile) const { return sourceTile < m_SourceTileCount ? m_Flags[sourceTile] : uint8_t(TileFlagEmpty); }
+
+        // The whole tile-to-layer table, ready to upload as a buffer the shader indexes with the vertex tile.
+        const uint16_t* GetLayerTable() const { return m_Layers; }
+
+        // Edge length in texels of one layer at the given level.
+        uint32_t GetMipExtent(uint32_t level) const { return m_TileSize >> level; }
+        const uint8_t* GetMipData(uint32_t level) const { return m_Data + m_MipOffsets[level]; }
+        size_t GetMipSize(uint32_t level) const { return static_cast<size_t>(GetMipExtent(level)) * GetMipExtent(level) * 4 * m_LayerCount; }
+
+        size_t GetBlobSize() const { return m_Size; }
+
+    private:
+        // Only used by Open; Attach leaves it closed.
+        MappedFile m_File;
+        const uint8_t* m_Data = nullptr;
+        size_t m_Size = 0;
+
+        const uint16_t* m_Layers = nullptr;
+        const uint8_t* m_Flags = nullptr;
+        uint64_t m_MipOffsets[MaxMipLevels]{};
+
+        uint32_t m_TileSize = 0;
+        uint32_t m_SourceTileCount = 0;
+        uint32_t m_LayerCount = 0;
+        uint32_t m_MipLevelCount = 0;
+        uint32_t m_SourceHash = 0;
+    };
+}
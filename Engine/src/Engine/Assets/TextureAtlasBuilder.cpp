@@ -0,0 +1,348 @@
+#include "Engine/Assets/TextureAtlasBuilder.h"
+
+#include "Engine/Assets/TextureAtlasFormat.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Profiler.h"
+#include "Engine/IO/Compression.h"
+#include "Engine/IO/MappedFile.h"
+#include "Engine/IO/WritableFile.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <unordered_map>
+
+// Only the PNG decoder is compiled in, and images are always handed over from memory.
+#define STB_IMAGE_IMPLEMENTATION
+#define STBI_ONLY_PNG
+#define STBI_NO_STDIO
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+#include <stb_image.h>
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+// SSE2 is part of the x86-64 baseline, so the filter needs no runtime dispatch.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define ENGINE_ATLAS_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define ENGINE_ATLAS_SSE2 0
+#endif
+
+namespace Engine::TextureAtlasBuilder
+{
+    namespace
+    {
+        // Resolution of the linear-to-sRGB encode table; fine enough that every 8-bit output stays reachable.
+        constexpr uint32_t s_EncodeTableSize = 4096;
+
+        // Filtering happens in linear light so mips of high-contrast tiles do not darken.
+        struct ColorTables
+        {
+            std::array<float, 256> SrgbToLinear{};
+            std::array<uint8_t, s_EncodeTableSize> LinearToSrgb{};
+
+            ColorTables()
+            {
+                for (uint32_t i = 0; i < 256; ++i)
+                {
+                    const float l_Value = static_cast<float>(i) / 255.0f;
+                    SrgbToLinear[i] = l_Value <= 0.04045f ? l_Value / 12.92f : std::pow((l_Value + 0.055f) / 1.055f, 2.4f);
+                }
+
+                for (uint32_t i = 0; i < s_EncodeTableSize; ++i)
+                {
+                    const float l_Value = static_cast<float>(i) / static_cast<float>(s_EncodeTableSize - 1);
+                    const float l_Encoded = l_Value <= 0.0031308f ? l_Value * 12.92f : 1.055f * std::pow(l_Value, 1.0f / 2.4f) - 0.055f;
+                    LinearToSrgb[i] = static_cast<uint8_t>(std::clamp(l_Encoded, 0.0f, 1.0f) * 255.0f + 0.5f);
+                }
+            }
+        };
+
+        const ColorTables& GetColorTables()
+        {
+            static const ColorTables s_Tables;
+
+            return s_Tables;
+        }
+
+        uint8_t ComputeTileFlags(const uint8_t* texels, uint32_t texelCount)
+        {
+            bool l_HasVisible = false;
+            bool l_HasHole = false;
+            bool l_HasPartial = false;
+            for (uint32_t i = 0; i < texelCount; ++i)
+            {
+                const uint8_t l_Alpha = texels[i * 4 + 3];
+                l_HasVisible = l_HasVisible || l_Alpha != 0;
+                l_HasHole = l_HasHole || l_Alpha == 0;
+                l_HasPartial = l_HasPartial || (l_Alpha != 0 && l_Alpha != 255);
+            }
+
+            if (!l_HasVisible)
+            {
+                return TileFlagEmpty;
+            }
+
+            if (l_HasPartial)
+            {
+                return TileFlagTranslucent;
+            }
+
+            return l_HasHole ? uint8_t(TileFlagCutout) : uint8_t(0);
+        }
+
+        // RGBA8 sRGB to premultiplied linear RGBA floats; premultiplying keeps transparent texels' colour out of the average.
+        void DecodeLayer(const uint8_t* texels, uint32_t texelCount, float* output)
+        {
+            const ColorTables& l_Tables = GetColorTables();
+            for (uint32_t i = 0; i < texelCount; ++i)
+            {
+                const float l_Alpha = static_cast<float>(texels[i * 4 + 3]) / 255.0f;
+                output[i * 4 + 0] = l_Tables.SrgbToLinear[texels[i * 4 + 0]] * l_Alpha;
+                output[i * 4 + 1] = l_Tables.SrgbToLinear[texels[i * 4 + 1]] * l_Alpha;
+                output[i * 4 + 2] = l_Tables.SrgbToLinear[texels[i * 4 + 2]] * l_Alpha;
+                output[i * 4 + 3] = l_Alpha;
+            }
+        }
+
+        void EncodeLayer(const float* texels, uint32_t texelCount, uint8_t* output)
+        {
+            const ColorTables& l_Tables = GetColorTables();
+            for (uint32_t i = 0; i < texelCount; ++i)
+            {
+                const float l_Alpha = texels[i * 4 + 3];
+                const float l_Scale = l_Alpha > 0.0f ? 1.0f / l_Alpha : 0.0f;
+                for (uint32_t c = 0; c < 3; ++c)
+                {
+                    const float l_Linear = std::clamp(texels[i * 4 + c] * l_Scale, 0.0f, 1.0f);
+                    output[i * 4 + c] = l_Tables.LinearToSrgb[static_cast<uint32_t>(l_Linear * static_cast<float>(s_EncodeTableSize - 1) + 0.5f)];
+                }
+                output[i * 4 + 3] = static_cast<uint8_t>(std::clamp(l_Alpha, 0.0f, 1.0f) * 255.0f + 0.5f);
+            }
+        }
+
+        uint32_t GetFullMipCount(uint32_t tileSize)
+        {
+            uint32_t l_Count = 1;
+            while ((tileSize >> l_Count) != 0)
+            {
+                ++l_Count;
+            }
+
+            return l_Count;
+        }
+    }
+
+    bool DecodeImage(const uint8_t* data, size_t size, AtlasImage& image)
+    {
+        ENGINE_PROFILE_SCOPE("TextureAtlasBuilder::DecodeImage");
+
+        int l_Width = 0;
+        int l_Height = 0;
+        int l_Channels = 0;
+        stbi_uc* l_Pixels = stbi_load_from_memory(data, static_cast<int>(size), &l_Width, &l_Height, &l_Channels, 4);
+        if (l_Pixels == nullptr)
+        {
+            ENGINE_CHANNEL_ERROR(Assets, "Failed to decode image ({})", stbi_failure_reason());
+
+            return false;
+        }
+
+        image.Width = static_cast<uint32_t>(l_Width);
+        image.Height = static_cast<uint32_t>(l_Height);
+        image.Pixels.assign(l_Pixels, l_Pixels + static_cast<size_t>(l_Width) * static_cast<size_t>(l_Height) * 4);
+        stbi_image_free(l_Pixels);
+
+        return true;
+    }
+
+    uint32_t ComputeSourceHash(const uint8_t* data, size_t size, const TextureAtlasDescriptor& descriptor)
+    {
+        const uint32_t l_Parameters[3] = { FormatVersion, descriptor.TileSize, descriptor.MipLevelCount };
+        const uint32_t l_Crc = Compression::ComputeCrc32(data, size);
+
+        return Compression::ComputeCrc32(l_Parameters, sizeof(l_Parameters), l_Crc);
+    }
+
+    void DownsampleLevel(const float* source, uint32_t sourceExtent, float* destination)
+    {
+        const uint32_t l_Extent = sourceExtent / 2;
+        const size_t l_RowFloats = static_cast<size_t>(sourceExtent) * 4;
+        for (uint32_t y = 0; y < l_Extent; ++y)
+        {
+            const float* l_Top = source + static_cast<size_t>(y) * 2 * l_RowFloats;
+            const float* l_Bottom = l_Top + l_RowFloats;
+            float* l_Output = destination + static_cast<size_t>(y) * l_Extent * 4;
+
+#if ENGINE_ATLAS_SSE2
+            // One RGBA texel per register.
+            const __m128 l_Quarter = _mm_set1_ps(0.25f);
+            for (uint32_t x = 0; x < l_Extent; ++x)
+            {
+                const __m128 l_A = _mm_loadu_ps(l_Top + x * 8);
+                const __m128 l_B = _mm_loadu_ps(l_Top + x * 8 + 4);
+                const __m128 l_C = _mm_loadu_ps(l_Bottom + x * 8);
+                const __m128 l_D = _mm_loadu_ps(l_Bottom + x * 8 + 4);
+                const __m128 l_Sum = _mm_add_ps(_mm_add_ps(_mm_add_ps(l_A, l_B), l_C), l_D);
+                _mm_storeu_ps(l_Output + x * 4, _mm_mul_ps(l_Sum, l_Quarter));
+            }
+#else
+            for (uint32_t x = 0; x < l_Extent; ++x)
+            {
+                for (uint32_t c = 0; c < 4; ++c)
+                {
+                    const float l_Sum = ((l_Top[x * 8 + c] + l_Top[x * 8 + 4 + c]) + l_Bottom[x * 8 + c]) + l_Bottom[x * 8 + 4 + c];
+                    l_Output[x * 4 + c] = l_Sum * 0.25f;
+                }
+            }
+#endif
+        }
+    }
+
+    bool Cook(const AtlasImage& image, const TextureAtlasDescriptor& descriptor, uint32_t sourceHash, std::vector<uint8_t>& output)
+    {
+        ENGINE_PROFILE_SCOPE("TextureAtlasBuilder::Cook");
+
+        const uint32_t l_TileSize = descriptor.TileSize;
+        if (l_TileSize == 0 || (l_TileSize & (l_TileSize - 1)) != 0 || l_TileSize > (1u << (TextureAtlas::MaxMipLevels - 1)))
+        {
+            ENGINE_CHANNEL_ERROR(Assets, "Atlas tile size {} is not a power of two", l_TileSize);
+
+            return false;
+        }
+
+        const uint32_t l_Columns = image.Width / l_TileSize;
+        const uint32_t l_Rows = image.Height / l_TileSize;
+        const uint32_t l_SourceTileCount = l_Columns * l_Rows;
+        if (l_SourceTileCount == 0 || l_SourceTileCount >= TextureAtlas::InvalidLayer)
+        {
+            ENGINE_CHANNEL_ERROR(Assets, "A {}x{} image cannot be cut into {}px tiles", image.Width, image.Height, l_TileSize);
+
+            return false;
+        }
+
+        const uint32_t l_FullMipCount = GetFullMipCount(l_TileSize);
+        const uint32_t l_MipCount = descriptor.MipLevelCount == 0 ? l_FullMipCount : std::min(descriptor.MipLevelCount, l_FullMipCount);
+        const uint32_t l_TexelCount = l_TileSize * l_TileSize;
+        const size_t l_LayerBytes = static_cast<size_t>(l_TexelCount) * 4;
+
+        // Pass 1: slice, classify and deduplicate. Base-level texels are copied verbatim, never re-encoded.
+        std::vector<uint16_t> l_Layers(l_SourceTileCount, TextureAtlas::InvalidLayer);
+        std::vector<uint8_t> l_Flags(l_SourceTileCount, 0);
+        std::vector<uint8_t> l_BaseLevel;
+        std::unordered_map<uint32_t, std::vector<uint16_t>> l_LayersByHash;
+        std::vector<uint8_t> l_Tile(l_LayerBytes);
+        for (uint32_t it_Tile = 0; it_Tile < l_SourceTileCount; ++it_Tile)
+        {
+            const uint32_t l_OriginX = (it_Tile % l_Columns) * l_TileSize;
+            const uint32_t l_OriginY = (it_Tile / l_Columns) * l_TileSize;
+            for (uint32_t y = 0; y < l_TileSize; ++y)
+            {
+                const size_t l_SourceOffset = (static_cast<size_t>(l_OriginY + y) * image.Width + l_OriginX) * 4;
+                std::memcpy(l_Tile.data() + static_cast<size_t>(y) * l_TileSize * 4, image.Pixels.data() + l_SourceOffset, static_cast<size_t>(l_TileSize) * 4);
+            }
+
+            l_Flags[it_Tile] = ComputeTileFlags(l_Tile.data(), l_TexelCount);
+            if ((l_Flags[it_Tile] & TileFlagEmpty) != 0)
+            {
+                continue;
+            }
+
+            std::vector<uint16_t>& l_Candidates = l_LayersByHash[Compression::ComputeCrc32(l_Tile.data(), l_LayerBytes)];
+            for (const uint16_t it_Layer : l_Candidates)
+            {
+                if (std::memcmp(l_BaseLevel.data() + it_Layer * l_LayerBytes, l_Tile.data(), l_LayerBytes) == 0)
+                {
+                    l_Layers[it_Tile] = it_Layer;
+                    break;
+                }
+            }
+
+            if (l_Layers[it_Tile] == TextureAtlas::InvalidLayer)
+            {
+                const uint16_t l_Layer = static_cast<uint16_t>(l_BaseLevel.size() / l_LayerBytes);
+                l_BaseLevel.insert(l_BaseLevel.end(), l_Tile.begin(), l_Tile.end());
+                l_Candidates.push_back(l_Layer);
+                l_Layers[it_Tile] = l_Layer;
+            }
+        }
+
+        TextureAtlasFormat::FileHeader l_Header;
+        l_Header.Magic = TextureAtlasFormat::Magic;
+        l_Header.Version = FormatVersion;
+        l_Header.TileSize = static_cast<uint16_t>(l_TileSize);
+        l_Header.SourceTileCount = l_SourceTileCount;
+        l_Header.LayerCount = static_cast<uint32_t>(l_BaseLevel.size() / l_LayerBytes);
+        l_Header.MipLevelCount = l_MipCount;
+        l_Header.SourceHash = sourceHash;
+
+        uint64_t l_MipOffsets[TextureAtlas::MaxMipLevels]{};
+        output.assign(TextureAtlasFormat::ComputeMipOffsets(l_Header, l_MipOffsets), 0);
+
+        const size_t l_TablesOffset = sizeof(l_Header);
+        std::memcpy(output.data() + l_TablesOffset, l_Layers.data(), l_Layers.size() * sizeof(uint16_t));
+        std::memcpy(output.data() + l_TablesOffset + l_Layers.size() * sizeof(uint16_t), l_Flags.data(), l_Flags.size());
+        std::memcpy(output.data() + l_MipOffsets[0], l_BaseLevel.data(), l_BaseLevel.size());
+
+        // Pass 2: each layer's chain is filtered from the previous float level, so rounding never compounds.
+        std::vector<float> l_Current(static_cast<size_t>(l_TexelCount) * 4);
+        std::vector<float> l_Next(l_Current.size());
+        for (uint32_t it_Layer = 0; it_Layer < l_Header.LayerCount; ++it_Layer)
+        {
+            DecodeLayer(l_BaseLevel.data() + it_Layer * l_LayerBytes, l_TexelCount, l_Current.data());
+            for (uint32_t it_Level = 1; it_Level < l_MipCount; ++it_Level)
+            {
+                const uint32_t l_Extent = l_TileSize >> it_Level;
+                DownsampleLevel(l_Current.data(), l_Extent * 2, l_Next.data());
+
+                const size_t l_LevelLayerBytes = static_cast<size_t>(l_Extent) * l_Extent * 4;
+                EncodeLayer(l_Next.data(), l_Extent * l_Extent, output.data() + l_MipOffsets[it_Level] + it_Layer * l_LevelLayerBytes);
+                l_Current.swap(l_Next);
+            }
+        }
+
+        const uint32_t l_Crc = Compression::ComputeCrc32(&l_Header, offsetof(TextureAtlasFormat::FileHeader, TableCrc));
+        l_Header.TableCrc = Compression::ComputeCrc32(output.data() + l_TablesOffset, TextureAtlasFormat::GetTablesSize(l_SourceTileCount), l_Crc);
+        std::memcpy(output.data(), &l_Header, sizeof(l_Header));
+
+        return true;
+    }
+
+    bool Build(const TextureAtlasDescriptor& descriptor, const std::filesystem::path& outputPath)
+    {
+        MappedFile l_Source;
+        if (!l_Source.Open(descriptor.SourcePath) || l_Source.GetSize() == 0)
+        {
+            ENGINE_CHANNEL_ERROR(Assets, "Failed to read atlas source {}", descriptor.SourcePath.string());
+
+            return false;
+        }
+
+        AtlasImage l_Image;
+        if (!DecodeImage(l_Source.GetData(), l_Source.GetSize(), l_Image))
+        {
+            return false;
+        }
+
+        std::vector<uint8_t> l_Blob;
+        if (!Cook(l_Image, descriptor, ComputeSourceHash(l_Source.GetData(), l_Source.GetSize(), descriptor), l_Blob))
+        {
+            return false;
+        }
+
+        if (!WritableFile::WriteAtomically(outputPath, l_Blob.data(), l_Blob.size()))
+        {
+            ENGINE_CHANNEL_ERROR(Assets, "Failed to write atlas cache {}", outputPath.string());
+
+            return false;
+        }
+
+        return true;
+    }
+}
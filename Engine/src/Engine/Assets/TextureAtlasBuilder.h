@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/Assets/TextureAtlas.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace Engine::TextureAtlasBuilder
+{
+    // Bumping this invalidates every cooked atlas, since it is part of the source hash.
+    constexpr uint16_t FormatVersion = 1;
+
+    // Decoded RGBA8 image, rows from top to bottom.
+    struct AtlasImage
+    {
+        uint32_t Width = 0;
+        uint32_t Height = 0;
+        std::vector<uint8_t> Pixels;
+    };
+
+    // Decodes a PNG held in memory, expanding it to RGBA8.
+    ENGINE_API bool DecodeImage(const uint8_t* data, size_t size, AtlasImage& image);
+
+    // Identifies the cook inputs: the encoded source file, the descriptor fields and the blob format.
+    ENGINE_API uint32_t ComputeSourceHash(const uint8_t* data, size_t size, const TextureAtlasDescriptor& descriptor);
+
+    // Slices the image into tiles, drops empty ones, merges duplicates into one layer and builds each layer's
+    // mip chain. Replaces the contents of output with the blob layout documented on TextureAtlas.
+    ENGINE_API bool Cook(const AtlasImage& image, const TextureAtlasDescriptor& descriptor, uint32_t sourceHash, std::vector<uint8_t>& output);
+
+    // Reads, decodes and cooks descriptor.SourcePath, then writes the blob to outputPath through a temporary
+    // file so a crash never leaves a half-written cache behind.
+    ENGINE_API bool Build(const TextureAtlasDescriptor& descriptor, const std::filesystem::path& outputPath);
+
+    // One 2x2 box-filter step over premultiplied, linear-light RGBA floats: extent x extent in, half that out.
+    // Uses SSE2 where available; the scalar path adds in the same order, so both produce identical output.
+    ENGINE_API void DownsampleLevel(const float* source, uint32_t sourceExtent, float* destination);
+}
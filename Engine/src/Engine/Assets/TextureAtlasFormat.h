@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// On-disk layout shared by TextureAtlas (reader) and TextureAtlasBuilder (writer); not part of the public API.
+namespace Engine::TextureAtlasFormat
+{
+    constexpr uint32_t Magic = 0x4154434Du; // "MCTA"
+
+    struct FileHeader
+    {
+        uint32_t Magic = 0;
+        uint16_t Version = 0;
+        uint16_t TileSize = 0;
+        uint32_t SourceTileCount = 0;
+        uint32_t LayerCount = 0;
+        uint32_t MipLevelCount = 0;
+        uint32_t SourceHash = 0;
+
+        // Covers every header field before it plus both lookup tables.
+        uint32_t TableCrc = 0;
+        uint32_t Reserved = 0;
+    };
+
+    static_assert(sizeof(FileHeader) == 32, "Atlas header must have no padding");
+
+    constexpr uint64_t AlignMip(uint64_t offset)
+    {
+        return (offset + 15) & ~uint64_t{ 15 };
+    }
+
+    constexpr uint64_t GetTablesSize(uint32_t sourceTileCount)
+    {
+        return uint64_t{ sourceTileCount } * (sizeof(uint16_t) + sizeof(uint8_t));
+    }
+
+    constexpr uint64_t GetMipSize(uint32_t tileSize, uint32_t level, uint32_t layerCount)
+    {
+        const uint64_t l_Extent = tileSize >> level;
+
+        return l_Extent * l_Extent * 4 * layerCount;
+    }
+
+    // Fills offsets[0..levelCount) and returns the total blob size.
+    inline uint64_t ComputeMipOffsets(const FileHeader& header, uint64_t* offsets)
+    {
+        uint64_t l_Offset = sizeof(FileHeader) + GetTablesSize(header.SourceTileCount);
+        for (uint32_t i = 0; i < header.MipLevelCount; ++i)
+        {
+            l_Offset = AlignMip(l_Offset);
+            offsets[i] = l_Offset;
+            l_Offset += GetMipSize(header.TileSize, i, header.LayerCount);
+        }
+
+        return l_Offset;
+    }
+}
@@ -0,0 +1,290 @@
+#include "Engine/Core/AsyncLogSink.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <string_view>
+
+namespace Engine
+{
+    AsyncLogSink::AsyncLogSink(std::vector<spdlog::sink_ptr> targets, uint32_t queueCapacity, LogOverflowPolicy overflowPolicy)
+        : m_Targets(std::move(targets)), m_OverflowPolicy(overflowPolicy), m_Queue(queueCapacity)
+    {
+        m_IsRunning.store(true, std::memory_order_release);
+        m_Thread = std::thread(&AsyncLogSink::ThreadMain, this);
+    }
+
+    AsyncLogSink::~AsyncLogSink()
+    {
+        Stop();
+    }
+
+    void AsyncLogSink::log(const spdlog::details::log_msg& message)
+    {
+        if (!m_IsRunning.load(std::memory_order_acquire))
+        {
+            WriteThrough(message);
+
+            return;
+        }
+
+        // Too long for a queue cell: let everything queued so far reach the targets, then write it whole on
+        // this thread so it neither loses its tail nor overtakes earlier messages.
+        if (message.payload.size() > MaxPayloadSize)
+        {
+            flush();
+            WriteThrough(message);
+            FlushTargets();
+
+            return;
+        }
+
+        Record l_Record;
+        l_Record.Time = message.time;
+        l_Record.ThreadId = message.thread_id;
+        l_Record.Level = message.level;
+        l_Record.LoggerNameSize = static_cast<uint8_t>(std::min(message.logger_name.size(), l_Record.LoggerName.size()));
+        std::memcpy(l_Record.LoggerName.data(), message.logger_name.data(), l_Record.LoggerNameSize);
+        l_Record.PayloadSize = static_cast<uint16_t>(std::min(message.payload.size(), l_Record.Payload.size()));
+        std::memcpy(l_Record.Payload.data(), message.payload.data(), l_Record.PayloadSize);
+
+        if (!m_Queue.TryPush(l_Record))
+        {
+            if (m_OverflowPolicy == LogOverflowPolicy::Drop)
+            {
+                m_DroppedCount.fetch_add(1, std::memory_order_relaxed);
+
+                return;
+            }
+
+            // Block: keep nudging the background thread until a cell frees up. If the sink stops meanwhile
+            // nothing will free one, so write the message here instead.
+            do
+            {
+                if (!m_IsRunning.load(std::memory_order_acquire))
+                {
+                    WriteThrough(message);
+
+                    return;
+                }
+
+                ForceWake();
+                std::this_thread::yield();
+            } while (!m_Queue.TryPush(l_Record));
+        }
+
+        // The push may have landed after Stop() drained the queue; nobody else would ever write it. The fence
+        // pairs with the exchange in Stop() so at least one side sees the other.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!m_IsRunning.load(std::memory_order_relaxed))
+        {
+            DrainStopped();
+
+            return;
+        }
+
+        Wake();
+    }
+
+    void AsyncLogSink::flush()
+    {
+        if (!m_IsRunning.load(std::memory_order_acquire))
+        {
+            std::lock_guard<std::mutex> l_Lock(m_SynchronousMutex);
+            FlushTargets();
+
+            return;
+        }
+
+        const uint64_t l_Target = m_Queue.GetPushCount();
+        ForceWake();
+
+        std::unique_lock<std::mutex> l_Lock(m_FlushMutex);
+        m_FlushCondition.wait(l_Lock, [this, l_Target]()
+            {
+                return m_FlushedCount >= l_Target || !m_IsRunning.load(std::memory_order_acquire);
+            });
+    }
+
+    void AsyncLogSink::set_pattern(const std::string& pattern)
+    {
+        for (const spdlog::sink_ptr& it_Target : m_Targets)
+        {
+            it_Target->set_pattern(pattern);
+        }
+    }
+
+    void AsyncLogSink::set_formatter(std::unique_ptr<spdlog::formatter> formatter)
+    {
+        for (const spdlog::sink_ptr& it_Target : m_Targets)
+        {
+            it_Target->set_formatter(formatter->clone());
+        }
+    }
+
+    void AsyncLogSink::Stop()
+    {
+        if (!m_IsRunning.exchange(false, std::memory_order_seq_cst))
+        {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> l_Lock(m_WakeMutex);
+            m_IsStopRequested = true;
+            m_IsConsumerIdle.store(false);
+        }
+        m_WakeCondition.notify_one();
+
+        if (m_Thread.joinable())
+        {
+            m_Thread.join();
+        }
+
+        // Producers that saw the sink running just before it stopped may still have queued a message.
+        DrainStopped();
+
+        std::lock_guard<std::mutex> l_FlushLock(m_FlushMutex);
+        m_FlushCondition.notify_all();
+    }
+
+    void AsyncLogSink::ThreadMain()
+    {
+        Record l_Record;
+        uint64_t l_ReportedDropCount = 0;
+
+        for (;;)
+        {
+            bool l_HasWritten = false;
+            while (m_Queue.TryPop(l_Record))
+            {
+                Write(l_Record);
+                l_HasWritten = true;
+            }
+
+            const uint64_t l_DroppedCount = m_DroppedCount.load(std::memory_order_relaxed);
+            if (l_DroppedCount != l_ReportedDropCount)
+            {
+                WriteDropReport(l_DroppedCount - l_ReportedDropCount);
+                l_ReportedDropCount = l_DroppedCount;
+                l_HasWritten = true;
+            }
+
+            // The file only reaches the disk here, off the threads that produced the messages.
+            if (l_HasWritten)
+            {
+                FlushTargets();
+            }
+
+            {
+                std::lock_guard<std::mutex> l_Lock(m_FlushMutex);
+                m_FlushedCount = m_Queue.GetPopCount();
+            }
+            m_FlushCondition.notify_all();
+
+            std::unique_lock<std::mutex> l_Lock(m_WakeMutex);
+            const bool l_IsDrained = m_Queue.GetPopCount() == m_Queue.GetPushCount();
+            if (m_IsStopRequested && l_IsDrained)
+            {
+                break;
+            }
+
+            if (!l_IsDrained)
+            {
+                // A producer claimed a cell but has not finished copying into it yet.
+                l_Lock.unlock();
+                std::this_thread::yield();
+
+                continue;
+            }
+
+            // Announce the nap before sleeping so producers know to notify; the timeout bounds the latency
+            // of a wake-up that races with this check.
+            m_IsConsumerIdle.store(true);
+            if (m_Queue.GetPopCount() == m_Queue.GetPushCount())
+            {
+                m_WakeCondition.wait_for(l_Lock, std::chrono::milliseconds(50), [this]()
+                    {
+                        return !m_IsConsumerIdle.load() || m_IsStopRequested;
+                    });
+            }
+            m_IsConsumerIdle.store(false);
+        }
+    }
+
+    void AsyncLogSink::Write(const Record& record)
+    {
+        spdlog::details::log_msg l_Message(record.Time, spdlog::source_loc{}, std::string_view(record.LoggerName.data(), record.LoggerNameSize),
+            record.Level, std::string_view(record.Payload.data(), record.PayloadSize));
+        l_Message.thread_id = record.ThreadId;
+
+        for (const spdlog::sink_ptr& it_Target : m_Targets)
+        {
+            if (it_Target->should_log(record.Level))
+            {
+                it_Target->log(l_Message);
+            }
+        }
+    }
+
+    void AsyncLogSink::WriteThrough(const spdlog::details::log_msg& message)
+    {
+        std::lock_guard<std::mutex> l_Lock(m_SynchronousMutex);
+        for (const spdlog::sink_ptr& it_Target : m_Targets)
+        {
+            if (it_Target->should_log(message.level))
+            {
+                it_Target->log(message);
+            }
+        }
+    }
+
+    void AsyncLogSink::DrainStopped()
+    {
+        std::lock_guard<std::mutex> l_Lock(m_SynchronousMutex);
+        Record l_Record;
+        while (m_Queue.TryPop(l_Record))
+        {
+            Write(l_Record);
+        }
+        FlushTargets();
+    }
+
+    void AsyncLogSink::WriteDropReport(uint64_t droppedCount)
+    {
+        const std::string l_Text = "Dropped " + std::to_string(droppedCount) + " log messages because the queue was full";
+        spdlog::details::log_msg l_Message(std::string_view("LOG"), spdlog::level::warn, std::string_view(l_Text));
+
+        for (const spdlog::sink_ptr& it_Target : m_Targets)
+        {
+            it_Target->log(l_Message);
+        }
+    }
+
+    void AsyncLogSink::FlushTargets()
+    {
+        for (const spdlog::sink_ptr& it_Target : m_Targets)
+        {
+            it_Target->flush();
+        }
+    }
+
+    void AsyncLogSink::Wake()
+    {
+        // A plain load keeps the common case (consumer busy) free of shared writes.
+        if (m_IsConsumerIdle.load() && m_IsConsumerIdle.exchange(false))
+        {
+            std::lock_guard<std::mutex> l_Lock(m_WakeMutex);
+            m_WakeCondition.notify_one();
+        }
+    }
+
+    void AsyncLogSink::ForceWake()
+    {
+        {
+            std::lock_guard<std::mutex> l_Lock(m_WakeMutex);
+            m_IsConsumerIdle.store(false);
+        }
+        m_WakeCondition.notify_one();
+    }
+}
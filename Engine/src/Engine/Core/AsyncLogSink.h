@@ -0,0 +1,111 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/Jobs/MpmcQueue.h"
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _MSC_VER
+#pragma warning(push, 0)
+#endif
+#include <spdlog/sinks/sink.h>
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+namespace Engine
+{
+    // What a producer does when the log queue is full.
+    enum class LogOverflowPolicy : uint8_t
+    {
+        // Wait for the background thread to make room; nothing is lost.
+        Block,
+
+        // Discard the message and count it; the background thread reports the total later.
+        Drop
+    };
+
+    // spdlog sink that hands formatted messages to a background thread through a bounded lock-free queue.
+    // The calling thread only formats the message and copies it into a queue cell; the background thread
+    // writes every message to the wrapped sinks in order and flushes them whenever the queue runs dry.
+    // Messages longer than MaxPayloadSize do not fit a queue cell; they wait for the queue to drain and are
+    // written whole on the calling thread.
+    class ENGINE_API AsyncLogSink final : public spdlog::sinks::sink
+    {
+    public:
+        static constexpr size_t MaxPayloadSize = 440;
+
+        AsyncLogSink(std::vector<spdlog::sink_ptr> targets, uint32_t queueCapacity, LogOverflowPolicy overflowPolicy);
+        ~AsyncLogSink() override;
+
+        AsyncLogSink(const AsyncLogSink&) = delete;
+        AsyncLogSink& operator=(const AsyncLogSink&) = delete;
+
+        void log(const spdlog::details::log_msg& message) override;
+
+        // Block until every message queued before the call has been written and the targets are flushed.
+        void flush() override;
+
+        void set_pattern(const std::string& pattern) override;
+        void set_formatter(std::unique_ptr<spdlog::formatter> formatter) override;
+
+        // Drain the queue and join the background thread; later messages are written on the calling thread.
+        void Stop();
+
+        uint64_t GetDroppedCount() const { return m_DroppedCount.load(std::memory_order_relaxed); }
+
+    private:
+        // A log_msg with its strings copied out of the caller's buffers.
+        struct Record
+        {
+            spdlog::log_clock::time_point Time;
+            size_t ThreadId = 0;
+            spdlog::level::level_enum Level = spdlog::level::info;
+            uint8_t LoggerNameSize = 0;
+            uint16_t PayloadSize = 0;
+            std::array<char, 24> LoggerName{};
+            std::array<char, MaxPayloadSize> Payload{};
+        };
+
+        void ThreadMain();
+        void Write(const Record& record);
+        void WriteThrough(const spdlog::details::log_msg& message);
+        void DrainStopped();
+        void WriteDropReport(uint64_t droppedCount);
+        void FlushTargets();
+        void Wake();
+        void ForceWake();
+
+    private:
+        std::vector<spdlog::sink_ptr> m_Targets;
+        LogOverflowPolicy m_OverflowPolicy;
+
+        MpmcQueue<Record> m_Queue;
+        std::atomic<uint64_t> m_DroppedCount{ 0 };
+        std::atomic<bool> m_IsRunning{ false };
+
+        // Producers only touch the mutex when the background thread has announced it is going to sleep.
+        std::mutex m_WakeMutex;
+        std::condition_variable m_WakeCondition;
+        std::atomic<bool> m_IsConsumerIdle{ false };
+        bool m_IsStopRequested = false;
+
+        // Messages written and flushed so far, for flush() callers waiting on the background thread.
+        std::mutex m_FlushMutex;
+        std::condition_variable m_FlushCondition;
+        uint64_t m_FlushedCount = 0;
+
+        // Serializes writes that bypass the background thread: oversized messages, and everything once it has stopped.
+        std::mutex m_SynchronousMutex;
+
+        std::thread m_Thread;
+    };
+}
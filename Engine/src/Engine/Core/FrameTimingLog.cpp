@@ -0,0 +1,36 @@
+#include "Engine/Core/FrameTimingLog.h"
+
+#include "Engine/Core/Log.h"
+
+#include <cstdio>
+
+namespace Engine
+{
+    bool FrameTimingLog::WriteCsv(const std::filesystem::path& path) const
+    {
+        std::FILE* l_File = std::fopen(path.string().c_str(), "w");
+        if (l_File == nullptr)
+        {
+            ENGINE_ERROR("Failed to open frame timing file {}", path.string());
+
+            return false;
+        }
+
+        std::fputs("frame,delta_time,ticks,events,events_ms,update_ms,render_ms,present_ms,frame_ms,frame_arena_bytes\n", l_File);
+        for (const FrameTimingSample& it_Sample : m_Samples)
+        {
+            std::fprintf(l_File, "%llu,%.9f,%u,%u,%.4f,%.4f,%.4f,%.4f,%.4f,%llu\n", static_cast<unsigned long long>(it_Sample.FrameIndex),
+                it_Sample.DeltaTime, it_Sample.TickCount, it_Sample.EventCount, it_Sample.EventsMilliseconds, it_Sample.UpdateMilliseconds,
+                it_Sample.RenderMilliseconds, it_Sample.PresentMilliseconds, it_Sample.FrameMilliseconds,
+                static_cast<unsigned long long>(it_Sample.FrameArenaBytes));
+        }
+
+        const bool l_Succeeded = std::fclose(l_File) == 0;
+        if (l_Succeeded)
+        {
+            ENGINE_INFO("Wrote {} frame timings to {}", m_Samples.size(), path.string());
+        }
+
+        return l_Succeeded;
+    }
+}
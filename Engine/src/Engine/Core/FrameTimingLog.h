@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace Engine
+{
+    // Where one main-loop iteration spent its time, in milliseconds of wall clock.
+    struct FrameTimingSample
+    {
+        uint64_t FrameIndex = 0;
+
+        // Seconds the simulation advanced by (scripted or replayed deltas included).
+        double DeltaTime = 0.0;
+
+        uint32_t TickCount = 0;
+        uint32_t EventCount = 0;
+
+        double EventsMilliseconds = 0.0;
+        double UpdateMilliseconds = 0.0;
+        double RenderMilliseconds = 0.0;
+        double PresentMilliseconds = 0.0;
+        double FrameMilliseconds = 0.0;
+
+        // Frame arena high-water mark for this frame; spikes here explain allocator-driven hitches.
+        uint64_t FrameArenaBytes = 0;
+    };
+
+    // Collects per-frame timings in memory and writes them as CSV once the run ends, so the measured loop
+    // never touches the disk. Replaying the same input recording twice gives two directly comparable files.
+    class ENGINE_API FrameTimingLog
+    {
+    public:
+        void Reserve(size_t frameCount) { m_Samples.reserve(frameCount); }
+        void Add(const FrameTimingSample& sample) { m_Samples.push_back(sample); }
+        void Clear() { m_Samples.clear(); }
+
+        const std::vector<FrameTimingSample>& GetSamples() const { return m_Samples; }
+
+        bool WriteCsv(const std::filesystem::path& path) const;
+
+    private:
+        std::vector<FrameTimingSample> m_Samples;
+    };
+}
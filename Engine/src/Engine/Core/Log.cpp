@@ -1,5 +1,9 @@
 #include "Engine/Core/Log.h"
 
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <string_view>
 #include <vector>
 
 #include <spdlog/sinks/stdout_color_sinks.h>
@@ -9,11 +13,39 @@ namespace Engine
 {
     namespace Utilities
     {
+        namespace
+        {
+            constexpr const char* s_ChannelNames[] = { "ENGINE", "GAME", "WINDOW", "INPUT", "JOBS", "WORLD", "ASSETS" };
+            static_assert(std::size(s_ChannelNames) == static_cast<size_t>(LogChannel::Count), "Every log channel needs a name");
+
+            bool EqualsIgnoreCase(std::string_view left, std::string_view right)
+            {
+                return left.size() == right.size() && std::equal(left.begin(), left.end(), right.begin(), [](char a, char b)
+                    {
+                        return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+                    });
+            }
+
+            std::string_view Trim(std::string_view text)
+            {
+                while (!text.empty() && std::isspace(static_cast<unsigned char>(text.front())))
+                {
+                    text.remove_prefix(1);
+                }
+                while (!text.empty() && std::isspace(static_cast<unsigned char>(text.back())))
+                {
+                    text.remove_suffix(1);
+                }
+
+                return text;
+            }
+        }
+
         bool Log::s_IsInitialized = false;
-        std::shared_ptr<spdlog::logger> Log::s_CoreLogger;
-        std::shared_ptr<spdlog::logger> Log::s_ClientLogger;
+        std::array<std::shared_ptr<spdlog::logger>, static_cast<size_t>(LogChannel::Count)> Log::s_Loggers;
+        std::shared_ptr<AsyncLogSink> Log::s_AsyncSink;
 
-        void Log::Initialize()
+        void Log::Initialize(const LogSpecification& specification)
         {
             if (s_IsInitialized)
             {
@@ -27,22 +59,141 @@ namespace Engine
             l_LogSinks[0]->set_pattern("%^[%T] %n: %v%$");
             l_LogSinks[1]->set_pattern("[%T] [%l] %n: %v");
 
+            // In async mode the loggers only see the queue; the console and file are written by its thread.
+            if (specification.Async)
+            {
+                s_AsyncSink = std::make_shared<AsyncLogSink>(l_LogSinks, specification.QueueCapacity, specification.OverflowPolicy);
+                l_LogSinks = { s_AsyncSink };
+            }
+
             auto a_CreateLogger = [&](const char* name) -> std::shared_ptr<spdlog::logger>
                 {
                     auto a_Logger = std::make_shared<spdlog::logger>(name, begin(l_LogSinks), end(l_LogSinks));
                     spdlog::register_logger(a_Logger);
                     a_Logger->set_level(spdlog::level::trace);
-                    a_Logger->flush_on(spdlog::level::trace);
+
+                    // Synchronous logging keeps the old flush-every-message behaviour; async mode flushes in the
+                    // background and only makes errors wait until they are on disk.
+                    a_Logger->flush_on(specification.Async ? spdlog::level::err : spdlog::level::trace);
 
                     return a_Logger;
                 };
 
-            s_CoreLogger = a_CreateLogger("ENGINE");
-            s_ClientLogger = a_CreateLogger("GAME");
+            for (size_t i = 0; i < s_Loggers.size(); ++i)
+            {
+                s_Loggers[i] = a_CreateLogger(s_ChannelNames[i]);
+            }
+
+            // Per-event tracing of window and input callbacks is opt-in through the Levels string.
+            s_Loggers[static_cast<size_t>(LogChannel::Window)]->set_level(spdlog::level::info);
+            s_Loggers[static_cast<size_t>(LogChannel::Input)]->set_level(spdlog::level::info);
 
             s_IsInitialized = true;
 
-            ENGINE_INFO("Logging system initialized with console and file sinks");
+            // Static loggers outlive main, so the background thread is drained and joined before they are destroyed.
+            if (s_AsyncSink != nullptr)
+            {
+                std::atexit(&Log::Shutdown);
+            }
+
+            if (!ConfigureLevels(specification.Levels))
+            {
+                ENGINE_WARN("Some log level settings were not recognized: '{}'", specification.Levels);
+            }
+
+            ENGINE_INFO("Logging system initialized with console and file sinks ({})", specification.Async ? "async" : "sync");
+        }
+
+        void Log::Shutdown()
+        {
+            if (s_AsyncSink != nullptr)
+            {
+                s_AsyncSink->Stop();
+            }
+        }
+
+        void Log::Flush()
+        {
+            for (const std::shared_ptr<spdlog::logger>& it_Logger : s_Loggers)
+            {
+                if (it_Logger != nullptr)
+                {
+                    // Every logger shares the same sinks, so one flush covers them all.
+                    it_Logger->flush();
+
+                    return;
+                }
+            }
+        }
+
+        void Log::SetLevel(LogChannel channel, spdlog::level::level_enum level)
+        {
+            const std::shared_ptr<spdlog::logger>& l_Logger = s_Loggers[static_cast<size_t>(channel)];
+            if (l_Logger != nullptr)
+            {
+                l_Logger->set_level(level);
+            }
+        }
+
+        bool Log::ConfigureLevels(const std::string& levels)
+        {
+            bool l_IsValid = true;
+
+            std::string_view l_Remaining = levels;
+            while (!l_Remaining.empty())
+            {
+                const size_t l_Separator = l_Remaining.find(',');
+                const std::string_view l_Entry = Trim(l_Remaining.substr(0, l_Separator));
+                l_Remaining = l_Separator == std::string_view::npos ? std::string_view() : l_Remaining.substr(l_Separator + 1);
+
+                if (l_Entry.empty())
+                {
+                    continue;
+                }
+
+                const size_t l_Equals = l_Entry.find('=');
+                if (l_Equals == std::string_view::npos)
+                {
+                    l_IsValid = false;
+
+                    continue;
+                }
+
+                const std::string_view l_Channel = Trim(l_Entry.substr(0, l_Equals));
+                std::string l_LevelName(Trim(l_Entry.substr(l_Equals + 1)));
+                std::transform(l_LevelName.begin(), l_LevelName.end(), l_LevelName.begin(), [](char character)
+                    {
+                        return static_cast<char>(std::tolower(static_cast<unsigned char>(character)));
+                    });
+                const spdlog::level::level_enum l_Level = spdlog::level::from_str(l_LevelName);
+
+                // from_str maps unknown names to off, so only accept "off" when it was actually asked for.
+                if (l_Level == spdlog::level::off && l_LevelName != "off")
+                {
+                    l_IsValid = false;
+
+                    continue;
+                }
+
+                bool l_IsMatched = false;
+                for (size_t i = 0; i < s_Loggers.size(); ++i)
+                {
+                    if (l_Channel == "*" || EqualsIgnoreCase(l_Channel, s_ChannelNames[i]))
+                    {
+                        SetLevel(static_cast<LogChannel>(i), l_Level);
+                        l_IsMatched = true;
+                    }
+                }
+
+                l_IsValid = l_IsValid && l_IsMatched;
+            }
+
+            return l_IsValid;
+        }
+
+        uint64_t Log::GetDroppedMessageCount()
+        {
+            return s_AsyncSink != nullptr ? s_AsyncSink->GetDroppedCount() : 0;
         }
     }
-}
\ No newline at end of file
+}
@@ -4,6 +4,12 @@
 #include "glm/gtx/string_cast.hpp"
 
 #include "Engine/Core/Core.h"
+#include "Engine/Core/AsyncLogSink.h"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
 
 // This ignores all warnings raised inside External headers
 #ifdef _MSC_VER
@@ -15,23 +21,80 @@
 #pragma warning(pop)
 #endif
 
+// Lowest level that survives compilation; calls below it expand to nothing, arguments included.
+// Set ENGINE_LOG_ACTIVE_LEVEL from CMake to override the default of trace in debug builds and info otherwise.
+#define ENGINE_LOG_LEVEL_TRACE 0
+#define ENGINE_LOG_LEVEL_DEBUG 1
+#define ENGINE_LOG_LEVEL_INFO 2
+#define ENGINE_LOG_LEVEL_WARN 3
+#define ENGINE_LOG_LEVEL_ERROR 4
+#define ENGINE_LOG_LEVEL_CRITICAL 5
+#define ENGINE_LOG_LEVEL_OFF 6
+
+#ifndef ENGINE_LOG_ACTIVE_LEVEL
+#   ifdef NDEBUG
+#       define ENGINE_LOG_ACTIVE_LEVEL ENGINE_LOG_LEVEL_INFO
+#   else
+#       define ENGINE_LOG_ACTIVE_LEVEL ENGINE_LOG_LEVEL_TRACE
+#   endif
+#endif
+
 namespace Engine
 {
     namespace Utilities
     {
+        // Subsystems with their own logger name and runtime level.
+        enum class LogChannel : uint8_t
+        {
+            Engine,
+            Game,
+            Window,
+            Input,
+            Jobs,
+            World,
+            Assets,
+            Count
+        };
+
+        struct LogSpecification
+        {
+            // Hand messages to a background thread instead of writing and flushing on the calling thread.
+            bool Async = true;
+            uint32_t QueueCapacity = 8192;
+            LogOverflowPolicy OverflowPolicy = LogOverflowPolicy::Block;
+
+            // Runtime levels as "channel=level" pairs, e.g. "Input=trace,World=warn"; "*" addresses every channel.
+            std::string Levels;
+        };
+
         class ENGINE_API Log
         {
         public:
-            static void Initialize();
+            static void Initialize(const LogSpecification& specification = LogSpecification());
+
+            // Drain the async queue and write synchronously from then on; runs automatically at exit.
+            static void Shutdown();
+
+            // Block until every message logged so far is on disk.
+            static void Flush();
+
+            static std::shared_ptr<spdlog::logger>& GetCoreLogger() { return s_Loggers[static_cast<size_t>(LogChannel::Engine)]; }
+            static std::shared_ptr<spdlog::logger>& GetClientLogger() { return s_Loggers[static_cast<size_t>(LogChannel::Game)]; }
+            static std::shared_ptr<spdlog::logger>& GetLogger(LogChannel channel) { return s_Loggers[static_cast<size_t>(channel)]; }
+
+            static void SetLevel(LogChannel channel, spdlog::level::level_enum level);
 
-            static std::shared_ptr<spdlog::logger>& GetCoreLogger() { return s_CoreLogger; }
-            static std::shared_ptr<spdlog::logger>& GetClientLogger() { return s_ClientLogger; }
+            // Apply a Levels string (see LogSpecification); returns false if any entry was not understood.
+            static bool ConfigureLevels(const std::string& levels);
+
+            // Messages discarded by the Drop overflow policy since startup.
+            static uint64_t GetDroppedMessageCount();
 
         private:
             // Tracks whether the logger has already been initialized to avoid duplicate registration exceptions.
             static bool s_IsInitialized;
-            static std::shared_ptr<spdlog::logger> s_CoreLogger;
-            static std::shared_ptr<spdlog::logger> s_ClientLogger;
+            static std::array<std::shared_ptr<spdlog::logger>, static_cast<size_t>(LogChannel::Count)> s_Loggers;
+            static std::shared_ptr<AsyncLogSink> s_AsyncSink;
         };
     }
 }
@@ -54,16 +117,57 @@ inline OStream& operator<<(OStream& os, glm::qua<T, Q> quaternion)
     return os << glm::to_string(quaternion);
 }
 
+#define ENGINE_LOG_CALL(channel, level, ...) ::Engine::Utilities::Log::GetLogger(::Engine::Utilities::LogChannel::channel)->level(__VA_ARGS__)
+
+// Channel log macros, e.g. ENGINE_CHANNEL_TRACE(Input, "Key {} pressed", key)
+#if ENGINE_LOG_ACTIVE_LEVEL <= ENGINE_LOG_LEVEL_TRACE
+#   define ENGINE_CHANNEL_TRACE(channel, ...)   ENGINE_LOG_CALL(channel, trace, __VA_ARGS__)
+#else
+#   define ENGINE_CHANNEL_TRACE(channel, ...)   (void)0
+#endif
+
+#if ENGINE_LOG_ACTIVE_LEVEL <= ENGINE_LOG_LEVEL_DEBUG
+#   define ENGINE_CHANNEL_DEBUG(channel, ...)   ENGINE_LOG_CALL(channel, debug, __VA_ARGS__)
+#else
+#   define ENGINE_CHANNEL_DEBUG(channel, ...)   (void)0
+#endif
+
+#if ENGINE_LOG_ACTIVE_LEVEL <= ENGINE_LOG_LEVEL_INFO
+#   define ENGINE_CHANNEL_INFO(channel, ...)    ENGINE_LOG_CALL(channel, info, __VA_ARGS__)
+#else
+#   define ENGINE_CHANNEL_INFO(channel, ...)    (void)0
+#endif
+
+#if ENGINE_LOG_ACTIVE_LEVEL <= ENGINE_LOG_LEVEL_WARN
+#   define ENGINE_CHANNEL_WARN(channel, ...)    ENGINE_LOG_CALL(channel, warn, __VA_ARGS__)
+#else
+#   define ENGINE_CHANNEL_WARN(channel, ...)    (void)0
+#endif
+
+#if ENGINE_LOG_ACTIVE_LEVEL <= ENGINE_LOG_LEVEL_ERROR
+#   define ENGINE_CHANNEL_ERROR(channel, ...)   ENGINE_LOG_CALL(channel, error, __VA_ARGS__)
+#else
+#   define ENGINE_CHANNEL_ERROR(channel, ...)   (void)0
+#endif
+
+#if ENGINE_LOG_ACTIVE_LEVEL <= ENGINE_LOG_LEVEL_CRITICAL
+#   define ENGINE_CHANNEL_CRITICAL(channel, ...) ENGINE_LOG_CALL(channel, critical, __VA_ARGS__)
+#else
+#   define ENGINE_CHANNEL_CRITICAL(channel, ...) (void)0
+#endif
+
 // Core log macros
-#define ENGINE_TRACE(...)      ::Engine::Utilities::Log::GetCoreLogger()->trace(__VA_ARGS__)
-#define ENGINE_INFO(...)       ::Engine::Utilities::Log::GetCoreLogger()->info(__VA_ARGS__)
-#define ENGINE_WARN(...)       ::Engine::Utilities::Log::GetCoreLogger()->warn(__VA_ARGS__)
-#define ENGINE_ERROR(...)      ::Engine::Utilities::Log::GetCoreLogger()->error(__VA_ARGS__)
-#define ENGINE_CRITICAL(...)   ::Engine::Utilities::Log::GetCoreLogger()->critical(__VA_ARGS__)
+#define ENGINE_TRACE(...)      ENGINE_CHANNEL_TRACE(Engine, __VA_ARGS__)
+#define ENGINE_DEBUG(...)      ENGINE_CHANNEL_DEBUG(Engine, __VA_ARGS__)
+#define ENGINE_INFO(...)       ENGINE_CHANNEL_INFO(Engine, __VA_ARGS__)
+#define ENGINE_WARN(...)       ENGINE_CHANNEL_WARN(Engine, __VA_ARGS__)
+#define ENGINE_ERROR(...)      ENGINE_CHANNEL_ERROR(Engine, __VA_ARGS__)
+#define ENGINE_CRITICAL(...)   ENGINE_CHANNEL_CRITICAL(Engine, __VA_ARGS__)
 
 // Client log macros
-#define GAME_TRACE(...)      ::Engine::Utilities::Log::GetClientLogger()->trace(__VA_ARGS__)
-#define GAME_INFO(...)       ::Engine::Utilities::Log::GetClientLogger()->info(__VA_ARGS__)
-#define GAME_WARN(...)       ::Engine::Utilities::Log::GetClientLogger()->warn(__VA_ARGS__)
-#define GAME_ERROR(...)      ::Engine::Utilities::Log::GetClientLogger()->error(__VA_ARGS__)
-#define GAME_CRITICAL(...)   ::Engine::Utilities::Log::GetClientLogger()->critical(__VA_ARGS__)
\ No newline at end of file
+#define GAME_TRACE(...)      ENGINE_CHANNEL_TRACE(Game, __VA_ARGS__)
+#define GAME_DEBUG(...)      ENGINE_CHANNEL_DEBUG(Game, __VA_ARGS__)
+#define GAME_INFO(...)       ENGINE_CHANNEL_INFO(Game, __VA_ARGS__)
+#define GAME_WARN(...)       ENGINE_CHANNEL_WARN(Game, __VA_ARGS__)
+#define GAME_ERROR(...)      ENGINE_CHANNEL_ERROR(Game, __VA_ARGS__)
+#define GAME_CRITICAL(...)   ENGINE_CHANNEL_CRITICAL(Game, __VA_ARGS__)
\ No newline at end of file
@@ -0,0 +1,359 @@
+#include "Engine/Core/Profiler.h"
+
+#if ENGINE_PROFILING_ENABLED
+
+#include "Engine/Core/Log.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+
+namespace Engine
+{
+    namespace
+    {
+        struct ZoneEvent
+        {
+            uint64_t StartTime = 0;
+            uint64_t EndTime = 0;
+            ProfileZoneId Zone = 0;
+            uint32_t ThreadIndex = 0;
+        };
+
+        // Single-producer single-consumer ring: the owning thread writes, EndFrame reads.
+        struct ThreadBuffer
+        {
+            std::array<ZoneEvent, Profiler::ThreadBufferCapacity> Events;
+            std::string Name;
+            uint32_t Index = 0;
+
+            // Cleared when the owning thread exits so the next new thread reuses the buffer.
+            bool IsInUse = true;
+
+            alignas(64) std::atomic<uint64_t> WritePosition{ 0 };
+            std::atomic<uint64_t> DroppedCount{ 0 };
+            alignas(64) std::atomic<uint64_t> ReadPosition{ 0 };
+        };
+
+        struct ZoneData
+        {
+            std::string Name;
+
+            // Ring of per-frame totals in nanoseconds.
+            std::array<uint64_t, Profiler::StatisticsWindow> Samples{};
+            uint32_t SampleCount = 0;
+            uint32_t NextSample = 0;
+
+            uint64_t FrameTotal = 0;
+            uint32_t FrameCalls = 0;
+            uint32_t CallsLastFrame = 0;
+        };
+
+        // Everything but the rings is touched only under this mutex: zone registration, thread registration
+        // and collection. None of those are on a per-zone path.
+        std::mutex s_Mutex;
+        std::vector<std::unique_ptr<ThreadBuffer>> s_Threads;
+        std::vector<ZoneData> s_Zones;
+        std::vector<ZoneEvent> s_CaptureEvents;
+        bool s_IsCapturing = false;
+
+        // Returns the buffer to the pool when its thread exits; short-lived job systems would otherwise leak one
+        // buffer per worker they ever started.
+        struct ThreadBufferLease
+        {
+            ThreadBuffer* Buffer = nullptr;
+
+            ~ThreadBufferLease()
+            {
+                if (Buffer != nullptr)
+                {
+                    std::lock_guard<std::mutex> l_Lock(s_Mutex);
+                    Buffer->IsInUse = false;
+                }
+            }
+        };
+
+        thread_local ThreadBufferLease t_Lease;
+
+        ThreadBuffer& GetThreadBuffer()
+        {
+            if (t_Lease.Buffer == nullptr)
+            {
+                std::lock_guard<std::mutex> l_Lock(s_Mutex);
+                for (const std::unique_ptr<ThreadBuffer>& it_Buffer : s_Threads)
+                {
+                    if (!it_Buffer->IsInUse)
+                    {
+                        t_Lease.Buffer = it_Buffer.get();
+                        break;
+                    }
+                }
+
+                if (t_Lease.Buffer == nullptr)
+                {
+                    s_Threads.push_back(std::make_unique<ThreadBuffer>());
+                    t_Lease.Buffer = s_Threads.back().get();
+                    t_Lease.Buffer->Index = static_cast<uint32_t>(s_Threads.size() - 1);
+                }
+
+                t_Lease.Buffer->IsInUse = true;
+                t_Lease.Buffer->Name = "Thread " + std::to_string(t_Lease.Buffer->Index);
+            }
+
+            return *t_Lease.Buffer;
+        }
+
+        ProfileZoneStats ComputeStats(const ZoneData& zone)
+        {
+            ProfileZoneStats l_Stats;
+            l_Stats.SampleCount = zone.SampleCount;
+            l_Stats.CallsLastFrame = zone.CallsLastFrame;
+            if (zone.SampleCount == 0)
+            {
+                return l_Stats;
+            }
+
+            std::array<uint64_t, Profiler::StatisticsWindow> l_Sorted;
+            std::copy_n(zone.Samples.begin(), zone.SampleCount, l_Sorted.begin());
+            std::sort(l_Sorted.begin(), l_Sorted.begin() + zone.SampleCount);
+
+            uint64_t l_Total = 0;
+            for (uint32_t i = 0; i < zone.SampleCount; ++i)
+            {
+                l_Total += l_Sorted[i];
+            }
+
+            // Nearest-rank percentile.
+            const uint32_t l_P99Index = (zone.SampleCount * 99 + 99) / 100 - 1;
+
+            l_Stats.MinMilliseconds = static_cast<double>(l_Sorted[0]) * 1e-6;
+            l_Stats.MaxMilliseconds = static_cast<double>(l_Sorted[zone.SampleCount - 1]) * 1e-6;
+            l_Stats.AverageMilliseconds = static_cast<double>(l_Total) * 1e-6 / zone.SampleCount;
+            l_Stats.P99Milliseconds = static_cast<double>(l_Sorted[l_P99Index]) * 1e-6;
+
+            return l_Stats;
+        }
+
+        void WriteJsonString(std::FILE* file, const std::string& text)
+        {
+            std::fputc('"', file);
+            for (const char it_Character : text)
+            {
+                if (it_Character == '"' || it_Character == '\\')
+                {
+                    std::fputc('\\', file);
+                }
+
+                std::fputc(static_cast<unsigned char>(it_Character) < 0x20 ? ' ' : it_Character, file);
+            }
+            std::fputc('"', file);
+        }
+    }
+
+    ProfileZoneId Profiler::RegisterZone(const char* name)
+    {
+        std::lock_guard<std::mutex> l_Lock(s_Mutex);
+        for (size_t i = 0; i < s_Zones.size(); ++i)
+        {
+            if (s_Zones[i].Name == name)
+            {
+                return static_cast<ProfileZoneId>(i);
+            }
+        }
+
+        s_Zones.emplace_back();
+        s_Zones.back().Name = name;
+
+        return static_cast<ProfileZoneId>(s_Zones.size() - 1);
+    }
+
+    void Profiler::SetThreadName(const std::string& name)
+    {
+        ThreadBuffer& l_Buffer = GetThreadBuffer();
+
+        std::lock_guard<std::mutex> l_Lock(s_Mutex);
+        l_Buffer.Name = name;
+    }
+
+    void Profiler::Record(ProfileZoneId zone, uint64_t startTime, uint64_t endTime)
+    {
+        ThreadBuffer& l_Buffer = GetThreadBuffer();
+
+        const uint64_t l_WritePosition = l_Buffer.WritePosition.load(std::memory_order_relaxed);
+        if (l_WritePosition - l_Buffer.ReadPosition.load(std::memory_order_acquire) >= ThreadBufferCapacity)
+        {
+            l_Buffer.DroppedCount.fetch_add(1, std::memory_order_relaxed);
+
+            return;
+        }
+
+        ZoneEvent& l_Event = l_Buffer.Events[l_WritePosition % ThreadBufferCapacity];
+        l_Event.StartTime = startTime;
+        l_Event.EndTime = endTime;
+        l_Event.Zone = zone;
+        l_Event.ThreadIndex = l_Buffer.Index;
+        l_Buffer.WritePosition.store(l_WritePosition + 1, std::memory_order_release);
+    }
+
+    void Profiler::EndFrame()
+    {
+        std::lock_guard<std::mutex> l_Lock(s_Mutex);
+
+        for (const std::unique_ptr<ThreadBuffer>& it_Buffer : s_Threads)
+        {
+            const uint64_t l_ReadPosition = it_Buffer->ReadPosition.load(std::memory_order_relaxed);
+            const uint64_t l_WritePosition = it_Buffer->WritePosition.load(std::memory_order_acquire);
+            for (uint64_t it_Position = l_ReadPosition; it_Position != l_WritePosition; ++it_Position)
+            {
+                const ZoneEvent& l_Event = it_Buffer->Events[it_Position % ThreadBufferCapacity];
+                ZoneData& l_Zone = s_Zones[l_Event.Zone];
+                l_Zone.FrameTotal += l_Event.EndTime - l_Event.StartTime;
+                ++l_Zone.FrameCalls;
+
+                if (s_IsCapturing)
+                {
+                    s_CaptureEvents.push_back(l_Event);
+                }
+            }
+
+            it_Buffer->ReadPosition.store(l_WritePosition, std::memory_order_release);
+        }
+
+        for (ZoneData& it_Zone : s_Zones)
+        {
+            it_Zone.CallsLastFrame = it_Zone.FrameCalls;
+            if (it_Zone.FrameCalls == 0)
+            {
+                continue;
+            }
+
+            it_Zone.Samples[it_Zone.NextSample] = it_Zone.FrameTotal;
+            it_Zone.NextSample = (it_Zone.NextSample + 1) % StatisticsWindow;
+            it_Zone.SampleCount = std::min(it_Zone.SampleCount + 1, StatisticsWindow);
+            it_Zone.FrameTotal = 0;
+            it_Zone.FrameCalls = 0;
+        }
+    }
+
+    void Profiler::BeginCapture()
+    {
+        std::lock_guard<std::mutex> l_Lock(s_Mutex);
+        s_CaptureEvents.clear();
+        s_IsCapturing = true;
+    }
+
+    bool Profiler::EndCapture(const std::filesystem::path& path)
+    {
+        // Pick up zones that finished since the last frame boundary.
+        EndFrame();
+
+        std::lock_guard<std::mutex> l_Lock(s_Mutex);
+        s_IsCapturing = false;
+
+        std::FILE* l_File = std::fopen(path.string().c_str(), "w");
+        if (l_File == nullptr)
+        {
+            ENGINE_ERROR("Failed to open profile capture {}", path.string());
+            s_CaptureEvents.clear();
+
+            return false;
+        }
+
+        uint64_t l_Origin = UINT64_MAX;
+        for (const ZoneEvent& it_Event : s_CaptureEvents)
+        {
+            l_Origin = std::min(l_Origin, it_Event.StartTime);
+        }
+
+        // Chrome's trace event format: complete ("X") events in microseconds, plus thread name metadata.
+        std::fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", l_File);
+        bool l_IsFirst = true;
+        for (const std::unique_ptr<ThreadBuffer>& it_Buffer : s_Threads)
+        {
+            std::fprintf(l_File, "%s\n{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":", l_IsFirst ? "" : ",", it_Buffer->Index);
+            WriteJsonString(l_File, it_Buffer->Name);
+            std::fputs("}}", l_File);
+            l_IsFirst = false;
+        }
+
+        for (const ZoneEvent& it_Event : s_CaptureEvents)
+        {
+            std::fprintf(l_File, "%s\n{\"ph\":\"X\",\"name\":", l_IsFirst ? "" : ",");
+            WriteJsonString(l_File, s_Zones[it_Event.Zone].Name);
+            std::fprintf(l_File, ",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}", it_Event.ThreadIndex,
+                static_cast<double>(it_Event.StartTime - l_Origin) * 1e-3, static_cast<double>(it_Event.EndTime - it_Event.StartTime) * 1e-3);
+            l_IsFirst = false;
+        }
+        std::fputs("\n]}\n", l_File);
+
+        const bool l_Succeeded = std::fclose(l_File) == 0;
+        if (l_Succeeded)
+        {
+            ENGINE_INFO("Wrote {} profile zones to {}", s_CaptureEvents.size(), path.string());
+        }
+
+        s_CaptureEvents.clear();
+        s_CaptureEvents.shrink_to_fit();
+
+        return l_Succeeded;
+    }
+
+    bool Profiler::IsCapturing()
+    {
+        std::lock_guard<std::mutex> l_Lock(s_Mutex);
+
+        return s_IsCapturing;
+    }
+
+    bool Profiler::GetZoneStats(const char* name, ProfileZoneStats& stats)
+    {
+        std::lock_guard<std::mutex> l_Lock(s_Mutex);
+        for (const ZoneData& it_Zone : s_Zones)
+        {
+            if (it_Zone.Name == name)
+            {
+                stats = ComputeStats(it_Zone);
+
+                return it_Zone.SampleCount > 0;
+            }
+        }
+
+        return false;
+    }
+
+    std::vector<ProfileZoneSummary> Profiler::GetAllZoneStats()
+    {
+        std::lock_guard<std::mutex> l_Lock(s_Mutex);
+
+        std::vector<ProfileZoneSummary> l_Summaries;
+        l_Summaries.reserve(s_Zones.size());
+        for (const ZoneData& it_Zone : s_Zones)
+        {
+            if (it_Zone.SampleCount > 0)
+            {
+                l_Summaries.push_back({ it_Zone.Name, ComputeStats(it_Zone) });
+            }
+        }
+
+        return l_Summaries;
+    }
+
+    uint64_t Profiler::GetDroppedZoneCount()
+    {
+        std::lock_guard<std::mutex> l_Lock(s_Mutex);
+
+        uint64_t l_DroppedCount = 0;
+        for (const std::unique_ptr<ThreadBuffer>& it_Buffer : s_Threads)
+        {
+            l_DroppedCount += it_Buffer->DroppedCount.load(std::memory_order_relaxed);
+        }
+
+        return l_DroppedCount;
+    }
+}
+
+#endif
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+
+// Profiling is on in every configuration except shipping builds, where the macros below expand to nothing
+// and the profiler itself is not compiled.
+#ifndef ENGINE_PROFILING_ENABLED
+#   ifdef ENGINE_SHIPPING
+#       define ENGINE_PROFILING_ENABLED 0
+#   else
+#       define ENGINE_PROFILING_ENABLED 1
+#   endif
+#endif
+
+#if ENGINE_PROFILING_ENABLED
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace Engine
+{
+    // Index of a named zone; every call site with the same name shares one id.
+    using ProfileZoneId = uint32_t;
+
+    // Rolling per-frame statistics of one zone over the last StatisticsWindow frames it ran in. A frame's
+    // sample is the zone's total time in that frame across all threads and calls.
+    struct ProfileZoneStats
+    {
+        double MinMilliseconds = 0.0;
+        double AverageMilliseconds = 0.0;
+        double P99Milliseconds = 0.0;
+        double MaxMilliseconds = 0.0;
+        uint32_t SampleCount = 0;
+
+        // How many times the zone was entered during the last collected frame.
+        uint32_t CallsLastFrame = 0;
+    };
+
+    struct ProfileZoneSummary
+    {
+        std::string Name;
+        ProfileZoneStats Stats;
+    };
+
+    // Hierarchical CPU profiler. Scopes write completed zones into a lock-free ring owned by the calling
+    // thread; the main thread collects every ring once per frame (EndFrame) to update the rolling statistics
+    // and, while a capture is running, to keep the events for a Chrome trace (chrome://tracing, Perfetto).
+    class ENGINE_API Profiler
+    {
+    public:
+        static constexpr uint32_t StatisticsWindow = 240;
+
+        // Zones per thread that may be recorded between two EndFrame calls; further zones are dropped.
+        static constexpr uint32_t ThreadBufferCapacity = 16384;
+
+        static ProfileZoneId RegisterZone(const char* name);
+
+        // Label the calling thread in captures.
+        static void SetThreadName(const std::string& name);
+
+        static uint64_t GetTimestamp()
+        {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        // Hot path; called by ProfileScope from any thread.
+        static void Record(ProfileZoneId zone, uint64_t startTime, uint64_t endTime);
+
+        // Main thread, once per frame: drain every thread's ring and roll the statistics forward.
+        static void EndFrame();
+
+        // Keep every zone collected from now on until EndCapture writes them as Chrome trace JSON.
+        static void BeginCapture();
+        static bool EndCapture(const std::filesystem::path& path);
+        static bool IsCapturing();
+
+        // Statistics for overlays; the name lookup returns false for zones that never ran.
+        static bool GetZoneStats(const char* name, ProfileZoneStats& stats);
+        static std::vector<ProfileZoneSummary> GetAllZoneStats();
+
+        // Zones lost because a thread filled its ring before the next EndFrame.
+        static uint64_t GetDroppedZoneCount();
+    };
+
+    // Times the enclosing scope; use through ENGINE_PROFILE_SCOPE.
+    class ProfileScope
+    {
+    public:
+        explicit ProfileScope(ProfileZoneId zone) : m_Zone(zone), m_StartTime(Profiler::GetTimestamp())
+        {
+
+        }
+
+        ~ProfileScope()
+        {
+            Profiler::Record(m_Zone, m_StartTime, Profiler::GetTimestamp());
+        }
+
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+
+    private:
+        ProfileZoneId m_Zone;
+        uint64_t m_StartTime;
+    };
+}
+
+#define ENGINE_PROFILE_CONCAT_INNER(a, b) a##b
+#define ENGINE_PROFILE_CONCAT(a, b) ENGINE_PROFILE_CONCAT_INNER(a, b)
+
+// The zone id is resolved once per call site, so a scope costs two clock reads and a ring write.
+#define ENGINE_PROFILE_SCOPE(name) \
+    static const ::Engine::ProfileZoneId ENGINE_PROFILE_CONCAT(s_ProfileZone, __LINE__) = ::Engine::Profiler::RegisterZone(name); \
+    const ::Engine::ProfileScope ENGINE_PROFILE_CONCAT(l_ProfileScope, __LINE__)(ENGINE_PROFILE_CONCAT(s_ProfileZone, __LINE__))
+#define ENGINE_PROFILE_FUNCTION() ENGINE_PROFILE_SCOPE(__func__)
+#define ENGINE_PROFILE_THREAD(name) ::Engine::Profiler::SetThreadName(name)
+#define ENGINE_PROFILE_FRAME_END() ::Engine::Profiler::EndFrame()
+
+#else
+
+#define ENGINE_PROFILE_SCOPE(name) (void)0
+#define ENGINE_PROFILE_FUNCTION() (void)0
+#define ENGINE_PROFILE_THREAD(name) (void)0
+#define ENGINE_PROFILE_FRAME_END() (void)0
+
+#endif
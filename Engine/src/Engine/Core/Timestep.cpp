@@ -0,0 +1,57 @@
+#include "Engine/Core/Timestep.h"
+
+#include <algorithm>
+
+namespace Engine
+{
+    FixedTimestep::FixedTimestep(double tickRate, uint32_t maxTicksPerFrame)
+    {
+        SetTickRate(tickRate);
+        SetMaxTicksPerFrame(maxTicksPerFrame);
+    }
+
+    void FixedTimestep::SetTickRate(double tickRate)
+    {
+        // Guard against zero or negative rates so the fixed step stays finite.
+        m_TickRate = tickRate > 0.0 ? tickRate : 20.0;
+        m_FixedDeltaTime = 1.0 / m_TickRate;
+    }
+
+    void FixedTimestep::SetMaxTicksPerFrame(uint32_t maxTicksPerFrame)
+    {
+        m_MaxTicksPerFrame = std::max<uint32_t>(maxTicksPerFrame, 1);
+    }
+
+    uint32_t FixedTimestep::Advance(double frameDeltaTime)
+    {
+        m_Accumulator += std::max(frameDeltaTime, 0.0);
+
+        uint32_t l_TickCount = 0;
+        while (m_Accumulator >= m_FixedDeltaTime && l_TickCount < m_MaxTicksPerFrame)
+        {
+            m_Accumulator -= m_FixedDeltaTime;
+            ++l_TickCount;
+        }
+
+        if (m_Accumulator >= m_FixedDeltaTime)
+        {
+            // Drop whole ticks we could not afford but keep the fractional remainder so interpolation stays smooth.
+            const double l_SkippedTicks = static_cast<double>(static_cast<uint64_t>(m_Accumulator / m_FixedDeltaTime));
+            m_DroppedTickCount += static_cast<uint64_t>(l_SkippedTicks);
+            m_Accumulator -= l_SkippedTicks * m_FixedDeltaTime;
+        }
+
+        return l_TickCount;
+    }
+
+    void FixedTimestep::Reset()
+    {
+        m_Accumulator = 0.0;
+        m_DroppedTickCount = 0;
+    }
+
+    float FixedTimestep::GetInterpolationAlpha() const
+    {
+        return static_cast<float>(std::clamp(m_Accumulator / m_FixedDeltaTime, 0.0, 1.0));
+    }
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+
+#include <cstdint>
+
+namespace Engine
+{
+    // Timing data handed to Layer::Update for every fixed simulation tick.
+    struct TickTiming
+    {
+        // Constant step length in seconds; identical for every tick at a given tick rate.
+        double FixedDeltaTime = 0.0;
+
+        // Monotonic tick counter since the main loop started.
+        uint64_t TickIndex = 0;
+
+        // Simulated seconds elapsed at the start of this tick (TickIndex * FixedDeltaTime).
+        double SimulationTime = 0.0;
+    };
+
+    // Timing data handed to Layer::Render once per presented frame.
+    struct FrameTiming
+    {
+        // Wall-clock (or scripted) seconds since the previous frame.
+        double DeltaTime = 0.0;
+
+        // Fraction of a tick accumulated but not yet simulated; blend previous and current state with it.
+        float InterpolationAlpha = 0.0f;
+
+        // Number of fixed ticks that ran before this frame was rendered.
+        uint32_t TicksThisFrame = 0;
+
+        uint64_t FrameIndex = 0;
+    };
+
+    // Accumulates frame time and converts it into a bounded number of fixed simulation ticks.
+    class ENGINE_API FixedTimestep
+    {
+    public:
+        explicit FixedTimestep(double tickRate = 20.0, uint32_t maxTicksPerFrame = 5);
+
+        void SetTickRate(double tickRate);
+        void SetMaxTicksPerFrame(uint32_t maxTicksPerFrame);
+
+        // Add elapsed frame time and return how many ticks should run this frame.
+        // Time beyond MaxTicksPerFrame ticks is discarded so a slow frame cannot trigger a spiral of death.
+        uint32_t Advance(double frameDeltaTime);
+
+        // Clear the accumulator, e.g. after loading screens where no time should be simulated.
+        void Reset();
+
+        double GetTickRate() const { return m_TickRate; }
+        double GetFixedDeltaTime() const { return m_FixedDeltaTime; }
+        uint32_t GetMaxTicksPerFrame() const { return m_MaxTicksPerFrame; }
+        float GetInterpolationAlpha() const;
+
+        // Total ticks skipped by the catch-up limit since the last Reset.
+        uint64_t GetDroppedTickCount() const { return m_DroppedTickCount; }
+
+    private:
+        double m_TickRate = 20.0;
+        double m_FixedDeltaTime = 1.0 / 20.0;
+        uint32_t m_MaxTicksPerFrame = 5;
+
+        double m_Accumulator = 0.0;
+        uint64_t m_DroppedTickCount = 0;
+    };
+}
@@ -0,0 +1,246 @@
+#include "Engine/Events/EventQueue.h"
+
+#include <bit>
+
+namespace Engine
+{
+    EventRecord ToEventRecord(const Event& event)
+    {
+        EventRecord l_Record;
+        l_Record.Type = event.GetEventType();
+
+        switch (l_Record.Type)
+        {
+        case EventType::WindowResize:
+        {
+            const WindowResizeEvent& l_Event = static_cast<const WindowResizeEvent&>(event);
+            l_Record.Resize = { l_Event.GetWidth(), l_Event.GetHeight() };
+
+            break;
+        }
+        case EventType::WindowFocusChanged:
+            l_Record.Flag = static_cast<const WindowFocusChangedEvent&>(event).IsFocused();
+            break;
+        case EventType::WindowMaximizeChanged:
+            l_Record.Flag = static_cast<const WindowMaximizeChangedEvent&>(event).IsMaximized();
+            break;
+        case EventType::KeyPressed:
+        {
+            const KeyPressedEvent& l_Event = static_cast<const KeyPressedEvent&>(event);
+            l_Record.Key = { l_Event.GetKeyCode(), l_Event.GetRepeatCount() };
+
+            break;
+        }
+        case EventType::KeyReleased:
+            l_Record.Key = { static_cast<const KeyReleasedEvent&>(event).GetKeyCode(), 0 };
+            break;
+        case EventType::MouseMoved:
+        {
+            // Deltas are filled in by the queue, which knows the previous position.
+            const MouseMovedEvent& l_Event = static_cast<const MouseMovedEvent&>(event);
+            l_Record.MouseMove = { l_Event.GetX(), l_Event.GetY(), 0.0f, 0.0f };
+
+            break;
+        }
+        case EventType::MouseButtonPressed:
+        case EventType::MouseButtonReleased:
+            l_Record.MouseButton = { static_cast<const MouseButtonEvent&>(event).GetMouseButton() };
+            break;
+        case EventType::MouseScrolled:
+        {
+            const MouseScrolledEvent& l_Event = static_cast<const MouseScrolledEvent&>(event);
+            l_Record.Scroll = { l_Event.GetXOffset(), l_Event.GetYOffset() };
+
+            break;
+        }
+        default:
+            break;
+        }
+
+        return l_Record;
+    }
+
+    EventQueue::EventQueue(uint32_t initialCapacity)
+    {
+        const uint32_t l_Capacity = std::bit_ceil(initialCapacity < 16 ? 16u : initialCapacity);
+        m_Records.resize(l_Capacity);
+        m_Mask = l_Capacity - 1;
+    }
+
+    void EventQueue::Push(const EventRecord& record)
+    {
+        ++m_SampleCount;
+
+        if (record.Type == EventType::MouseMoved)
+        {
+            const float l_DeltaX = m_HasMousePosition ? record.MouseMove.X - m_MouseX : 0.0f;
+            const float l_DeltaY = m_HasMousePosition ? record.MouseMove.Y - m_MouseY : 0.0f;
+            m_MouseX = record.MouseMove.X;
+            m_MouseY = record.MouseMove.Y;
+            m_HasMousePosition = true;
+
+            if (m_IsCoalescingEnabled && !IsEmpty() && m_Records[(m_Tail - 1) & m_Mask].Type == EventType::MouseMoved)
+            {
+                EventRecord& l_Last = m_Records[(m_Tail - 1) & m_Mask];
+                l_Last.MouseMove.X = record.MouseMove.X;
+                l_Last.MouseMove.Y = record.MouseMove.Y;
+                l_Last.MouseMove.DeltaX += l_DeltaX;
+                l_Last.MouseMove.DeltaY += l_DeltaY;
+                l_Last.SampleCount += record.SampleCount;
+
+                return;
+            }
+
+            EventRecord& l_Record = Append(EventType::MouseMoved);
+            l_Record = record;
+            l_Record.MouseMove.DeltaX = l_DeltaX;
+            l_Record.MouseMove.DeltaY = l_DeltaY;
+
+            return;
+        }
+
+        if (record.Type == EventType::MouseScrolled && m_IsCoalescingEnabled && !IsEmpty() && m_Records[(m_Tail - 1) & m_Mask].Type == EventType::MouseScrolled)
+        {
+            EventRecord& l_Last = m_Records[(m_Tail - 1) & m_Mask];
+            l_Last.Scroll.XOffset += record.Scroll.XOffset;
+            l_Last.Scroll.YOffset += record.Scroll.YOffset;
+            l_Last.SampleCount += record.SampleCount;
+
+            return;
+        }
+
+        Append(record.Type) = record;
+    }
+
+    void EventQueue::PushVerbatim(const EventRecord& record)
+    {
+        m_SampleCount += record.SampleCount;
+
+        // Keep the cursor tracking current so live samples pushed afterwards still get correct deltas.
+        if (record.Type == EventType::MouseMoved)
+        {
+            m_MouseX = record.MouseMove.X;
+            m_MouseY = record.MouseMove.Y;
+            m_HasMousePosition = true;
+        }
+
+        Append(record.Type) = record;
+    }
+
+    void EventQueue::PushWindowResize(int32_t width, int32_t height)
+    {
+        EventRecord l_Record;
+        l_Record.Type = EventType::WindowResize;
+        l_Record.Resize = { width, height };
+        Push(l_Record);
+    }
+
+    void EventQueue::PushWindowClose()
+    {
+        EventRecord l_Record;
+        l_Record.Type = EventType::WindowClose;
+        Push(l_Record);
+    }
+
+    void EventQueue::PushWindowFocusChanged(bool isFocused)
+    {
+        EventRecord l_Record;
+        l_Record.Type = EventType::WindowFocusChanged;
+        l_Record.Flag = isFocused;
+        Push(l_Record);
+    }
+
+    void EventQueue::PushWindowMaximizeChanged(bool isMaximized)
+    {
+        EventRecord l_Record;
+        l_Record.Type = EventType::WindowMaximizeChanged;
+        l_Record.Flag = isMaximized;
+        Push(l_Record);
+    }
+
+    void EventQueue::PushKeyPressed(int32_t keyCode, int32_t repeatCount)
+    {
+        EventRecord l_Record;
+        l_Record.Type = EventType::KeyPressed;
+        l_Record.Key = { keyCode, repeatCount };
+        Push(l_Record);
+    }
+
+    void EventQueue::PushKeyReleased(int32_t keyCode)
+    {
+        EventRecord l_Record;
+        l_Record.Type = EventType::KeyReleased;
+        l_Record.Key = { keyCode, 0 };
+        Push(l_Record);
+    }
+
+    void EventQueue::PushMouseMoved(float x, float y)
+    {
+        EventRecord l_Record;
+        l_Record.Type = EventType::MouseMoved;
+        l_Record.MouseMove = { x, y, 0.0f, 0.0f };
+        Push(l_Record);
+    }
+
+    void EventQueue::PushMouseButtonPressed(int32_t button)
+    {
+        EventRecord l_Record;
+        l_Record.Type = EventType::MouseButtonPressed;
+        l_Record.MouseButton = { button };
+        Push(l_Record);
+    }
+
+    void EventQueue::PushMouseButtonReleased(int32_t button)
+    {
+        EventRecord l_Record;
+        l_Record.Type = EventType::MouseButtonReleased;
+        l_Record.MouseButton = { button };
+        Push(l_Record);
+    }
+
+    void EventQueue::PushMouseScrolled(float xOffset, float yOffset)
+    {
+        EventRecord l_Record;
+        l_Record.Type = EventType::MouseScrolled;
+        l_Record.Scroll = { xOffset, yOffset };
+        Push(l_Record);
+    }
+
+    void EventQueue::Clear()
+    {
+        m_Head = m_Tail;
+        m_SampleCount = 0;
+        for (std::vector<uint32_t>& it_Bucket : m_Buckets)
+        {
+            it_Bucket.clear();
+        }
+    }
+
+    EventRecord& EventQueue::Append(EventType type)
+    {
+        if (GetCount() == m_Records.size())
+        {
+            Grow();
+        }
+
+        m_Buckets[static_cast<size_t>(type)].push_back(GetCount());
+
+        return m_Records[m_Tail++ & m_Mask];
+    }
+
+    void EventQueue::Grow()
+    {
+        // Unwrap into a ring twice the size; bucket offsets are relative to the head and stay valid.
+        std::vector<EventRecord> l_Records(m_Records.size() * 2);
+        const uint32_t l_Count = GetCount();
+        for (uint32_t i = 0; i < l_Count; ++i)
+        {
+            l_Records[i] = m_Records[(m_Head + i) & m_Mask];
+        }
+
+        m_Records = std::move(l_Records);
+        m_Mask = static_cast<uint32_t>(m_Records.size()) - 1;
+        m_Head = 0;
+        m_Tail = l_Count;
+    }
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/Events/EventRecord.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace Engine
+{
+    // Frame-batched event storage. Producers (window callbacks, synthetic sources, replay) push records
+    // while events are polled; consumers then walk them in arrival order or one EventType bucket at a time,
+    // and the owner clears the batch before the next poll. Records live in a power-of-two ring that grows
+    // on overflow, so steady-state frames never allocate.
+    class ENGINE_API EventQueue
+    {
+    public:
+        explicit EventQueue(uint32_t initialCapacity = 256);
+
+        // Consecutive mouse motion or scroll samples fold into the previous record when it has the same type,
+        // so ordering relative to clicks and key presses is preserved.
+        void Push(const EventRecord& record);
+        void Push(const Event& event) { Push(ToEventRecord(event)); }
+
+        // Append a record exactly as given, without coalescing or recomputing mouse deltas; used to replay
+        // batches that were already coalesced when they were recorded.
+        void PushVerbatim(const EventRecord& record);
+
+        void PushWindowResize(int32_t width, int32_t height);
+        void PushWindowClose();
+        void PushWindowFocusChanged(bool isFocused);
+        void PushWindowMaximizeChanged(bool isMaximized);
+        void PushKeyPressed(int32_t keyCode, int32_t repeatCount);
+        void PushKeyReleased(int32_t keyCode);
+        void PushMouseMoved(float x, float y);
+        void PushMouseButtonPressed(int32_t button);
+        void PushMouseButtonReleased(int32_t button);
+        void PushMouseScrolled(float xOffset, float yOffset);
+
+        // Drop the current batch; capacity is kept.
+        void Clear();
+
+        uint32_t GetCount() const { return m_Tail - m_Head; }
+        uint32_t GetCount(EventType type) const { return static_cast<uint32_t>(m_Buckets[static_cast<size_t>(type)].size()); }
+        bool IsEmpty() const { return m_Tail == m_Head; }
+
+        // Raw samples pushed into the current batch, before coalescing.
+        uint64_t GetSampleCount() const { return m_SampleCount; }
+
+        void SetCoalescingEnabled(bool isEnabled) { m_IsCoalescingEnabled = isEnabled; }
+
+        // The index-th record of the batch in arrival order.
+        const EventRecord& operator[](uint32_t index) const { return m_Records[(m_Head + index) & m_Mask]; }
+
+        template<typename F>
+        void ForEach(F&& function) const
+        {
+            for (uint32_t it_Position = m_Head; it_Position != m_Tail; ++it_Position)
+            {
+                function(m_Records[it_Position & m_Mask]);
+            }
+        }
+
+        // Visit only the records of one type, still in arrival order.
+        template<typename F>
+        void ForEach(EventType type, F&& function) const
+        {
+            for (const uint32_t it_Offset : m_Buckets[static_cast<size_t>(type)])
+            {
+                function(m_Records[(m_Head + it_Offset) & m_Mask]);
+            }
+        }
+
+    private:
+        EventRecord& Append(EventType type);
+        void Grow();
+
+    private:
+        std::vector<EventRecord> m_Records;
+        uint32_t m_Mask = 0;
+
+        // Free-running positions; the batch is [m_Head, m_Tail) and wraps through the mask.
+        uint32_t m_Head = 0;
+        uint32_t m_Tail = 0;
+
+        // Offsets from m_Head of the records of each type.
+        std::array<std::vector<uint32_t>, EventTypeCount> m_Buckets;
+
+        bool m_IsCoalescingEnabled = true;
+        uint64_t m_SampleCount = 0;
+
+        // Last reported cursor position, carried across batches so coalesced records keep exact deltas.
+        bool m_HasMousePosition = false;
+        float m_MouseX = 0.0f;
+        float m_MouseY = 0.0f;
+    };
+}
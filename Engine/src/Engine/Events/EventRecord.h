@@ -0,0 +1,112 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/Events/Events.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace Engine
+{
+    constexpr size_t EventTypeCount = static_cast<size_t>(EventType::MouseScrolled) + 1;
+
+    // Plain-data form of every engine event. Records are copied into contiguous storage instead of being
+    // allocated and dispatched virtually, which matters when a high-rate mouse reports thousands of samples a second.
+    struct EventRecord
+    {
+        struct ResizeData
+        {
+            int32_t Width;
+            int32_t Height;
+        };
+
+        struct KeyData
+        {
+            int32_t KeyCode;
+            int32_t RepeatCount;
+        };
+
+        struct MouseButtonData
+        {
+            int32_t Button;
+        };
+
+        // Position after the last folded sample and the motion accumulated across all of them.
+        struct MouseMoveData
+        {
+            float X;
+            float Y;
+            float DeltaX;
+            float DeltaY;
+        };
+
+        struct ScrollData
+        {
+            float XOffset;
+            float YOffset;
+        };
+
+        EventType Type = EventType::None;
+
+        // Raw samples folded into this record; above one only for coalesced mouse motion and scrolling.
+        uint32_t SampleCount = 1;
+
+        union
+        {
+            ResizeData Resize{};
+            KeyData Key;
+            MouseButtonData MouseButton;
+            MouseMoveData MouseMove;
+            ScrollData Scroll;
+
+            // Focus or maximize state for the window toggle events.
+            bool Flag;
+        };
+    };
+
+    static_assert(std::is_trivially_copyable_v<EventRecord>, "Event records are copied as raw bytes");
+
+    ENGINE_API EventRecord ToEventRecord(const Event& event);
+
+    // Rebuild the polymorphic event on the stack and hand it to function, for code that still consumes Event&.
+    template<typename F>
+    void DispatchAsEvent(const EventRecord& record, F&& function)
+    {
+        switch (record.Type)
+        {
+        case EventType::WindowResize:
+            function(WindowResizeEvent(record.Resize.Width, record.Resize.Height));
+            break;
+        case EventType::WindowClose:
+            function(WindowCloseEvent());
+            break;
+        case EventType::WindowFocusChanged:
+            function(WindowFocusChangedEvent(record.Flag));
+            break;
+        case EventType::WindowMaximizeChanged:
+            function(WindowMaximizeChangedEvent(record.Flag));
+            break;
+        case EventType::KeyPressed:
+            function(KeyPressedEvent(record.Key.KeyCode, record.Key.RepeatCount));
+            break;
+        case EventType::KeyReleased:
+            function(KeyReleasedEvent(record.Key.KeyCode));
+            break;
+        case EventType::MouseMoved:
+            function(MouseMovedEvent(record.MouseMove.X, record.MouseMove.Y));
+            break;
+        case EventType::MouseButtonPressed:
+            function(MouseButtonPressedEvent(record.MouseButton.Button));
+            break;
+        case EventType::MouseButtonReleased:
+            function(MouseButtonReleasedEvent(record.MouseButton.Button));
+            break;
+        case EventType::MouseScrolled:
+            function(MouseScrolledEvent(record.Scroll.XOffset, record.Scroll.YOffset));
+            break;
+        default:
+            break;
+        }
+    }
+}
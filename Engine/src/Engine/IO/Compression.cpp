@@ -0,0 +1,237 @@
+#include "Engine/IO/Compression.h"
+
+#include <array>
+#include <cstring>
+
+namespace Engine::Compression
+{
+    namespace
+    {
+        constexpr uint32_t s_MinimumMatch = 4;
+        constexpr uint32_t s_MaximumOffset = 65535;
+        constexpr uint32_t s_HashBits = 12;
+
+        // The tail of the input is always emitted as literals so the decoder never reads a match past the end.
+        constexpr size_t s_TailLiterals = 5;
+
+        uint32_t Read32(const uint8_t* data)
+        {
+            uint32_t l_Value;
+            std::memcpy(&l_Value, data, sizeof(l_Value));
+
+            return l_Value;
+        }
+
+        uint32_t HashSequence(uint32_t sequence)
+        {
+            return (sequence * 2654435761u) >> (32 - s_HashBits);
+        }
+
+        uint8_t* WriteLength(uint8_t* out, size_t length)
+        {
+            while (length >= 255)
+            {
+                *out++ = 255;
+                length -= 255;
+            }
+            *out++ = static_cast<uint8_t>(length);
+
+            return out;
+        }
+
+        uint8_t* WriteSequence(uint8_t* out, const uint8_t* literals, size_t literalLength, uint32_t offset, size_t matchLength)
+        {
+            uint8_t* l_Token = out++;
+            const size_t l_MatchCode = matchLength >= s_MinimumMatch ? matchLength - s_MinimumMatch : 0;
+            *l_Token = static_cast<uint8_t>(((literalLength < 15 ? literalLength : 15) << 4) | (l_MatchCode < 15 ? l_MatchCode : 15));
+
+            if (literalLength >= 15)
+            {
+                out = WriteLength(out, literalLength - 15);
+            }
+
+            std::memcpy(out, literals, literalLength);
+            out += literalLength;
+
+            if (matchLength == 0)
+            {
+                return out;
+            }
+
+            *out++ = static_cast<uint8_t>(offset & 0xFF);
+            *out++ = static_cast<uint8_t>(offset >> 8);
+            if (l_MatchCode >= 15)
+            {
+                out = WriteLength(out, l_MatchCode - 15);
+            }
+
+            return out;
+        }
+
+        std::array<uint32_t, 256> BuildCrcTable()
+        {
+            std::array<uint32_t, 256> l_Table{};
+            for (uint32_t i = 0; i < 256; ++i)
+            {
+                uint32_t l_Value = i;
+                for (uint32_t l_Bit = 0; l_Bit < 8; ++l_Bit)
+                {
+                    l_Value = (l_Value & 1) != 0 ? (l_Value >> 1) ^ 0xEDB88320u : l_Value >> 1;
+                }
+                l_Table[i] = l_Value;
+            }
+
+            return l_Table;
+        }
+    }
+
+    size_t GetMaxCompressedSize(size_t sourceSize)
+    {
+        return sourceSize + sourceSize / 255 + 16;
+    }
+
+    size_t Compress(const uint8_t* source, size_t sourceSize, uint8_t* destination)
+    {
+        uint8_t* l_Out = destination;
+        size_t l_Anchor = 0;
+
+        if (sourceSize > s_MinimumMatch + s_TailLiterals)
+        {
+            // Positions are stored plus one so zero marks an empty slot.
+            std::array<uint32_t, size_t{ 1 } << s_HashBits> l_Table{};
+            const size_t l_MatchLimit = sourceSize - s_TailLiterals;
+            size_t l_Position = 0;
+
+            while (l_Position + s_MinimumMatch <= l_MatchLimit)
+            {
+                const uint32_t l_Sequence = Read32(source + l_Position);
+                uint32_t& l_Slot = l_Table[HashSequence(l_Sequence)];
+                const size_t l_Candidate = l_Slot;
+                l_Slot = static_cast<uint32_t>(l_Position + 1);
+
+                if (l_Candidate == 0 || l_Position - (l_Candidate - 1) > s_MaximumOffset || Read32(source + l_Candidate - 1) != l_Sequence)
+                {
+                    ++l_Position;
+                    continue;
+                }
+
+                const size_t l_Reference = l_Candidate - 1;
+                size_t l_Length = s_MinimumMatch;
+                while (l_Position + l_Length < l_MatchLimit && source[l_Reference + l_Length] == source[l_Position + l_Length])
+                {
+                    ++l_Length;
+                }
+
+                l_Out = WriteSequence(l_Out, source + l_Anchor, l_Position - l_Anchor, static_cast<uint32_t>(l_Position - l_Reference), l_Length);
+                l_Position += l_Length;
+                l_Anchor = l_Position;
+            }
+        }
+
+        l_Out = WriteSequence(l_Out, source + l_Anchor, sourceSize - l_Anchor, 0, 0);
+
+        return static_cast<size_t>(l_Out - destination);
+    }
+
+    bool Decompress(const uint8_t* source, size_t sourceSize, uint8_t* destination, size_t destinationSize)
+    {
+        const uint8_t* l_In = source;
+        const uint8_t* const l_InEnd = source + sourceSize;
+        size_t l_Written = 0;
+
+        const auto a_ReadLength = [&l_In, l_InEnd](size_t& length) -> bool
+        {
+            uint8_t l_Byte = 255;
+            while (l_Byte == 255)
+            {
+                if (l_In >= l_InEnd)
+                {
+                    return false;
+                }
+
+                l_Byte = *l_In++;
+                length += l_Byte;
+            }
+
+            return true;
+        };
+
+        while (l_In < l_InEnd)
+        {
+            const uint8_t l_Token = *l_In++;
+
+            size_t l_LiteralLength = l_Token >> 4;
+            if (l_LiteralLength == 15 && !a_ReadLength(l_LiteralLength))
+            {
+                return false;
+            }
+
+            if (l_LiteralLength > static_cast<size_t>(l_InEnd - l_In) || l_LiteralLength > destinationSize - l_Written)
+            {
+                return false;
+            }
+
+            std::memcpy(destination + l_Written, l_In, l_LiteralLength);
+            l_In += l_LiteralLength;
+            l_Written += l_LiteralLength;
+
+            // The final sequence carries literals only.
+            if (l_In == l_InEnd)
+            {
+                break;
+            }
+
+            if (l_InEnd - l_In < 2)
+            {
+                return false;
+            }
+
+            const size_t l_Offset = static_cast<size_t>(l_In[0]) | (static_cast<size_t>(l_In[1]) << 8);
+            l_In += 2;
+
+            size_t l_MatchLength = l_Token & 0x0F;
+            if (l_MatchLength == 15 && !a_ReadLength(l_MatchLength))
+            {
+                return false;
+            }
+            l_MatchLength += s_MinimumMatch;
+
+            if (l_Offset == 0 || l_Offset > l_Written || l_MatchLength > destinationSize - l_Written)
+            {
+                return false;
+            }
+
+            // Byte-wise copy because short offsets overlap the bytes being written (runs).
+            uint8_t* l_Destination = destination + l_Written;
+            const uint8_t* l_Match = l_Destination - l_Offset;
+            if (l_Offset >= l_MatchLength)
+            {
+                std::memcpy(l_Destination, l_Match, l_MatchLength);
+            }
+            else
+            {
+                for (size_t i = 0; i < l_MatchLength; ++i)
+                {
+                    l_Destination[i] = l_Match[i];
+                }
+            }
+            l_Written += l_MatchLength;
+        }
+
+        return l_Written == destinationSize;
+    }
+
+    uint32_t ComputeCrc32(const void* data, size_t size, uint32_t crc)
+    {
+        static const std::array<uint32_t, 256> s_Table = BuildCrcTable();
+
+        const uint8_t* l_Bytes = static_cast<const uint8_t*>(data);
+        crc = ~crc;
+        for (size_t i = 0; i < size; ++i)
+        {
+            crc = s_Table[(crc ^ l_Bytes[i]) & 0xFF] ^ (crc >> 8);
+        }
+
+        return ~crc;
+    }
+}
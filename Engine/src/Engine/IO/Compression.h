@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Engine::Compression
+{
+    // Byte-oriented LZ77 in the LZ4 block layout: a token (literal length, match length), literals, and a
+    // 16-bit back-reference. It favours decode speed over ratio, which suits palette blobs full of runs.
+
+    // Worst-case output size for an input of sourceSize bytes.
+    ENGINE_API size_t GetMaxCompressedSize(size_t sourceSize);
+
+    // Returns the number of bytes written to destination, which must hold GetMaxCompressedSize(sourceSize).
+    ENGINE_API size_t Compress(const uint8_t* source, size_t sourceSize, uint8_t* destination);
+
+    // Decodes exactly destinationSize bytes; returns false on malformed or truncated input.
+    ENGINE_API bool Decompress(const uint8_t* source, size_t sourceSize, uint8_t* destination, size_t destinationSize);
+
+    // CRC-32 (IEEE) used to validate tables and blobs after a crash or partial write.
+    ENGINE_API uint32_t ComputeCrc32(const void* data, size_t size, uint32_t crc = 0);
+}
@@ -0,0 +1,174 @@
+#include "Engine/IO/MappedFile.h"
+
+#include <utility>
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace Engine
+{
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Close();
+            m_Data = std::exchange(other.m_Data, nullptr);
+            m_Size = std::exchange(other.m_Size, 0);
+            m_IsOpen = std::exchange(other.m_IsOpen, false);
+#ifdef _WIN32
+            m_FileHandle = std::exchange(other.m_FileHandle, nullptr);
+            m_MappingHandle = std::exchange(other.m_MappingHandle, nullptr);
+#endif
+        }
+
+        return *this;
+    }
+
+#ifdef _WIN32
+    bool MappedFile::Open(const std::filesystem::path& path)
+    {
+        Close();
+
+        // Share write access so the owner of the file can keep appending while it is mapped.
+        HANDLE l_File = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (l_File == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER l_Size{};
+        if (!GetFileSizeEx(l_File, &l_Size))
+        {
+            CloseHandle(l_File);
+
+            return false;
+        }
+
+        m_FileHandle = l_File;
+        m_Size = static_cast<size_t>(l_Size.QuadPart);
+        m_IsOpen = true;
+        if (m_Size == 0)
+        {
+            return true;
+        }
+
+        m_MappingHandle = CreateFileMappingW(l_File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (m_MappingHandle == nullptr)
+        {
+            Close();
+
+            return false;
+        }
+
+        m_Data = static_cast<const uint8_t*>(MapViewOfFile(m_MappingHandle, FILE_MAP_READ, 0, 0, 0));
+        if (m_Data == nullptr)
+        {
+            Close();
+
+            return false;
+        }
+
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (m_Data != nullptr)
+        {
+            UnmapViewOfFile(m_Data);
+        }
+
+        if (m_MappingHandle != nullptr)
+        {
+            CloseHandle(m_MappingHandle);
+        }
+
+        if (m_FileHandle != nullptr)
+        {
+            CloseHandle(m_FileHandle);
+        }
+
+        m_Data = nullptr;
+        m_MappingHandle = nullptr;
+        m_FileHandle = nullptr;
+        m_Size = 0;
+        m_IsOpen = false;
+    }
+#else
+    bool MappedFile::Open(const std::filesystem::path& path)
+    {
+        Close();
+
+        const int l_File = ::open(path.c_str(), O_RDONLY);
+        if (l_File < 0)
+        {
+            return false;
+        }
+
+        struct stat l_Stat{};
+        if (::fstat(l_File, &l_Stat) != 0)
+        {
+            ::close(l_File);
+
+            return false;
+        }
+
+        m_Size = static_cast<size_t>(l_Stat.st_size);
+        m_IsOpen = true;
+        if (m_Size > 0)
+        {
+            void* l_Data = ::mmap(nullptr, m_Size, PROT_READ, MAP_SHARED, l_File, 0);
+            if (l_Data == MAP_FAILED)
+            {
+                ::close(l_File);
+                m_Size = 0;
+                m_IsOpen = false;
+
+                return false;
+            }
+
+            m_Data = static_cast<const uint8_t*>(l_Data);
+        }
+
+        // The mapping keeps its own reference to the file.
+        ::close(l_File);
+
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (m_Data != nullptr)
+        {
+            ::munmap(const_cast<uint8_t*>(m_Data), m_Size);
+        }
+
+        m_Data = nullptr;
+        m_Size = 0;
+        m_IsOpen = false;
+    }
+#endif
+}
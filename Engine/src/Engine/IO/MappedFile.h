@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+namespace Engine
+{
+    // Read-only memory mapping of a whole file. Readers get pointers straight into the page cache,
+    // so loading never copies through an intermediate buffer.
+    class ENGINE_API MappedFile
+    {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        // Maps the file at its current size; an empty file opens successfully with no data.
+        bool Open(const std::filesystem::path& path);
+        void Close();
+
+        bool IsOpen() const { return m_IsOpen; }
+        const uint8_t* GetData() const { return m_Data; }
+        size_t GetSize() const { return m_Size; }
+
+    private:
+        const uint8_t* m_Data = nullptr;
+        size_t m_Size = 0;
+        bool m_IsOpen = false;
+
+#ifdef _WIN32
+        void* m_FileHandle = nullptr;
+        void* m_MappingHandle = nullptr;
+#endif
+    };
+}
@@ -0,0 +1,197 @@
+#include "Engine/IO/WritableFile.h"
+
+#include <algorithm>
+#include <system_error>
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+#else
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace Engine
+{
+    WritableFile::~WritableFile()
+    {
+        Close();
+    }
+
+#ifdef _WIN32
+    bool WritableFile::Open(const std::filesystem::path& path, bool createIfMissing)
+    {
+        Close();
+
+        // Readers map the same file, so sharing must allow them (and a later rename over it) while it is open.
+        HANDLE l_File = CreateFileW(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+            createIfMissing ? OPEN_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (l_File == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        m_Handle = l_File;
+
+        return true;
+    }
+
+    void WritableFile::Close()
+    {
+        if (m_Handle != nullptr)
+        {
+            CloseHandle(m_Handle);
+            m_Handle = nullptr;
+        }
+    }
+
+    bool WritableFile::WriteAt(uint64_t offset, const void* data, size_t size)
+    {
+        const uint8_t* l_Bytes = static_cast<const uint8_t*>(data);
+        while (size > 0)
+        {
+            OVERLAPPED l_Overlapped{};
+            l_Overlapped.Offset = static_cast<DWORD>(offset & 0xFFFFFFFFu);
+            l_Overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+
+            const DWORD l_Request = static_cast<DWORD>(std::min<size_t>(size, 1u << 30));
+            DWORD l_Written = 0;
+            if (!WriteFile(m_Handle, l_Bytes, l_Request, &l_Written, &l_Overlapped) || l_Written == 0)
+            {
+                return false;
+            }
+
+            l_Bytes += l_Written;
+            offset += l_Written;
+            size -= l_Written;
+        }
+
+        return true;
+    }
+
+    bool WritableFile::Sync()
+    {
+        return FlushFileBuffers(m_Handle) != 0;
+    }
+
+    bool WritableFile::IsOpen() const
+    {
+        return m_Handle != nullptr;
+    }
+
+    uint64_t WritableFile::GetSize() const
+    {
+        LARGE_INTEGER l_Size{};
+        if (m_Handle == nullptr || !GetFileSizeEx(m_Handle, &l_Size))
+        {
+            return 0;
+        }
+
+        return static_cast<uint64_t>(l_Size.QuadPart);
+    }
+#else
+    bool WritableFile::Open(const std::filesystem::path& path, bool createIfMissing)
+    {
+        Close();
+
+        m_Descriptor = ::open(path.c_str(), createIfMissing ? (O_RDWR | O_CREAT) : O_RDWR, 0644);
+
+        return m_Descriptor >= 0;
+    }
+
+    void WritableFile::Close()
+    {
+        if (m_Descriptor >= 0)
+        {
+            ::close(m_Descriptor);
+            m_Descriptor = -1;
+        }
+    }
+
+    bool WritableFile::WriteAt(uint64_t offset, const void* data, size_t size)
+    {
+        const uint8_t* l_Bytes = static_cast<const uint8_t*>(data);
+        while (size > 0)
+        {
+            const ssize_t l_Written = ::pwrite(m_Descriptor, l_Bytes, size, static_cast<off_t>(offset));
+            if (l_Written < 0 && errno == EINTR)
+            {
+                continue;
+            }
+
+            if (l_Written <= 0)
+            {
+                return false;
+            }
+
+            l_Bytes += l_Written;
+            offset += static_cast<uint64_t>(l_Written);
+            size -= static_cast<size_t>(l_Written);
+        }
+
+        return true;
+    }
+
+    bool WritableFile::Sync()
+    {
+#ifdef __APPLE__
+        // Plain fsync only reaches the drive cache on macOS.
+        return ::fcntl(m_Descriptor, F_FULLFSYNC) == 0 || ::fsync(m_Descriptor) == 0;
+#else
+        return ::fdatasync(m_Descriptor) == 0;
+#endif
+    }
+
+    bool WritableFile::IsOpen() const
+    {
+        return m_Descriptor >= 0;
+    }
+
+    uint64_t WritableFile::GetSize() const
+    {
+        struct stat l_Stat{};
+        if (m_Descriptor < 0 || ::fstat(m_Descriptor, &l_Stat) != 0)
+        {
+            return 0;
+        }
+
+        return static_cast<uint64_t>(l_Stat.st_size);
+    }
+#endif
+
+    bool WritableFile::WriteAtomically(const std::filesystem::path& path, const void* data, size_t size)
+    {
+        std::error_code l_Error;
+        if (path.has_parent_path())
+        {
+            std::filesystem::create_directories(path.parent_path(), l_Error);
+        }
+
+        std::filesystem::path l_StagingPath = path;
+        l_StagingPath += ".tmp";
+        std::filesystem::remove(l_StagingPath, l_Error);
+
+        WritableFile l_File;
+        const bool l_HasWritten = l_File.Open(l_StagingPath, true) && (size == 0 || l_File.WriteAt(0, data, size)) && l_File.Sync();
+        l_File.Close();
+        if (l_HasWritten)
+        {
+            std::filesystem::rename(l_StagingPath, path, l_Error);
+            if (!l_Error)
+            {
+                return true;
+            }
+        }
+
+        std::filesystem::remove(l_StagingPath, l_Error);
+
+        return false;
+    }
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+namespace Engine
+{
+    // Unbuffered read/write file with positional writes and an explicit durability barrier. Paired with
+    // MappedFile: writers append through this handle while readers keep using the mapping.
+    class ENGINE_API WritableFile
+    {
+    public:
+        WritableFile() = default;
+        ~WritableFile();
+
+        WritableFile(const WritableFile&) = delete;
+        WritableFile& operator=(const WritableFile&) = delete;
+
+        // Opens an existing file, or creates an empty one when createIfMissing is set.
+        bool Open(const std::filesystem::path& path, bool createIfMissing);
+        void Close();
+
+        // Writes the whole range at the absolute offset, extending the file when needed.
+        bool WriteAt(uint64_t offset, const void* data, size_t size);
+
+        // Blocks until everything written so far has reached the storage device.
+        bool Sync();
+
+        bool IsOpen() const;
+        uint64_t GetSize() const;
+
+        // Writes the whole buffer to a sibling .tmp file, syncs it and renames it over path, creating parent
+        // directories as needed. Readers see either the previous file or the complete new one, never a partial write.
+        static bool WriteAtomically(const std::filesystem::path& path, const void* data, size_t size);
+
+    private:
+#ifdef _WIN32
+        void* m_Handle = nullptr;
+#else
+        int m_Descriptor = -1;
+#endif
+    };
+}
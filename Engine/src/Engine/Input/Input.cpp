@@ -3,18 +3,25 @@
 
 #include <GLFW/glfw3.h>
 
+#include <algorithm>
+
 namespace Engine
 {
+    static_assert(GLFW_KEY_LAST < Input::KeyCapacity, "Key bitsets must cover every GLFW key code");
+    static_assert(GLFW_MOUSE_BUTTON_LAST < Input::MouseButtonCapacity, "Button bitsets must cover every GLFW mouse button");
+
     // Static member definitions
-    std::unordered_map<int, bool> Input::s_KeyStates{};
-    std::unordered_set<int> Input::s_KeysPressedThisFrame{};
-    std::unordered_set<int> Input::s_KeysReleasedThisFrame{};
+    Input::KeyBits Input::s_KeysDown{};
+    Input::KeyBits Input::s_KeysPressedThisFrame{};
+    Input::KeyBits Input::s_KeysReleasedThisFrame{};
 
-    std::unordered_map<int, bool> Input::s_MouseButtonStates{};
-    std::unordered_set<int> Input::s_MouseButtonsPressedThisFrame{};
-    std::unordered_set<int> Input::s_MouseButtonsReleasedThisFrame{};
+    uint64_t Input::s_MouseButtonsDown = 0;
+    uint64_t Input::s_MouseButtonsPressedThisFrame = 0;
+    uint64_t Input::s_MouseButtonsReleasedThisFrame = 0;
 
-    std::unordered_map<std::string, std::vector<std::vector<int>>> Input::s_ActionMappings{};
+    std::unordered_map<std::string, ActionHandle> Input::s_ActionLookup{};
+    std::vector<Input::Action> Input::s_Actions{};
+    std::vector<Input::KeyBits> Input::s_ActionCombinations{};
 
     bool Input::s_HasMousePosition = false;
     float Input::s_MouseX = 0.0f;
@@ -27,10 +34,10 @@ namespace Engine
     void Input::BeginFrame()
     {
         // Reset transient state at the start of every frame so edge-triggered queries stay accurate.
-        s_KeysPressedThisFrame.clear();
-        s_KeysReleasedThisFrame.clear();
-        s_MouseButtonsPressedThisFrame.clear();
-        s_MouseButtonsReleasedThisFrame.clear();
+        s_KeysPressedThisFrame = {};
+        s_KeysReleasedThisFrame = {};
+        s_MouseButtonsPressedThisFrame = 0;
+        s_MouseButtonsReleasedThisFrame = 0;
 
         s_MouseDeltaX = 0.0f;
         s_MouseDeltaY = 0.0f;
@@ -55,81 +62,84 @@ namespace Engine
         s_ScrollDeltaY = 0.0f;
     }
 
-    void Input::OnEvent(const Event& event)
+    void Input::ResetState()
     {
-        // Previously traced every single event; removed to avoid log spam in hot paths.
-        // ENGINE_TRACE("Input::OnEvent - received event type {}", static_cast<int>(event.GetEventType()));
+        BeginFrame();
+        ResetMouseTracking();
+
+        s_KeysDown = {};
+        s_MouseButtonsDown = 0;
+    }
 
-        switch (event.GetEventType())
+    void Input::OnEvent(const EventRecord& record)
+    {
+        // Per-event traces stay off unless the Input channel is set to trace; the level check is a single atomic load.
+        switch (record.Type)
         {
         case EventType::KeyPressed:
         {
-            const KeyPressedEvent& l_KeyEvent = static_cast<const KeyPressedEvent&>(event);
-            const bool l_IsRepeat = l_KeyEvent.GetRepeatCount() > 0;
-            s_KeyStates[l_KeyEvent.GetKeyCode()] = true;
+            const bool l_IsRepeat = record.Key.RepeatCount > 0;
+            SetBit(s_KeysDown, record.Key.KeyCode, true);
 
             // Only mark an edge when the key transitions from up to down.
             if (!l_IsRepeat)
             {
-                s_KeysPressedThisFrame.insert(l_KeyEvent.GetKeyCode());
-                // ENGINE_TRACE("Key {} pressed", l_KeyEvent.GetKeyCode());
+                SetBit(s_KeysPressedThisFrame, record.Key.KeyCode, true);
+                ENGINE_CHANNEL_TRACE(Input, "Key {} pressed", record.Key.KeyCode);
             }
 
             break;
         }
         case EventType::KeyReleased:
         {
-            const KeyReleasedEvent& l_KeyEvent = static_cast<const KeyReleasedEvent&>(event);
-            s_KeyStates[l_KeyEvent.GetKeyCode()] = false;
-            s_KeysReleasedThisFrame.insert(l_KeyEvent.GetKeyCode());
-            // ENGINE_TRACE("Key {} released", l_KeyEvent.GetKeyCode());
+            SetBit(s_KeysDown, record.Key.KeyCode, false);
+            SetBit(s_KeysReleasedThisFrame, record.Key.KeyCode, true);
+            ENGINE_CHANNEL_TRACE(Input, "Key {} released", record.Key.KeyCode);
 
             break;
         }
         case EventType::MouseButtonPressed:
         {
-            const MouseButtonPressedEvent& l_MouseEvent = static_cast<const MouseButtonPressedEvent&>(event);
-            s_MouseButtonStates[l_MouseEvent.GetMouseButton()] = true;
-            s_MouseButtonsPressedThisFrame.insert(l_MouseEvent.GetMouseButton());
-            // ENGINE_TRACE("Mouse button {} pressed", l_MouseEvent.GetMouseButton());
+            SetButton(s_MouseButtonsDown, record.MouseButton.Button, true);
+            SetButton(s_MouseButtonsPressedThisFrame, record.MouseButton.Button, true);
+            ENGINE_CHANNEL_TRACE(Input, "Mouse button {} pressed", record.MouseButton.Button);
 
             break;
         }
         case EventType::MouseButtonReleased:
         {
-            const MouseButtonReleasedEvent& l_MouseEvent = static_cast<const MouseButtonReleasedEvent&>(event);
-            s_MouseButtonStates[l_MouseEvent.GetMouseButton()] = false;
-            s_MouseButtonsReleasedThisFrame.insert(l_MouseEvent.GetMouseButton());
-            // ENGINE_TRACE("Mouse button {} released", l_MouseEvent.GetMouseButton());
+            SetButton(s_MouseButtonsDown, record.MouseButton.Button, false);
+            SetButton(s_MouseButtonsReleasedThisFrame, record.MouseButton.Button, true);
+            ENGINE_CHANNEL_TRACE(Input, "Mouse button {} released", record.MouseButton.Button);
 
             break;
         }
         case EventType::MouseMoved:
         {
-            const MouseMovedEvent& l_MouseEvent = static_cast<const MouseMovedEvent&>(event);
+            // Coalesced records carry the final position of a burst; per-sample deltas telescope, so this matches
+            // feeding every raw sample up to float rounding.
             if (!s_HasMousePosition)
             {
-                s_MouseX = l_MouseEvent.GetX();
-                s_MouseY = l_MouseEvent.GetY();
+                s_MouseX = record.MouseMove.X;
+                s_MouseY = record.MouseMove.Y;
                 s_HasMousePosition = true;
             }
             else
             {
-                s_MouseDeltaX += l_MouseEvent.GetX() - s_MouseX;
-                s_MouseDeltaY += l_MouseEvent.GetY() - s_MouseY;
-                s_MouseX = l_MouseEvent.GetX();
-                s_MouseY = l_MouseEvent.GetY();
+                s_MouseDeltaX += record.MouseMove.X - s_MouseX;
+                s_MouseDeltaY += record.MouseMove.Y - s_MouseY;
+                s_MouseX = record.MouseMove.X;
+                s_MouseY = record.MouseMove.Y;
             }
-            // ENGINE_TRACE("Mouse moved to ({}, {})", s_MouseX, s_MouseY);
+            ENGINE_CHANNEL_TRACE(Input, "Mouse moved to ({}, {})", s_MouseX, s_MouseY);
 
             break;
         }
         case EventType::MouseScrolled:
         {
-            const MouseScrolledEvent& l_MouseEvent = static_cast<const MouseScrolledEvent&>(event);
-            s_ScrollDeltaX += l_MouseEvent.GetXOffset();
-            s_ScrollDeltaY += l_MouseEvent.GetYOffset();
-            // ENGINE_TRACE("Mouse scrolled with delta ({}, {})", s_ScrollDeltaX, s_ScrollDeltaY);
+            s_ScrollDeltaX += record.Scroll.XOffset;
+            s_ScrollDeltaY += record.Scroll.YOffset;
+            ENGINE_CHANNEL_TRACE(Input, "Mouse scrolled with delta ({}, {})", s_ScrollDeltaX, s_ScrollDeltaY);
 
             break;
         }
@@ -138,46 +148,27 @@ namespace Engine
         }
     }
 
-    bool Input::IsKeyDown(int keyCode)
+    void Input::SetBit(KeyBits& bits, int keyCode, bool value)
     {
-        const auto l_Found = s_KeyStates.find(keyCode);
-        if (l_Found == s_KeyStates.end())
+        if (static_cast<unsigned>(keyCode) >= static_cast<unsigned>(KeyCapacity))
         {
-            return false;
+            return;
         }
 
-        return l_Found->second;
-    }
-
-    bool Input::WasKeyPressedThisFrame(int keyCode)
-    {
-        return s_KeysPressedThisFrame.find(keyCode) != s_KeysPressedThisFrame.end();
-    }
-
-    bool Input::WasKeyReleasedThisFrame(int keyCode)
-    {
-        return s_KeysReleasedThisFrame.find(keyCode) != s_KeysReleasedThisFrame.end();
+        const uint64_t l_Mask = uint64_t{ 1 } << (keyCode & 63);
+        uint64_t& l_Word = bits.Words[keyCode >> 6];
+        l_Word = value ? (l_Word | l_Mask) : (l_Word & ~l_Mask);
     }
 
-    bool Input::IsMouseButtonDown(int button)
+    void Input::SetButton(uint64_t& bits, int button, bool value)
     {
-        const auto l_Found = s_MouseButtonStates.find(button);
-        if (l_Found == s_MouseButtonStates.end())
+        if (static_cast<unsigned>(button) >= static_cast<unsigned>(MouseButtonCapacity))
         {
-            return false;
+            return;
         }
 
-        return l_Found->second;
-    }
-
-    bool Input::WasMouseButtonPressedThisFrame(int button)
-    {
-        return s_MouseButtonsPressedThisFrame.find(button) != s_MouseButtonsPressedThisFrame.end();
-    }
-
-    bool Input::WasMouseButtonReleasedThisFrame(int button)
-    {
-        return s_MouseButtonsReleasedThisFrame.find(button) != s_MouseButtonsReleasedThisFrame.end();
+        const uint64_t l_Mask = uint64_t{ 1 } << button;
+        bits = value ? (bits | l_Mask) : (bits & ~l_Mask);
     }
 
     std::pair<float, float> Input::GetMousePosition()
@@ -195,28 +186,77 @@ namespace Engine
         return { s_ScrollDeltaX, s_ScrollDeltaY };
     }
 
-    void Input::RegisterActionMapping(const std::string& actionName, const std::vector<int>& keyCombination)
+    ActionHandle Input::RegisterAction(const std::string& actionName, const std::vector<std::vector<int>>& keyCombinations)
     {
-        // Replace any existing mappings with a fresh single-combo mapping for clarity.
-        s_ActionMappings[actionName] = { keyCombination };
+        const auto [l_Found, l_Inserted] = s_ActionLookup.try_emplace(actionName, static_cast<ActionHandle>(s_Actions.size()));
+        if (l_Inserted)
+        {
+            s_Actions.push_back({});
+        }
+
+        // Compile each combination into a key mask; empty combinations and unmappable keys can never fire.
+        std::vector<KeyBits> l_Compiled;
+        for (const std::vector<int>& it_Combination : keyCombinations)
+        {
+            KeyBits l_Mask;
+            bool l_IsValid = !it_Combination.empty();
+            for (const int it_Key : it_Combination)
+            {
+                l_IsValid = l_IsValid && static_cast<unsigned>(it_Key) < static_cast<unsigned>(KeyCapacity);
+                SetBit(l_Mask, it_Key, true);
+            }
+
+            if (l_IsValid)
+            {
+                l_Compiled.push_back(l_Mask);
+            }
+            else
+            {
+                ENGINE_CHANNEL_WARN(Input, "Action '{}' has an empty or unmappable key combination; it is ignored", actionName);
+            }
+        }
+
+        // Reuse the existing slots when they fit; otherwise append and leave the old range unused.
+        Action& l_Action = s_Actions[l_Found->second];
+        if (l_Compiled.size() > l_Action.Count)
+        {
+            l_Action.First = static_cast<uint32_t>(s_ActionCombinations.size());
+            s_ActionCombinations.resize(s_ActionCombinations.size() + l_Compiled.size());
+        }
+
+        std::copy(l_Compiled.begin(), l_Compiled.end(), s_ActionCombinations.begin() + l_Action.First);
+        l_Action.Count = static_cast<uint32_t>(l_Compiled.size());
+
+        return l_Found->second;
     }
 
-    void Input::ClearActionMapping(const std::string& actionName)
+    ActionHandle Input::FindAction(const std::string& actionName)
     {
-        s_ActionMappings.erase(actionName);
+        const auto l_Found = s_ActionLookup.find(actionName);
+
+        return l_Found != s_ActionLookup.end() ? l_Found->second : InvalidActionHandle;
     }
 
-    bool Input::IsActionDown(const std::string& actionName)
+    bool Input::IsActionDown(ActionHandle action)
     {
-        const auto l_Found = s_ActionMappings.find(actionName);
-        if (l_Found == s_ActionMappings.end())
+        if (action >= s_Actions.size())
         {
             return false;
         }
 
-        for (const std::vector<int>& l_Combination : l_Found->second)
+        const Action& l_Action = s_Actions[action];
+        for (uint32_t it_Index = l_Action.First; it_Index < l_Action.First + l_Action.Count; ++it_Index)
         {
-            if (EvaluateCombinationDown(l_Combination))
+            const KeyBits& l_Mask = s_ActionCombinations[it_Index];
+
+            // Every key of the combination must be down.
+            uint64_t l_Missing = 0;
+            for (int it_Word = 0; it_Word < KeyWordCount; ++it_Word)
+            {
+                l_Missing |= l_Mask.Words[it_Word] & ~s_KeysDown.Words[it_Word];
+            }
+
+            if (l_Missing == 0)
             {
                 return true;
             }
@@ -225,17 +265,28 @@ namespace Engine
         return false;
     }
 
-    bool Input::WasActionPressedThisFrame(const std::string& actionName)
+    bool Input::WasActionPressedThisFrame(ActionHandle action)
     {
-        const auto l_Found = s_ActionMappings.find(actionName);
-        if (l_Found == s_ActionMappings.end())
+        if (action >= s_Actions.size())
         {
             return false;
         }
 
-        for (const std::vector<int>& l_Combination : l_Found->second)
+        const Action& l_Action = s_Actions[action];
+        for (uint32_t it_Index = l_Action.First; it_Index < l_Action.First + l_Action.Count; ++it_Index)
         {
-            if (EvaluateCombinationPressed(l_Combination))
+            const KeyBits& l_Mask = s_ActionCombinations[it_Index];
+
+            // All keys down and at least one of them went down this frame.
+            uint64_t l_Missing = 0;
+            uint64_t l_Edges = 0;
+            for (int it_Word = 0; it_Word < KeyWordCount; ++it_Word)
+            {
+                l_Missing |= l_Mask.Words[it_Word] & ~s_KeysDown.Words[it_Word];
+                l_Edges |= l_Mask.Words[it_Word] & s_KeysPressedThisFrame.Words[it_Word];
+            }
+
+            if (l_Missing == 0 && l_Edges != 0)
             {
                 return true;
             }
@@ -244,29 +295,19 @@ namespace Engine
         return false;
     }
 
-    bool Input::EvaluateCombinationDown(const std::vector<int>& keyCombination)
+    void Input::RegisterActionMapping(const std::string& actionName, const std::vector<int>& keyCombination)
     {
-        for (int it_Key : keyCombination)
-        {
-            if (!IsKeyDown(it_Key))
-            {
-                return false;
-            }
-        }
-
-        return !keyCombination.empty();
+        // Replace any existing mappings with a fresh single-combo mapping for clarity.
+        RegisterAction(actionName, { keyCombination });
     }
 
-    bool Input::EvaluateCombinationPressed(const std::vector<int>& keyCombination)
+    void Input::ClearActionMapping(const std::string& actionName)
     {
-        bool l_AllKeysDown = true;
-        bool l_EdgeDetected = false;
-        for (int it_Key : keyCombination)
+        // The handle stays reserved so code that cached it keeps working; it simply never fires.
+        const ActionHandle l_Action = FindAction(actionName);
+        if (l_Action != InvalidActionHandle)
         {
-            l_AllKeysDown = l_AllKeysDown && IsKeyDown(it_Key);
-            l_EdgeDetected = l_EdgeDetected || WasKeyPressedThisFrame(it_Key);
+            s_Actions[l_Action].Count = 0;
         }
-
-        return l_AllKeysDown && l_EdgeDetected && !keyCombination.empty();
     }
 }
\ No newline at end of file
@@ -1,37 +1,52 @@
 #pragma once
 
 #include "Engine/Core/Core.h"
+#include "Engine/Events/EventRecord.h"
 #include "Engine/Events/Events.h"
 
+#include <array>
+#include <cstdint>
 #include <string>
 #include <unordered_map>
-#include <unordered_set>
 #include <utility>
 #include <vector>
 
 namespace Engine
 {
+    // Index of an action registered with Input::RegisterAction; valid for the lifetime of the process.
+    using ActionHandle = uint32_t;
+    constexpr ActionHandle InvalidActionHandle = 0xFFFFFFFFu;
+
     class ENGINE_API Input
     {
     public:
+        // Key codes are GLFW key codes; anything outside [0, KeyCapacity) (e.g. GLFW_KEY_UNKNOWN) is ignored.
+        static constexpr int KeyCapacity = 512;
+        static constexpr int MouseButtonCapacity = 64;
+
         static void BeginFrame();
         static void EndFrame();
 
         // Reset cached mouse tracking so cursor mode transitions do not cause sudden camera jumps.
         static void ResetMouseTracking();
 
+        // Release every key and button and forget the cursor; action registrations are kept. Runs start from
+        // this state so a recorded session replays against the same input history.
+        static void ResetState();
+
         // Cache incoming events so gameplay code can query state without owning callbacks.
-        static void OnEvent(const Event& event);
+        static void OnEvent(const EventRecord& record);
+        static void OnEvent(const Event& event) { OnEvent(ToEventRecord(event)); }
 
         // Key queries ------------------------------------------------------
-        static bool IsKeyDown(int keyCode);
-        static bool WasKeyPressedThisFrame(int keyCode);
-        static bool WasKeyReleasedThisFrame(int keyCode);
+        static bool IsKeyDown(int keyCode) { return TestBit(s_KeysDown, keyCode); }
+        static bool WasKeyPressedThisFrame(int keyCode) { return TestBit(s_KeysPressedThisFrame, keyCode); }
+        static bool WasKeyReleasedThisFrame(int keyCode) { return TestBit(s_KeysReleasedThisFrame, keyCode); }
 
         // Mouse button queries ---------------------------------------------
-        static bool IsMouseButtonDown(int button);
-        static bool WasMouseButtonPressedThisFrame(int button);
-        static bool WasMouseButtonReleasedThisFrame(int button);
+        static bool IsMouseButtonDown(int button) { return TestButton(s_MouseButtonsDown, button); }
+        static bool WasMouseButtonPressedThisFrame(int button) { return TestButton(s_MouseButtonsPressedThisFrame, button); }
+        static bool WasMouseButtonReleasedThisFrame(int button) { return TestButton(s_MouseButtonsReleasedThisFrame, button); }
 
         // Pointer deltas ---------------------------------------------------
         static std::pair<float, float> GetMousePosition();
@@ -39,26 +54,66 @@ namespace Engine
         static std::pair<float, float> GetScrollDelta();
 
         // Action mappings allow gameplay systems to reason about intent
-        // instead of concrete keycodes (e.g., "MoveForward").
+        // instead of concrete keycodes (e.g., "MoveForward"). Register once and keep the handle: each key
+        // combination is precompiled into a bitmask, so a handle query is a handful of AND/compare operations.
+        // Registering an existing name replaces its combinations and returns the same handle.
+        static ActionHandle RegisterAction(const std::string& actionName, const std::vector<std::vector<int>>& keyCombinations);
+        static ActionHandle FindAction(const std::string& actionName);
+        static bool IsActionDown(ActionHandle action);
+        static bool WasActionPressedThisFrame(ActionHandle action);
+
+        // Name-based conveniences; each call pays a string lookup, so prefer handles in per-tick code.
         static void RegisterActionMapping(const std::string& actionName, const std::vector<int>& keyCombination);
         static void ClearActionMapping(const std::string& actionName);
-        static bool IsActionDown(const std::string& actionName);
-        static bool WasActionPressedThisFrame(const std::string& actionName);
+        static bool IsActionDown(const std::string& actionName) { return IsActionDown(FindAction(actionName)); }
+        static bool WasActionPressedThisFrame(const std::string& actionName) { return WasActionPressedThisFrame(FindAction(actionName)); }
 
     private:
-        static bool EvaluateCombinationDown(const std::vector<int>& keyCombination);
-        static bool EvaluateCombinationPressed(const std::vector<int>& keyCombination);
+        static constexpr int KeyWordCount = KeyCapacity / 64;
+
+        // One bit per key code.
+        struct KeyBits
+        {
+            std::array<uint64_t, KeyWordCount> Words{};
+        };
+
+        // An action's combinations live in s_ActionCombinations[First, First + Count).
+        struct Action
+        {
+            uint32_t First = 0;
+            uint32_t Count = 0;
+        };
+
+        static bool TestBit(const KeyBits& bits, int keyCode)
+        {
+            if (static_cast<unsigned>(keyCode) >= static_cast<unsigned>(KeyCapacity))
+            {
+                return false;
+            }
+
+            return (bits.Words[keyCode >> 6] >> (keyCode & 63)) & 1;
+        }
+
+        static bool TestButton(uint64_t bits, int button)
+        {
+            return static_cast<unsigned>(button) < static_cast<unsigned>(MouseButtonCapacity) && ((bits >> button) & 1) != 0;
+        }
+
+        static void SetBit(KeyBits& bits, int keyCode, bool value);
+        static void SetButton(uint64_t& bits, int button, bool value);
 
         // Internal caches --------------------------------------------------
-        static std::unordered_map<int, bool> s_KeyStates;
-        static std::unordered_set<int> s_KeysPressedThisFrame;
-        static std::unordered_set<int> s_KeysReleasedThisFrame;
+        static KeyBits s_KeysDown;
+        static KeyBits s_KeysPressedThisFrame;
+        static KeyBits s_KeysReleasedThisFrame;
 
-        static std::unordered_map<int, bool> s_MouseButtonStates;
-        static std::unordered_set<int> s_MouseButtonsPressedThisFrame;
-        static std::unordered_set<int> s_MouseButtonsReleasedThisFrame;
+        static uint64_t s_MouseButtonsDown;
+        static uint64_t s_MouseButtonsPressedThisFrame;
+        static uint64_t s_MouseButtonsReleasedThisFrame;
 
-        static std::unordered_map<std::string, std::vector<std::vector<int>>> s_ActionMappings;
+        static std::unordered_map<std::string, ActionHandle> s_ActionLookup;
+        static std::vector<Action> s_Actions;
+        static std::vector<KeyBits> s_ActionCombinations;
 
         static bool s_HasMousePosition;
         static float s_MouseX;
@@ -0,0 +1,200 @@
+#include "Engine/Input/InputRecording.h"
+
+#include "Engine/Core/Log.h"
+
+#include <cstring>
+#include <vector>
+
+namespace Engine
+{
+    namespace
+    {
+        constexpr uint32_t s_RecordingMagic = 0x5249434Du; // "MCIR"
+        constexpr uint16_t s_RecordingVersion = 1;
+
+        struct RecordingHeader
+        {
+            uint32_t Magic = 0;
+            uint16_t Version = 0;
+
+            // Records are stored as raw bytes, so a build with a different layout must refuse the file.
+            uint16_t RecordSize = 0;
+        };
+
+        struct FrameHeader
+        {
+            uint64_t FrameIndex = 0;
+            double DeltaTime = 0.0;
+
+            // Seconds since recording started, for lining the stream up with external captures.
+            double Timestamp = 0.0;
+            uint32_t RecordCount = 0;
+            uint32_t Reserved = 0;
+        };
+
+        static_assert(sizeof(RecordingHeader) == 8 && sizeof(FrameHeader) == 32, "Recording headers must have no padding");
+
+        bool IsInputEvent(EventType type)
+        {
+            return type == EventType::KeyPressed || type == EventType::KeyReleased || type == EventType::MouseMoved
+                || type == EventType::MouseButtonPressed || type == EventType::MouseButtonReleased || type == EventType::MouseScrolled;
+        }
+    }
+
+    InputRecorder::~InputRecorder()
+    {
+        Close();
+    }
+
+    bool InputRecorder::Open(const std::filesystem::path& path)
+    {
+        Close();
+
+        m_Stream.open(path, std::ios::binary | std::ios::trunc);
+        if (!m_Stream.is_open())
+        {
+            ENGINE_CHANNEL_ERROR(Input, "Failed to open input recording {}", path.string());
+
+            return false;
+        }
+
+        RecordingHeader l_Header;
+        l_Header.Magic = s_RecordingMagic;
+        l_Header.Version = s_RecordingVersion;
+        l_Header.RecordSize = static_cast<uint16_t>(sizeof(EventRecord));
+        m_Stream.write(reinterpret_cast<const char*>(&l_Header), sizeof(l_Header));
+
+        m_StartTime = std::chrono::steady_clock::now();
+        m_FrameCount = 0;
+
+        ENGINE_CHANNEL_INFO(Input, "Recording input to {}", path.string());
+
+        return true;
+    }
+
+    void InputRecorder::Close()
+    {
+        if (m_Stream.is_open())
+        {
+            m_Stream.close();
+            ENGINE_CHANNEL_INFO(Input, "Input recording closed after {} frames", m_FrameCount);
+        }
+    }
+
+    void InputRecorder::RecordFrame(uint64_t frameIndex, double deltaTime, const EventQueue& events)
+    {
+        if (!m_Stream.is_open())
+        {
+            return;
+        }
+
+        FrameHeader l_Frame;
+        l_Frame.FrameIndex = frameIndex;
+        l_Frame.DeltaTime = deltaTime;
+        l_Frame.Timestamp = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_StartTime).count();
+        l_Frame.RecordCount = events.GetCount();
+        m_Stream.write(reinterpret_cast<const char*>(&l_Frame), sizeof(l_Frame));
+
+        // The ring may wrap, so records are written one by one; the stream buffers them.
+        events.ForEach([this](const EventRecord& record)
+            {
+                m_Stream.write(reinterpret_cast<const char*>(&record), sizeof(record));
+            });
+
+        ++m_FrameCount;
+    }
+
+    bool InputReplayer::Open(const std::filesystem::path& path)
+    {
+        Close();
+
+        if (!m_File.Open(path))
+        {
+            ENGINE_CHANNEL_ERROR(Input, "Failed to open input recording {}", path.string());
+
+            return false;
+        }
+
+        RecordingHeader l_Header;
+        if (m_File.GetSize() >= sizeof(l_Header))
+        {
+            std::memcpy(&l_Header, m_File.GetData(), sizeof(l_Header));
+        }
+
+        if (l_Header.Magic != s_RecordingMagic || l_Header.Version != s_RecordingVersion || l_Header.RecordSize != sizeof(EventRecord))
+        {
+            ENGINE_CHANNEL_ERROR(Input, "Input recording {} is not compatible with this build", path.string());
+            Close();
+
+            return false;
+        }
+
+        m_Cursor = sizeof(l_Header);
+        m_FrameCount = 0;
+
+        ENGINE_CHANNEL_INFO(Input, "Replaying input from {}", path.string());
+
+        return true;
+    }
+
+    void InputReplayer::Close()
+    {
+        m_File.Close();
+        m_Cursor = 0;
+    }
+
+    bool InputReplayer::ReplayFrame(EventQueue& events, double& deltaTime)
+    {
+        FrameHeader l_Frame;
+        if (!m_File.IsOpen() || m_File.GetSize() - m_Cursor < sizeof(l_Frame))
+        {
+            m_Cursor = m_File.GetSize();
+
+            return false;
+        }
+
+        std::memcpy(&l_Frame, m_File.GetData() + m_Cursor, sizeof(l_Frame));
+        const size_t l_RecordBytes = size_t{ l_Frame.RecordCount } * sizeof(EventRecord);
+        if (m_File.GetSize() - m_Cursor - sizeof(l_Frame) < l_RecordBytes)
+        {
+            ENGINE_CHANNEL_WARN(Input, "Input recording ends with a truncated frame; stopping replay");
+            m_Cursor = m_File.GetSize();
+
+            return false;
+        }
+
+        // Keep window events from this frame's poll (close, resize, focus) and drop live input.
+        std::vector<EventRecord> l_WindowEvents;
+        events.ForEach([&l_WindowEvents](const EventRecord& record)
+            {
+                if (!IsInputEvent(record.Type))
+                {
+                    l_WindowEvents.push_back(record);
+                }
+            });
+        events.Clear();
+
+        // Window events were recorded too; only the live ones are kept so a replay can still be closed or resized.
+        const uint8_t* l_Records = m_File.GetData() + m_Cursor + sizeof(l_Frame);
+        for (uint32_t i = 0; i < l_Frame.RecordCount; ++i)
+        {
+            EventRecord l_Record;
+            std::memcpy(&l_Record, l_Records + size_t{ i } * sizeof(EventRecord), sizeof(l_Record));
+            if (IsInputEvent(l_Record.Type))
+            {
+                events.PushVerbatim(l_Record);
+            }
+        }
+
+        for (const EventRecord& it_Record : l_WindowEvents)
+        {
+            events.PushVerbatim(it_Record);
+        }
+
+        m_Cursor += sizeof(l_Frame) + l_RecordBytes;
+        deltaTime = l_Frame.DeltaTime;
+        ++m_FrameCount;
+
+        return true;
+    }
+}
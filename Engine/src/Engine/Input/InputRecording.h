@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/Events/EventQueue.h"
+#include "Engine/IO/MappedFile.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+
+namespace Engine
+{
+    // Binary input stream: a header, then one block per frame holding the frame index, the frame's delta time,
+    // a wall-clock timestamp and the exact event records the application consumed that frame. Records are
+    // stored after coalescing, so replaying them reproduces every Input query result bit for bit.
+    class ENGINE_API InputRecorder
+    {
+    public:
+        InputRecorder() = default;
+        ~InputRecorder();
+
+        InputRecorder(const InputRecorder&) = delete;
+        InputRecorder& operator=(const InputRecorder&) = delete;
+
+        bool Open(const std::filesystem::path& path);
+        void Close();
+        bool IsOpen() const { return m_Stream.is_open(); }
+
+        // Append one frame; called once per frame, after polling and before the events are processed.
+        void RecordFrame(uint64_t frameIndex, double deltaTime, const EventQueue& events);
+
+        uint64_t GetFrameCount() const { return m_FrameCount; }
+
+    private:
+        std::ofstream m_Stream;
+        std::chrono::steady_clock::time_point m_StartTime;
+        uint64_t m_FrameCount = 0;
+    };
+
+    // Plays a recording back through an EventQueue. Input events the platform produced are discarded while
+    // a replay is active, so only the recorded stream reaches the game; window events still pass through.
+    class ENGINE_API InputReplayer
+    {
+    public:
+        bool Open(const std::filesystem::path& path);
+        void Close();
+        bool IsOpen() const { return m_File.IsOpen(); }
+
+        // Replace this frame's input with the next recorded frame and report the delta time it ran with.
+        // Returns false once the recording is exhausted.
+        bool ReplayFrame(EventQueue& events, double& deltaTime);
+
+        bool IsFinished() const { return m_Cursor >= m_File.GetSize(); }
+        uint64_t GetReplayedFrameCount() const { return m_FrameCount; }
+
+    private:
+        MappedFile m_File;
+        size_t m_Cursor = 0;
+        uint64_t m_FrameCount = 0;
+    };
+}
@@ -0,0 +1,394 @@
+#include "Engine/Jobs/JobSystem.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Profiler.h"
+
+#include <algorithm>
+#include <string>
+
+namespace Engine
+{
+    namespace
+    {
+        // Identifies which system and slot the current worker thread belongs to.
+        thread_local const JobSystem* t_CurrentJobSystem = nullptr;
+        thread_local int32_t t_CurrentSlotIndex = -1;
+
+        // Number of failed search rounds before an idle worker goes to sleep.
+        constexpr uint32_t s_IdleSpinCount = 64;
+
+        uint32_t NextRandom(uint32_t& state)
+        {
+            // Xorshift32: cheap and good enough to spread steal victims.
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+
+            return state;
+        }
+    }
+
+    JobSystem::JobSystem(uint32_t workerCount) : m_OwnerThreadId(std::this_thread::get_id())
+    {
+        if (workerCount == 0)
+        {
+            const uint32_t l_HardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+            workerCount = std::max(l_HardwareThreads, 2u) - 1;
+        }
+
+        // Slot 0 belongs to the owning thread; workers take slots 1..N.
+        m_Slots.reserve(workerCount + 1);
+        for (uint32_t i = 0; i <= workerCount; ++i)
+        {
+            m_Slots.push_back(std::make_unique<Slot>());
+            m_Slots.back()->RandomState = 0x9E3779B9u * (i + 1);
+        }
+
+        m_Workers.reserve(workerCount);
+        for (uint32_t i = 1; i <= workerCount; ++i)
+        {
+            m_Workers.emplace_back(&JobSystem::WorkerMain, this, i);
+        }
+
+        ENGINE_CHANNEL_INFO(Jobs, "Job system started with {} worker threads", workerCount);
+    }
+
+    JobSystem::~JobSystem()
+    {
+        {
+            std::lock_guard<std::mutex> l_Lock(m_SleepMutex);
+            m_IsShuttingDown.store(true, std::memory_order_seq_cst);
+        }
+        m_SleepCondition.notify_all();
+
+        for (std::thread& it_Worker : m_Workers)
+        {
+            it_Worker.join();
+        }
+
+        // Run whatever is still queued on this thread, including continuations those jobs release, so every
+        // counter reaches zero and nobody waiting on one hangs. The workers are gone, so nothing races the deques.
+        uint32_t l_DrainedCount = 0;
+        while (Job* l_Job = FindJob(0))
+        {
+            Execute(l_Job, 0);
+            ++l_DrainedCount;
+        }
+
+        if (l_DrainedCount > 0)
+        {
+            ENGINE_CHANNEL_INFO(Jobs, "Ran {} jobs still queued at shutdown", l_DrainedCount);
+        }
+
+        ENGINE_CHANNEL_INFO(Jobs, "Job system shut down");
+    }
+
+    void JobSystem::Submit(JobFunction function, JobCounter* counter)
+    {
+        if (counter != nullptr)
+        {
+            counter->m_PendingCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        Job* l_Job = new Job{ std::move(function), counter };
+        Schedule(l_Job);
+    }
+
+    void JobSystem::SubmitAfter(JobCounter& dependency, JobFunction function, JobCounter* counter)
+    {
+        if (counter != nullptr)
+        {
+            counter->m_PendingCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        Job* l_Job = new Job{ std::move(function), counter };
+
+        {
+            // The check happens under the lock so a concurrent completion either sees this continuation or we see zero.
+            std::lock_guard<std::mutex> l_Lock(dependency.m_ContinuationMutex);
+            if (dependency.m_PendingCount.load(std::memory_order_acquire) != 0)
+            {
+                dependency.m_Continuations.push_back(l_Job);
+
+                return;
+            }
+        }
+
+        Schedule(l_Job);
+    }
+
+    void JobSystem::SubmitAfterAll(const std::vector<JobCounter*>& dependencies, JobFunction function, JobCounter* counter)
+    {
+        if (dependencies.size() <= 1)
+        {
+            if (dependencies.empty())
+            {
+                Submit(std::move(function), counter);
+            }
+            else
+            {
+                SubmitAfter(*dependencies[0], std::move(function), counter);
+            }
+
+            return;
+        }
+
+        if (counter != nullptr)
+        {
+            counter->m_PendingCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // One lightweight continuation per dependency; whichever finishes last schedules the real job.
+        Job* l_Job = new Job{ std::move(function), counter };
+        std::shared_ptr<std::atomic<uint32_t>> l_RemainingCount = std::make_shared<std::atomic<uint32_t>>(static_cast<uint32_t>(dependencies.size()));
+        for (JobCounter* it_Dependency : dependencies)
+        {
+            SubmitAfter(*it_Dependency, [this, l_Job, l_RemainingCount]()
+                {
+                    if (l_RemainingCount->fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    {
+                        Schedule(l_Job);
+                    }
+                });
+        }
+    }
+
+    void JobSystem::ParallelFor(uint32_t count, uint32_t batchSize, const std::function<void(uint32_t, uint32_t)>& function, JobCounter* counter)
+    {
+        batchSize = std::max(batchSize, 1u);
+        for (uint32_t l_Begin = 0; l_Begin < count; l_Begin += batchSize)
+        {
+            const uint32_t l_End = std::min(l_Begin + batchSize, count);
+            Submit([function, l_Begin, l_End]()
+                {
+                    function(l_Begin, l_End);
+                }, counter);
+        }
+    }
+
+    void JobSystem::WaitForCounter(JobCounter& counter)
+    {
+        const int32_t l_SlotIndex = GetCurrentSlotIndex();
+
+        while (!counter.IsComplete())
+        {
+            // Help drain the queues instead of blocking so the waiting thread contributes throughput.
+            Job* l_Job = l_SlotIndex >= 0 ? FindJob(l_SlotIndex) : nullptr;
+            if (l_Job != nullptr)
+            {
+                Execute(l_Job, l_SlotIndex);
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void JobSystem::PostToMainThread(JobFunction function)
+    {
+        m_MainThreadQueue.Push(std::move(function));
+    }
+
+    uint32_t JobSystem::DrainMainThreadQueue()
+    {
+        uint32_t l_ExecutedCount = 0;
+        while (std::optional<JobFunction> l_Function = m_MainThreadQueue.Pop())
+        {
+            (*l_Function)();
+            ++l_ExecutedCount;
+        }
+
+        return l_ExecutedCount;
+    }
+
+    int32_t JobSystem::GetCurrentSlotIndex() const
+    {
+        if (t_CurrentJobSystem == this)
+        {
+            return t_CurrentSlotIndex;
+        }
+
+        return std::this_thread::get_id() == m_OwnerThreadId ? 0 : -1;
+    }
+
+    JobSystemStats JobSystem::GetStats() const
+    {
+        JobSystemStats l_Stats;
+        l_Stats.ExecutedPerSlot.reserve(m_Slots.size());
+        l_Stats.StealsPerSlot.reserve(m_Slots.size());
+
+        for (const std::unique_ptr<Slot>& it_Slot : m_Slots)
+        {
+            const uint64_t l_Executed = it_Slot->ExecutedCount.load(std::memory_order_relaxed);
+            const uint64_t l_Steals = it_Slot->StealCount.load(std::memory_order_relaxed);
+
+            l_Stats.ExecutedJobCount += l_Executed;
+            l_Stats.StealAttemptCount += it_Slot->StealAttemptCount.load(std::memory_order_relaxed);
+            l_Stats.StealCount += l_Steals;
+            l_Stats.ExecutedPerSlot.push_back(l_Executed);
+            l_Stats.StealsPerSlot.push_back(l_Steals);
+        }
+
+        return l_Stats;
+    }
+
+    void JobSystem::ResetStats()
+    {
+        for (std::unique_ptr<Slot>& it_Slot : m_Slots)
+        {
+            it_Slot->ExecutedCount.store(0, std::memory_order_relaxed);
+            it_Slot->StealAttemptCount.store(0, std::memory_order_relaxed);
+            it_Slot->StealCount.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    void JobSystem::WorkerMain(uint32_t slotIndex)
+    {
+        t_CurrentJobSystem = this;
+        t_CurrentSlotIndex = static_cast<int32_t>(slotIndex);
+        ENGINE_PROFILE_THREAD("Job Worker " + std::to_string(slotIndex));
+
+        uint32_t l_IdleRounds = 0;
+        while (!m_IsShuttingDown.load(std::memory_order_acquire))
+        {
+            Job* l_Job = FindJob(static_cast<int32_t>(slotIndex));
+            if (l_Job != nullptr)
+            {
+                Execute(l_Job, static_cast<int32_t>(slotIndex));
+                l_IdleRounds = 0;
+
+                continue;
+            }
+
+            if (++l_IdleRounds < s_IdleSpinCount)
+            {
+                std::this_thread::yield();
+
+                continue;
+            }
+
+            // Nothing to do for a while: sleep until a submission bumps the queued count.
+            std::unique_lock<std::mutex> l_Lock(m_SleepMutex);
+            m_SleepingWorkerCount.fetch_add(1, std::memory_order_seq_cst);
+            m_SleepCondition.wait(l_Lock, [this]()
+                {
+                    return m_QueuedJobCount.load(std::memory_order_seq_cst) > 0 || m_IsShuttingDown.load(std::memory_order_seq_cst);
+                });
+            m_SleepingWorkerCount.fetch_sub(1, std::memory_order_seq_cst);
+            l_IdleRounds = 0;
+        }
+
+        t_CurrentJobSystem = nullptr;
+        t_CurrentSlotIndex = -1;
+    }
+
+    void JobSystem::Schedule(Job* job)
+    {
+        const int32_t l_SlotIndex = GetCurrentSlotIndex();
+
+        bool l_IsQueued = l_SlotIndex >= 0 && m_Slots[l_SlotIndex]->Deque.Push(job);
+        if (!l_IsQueued)
+        {
+            // Foreign threads and overflowing deques share one locked queue; both are rare.
+            std::lock_guard<std::mutex> l_Lock(m_InjectionMutex);
+            m_InjectionQueue.push_back(job);
+            m_InjectionCount.fetch_add(1, std::memory_order_release);
+        }
+
+        m_QueuedJobCount.fetch_add(1, std::memory_order_seq_cst);
+
+        // Pairs with the sleeping check in WorkerMain: one side always observes the other's increment.
+        if (m_SleepingWorkerCount.load(std::memory_order_seq_cst) > 0)
+        {
+            {
+                std::lock_guard<std::mutex> l_Lock(m_SleepMutex);
+            }
+            m_SleepCondition.notify_one();
+        }
+    }
+
+    Job* JobSystem::FindJob(int32_t slotIndex)
+    {
+        Slot& l_Slot = *m_Slots[slotIndex];
+
+        Job* l_Job = l_Slot.Deque.Pop();
+        if (l_Job == nullptr && m_InjectionCount.load(std::memory_order_acquire) > 0)
+        {
+            std::lock_guard<std::mutex> l_Lock(m_InjectionMutex);
+            if (!m_InjectionQueue.empty())
+            {
+                l_Job = m_InjectionQueue.front();
+                m_InjectionQueue.pop_front();
+                m_InjectionCount.fetch_sub(1, std::memory_order_release);
+            }
+        }
+
+        if (l_Job == nullptr && m_Slots.size() > 1)
+        {
+            // Start at a random victim so thieves spread out instead of all hammering slot 0.
+            const uint32_t l_SlotCount = static_cast<uint32_t>(m_Slots.size());
+            const uint32_t l_Start = NextRandom(l_Slot.RandomState) % l_SlotCount;
+            for (uint32_t i = 0; i < l_SlotCount && l_Job == nullptr; ++i)
+            {
+                const uint32_t l_Victim = (l_Start + i) % l_SlotCount;
+                if (l_Victim == static_cast<uint32_t>(slotIndex))
+                {
+                    continue;
+                }
+
+                l_Slot.StealAttemptCount.fetch_add(1, std::memory_order_relaxed);
+                l_Job = m_Slots[l_Victim]->Deque.Steal();
+                if (l_Job != nullptr)
+                {
+                    l_Slot.StealCount.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        if (l_Job != nullptr)
+        {
+            m_QueuedJobCount.fetch_sub(1, std::memory_order_seq_cst);
+        }
+
+        return l_Job;
+    }
+
+    void JobSystem::Execute(Job* job, int32_t slotIndex)
+    {
+        {
+            ENGINE_PROFILE_SCOPE("Job");
+            job->Function();
+        }
+
+        if (job->Counter != nullptr)
+        {
+            CompleteCounter(*job->Counter);
+        }
+
+        delete job;
+
+        m_Slots[slotIndex]->ExecutedCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void JobSystem::CompleteCounter(JobCounter& counter)
+    {
+        // Announce ourselves before decrementing so IsComplete stays false until we stop touching the counter.
+        counter.m_CompletingCount.fetch_add(1, std::memory_order_relaxed);
+
+        std::vector<Job*> l_Continuations;
+        if (counter.m_PendingCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            // The counter just reached zero: release every job that was waiting on it.
+            std::lock_guard<std::mutex> l_Lock(counter.m_ContinuationMutex);
+            l_Continuations.swap(counter.m_Continuations);
+        }
+
+        // Last access: a waiter may destroy the counter as soon as this lands.
+        counter.m_CompletingCount.fetch_sub(1, std::memory_order_release);
+
+        for (Job* it_Job : l_Continuations)
+        {
+            Schedule(it_Job);
+        }
+    }
+}
\ No newline at end of file
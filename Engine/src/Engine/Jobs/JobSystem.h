@@ -0,0 +1,156 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/Jobs/MpscQueue.h"
+#include "Engine/Jobs/WorkStealingDeque.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Engine
+{
+    class JobCounter;
+
+    using JobFunction = std::function<void()>;
+
+    // A unit of work owned by the scheduler from submission until it has run.
+    struct Job
+    {
+        JobFunction Function;
+        JobCounter* Counter = nullptr;
+    };
+
+    // Tracks a group of in-flight jobs. Jobs attached to a counter increment it on submission and
+    // decrement it on completion; other jobs may be scheduled to start once it reaches zero.
+    // Once IsComplete returns true no worker touches the counter again, so it may live on the stack.
+    class ENGINE_API JobCounter
+    {
+    public:
+        JobCounter() = default;
+        JobCounter(const JobCounter&) = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+
+        bool IsComplete() const
+        {
+            // Pending is read first: seeing zero there makes every completer's earlier increment visible below.
+            return m_PendingCount.load(std::memory_order_acquire) == 0 && m_CompletingCount.load(std::memory_order_acquire) == 0;
+        }
+
+        uint32_t GetPendingCount() const { return m_PendingCount.load(std::memory_order_acquire); }
+
+    private:
+        friend class JobSystem;
+
+        std::atomic<uint32_t> m_PendingCount{ 0 };
+
+        // Threads still inside CompleteCounter; they may touch the counter after the pending count hits zero.
+        std::atomic<uint32_t> m_CompletingCount{ 0 };
+
+        // Jobs waiting for this counter; guarded by a mutex because continuations are rare compared to jobs.
+        std::mutex m_ContinuationMutex;
+        std::vector<Job*> m_Continuations;
+    };
+
+    // Aggregated counters describing scheduler behaviour since the last ResetStats call.
+    struct JobSystemStats
+    {
+        uint64_t ExecutedJobCount = 0;
+        uint64_t StealAttemptCount = 0;
+        uint64_t StealCount = 0;
+
+        // Per slot (index 0 is the owning thread, 1..N are workers).
+        std::vector<uint64_t> ExecutedPerSlot;
+        std::vector<uint64_t> StealsPerSlot;
+    };
+
+    // Work-stealing job scheduler. The constructing thread becomes slot 0 and can help execute jobs
+    // while it waits; every worker thread owns a lock-free deque and steals from the others when idle.
+    class ENGINE_API JobSystem
+    {
+    public:
+        // A worker count of zero uses one worker per hardware thread minus the owning thread.
+        explicit JobSystem(uint32_t workerCount = 0);
+
+        // Joins the workers, then runs every job still queued on the calling thread, so each counter still
+        // completes and its continuations run. Anything those jobs capture must outlive the system.
+        ~JobSystem();
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        // Queue a job; the optional counter is incremented now and decremented once the job finishes.
+        void Submit(JobFunction function, JobCounter* counter = nullptr);
+
+        // Queue a job that only becomes runnable once the dependency counter reaches zero.
+        void SubmitAfter(JobCounter& dependency, JobFunction function, JobCounter* counter = nullptr);
+
+        // Queue a job that only becomes runnable once every dependency counter reaches zero.
+        void SubmitAfterAll(const std::vector<JobCounter*>& dependencies, JobFunction function, JobCounter* counter = nullptr);
+
+        // Split [0, count) into batches of batchSize and run function(begin, end) for each batch in parallel.
+        void ParallelFor(uint32_t count, uint32_t batchSize, const std::function<void(uint32_t, uint32_t)>& function, JobCounter* counter);
+
+        // Block until the counter reaches zero, executing queued jobs on this thread in the meantime.
+        void WaitForCounter(JobCounter& counter);
+
+        // Queue work for the owning thread from any thread; it runs during the next DrainMainThreadQueue.
+        void PostToMainThread(JobFunction function);
+
+        // Owning thread only. Runs everything posted so far and returns how many functions executed.
+        uint32_t DrainMainThreadQueue();
+
+        // Background worker threads, excluding the owning thread.
+        uint32_t GetWorkerCount() const { return static_cast<uint32_t>(m_Workers.size()); }
+
+        // Slot index of the calling thread in this system, or -1 for threads the system does not own.
+        int32_t GetCurrentSlotIndex() const;
+
+        JobSystemStats GetStats() const;
+        void ResetStats();
+
+    private:
+        // Per-thread scheduling state, padded so neighbouring slots never share a cache line.
+        struct alignas(64) Slot
+        {
+            WorkStealingDeque<Job*> Deque{ 4096 };
+            std::atomic<uint64_t> ExecutedCount{ 0 };
+            std::atomic<uint64_t> StealAttemptCount{ 0 };
+            std::atomic<uint64_t> StealCount{ 0 };
+            uint32_t RandomState = 0;
+        };
+
+        void WorkerMain(uint32_t slotIndex);
+
+        void Schedule(Job* job);
+        Job* FindJob(int32_t slotIndex);
+        void Execute(Job* job, int32_t slotIndex);
+        void CompleteCounter(JobCounter& counter);
+
+    private:
+        std::vector<std::unique_ptr<Slot>> m_Slots;
+        std::vector<std::thread> m_Workers;
+        std::thread::id m_OwnerThreadId;
+
+        // Fallback queue for submissions from foreign threads or when a deque is full.
+        std::mutex m_InjectionMutex;
+        std::deque<Job*> m_InjectionQueue;
+        std::atomic<uint32_t> m_InjectionCount{ 0 };
+
+        // Lock-free completion queue consumed by the owning thread once per frame.
+        MpscQueue<JobFunction> m_MainThreadQueue;
+
+        // Sleep/wake bookkeeping so idle workers do not spin forever.
+        std::mutex m_SleepMutex;
+        std::condition_variable m_SleepCondition;
+        std::atomic<uint32_t> m_QueuedJobCount{ 0 };
+        std::atomic<uint32_t> m_SleepingWorkerCount{ 0 };
+        std::atomic<bool> m_IsShuttingDown{ false };
+    };
+}
\ No newline at end of file
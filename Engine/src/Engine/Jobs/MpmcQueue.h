@@ -0,0 +1,115 @@
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace Engine
+{
+    // Bounded multi-producer multi-consumer ring (Vyukov). Each cell carries a sequence number that tells
+    // producers and consumers whose turn it is, so neither side takes a lock; a full or empty queue is
+    // reported instead of waited on. T must be default constructible and assignable.
+    template<typename T>
+    class MpmcQueue
+    {
+    public:
+        // Capacity is rounded up to a power of two.
+        explicit MpmcQueue(uint32_t capacity)
+            : m_Mask(std::bit_ceil(capacity < 2 ? 2u : capacity) - 1), m_Cells(std::make_unique<Cell[]>(size_t{ m_Mask } + 1))
+        {
+            for (size_t i = 0; i <= m_Mask; ++i)
+            {
+                m_Cells[i].Sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        MpmcQueue(const MpmcQueue&) = delete;
+        MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+        // Returns false without side effects when the queue is full.
+        template<typename U>
+        bool TryPush(U&& value)
+        {
+            size_t l_Position = m_EnqueuePosition.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                Cell& l_Cell = m_Cells[l_Position & m_Mask];
+                const size_t l_Sequence = l_Cell.Sequence.load(std::memory_order_acquire);
+                const intptr_t l_Difference = static_cast<intptr_t>(l_Sequence) - static_cast<intptr_t>(l_Position);
+                if (l_Difference == 0)
+                {
+                    if (m_EnqueuePosition.compare_exchange_weak(l_Position, l_Position + 1, std::memory_order_relaxed))
+                    {
+                        l_Cell.Value = std::forward<U>(value);
+                        l_Cell.Sequence.store(l_Position + 1, std::memory_order_release);
+
+                        return true;
+                    }
+                }
+                else if (l_Difference < 0)
+                {
+                    // The consumer has not released this cell from the previous lap yet.
+                    return false;
+                }
+                else
+                {
+                    l_Position = m_EnqueuePosition.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        // Returns false when the queue is empty.
+        bool TryPop(T& value)
+        {
+            size_t l_Position = m_DequeuePosition.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                Cell& l_Cell = m_Cells[l_Position & m_Mask];
+                const size_t l_Sequence = l_Cell.Sequence.load(std::memory_order_acquire);
+                const intptr_t l_Difference = static_cast<intptr_t>(l_Sequence) - static_cast<intptr_t>(l_Position + 1);
+                if (l_Difference == 0)
+                {
+                    if (m_DequeuePosition.compare_exchange_weak(l_Position, l_Position + 1, std::memory_order_relaxed))
+                    {
+                        value = std::move(l_Cell.Value);
+                        l_Cell.Sequence.store(l_Position + m_Mask + 1, std::memory_order_release);
+
+                        return true;
+                    }
+                }
+                else if (l_Difference < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    l_Position = m_DequeuePosition.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        uint32_t GetCapacity() const { return static_cast<uint32_t>(m_Mask + 1); }
+
+        // Total successful pushes and pops so far; with concurrent callers these are only snapshots.
+        uint64_t GetPushCount() const { return m_EnqueuePosition.load(std::memory_order_acquire); }
+        uint64_t GetPopCount() const { return m_DequeuePosition.load(std::memory_order_acquire); }
+
+    private:
+        struct Cell
+        {
+            std::atomic<size_t> Sequence{ 0 };
+            T Value{};
+        };
+
+        const size_t m_Mask;
+        std::unique_ptr<Cell[]> m_Cells;
+
+        // Producers and consumers hammer different counters, so each gets its own cache line.
+        alignas(64) std::atomic<size_t> m_EnqueuePosition{ 0 };
+        alignas(64) std::atomic<size_t> m_DequeuePosition{ 0 };
+    };
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <utility>
+
+namespace Engine
+{
+    // Unbounded multi-producer single-consumer queue (Vyukov). Push is wait-free for producers;
+    // only the single consumer thread may call Pop or IsEmpty.
+    template<typename T>
+    class MpscQueue
+    {
+    public:
+        MpscQueue() : m_Head(&m_Stub), m_Tail(&m_Stub)
+        {
+
+        }
+
+        ~MpscQueue()
+        {
+            while (Pop().has_value())
+            {
+
+            }
+        }
+
+        MpscQueue(const MpscQueue&) = delete;
+        MpscQueue& operator=(const MpscQueue&) = delete;
+
+        void Push(T value)
+        {
+            Node* l_Node = new Node(std::move(value));
+            Node* l_Previous = m_Head.exchange(l_Node, std::memory_order_acq_rel);
+            l_Previous->Next.store(l_Node, std::memory_order_release);
+        }
+
+        std::optional<T> Pop()
+        {
+            Node* l_Tail = m_Tail;
+            Node* l_Next = l_Tail->Next.load(std::memory_order_acquire);
+
+            if (l_Tail == &m_Stub)
+            {
+                if (l_Next == nullptr)
+                {
+                    return std::nullopt;
+                }
+
+                // Skip over the stub; it is re-inserted below once the queue drains to one element.
+                m_Tail = l_Next;
+                l_Tail = l_Next;
+                l_Next = l_Next->Next.load(std::memory_order_acquire);
+            }
+
+            if (l_Next != nullptr)
+            {
+                m_Tail = l_Next;
+
+                return Take(l_Tail);
+            }
+
+            if (l_Tail != m_Head.load(std::memory_order_acquire))
+            {
+                // A producer has swapped the head but not linked its node yet; try again later.
+                return std::nullopt;
+            }
+
+            Push(&m_Stub);
+
+            l_Next = l_Tail->Next.load(std::memory_order_acquire);
+            if (l_Next != nullptr)
+            {
+                m_Tail = l_Next;
+
+                return Take(l_Tail);
+            }
+
+            return std::nullopt;
+        }
+
+    private:
+        struct Node
+        {
+            Node() = default;
+            explicit Node(T&& value) : Value(std::move(value))
+            {
+
+            }
+
+            std::atomic<Node*> Next{ nullptr };
+            std::optional<T> Value;
+        };
+
+        void Push(Node* node)
+        {
+            node->Next.store(nullptr, std::memory_order_relaxed);
+            Node* l_Previous = m_Head.exchange(node, std::memory_order_acq_rel);
+            l_Previous->Next.store(node, std::memory_order_release);
+        }
+
+        static std::optional<T> Take(Node* node)
+        {
+            std::optional<T> l_Value = std::move(node->Value);
+            delete node;
+
+            return l_Value;
+        }
+
+    private:
+        Node m_Stub;
+        std::atomic<Node*> m_Head;
+        Node* m_Tail;
+    };
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace Engine
+{
+    // Fixed-capacity Chase-Lev deque. The owning thread pushes and pops at the bottom,
+    // any other thread may steal from the top. Only pointer payloads are supported so
+    // every slot can be read and written atomically.
+    template<typename T>
+    class WorkStealingDeque
+    {
+        static_assert(std::is_pointer_v<T>, "WorkStealingDeque stores pointers only");
+
+    public:
+        explicit WorkStealingDeque(size_t capacity = 4096)
+        {
+            // Round up to a power of two so indices can be masked instead of divided.
+            size_t l_Capacity = 1;
+            while (l_Capacity < capacity)
+            {
+                l_Capacity <<= 1;
+            }
+
+            m_Capacity = static_cast<int64_t>(l_Capacity);
+            m_Mask = m_Capacity - 1;
+            m_Buffer = std::make_unique<std::atomic<T>[]>(l_Capacity);
+        }
+
+        WorkStealingDeque(const WorkStealingDeque&) = delete;
+        WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+        // Owner only. Returns false when the deque is full so the caller can fall back to a shared queue.
+        bool Push(T item)
+        {
+            const int64_t l_Bottom = m_Bottom.load(std::memory_order_relaxed);
+            const int64_t l_Top = m_Top.load(std::memory_order_acquire);
+            if (l_Bottom - l_Top >= m_Capacity)
+            {
+                return false;
+            }
+
+            m_Buffer[l_Bottom & m_Mask].store(item, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            m_Bottom.store(l_Bottom + 1, std::memory_order_relaxed);
+
+            return true;
+        }
+
+        // Owner only. Pops the most recently pushed item (LIFO keeps caches warm) or returns nullptr.
+        T Pop()
+        {
+            const int64_t l_Bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+            m_Bottom.store(l_Bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t l_Top = m_Top.load(std::memory_order_relaxed);
+
+            T l_Item = nullptr;
+            if (l_Top <= l_Bottom)
+            {
+                l_Item = m_Buffer[l_Bottom & m_Mask].load(std::memory_order_relaxed);
+                if (l_Top == l_Bottom)
+                {
+                    // Last item: race thieves for it through the top index.
+                    if (!m_Top.compare_exchange_strong(l_Top, l_Top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                    {
+                        l_Item = nullptr;
+                    }
+
+                    m_Bottom.store(l_Bottom + 1, std::memory_order_relaxed);
+                }
+            }
+            else
+            {
+                m_Bottom.store(l_Bottom + 1, std::memory_order_relaxed);
+            }
+
+            return l_Item;
+        }
+
+        // Any thread. Takes the oldest item or returns nullptr when empty or when another thief won the race.
+        T Steal()
+        {
+            int64_t l_Top = m_Top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const int64_t l_Bottom = m_Bottom.load(std::memory_order_acquire);
+            if (l_Top >= l_Bottom)
+            {
+                return nullptr;
+            }
+
+            T l_Item = m_Buffer[l_Top & m_Mask].load(std::memory_order_relaxed);
+            if (!m_Top.compare_exchange_strong(l_Top, l_Top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                return nullptr;
+            }
+
+            return l_Item;
+        }
+
+        // Approximate size; only meaningful as a hint because other threads may be mutating the deque.
+        size_t GetApproximateSize() const
+        {
+            const int64_t l_Bottom = m_Bottom.load(std::memory_order_relaxed);
+            const int64_t l_Top = m_Top.load(std::memory_order_relaxed);
+
+            return l_Bottom > l_Top ? static_cast<size_t>(l_Bottom - l_Top) : 0;
+        }
+
+    private:
+        // Top and bottom live on separate cache lines so thieves do not false-share with the owner.
+        alignas(64) std::atomic<int64_t> m_Top{ 0 };
+        alignas(64) std::atomic<int64_t> m_Bottom{ 0 };
+        alignas(64) std::unique_ptr<std::atomic<T>[]> m_Buffer;
+        int64_t m_Capacity = 0;
+        int64_t m_Mask = 0;
+    };
+}
\ No newline at end of file
@@ -1,10 +1,13 @@
 #pragma once
 
 #include "Engine/Core/Core.h"
+#include "Engine/Core/Timestep.h"
+#include "Engine/Events/EventQueue.h"
 
 namespace Engine
 {
-    class Event;
+    class AssetManager;
+    class JobSystem;
 
     // Interface that allows the application to communicate with a gameplay-specific layer.
     class ENGINE_API Layer
@@ -13,9 +16,41 @@ namespace Engine
         virtual ~Layer() = default;
 
         virtual bool Initialize() = 0;
-        virtual void Update() = 0;
-        virtual void Render() = 0;
+
+        // Called zero or more times per frame at the application's fixed tick rate.
+        virtual void Update(const TickTiming& tickTiming) = 0;
+
+        // Called once per frame; use InterpolationAlpha to blend between the last two simulated states.
+        virtual void Render(const FrameTiming& frameTiming) = 0;
+
         virtual void OnEvent(const Event& event) = 0;
+
+        // Receives every event polled this frame in one call. Override to iterate records directly, e.g. one
+        // EventType bucket at a time; the default rebuilds each record as an Event and forwards it to OnEvent.
+        virtual void OnEvents(const EventQueue& events)
+        {
+            events.ForEach([this](const EventRecord& record)
+                {
+                    DispatchAsEvent(record, [this](const Event& event)
+                        {
+                            OnEvent(event);
+                        });
+                });
+        }
+
         virtual void Shutdown() = 0;
+
+    protected:
+        // Engine-owned scheduler for background work; valid from Initialize until Shutdown returns.
+        JobSystem& GetJobSystem() const { return *m_JobSystem; }
+
+        // Engine-owned asset cache; same lifetime as the job system.
+        AssetManager& GetAssetManager() const { return *m_AssetManager; }
+
+    private:
+        friend class Application;
+
+        JobSystem* m_JobSystem = nullptr;
+        AssetManager* m_AssetManager = nullptr;
     };
 }
\ No newline at end of file
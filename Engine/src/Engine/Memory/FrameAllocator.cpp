@@ -0,0 +1,78 @@
+#include "Engine/Memory/FrameAllocator.h"
+#include "Engine/Core/Log.h"
+
+#include <algorithm>
+
+namespace Engine
+{
+    // Static member definitions
+    std::unique_ptr<LinearArena> FrameAllocator::s_Arena{};
+    std::unique_ptr<ArenaMemoryResource> FrameAllocator::s_Resource{};
+    FrameMemoryStats FrameAllocator::s_Stats{};
+
+    void FrameAllocator::Initialize(size_t capacity)
+    {
+        s_Arena = std::make_unique<LinearArena>(capacity);
+        s_Resource = std::make_unique<ArenaMemoryResource>(*s_Arena);
+        s_Stats = FrameMemoryStats{};
+        s_Stats.CapacityBytes = s_Arena->GetCapacity();
+
+        ENGINE_TRACE("Frame allocator initialized with {} bytes", capacity);
+    }
+
+    void FrameAllocator::Shutdown()
+    {
+        if (s_Arena == nullptr)
+        {
+            return;
+        }
+
+        ENGINE_INFO("Frame allocator peak usage: {} bytes (capacity {} bytes, {} overflow frames)",
+            s_Stats.PeakFrameBytes, s_Stats.CapacityBytes, s_Stats.OverflowFrameCount);
+
+        s_Resource.reset();
+        s_Arena.reset();
+    }
+
+    void FrameAllocator::BeginFrame()
+    {
+        if (s_Arena == nullptr)
+        {
+            return;
+        }
+
+        s_Stats.LastFrameBytes = s_Arena->GetHighWaterBytes();
+        s_Stats.PeakFrameBytes = std::max(s_Stats.PeakFrameBytes, s_Stats.LastFrameBytes);
+
+        const bool l_HasOverflowed = s_Arena->GetBlockCount() > 1;
+        s_Arena->Reset();
+
+        if (l_HasOverflowed)
+        {
+            // Spikes are worth surfacing: they mean a frame allocated more than any frame before it.
+            ++s_Stats.OverflowFrameCount;
+            s_Stats.CapacityBytes = s_Arena->GetCapacity();
+            ENGINE_WARN("Frame arena grew to {} bytes after a {} byte frame", s_Stats.CapacityBytes, s_Stats.LastFrameBytes);
+        }
+    }
+
+    void* FrameAllocator::Allocate(size_t size, size_t alignment)
+    {
+        return s_Arena->Allocate(size, alignment);
+    }
+
+    std::pmr::memory_resource* FrameAllocator::GetMemoryResource()
+    {
+        return s_Resource != nullptr ? s_Resource.get() : std::pmr::new_delete_resource();
+    }
+
+    size_t FrameAllocator::GetCurrentFrameBytes()
+    {
+        return s_Arena != nullptr ? s_Arena->GetUsedBytes() : 0;
+    }
+
+    size_t FrameAllocator::GetCurrentFrameHighWaterBytes()
+    {
+        return s_Arena != nullptr ? s_Arena->GetHighWaterBytes() : 0;
+    }
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/Memory/LinearArena.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+namespace Engine
+{
+    // Allocation telemetry for the frame arena.
+    struct FrameMemoryStats
+    {
+        // Bytes used by the most recently completed frame.
+        size_t LastFrameBytes = 0;
+
+        // Largest single-frame usage since Initialize.
+        size_t PeakFrameBytes = 0;
+
+        // Current arena capacity; grows when a frame spills past it.
+        size_t CapacityBytes = 0;
+
+        // Frames whose allocations did not fit in one block and forced the arena to grow.
+        uint64_t OverflowFrameCount = 0;
+    };
+
+    // Main-thread arena whose contents live until the start of the next frame.
+    // Worker threads must use ScratchScope instead.
+    class ENGINE_API FrameAllocator
+    {
+    public:
+        static void Initialize(size_t capacity);
+        static void Shutdown();
+
+        // Record the finished frame's usage and release all frame allocations.
+        static void BeginFrame();
+
+        static void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+        template<typename T>
+        static T* AllocateArray(size_t count)
+        {
+            return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+        }
+
+        // Memory resource for pmr containers that only need to live for the current frame.
+        // Falls back to the heap before Initialize, so tools and benchmarks without an Application still work.
+        static std::pmr::memory_resource* GetMemoryResource();
+
+        static const FrameMemoryStats& GetStats() { return s_Stats; }
+
+        // Bytes allocated so far in the current frame.
+        static size_t GetCurrentFrameBytes();
+
+        // Largest usage reached so far in the current frame; what BeginFrame will record as LastFrameBytes.
+        static size_t GetCurrentFrameHighWaterBytes();
+
+    private:
+        static std::unique_ptr<LinearArena> s_Arena;
+        static std::unique_ptr<ArenaMemoryResource> s_Resource;
+        static FrameMemoryStats s_Stats;
+    };
+
+    // Vector whose storage lives in the frame arena; only valid until the next FrameAllocator::BeginFrame.
+    template<typename T>
+    std::pmr::vector<T> MakeFrameVector(size_t reserve = 0)
+    {
+        std::pmr::vector<T> l_Vector(FrameAllocator::GetMemoryResource());
+        l_Vector.reserve(reserve);
+
+        return l_Vector;
+    }
+}
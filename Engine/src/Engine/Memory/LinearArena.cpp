@@ -0,0 +1,121 @@
+#include "Engine/Memory/LinearArena.h"
+
+#include <algorithm>
+
+namespace Engine
+{
+    namespace
+    {
+        size_t AlignUp(size_t value, size_t alignment)
+        {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+
+        // Scratch arenas start small; they grow on demand and keep their peak size for the thread's lifetime.
+        constexpr size_t s_ScratchArenaCapacity = 256 * 1024;
+    }
+
+    LinearArena::LinearArena(size_t initialCapacity)
+    {
+        AddBlock(std::max<size_t>(initialCapacity, 4096));
+    }
+
+    LinearArena::~LinearArena() = default;
+
+    void* LinearArena::Allocate(size_t size, size_t alignment)
+    {
+        alignment = std::max<size_t>(alignment, 1);
+
+        while (true)
+        {
+            Block& l_Block = m_Blocks[m_CurrentBlock];
+            const uintptr_t l_Base = reinterpret_cast<uintptr_t>(l_Block.Memory.get());
+            const size_t l_AlignedOffset = AlignUp(l_Base + m_Offset, alignment) - l_Base;
+
+            if (l_AlignedOffset + size <= l_Block.Size)
+            {
+                m_UsedBytes += (l_AlignedOffset - m_Offset) + size;
+                m_HighWaterBytes = std::max(m_HighWaterBytes, m_UsedBytes);
+                m_Offset = l_AlignedOffset + size;
+
+                return l_Block.Memory.get() + l_AlignedOffset;
+            }
+
+            // Move on to the next block, reusing one kept from an earlier rollback when it exists.
+            // Account for the abandoned tail first because AddBlock may reallocate m_Blocks.
+            const size_t l_BlockSize = l_Block.Size;
+            m_UsedBytes += l_BlockSize - m_Offset;
+            if (m_CurrentBlock + 1 >= m_Blocks.size())
+            {
+                AddBlock(std::max(size + alignment, l_BlockSize * 2));
+            }
+
+            ++m_CurrentBlock;
+            m_Offset = 0;
+        }
+    }
+
+    LinearArena::Marker LinearArena::GetMarker() const
+    {
+        return { m_CurrentBlock, m_Offset, m_UsedBytes };
+    }
+
+    void LinearArena::ResetToMarker(const Marker& marker)
+    {
+        m_CurrentBlock = marker.BlockIndex;
+        m_Offset = marker.Offset;
+        m_UsedBytes = marker.UsedBytes;
+    }
+
+    void LinearArena::Reset()
+    {
+        if (m_Blocks.size() > 1)
+        {
+            const size_t l_Capacity = GetCapacity();
+            m_Blocks.clear();
+            AddBlock(l_Capacity);
+        }
+
+        m_CurrentBlock = 0;
+        m_Offset = 0;
+        m_UsedBytes = 0;
+        m_HighWaterBytes = 0;
+    }
+
+    size_t LinearArena::GetCapacity() const
+    {
+        size_t l_Capacity = 0;
+        for (const Block& it_Block : m_Blocks)
+        {
+            l_Capacity += it_Block.Size;
+        }
+
+        return l_Capacity;
+    }
+
+    void LinearArena::AddBlock(size_t minimumSize)
+    {
+        Block l_Block;
+        l_Block.Size = minimumSize;
+        l_Block.Memory = std::make_unique_for_overwrite<std::byte[]>(minimumSize);
+        m_Blocks.push_back(std::move(l_Block));
+    }
+
+    LinearArena& GetThreadScratchArena()
+    {
+        thread_local LinearArena t_ScratchArena(s_ScratchArenaCapacity);
+
+        return t_ScratchArena;
+    }
+
+    ScratchScope::ScratchScope()
+        : m_Arena(&GetThreadScratchArena()), m_Marker(m_Arena->GetMarker()), m_Resource(*m_Arena)
+    {
+
+    }
+
+    ScratchScope::~ScratchScope()
+    {
+        m_Arena->ResetToMarker(m_Marker);
+    }
+}
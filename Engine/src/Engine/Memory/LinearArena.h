@@ -0,0 +1,124 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Engine
+{
+    // Bump allocator over a chain of blocks. Individual frees are no-ops; memory is reclaimed all at
+    // once with Reset or rolled back to a marker. Not thread-safe: each thread owns its own arena.
+    class ENGINE_API LinearArena
+    {
+    public:
+        // Position inside the arena that ResetToMarker can roll back to.
+        struct Marker
+        {
+            size_t BlockIndex = 0;
+            size_t Offset = 0;
+            size_t UsedBytes = 0;
+        };
+
+        explicit LinearArena(size_t initialCapacity = 1024 * 1024);
+        ~LinearArena();
+
+        LinearArena(const LinearArena&) = delete;
+        LinearArena& operator=(const LinearArena&) = delete;
+
+        void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+        template<typename T>
+        T* AllocateArray(size_t count)
+        {
+            return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+        }
+
+        // Destructors never run for arena objects, so only trivially destructible types are allowed.
+        template<typename T, typename... Args>
+        T* New(Args&&... arguments)
+        {
+            static_assert(std::is_trivially_destructible_v<T>, "Arena objects are never destroyed");
+
+            return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(arguments)...);
+        }
+
+        Marker GetMarker() const;
+        void ResetToMarker(const Marker& marker);
+
+        // Release everything. If the previous cycle spilled into extra blocks they are merged into
+        // a single block large enough for that cycle, so steady-state frames never chain.
+        void Reset();
+
+        // Bytes handed out since the last Reset (including alignment padding).
+        size_t GetUsedBytes() const { return m_UsedBytes; }
+
+        // Largest GetUsedBytes value observed since the last Reset.
+        size_t GetHighWaterBytes() const { return m_HighWaterBytes; }
+
+        size_t GetCapacity() const;
+        size_t GetBlockCount() const { return m_Blocks.size(); }
+
+    private:
+        struct Block
+        {
+            std::unique_ptr<std::byte[]> Memory;
+            size_t Size = 0;
+        };
+
+        void AddBlock(size_t minimumSize);
+
+    private:
+        std::vector<Block> m_Blocks;
+        size_t m_CurrentBlock = 0;
+        size_t m_Offset = 0;
+        size_t m_UsedBytes = 0;
+        size_t m_HighWaterBytes = 0;
+    };
+
+    // Adapts a LinearArena to std::pmr so standard containers can opt into arena allocation.
+    class ENGINE_API ArenaMemoryResource : public std::pmr::memory_resource
+    {
+    public:
+        explicit ArenaMemoryResource(LinearArena& arena) : m_Arena(&arena)
+        {
+
+        }
+
+    private:
+        void* do_allocate(size_t bytes, size_t alignment) override { return m_Arena->Allocate(bytes, alignment); }
+        void do_deallocate(void*, size_t, size_t) override {}
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    private:
+        LinearArena* m_Arena;
+    };
+
+    // Per-thread scratch arena for temporary buffers inside jobs and helpers.
+    ENGINE_API LinearArena& GetThreadScratchArena();
+
+    // RAII scope over the calling thread's scratch arena; everything allocated inside is released on exit.
+    class ENGINE_API ScratchScope
+    {
+    public:
+        ScratchScope();
+        ~ScratchScope();
+
+        ScratchScope(const ScratchScope&) = delete;
+        ScratchScope& operator=(const ScratchScope&) = delete;
+
+        LinearArena& GetArena() { return *m_Arena; }
+        std::pmr::memory_resource* GetMemoryResource() { return &m_Resource; }
+
+    private:
+        LinearArena* m_Arena;
+        LinearArena::Marker m_Marker;
+        ArenaMemoryResource m_Resource;
+    };
+}
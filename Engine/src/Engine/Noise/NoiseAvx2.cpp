@@ -0,0 +1,81 @@
+#include "Engine/Noise/NoiseKernels.h"
+
+#if ENGINE_NOISE_X86
+
+#include <immintrin.h>
+
+// Compiled with AVX2 enabled (see Engine/CMakeLists.txt) and only called after a CPU check.
+// FMA stays disabled so results match the other backends bit for bit.
+namespace Engine::NoiseAvx2
+{
+    namespace
+    {
+        struct I
+        {
+            __m256i Value;
+
+            explicit I(__m256i value) : Value(value) {}
+            explicit I(int32_t value) : Value(_mm256_set1_epi32(value)) {}
+            static I LaneIndex() { return I(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)); }
+        };
+
+        struct F
+        {
+            static constexpr uint32_t Width = 8;
+
+            __m256 Value;
+
+            explicit F(__m256 value) : Value(value) {}
+            explicit F(float value) : Value(_mm256_set1_ps(value)) {}
+        };
+
+        inline I operator+(I a, I b) { return I(_mm256_add_epi32(a.Value, b.Value)); }
+        inline I operator-(I a, I b) { return I(_mm256_sub_epi32(a.Value, b.Value)); }
+        inline I operator*(I a, I b) { return I(_mm256_mullo_epi32(a.Value, b.Value)); }
+        inline I operator^(I a, I b) { return I(_mm256_xor_si256(a.Value, b.Value)); }
+        inline I operator&(I a, I b) { return I(_mm256_and_si256(a.Value, b.Value)); }
+        inline I operator|(I a, I b) { return I(_mm256_or_si256(a.Value, b.Value)); }
+        inline I operator~(I a) { return I(_mm256_xor_si256(a.Value, _mm256_set1_epi32(-1))); }
+        inline I operator<<(I a, int shift) { return I(_mm256_slli_epi32(a.Value, shift)); }
+        inline I operator>>(I a, int shift) { return I(_mm256_srli_epi32(a.Value, shift)); }
+        inline I operator<(I a, I b) { return I(_mm256_cmpgt_epi32(b.Value, a.Value)); }
+        inline I operator==(I a, I b) { return I(_mm256_cmpeq_epi32(a.Value, b.Value)); }
+
+        inline F operator+(F a, F b) { return F(_mm256_add_ps(a.Value, b.Value)); }
+        inline F operator-(F a, F b) { return F(_mm256_sub_ps(a.Value, b.Value)); }
+        inline F operator*(F a, F b) { return F(_mm256_mul_ps(a.Value, b.Value)); }
+
+        inline I CmpGt(F a, F b) { return I(_mm256_castps_si256(_mm256_cmp_ps(a.Value, b.Value, _CMP_GT_OQ))); }
+        inline F Max(F a, F b) { return F(_mm256_max_ps(a.Value, b.Value)); }
+        inline F Select(I mask, F a, F b) { return F(_mm256_blendv_ps(b.Value, a.Value, _mm256_castsi256_ps(mask.Value))); }
+        inline F ToFloat(I a) { return F(_mm256_cvtepi32_ps(a.Value)); }
+        inline F Abs(F a) { return F(_mm256_and_ps(a.Value, _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF)))); }
+
+        inline F FlipSign(F a, I signBits)
+        {
+            return F(_mm256_xor_ps(a.Value, _mm256_castsi256_ps(_mm256_and_si256(signBits.Value, _mm256_set1_epi32(static_cast<int32_t>(0x80000000u))))));
+        }
+
+        inline I FloorToInt(F a)
+        {
+            const __m256i l_Truncated = _mm256_cvttps_epi32(a.Value);
+            const __m256 l_RoundedUp = _mm256_cmp_ps(_mm256_cvtepi32_ps(l_Truncated), a.Value, _CMP_GT_OQ);
+
+            return I(_mm256_add_epi32(l_Truncated, _mm256_castps_si256(l_RoundedUp)));
+        }
+
+        inline void Store(float* out, F value) { _mm256_storeu_ps(out, value.Value); }
+    }
+
+    void GenerateGrid2D(const NoiseParameters& parameters, const NoiseGridRegion& region, float* out)
+    {
+        NoiseKernels::GenerateGrid2D<F, I>(parameters, region, out);
+    }
+
+    void GenerateGrid3D(const NoiseParameters& parameters, const NoiseGridRegion& region, float* out)
+    {
+        NoiseKernels::GenerateGrid3D<F, I>(parameters, region, out);
+    }
+}
+
+#endif
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Engine/Noise/NoiseGenerator.h"
+
+#include <cstdint>
+
+// SIMD backends only exist on x86; other architectures run the scalar kernels.
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define ENGINE_NOISE_X86 1
+#else
+    #define ENGINE_NOISE_X86 0
+#endif
+
+namespace Engine
+{
+    // Integer sample lattice handed to a backend. Positions are start + index * Stride on every axis.
+    struct NoiseGridRegion
+    {
+        int32_t StartX = 0;
+        int32_t StartY = 0;
+        int32_t StartZ = 0;
+        uint32_t SizeX = 0;
+        uint32_t SizeY = 1;
+        uint32_t SizeZ = 0;
+        int32_t Stride = 1;
+    };
+
+    // Each backend lives in its own translation unit compiled with that instruction set enabled.
+    namespace NoiseScalar
+    {
+        float Sample2D(const NoiseParameters& parameters, float x, float z);
+        float Sample3D(const NoiseParameters& parameters, float x, float y, float z);
+        void GenerateGrid2D(const NoiseParameters& parameters, const NoiseGridRegion& region, float* out);
+        void GenerateGrid3D(const NoiseParameters& parameters, const NoiseGridRegion& region, float* out);
+    }
+
+#if ENGINE_NOISE_X86
+    namespace NoiseSse2
+    {
+        void GenerateGrid2D(const NoiseParameters& parameters, const NoiseGridRegion& region, float* out);
+        void GenerateGrid3D(const NoiseParameters& parameters, const NoiseGridRegion& region, float* out);
+    }
+
+    namespace NoiseAvx2
+    {
+        void GenerateGrid2D(const NoiseParameters& parameters, const NoiseGridRegion& region, float* out);
+        void GenerateGrid3D(const NoiseParameters& parameters, const NoiseGridRegion& region, float* out);
+    }
+#endif
+}
@@ -0,0 +1,201 @@
+#include "Engine/Noise/NoiseGenerator.h"
+
+#include "Engine/Noise/NoiseBackends.h"
+
+#include <algorithm>
+
+#if ENGINE_NOISE_X86 && defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+namespace Engine
+{
+    namespace
+    {
+        // Seed offsets for the domain-warp fields so they are uncorrelated with the octaves.
+        constexpr uint32_t s_WarpSeedOffsets[3] = { 0x68E31DA4u, 0xB5297A4Du, 0x1B56C4E9u };
+
+        int32_t OffsetSeed(int32_t seed, uint32_t offset)
+        {
+            return static_cast<int32_t>(static_cast<uint32_t>(seed) + offset);
+        }
+
+        bool DetectAvx2()
+        {
+#if ENGINE_NOISE_X86 && defined(_MSC_VER)
+            int l_Registers[4] = {};
+            __cpuid(l_Registers, 0);
+            if (l_Registers[0] < 7)
+            {
+                return false;
+            }
+
+            // AVX needs both CPU support and the OS saving YMM state on context switches.
+            __cpuid(l_Registers, 1);
+            const bool l_HasOsSave = (l_Registers[2] & (1 << 27)) != 0;
+            const bool l_HasAvx = (l_Registers[2] & (1 << 28)) != 0;
+            if (!l_HasOsSave || !l_HasAvx || (_xgetbv(0) & 0x6) != 0x6)
+            {
+                return false;
+            }
+
+            __cpuidex(l_Registers, 7, 0);
+
+            return (l_Registers[1] & (1 << 5)) != 0;
+#elif ENGINE_NOISE_X86
+            // The GCC/Clang builtin also checks that the OS enabled YMM state.
+            __builtin_cpu_init();
+
+            return __builtin_cpu_supports("avx2");
+#else
+            return false;
+#endif
+        }
+
+        bool DetectSse2()
+        {
+#if ENGINE_NOISE_X86 && (defined(__x86_64__) || defined(_M_X64))
+            return true;
+#elif ENGINE_NOISE_X86 && defined(_MSC_VER)
+            int l_Registers[4] = {};
+            __cpuid(l_Registers, 1);
+
+            return (l_Registers[3] & (1 << 26)) != 0;
+#elif ENGINE_NOISE_X86
+            __builtin_cpu_init();
+
+            return __builtin_cpu_supports("sse2");
+#else
+            return false;
+#endif
+        }
+    }
+
+    NoiseGenerator::NoiseGenerator(const NoiseSettings& settings) : m_Settings(settings), m_Backend(GetBestBackend())
+    {
+        m_Parameters.Type = settings.Type;
+        m_Parameters.Fractal = settings.Fractal;
+        m_Parameters.OctaveCount = settings.Fractal == FractalType::None ? 1 : std::clamp<uint32_t>(settings.Octaves, 1, NoiseParameters::MaxOctaves);
+
+        // Per-octave values are computed once here so every backend reads the exact same floats.
+        float l_Frequency = settings.Frequency;
+        float l_Amplitude = 1.0f;
+        float l_AmplitudeSum = 0.0f;
+        for (uint32_t it_Octave = 0; it_Octave < m_Parameters.OctaveCount; ++it_Octave)
+        {
+            m_Parameters.OctaveSeeds[it_Octave] = OffsetSeed(settings.Seed, it_Octave);
+            m_Parameters.OctaveFrequencies[it_Octave] = l_Frequency;
+            m_Parameters.OctaveAmplitudes[it_Octave] = l_Amplitude;
+            l_AmplitudeSum += l_Amplitude;
+            l_Frequency *= settings.Lacunarity;
+            l_Amplitude *= settings.Gain;
+        }
+
+        m_Parameters.Normalization = l_AmplitudeSum > 0.0f ? 1.0f / l_AmplitudeSum : 1.0f;
+        m_Parameters.WarpAmplitude = settings.WarpAmplitude;
+        m_Parameters.WarpFrequency = settings.WarpFrequency;
+        for (uint32_t i = 0; i < 3; ++i)
+        {
+            m_Parameters.WarpSeeds[i] = OffsetSeed(settings.Seed, s_WarpSeedOffsets[i]);
+        }
+    }
+
+    float NoiseGenerator::Sample2D(float x, float z) const
+    {
+        return NoiseScalar::Sample2D(m_Parameters, x, z);
+    }
+
+    float NoiseGenerator::Sample3D(float x, float y, float z) const
+    {
+        return NoiseScalar::Sample3D(m_Parameters, x, y, z);
+    }
+
+    void NoiseGenerator::GenerateGrid2D(float* out, int32_t startX, int32_t startZ, uint32_t sizeX, uint32_t sizeZ, int32_t stride) const
+    {
+        NoiseGridRegion l_Region;
+        l_Region.StartX = startX;
+        l_Region.StartZ = startZ;
+        l_Region.SizeX = sizeX;
+        l_Region.SizeZ = sizeZ;
+        l_Region.Stride = stride;
+
+        switch (m_Backend)
+        {
+#if ENGINE_NOISE_X86
+            case NoiseBackend::Avx2: NoiseAvx2::GenerateGrid2D(m_Parameters, l_Region, out); break;
+            case NoiseBackend::Sse2: NoiseSse2::GenerateGrid2D(m_Parameters, l_Region, out); break;
+#endif
+            default: NoiseScalar::GenerateGrid2D(m_Parameters, l_Region, out); break;
+        }
+    }
+
+    void NoiseGenerator::GenerateGrid3D(float* out, int32_t startX, int32_t startY, int32_t startZ, uint32_t sizeX, uint32_t sizeY, uint32_t sizeZ,
+        int32_t stride) const
+    {
+        NoiseGridRegion l_Region;
+        l_Region.StartX = startX;
+        l_Region.StartY = startY;
+        l_Region.StartZ = startZ;
+        l_Region.SizeX = sizeX;
+        l_Region.SizeY = sizeY;
+        l_Region.SizeZ = sizeZ;
+        l_Region.Stride = stride;
+
+        switch (m_Backend)
+        {
+#if ENGINE_NOISE_X86
+            case NoiseBackend::Avx2: NoiseAvx2::GenerateGrid3D(m_Parameters, l_Region, out); break;
+            case NoiseBackend::Sse2: NoiseSse2::GenerateGrid3D(m_Parameters, l_Region, out); break;
+#endif
+            default: NoiseScalar::GenerateGrid3D(m_Parameters, l_Region, out); break;
+        }
+    }
+
+    bool NoiseGenerator::SetBackend(NoiseBackend backend)
+    {
+        if (!IsBackendSupported(backend))
+        {
+            return false;
+        }
+
+        m_Backend = backend;
+
+        return true;
+    }
+
+    bool NoiseGenerator::IsBackendSupported(NoiseBackend backend)
+    {
+        // CPU features cannot change while the process runs, so detect them once.
+        static const bool s_HasSse2 = DetectSse2();
+        static const bool s_HasAvx2 = DetectAvx2();
+
+        switch (backend)
+        {
+            case NoiseBackend::Scalar: return true;
+            case NoiseBackend::Sse2: return s_HasSse2;
+            case NoiseBackend::Avx2: return s_HasAvx2;
+            default: return false;
+        }
+    }
+
+    NoiseBackend NoiseGenerator::GetBestBackend()
+    {
+        if (IsBackendSupported(NoiseBackend::Avx2))
+        {
+            return NoiseBackend::Avx2;
+        }
+
+        return IsBackendSupported(NoiseBackend::Sse2) ? NoiseBackend::Sse2 : NoiseBackend::Scalar;
+    }
+
+    const char* NoiseGenerator::GetBackendName(NoiseBackend backend)
+    {
+        switch (backend)
+        {
+            case NoiseBackend::Scalar: return "scalar";
+            case NoiseBackend::Sse2: return "sse2";
+            case NoiseBackend::Avx2: return "avx2";
+            default: return "unknown";
+        }
+    }
+}
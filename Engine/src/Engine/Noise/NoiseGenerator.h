@@ -0,0 +1,100 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+
+#include <cstdint>
+
+namespace Engine
+{
+    enum class NoiseType : uint8_t
+    {
+        Perlin = 0,
+        Simplex
+    };
+
+    enum class FractalType : uint8_t
+    {
+        None = 0,   // Single octave.
+        FBm,        // Summed octaves.
+        Ridged      // Summed octaves of 1 - 2|n|, giving sharp crests.
+    };
+
+    // Instruction sets the noise kernels are compiled for. Every backend produces bit-identical results.
+    enum class NoiseBackend : uint8_t
+    {
+        Scalar = 0,
+        Sse2,
+        Avx2,
+        Count
+    };
+
+    struct NoiseSettings
+    {
+        NoiseType Type = NoiseType::Simplex;
+        FractalType Fractal = FractalType::FBm;
+        int32_t Seed = 1337;
+
+        // Frequency of the first octave in cycles per world unit.
+        float Frequency = 0.01f;
+
+        uint32_t Octaves = 4;
+        float Lacunarity = 2.0f;
+        float Gain = 0.5f;
+
+        // Offset the sample position by a low-frequency noise field before evaluating; zero disables warping.
+        float WarpAmplitude = 0.0f;
+        float WarpFrequency = 0.005f;
+    };
+
+    // Evaluated form of NoiseSettings shared by every backend, so per-octave values are computed exactly once.
+    struct NoiseParameters
+    {
+        static constexpr uint32_t MaxOctaves = 16;
+
+        NoiseType Type = NoiseType::Simplex;
+        FractalType Fractal = FractalType::FBm;
+        uint32_t OctaveCount = 1;
+        int32_t OctaveSeeds[MaxOctaves]{};
+        float OctaveFrequencies[MaxOctaves]{};
+        float OctaveAmplitudes[MaxOctaves]{};
+        float Normalization = 1.0f;
+        float WarpAmplitude = 0.0f;
+        float WarpFrequency = 0.0f;
+        int32_t WarpSeeds[3]{};
+    };
+
+    // Coherent noise over 2D (x, z) columns and 3D volumes. Grid calls evaluate whole rows with the widest
+    // instruction set the CPU supports; the scalar path exists as a fallback and as the reference.
+    // Output is roughly in [-1, 1].
+    class ENGINE_API NoiseGenerator
+    {
+    public:
+        explicit NoiseGenerator(const NoiseSettings& settings = NoiseSettings());
+
+        const NoiseSettings& GetSettings() const { return m_Settings; }
+
+        // Single samples always use the scalar kernels; they match grid output at the same integer positions.
+        float Sample2D(float x, float z) const;
+        float Sample3D(float x, float y, float z) const;
+
+        // out[z * sizeX + x] = noise at (startX + x * stride, startZ + z * stride).
+        void GenerateGrid2D(float* out, int32_t startX, int32_t startZ, uint32_t sizeX, uint32_t sizeZ, int32_t stride = 1) const;
+
+        // out[(y * sizeZ + z) * sizeX + x], matching the chunk block order.
+        void GenerateGrid3D(float* out, int32_t startX, int32_t startY, int32_t startZ, uint32_t sizeX, uint32_t sizeY, uint32_t sizeZ,
+            int32_t stride = 1) const;
+
+        // Defaults to GetBestBackend(); forcing another supported backend is meant for tests and benchmarks.
+        bool SetBackend(NoiseBackend backend);
+        NoiseBackend GetBackend() const { return m_Backend; }
+
+        static bool IsBackendSupported(NoiseBackend backend);
+        static NoiseBackend GetBestBackend();
+        static const char* GetBackendName(NoiseBackend backend);
+
+    private:
+        NoiseSettings m_Settings;
+        NoiseParameters m_Parameters;
+        NoiseBackend m_Backend = NoiseBackend::Scalar;
+    };
+}
@@ -0,0 +1,375 @@
+#pragma once
+
+#include "Engine/Noise/NoiseBackends.h"
+
+#include <cstddef>
+#include <cstdint>
+
+// Noise kernels written once against a small vector interface and instantiated per backend.
+// Every backend translation unit defines a float vector F and an int32 vector I inside an anonymous
+// namespace, providing:
+//   F(float), F::Width, + - *, Max, Abs, FlipSign(F, I), Select(I mask, F a, F b), Store(float*, F)
+//   I(int32_t), I::LaneIndex(), + - * ^ & | ~, << >> (logical), < == (lane masks), CmpGt(F, F),
+//   ToFloat(I), FloorToInt(F)
+// Because the kernels spell out every operation in the same order and no backend fuses multiply-adds,
+// all backends produce bit-identical results.
+//
+// Only templates live here: the wrapper types have internal linkage, so each backend gets private
+// instantiations compiled with its own instruction set and the linker can never mix them up.
+namespace Engine::NoiseKernels
+{
+    constexpr int32_t PrimeX = 501125321;
+    constexpr int32_t PrimeY = 1136930381;
+    constexpr int32_t PrimeZ = 1720413743;
+    constexpr int32_t HashMultiplier = 0x27D4EB2D;
+
+    // Range normalisation, measured so typical output fills [-1, 1].
+    constexpr float Perlin2Scale = 1.32f;
+    constexpr float Perlin3Scale = 0.964921414852142333984375f;
+    constexpr float Simplex2Scale = 90.0f;
+    constexpr float Simplex3Scale = 32.69428253173828125f;
+
+    constexpr float Skew2 = 0.366025403784438646763723170752936183f;
+    constexpr float Unskew2 = 0.211324865405187117745425609748864241f;
+    constexpr float Skew3 = 1.0f / 3.0f;
+    constexpr float Unskew3 = 1.0f / 6.0f;
+
+    template<typename I>
+    I Hash(I seed, I xPrimed, I yPrimed)
+    {
+        I l_Hash = seed ^ xPrimed ^ yPrimed;
+        l_Hash = l_Hash * I(HashMultiplier);
+
+        return l_Hash ^ (l_Hash >> 15);
+    }
+
+    template<typename I>
+    I Hash(I seed, I xPrimed, I yPrimed, I zPrimed)
+    {
+        I l_Hash = seed ^ xPrimed ^ yPrimed ^ zPrimed;
+        l_Hash = l_Hash * I(HashMultiplier);
+
+        return l_Hash ^ (l_Hash >> 15);
+    }
+
+    // Quintic smoothstep 6t^5 - 15t^4 + 10t^3.
+    template<typename F>
+    F Fade(F t)
+    {
+        return t * t * t * (t * (t * F(6.0f) - F(15.0f)) + F(10.0f));
+    }
+
+    template<typename F>
+    F Lerp(F a, F b, F t)
+    {
+        return a + t * (b - a);
+    }
+
+    // Eight gradients: (+-1, +-0.5) and (+-0.5, +-1).
+    template<typename F, typename I>
+    F Gradient(I hash, F x, F y)
+    {
+        const I l_Index = hash & I(7);
+        const I l_IsXMajor = l_Index < I(4);
+        const F l_U = Select(l_IsXMajor, x, y);
+        const F l_V = Select(l_IsXMajor, y, x);
+
+        return FlipSign(l_U, l_Index << 31) + FlipSign(l_V, (l_Index & I(2)) << 30) * F(0.5f);
+    }
+
+    // Perlin's twelve cube-edge gradients (sixteen entries, four repeated).
+    template<typename F, typename I>
+    F Gradient(I hash, F x, F y, F z)
+    {
+        const I l_Index = hash & I(15);
+        const F l_U = Select(l_Index < I(8), x, y);
+        const F l_V = Select(l_Index < I(4), y, Select((l_Index == I(12)) | (l_Index == I(14)), x, z));
+
+        return FlipSign(l_U, l_Index << 31) + FlipSign(l_V, (l_Index & I(2)) << 30);
+    }
+
+    template<typename F, typename I>
+    F Perlin(I seed, F x, F y)
+    {
+        const I l_X0 = FloorToInt(x);
+        const I l_Y0 = FloorToInt(y);
+        const F l_Dx0 = x - ToFloat(l_X0);
+        const F l_Dy0 = y - ToFloat(l_Y0);
+        const F l_Dx1 = l_Dx0 - F(1.0f);
+        const F l_Dy1 = l_Dy0 - F(1.0f);
+
+        const I l_Xp0 = l_X0 * I(PrimeX);
+        const I l_Yp0 = l_Y0 * I(PrimeY);
+        const I l_Xp1 = l_Xp0 + I(PrimeX);
+        const I l_Yp1 = l_Yp0 + I(PrimeY);
+
+        const F l_U = Fade(l_Dx0);
+        const F l_V = Fade(l_Dy0);
+
+        const F l_Bottom = Lerp(Gradient(Hash(seed, l_Xp0, l_Yp0), l_Dx0, l_Dy0), Gradient(Hash(seed, l_Xp1, l_Yp0), l_Dx1, l_Dy0), l_U);
+        const F l_Top = Lerp(Gradient(Hash(seed, l_Xp0, l_Yp1), l_Dx0, l_Dy1), Gradient(Hash(seed, l_Xp1, l_Yp1), l_Dx1, l_Dy1), l_U);
+
+        return Lerp(l_Bottom, l_Top, l_V) * F(Perlin2Scale);
+    }
+
+    template<typename F, typename I>
+    F Perlin(I seed, F x, F y, F z)
+    {
+        const I l_X0 = FloorToInt(x);
+        const I l_Y0 = FloorToInt(y);
+        const I l_Z0 = FloorToInt(z);
+        const F l_Dx0 = x - ToFloat(l_X0);
+        const F l_Dy0 = y - ToFloat(l_Y0);
+        const F l_Dz0 = z - ToFloat(l_Z0);
+        const F l_Dx1 = l_Dx0 - F(1.0f);
+        const F l_Dy1 = l_Dy0 - F(1.0f);
+        const F l_Dz1 = l_Dz0 - F(1.0f);
+
+        const I l_Xp0 = l_X0 * I(PrimeX);
+        const I l_Yp0 = l_Y0 * I(PrimeY);
+        const I l_Zp0 = l_Z0 * I(PrimeZ);
+        const I l_Xp1 = l_Xp0 + I(PrimeX);
+        const I l_Yp1 = l_Yp0 + I(PrimeY);
+        const I l_Zp1 = l_Zp0 + I(PrimeZ);
+
+        const F l_U = Fade(l_Dx0);
+        const F l_V = Fade(l_Dy0);
+        const F l_W = Fade(l_Dz0);
+
+        const F l_X00 = Lerp(Gradient(Hash(seed, l_Xp0, l_Yp0, l_Zp0), l_Dx0, l_Dy0, l_Dz0), Gradient(Hash(seed, l_Xp1, l_Yp0, l_Zp0), l_Dx1, l_Dy0, l_Dz0), l_U);
+        const F l_X10 = Lerp(Gradient(Hash(seed, l_Xp0, l_Yp1, l_Zp0), l_Dx0, l_Dy1, l_Dz0), Gradient(Hash(seed, l_Xp1, l_Yp1, l_Zp0), l_Dx1, l_Dy1, l_Dz0), l_U);
+        const F l_X01 = Lerp(Gradient(Hash(seed, l_Xp0, l_Yp0, l_Zp1), l_Dx0, l_Dy0, l_Dz1), Gradient(Hash(seed, l_Xp1, l_Yp0, l_Zp1), l_Dx1, l_Dy0, l_Dz1), l_U);
+        const F l_X11 = Lerp(Gradient(Hash(seed, l_Xp0, l_Yp1, l_Zp1), l_Dx0, l_Dy1, l_Dz1), Gradient(Hash(seed, l_Xp1, l_Yp1, l_Zp1), l_Dx1, l_Dy1, l_Dz1), l_U);
+
+        const F l_Y0Lerp = Lerp(l_X00, l_X10, l_V);
+        const F l_Y1Lerp = Lerp(l_X01, l_X11, l_V);
+
+        return Lerp(l_Y0Lerp, l_Y1Lerp, l_W) * F(Perlin3Scale);
+    }
+
+    // Falloff-weighted gradient contribution of one simplex corner.
+    template<typename F, typename I>
+    F SimplexCorner(F radius, I hash, F x, F y)
+    {
+        F l_T = Max(radius - x * x - y * y, F(0.0f));
+        l_T = l_T * l_T;
+
+        return l_T * l_T * Gradient(hash, x, y);
+    }
+
+    template<typename F, typename I>
+    F SimplexCorner(F radius, I hash, F x, F y, F z)
+    {
+        F l_T = Max(radius - x * x - y * y - z * z, F(0.0f));
+        l_T = l_T * l_T;
+
+        return l_T * l_T * Gradient(hash, x, y, z);
+    }
+
+    template<typename F, typename I>
+    F Simplex(I seed, F x, F y)
+    {
+        const F l_Skew = (x + y) * F(Skew2);
+        const I l_I = FloorToInt(x + l_Skew);
+        const I l_J = FloorToInt(y + l_Skew);
+        const F l_Unskew = ToFloat(l_I + l_J) * F(Unskew2);
+
+        const F l_X0 = x - (ToFloat(l_I) - l_Unskew);
+        const F l_Y0 = y - (ToFloat(l_J) - l_Unskew);
+
+        // The middle corner steps along x in the lower triangle and along y in the upper one.
+        const I l_StepX = CmpGt(l_X0, l_Y0);
+        const I l_StepY = ~l_StepX;
+
+        const F l_X1 = l_X0 - Select(l_StepX, F(1.0f), F(0.0f)) + F(Unskew2);
+        const F l_Y1 = l_Y0 - Select(l_StepY, F(1.0f), F(0.0f)) + F(Unskew2);
+        const F l_X2 = l_X0 + F(2.0f * Unskew2 - 1.0f);
+        const F l_Y2 = l_Y0 + F(2.0f * Unskew2 - 1.0f);
+
+        const I l_Ip = l_I * I(PrimeX);
+        const I l_Jp = l_J * I(PrimeY);
+
+        const F l_N0 = SimplexCorner(F(0.5f), Hash(seed, l_Ip, l_Jp), l_X0, l_Y0);
+        const F l_N1 = SimplexCorner(F(0.5f), Hash(seed, l_Ip + (I(PrimeX) & l_StepX), l_Jp + (I(PrimeY) & l_StepY)), l_X1, l_Y1);
+        const F l_N2 = SimplexCorner(F(0.5f), Hash(seed, l_Ip + I(PrimeX), l_Jp + I(PrimeY)), l_X2, l_Y2);
+
+        return (l_N0 + l_N1 + l_N2) * F(Simplex2Scale);
+    }
+
+    template<typename F, typename I>
+    F Simplex(I seed, F x, F y, F z)
+    {
+        const F l_Skew = (x + y + z) * F(Skew3);
+        const I l_I = FloorToInt(x + l_Skew);
+        const I l_J = FloorToInt(y + l_Skew);
+        const I l_K = FloorToInt(z + l_Skew);
+        const F l_Unskew = ToFloat(l_I + l_J + l_K) * F(Unskew3);
+
+        const F l_X0 = x - (ToFloat(l_I) - l_Unskew);
+        const F l_Y0 = y - (ToFloat(l_J) - l_Unskew);
+        const F l_Z0 = z - (ToFloat(l_K) - l_Unskew);
+
+        // Rank the offsets to find which of the six tetrahedra holds the point, without branches.
+        const I l_XGeY = ~CmpGt(l_Y0, l_X0);
+        const I l_YGeZ = ~CmpGt(l_Z0, l_Y0);
+        const I l_XGeZ = ~CmpGt(l_Z0, l_X0);
+
+        const I l_I1 = l_XGeY & l_XGeZ;
+        const I l_J1 = ~l_XGeY & l_YGeZ;
+        const I l_K1 = ~l_XGeZ & ~l_YGeZ;
+        const I l_I2 = l_XGeY | l_XGeZ;
+        const I l_J2 = ~l_XGeY | l_YGeZ;
+        const I l_K2 = ~(l_XGeZ & l_YGeZ);
+
+        const F l_One(1.0f);
+        const F l_Zero(0.0f);
+        const F l_X1 = l_X0 - Select(l_I1, l_One, l_Zero) + F(Unskew3);
+        const F l_Y1 = l_Y0 - Select(l_J1, l_One, l_Zero) + F(Unskew3);
+        const F l_Z1 = l_Z0 - Select(l_K1, l_One, l_Zero) + F(Unskew3);
+        const F l_X2 = l_X0 - Select(l_I2, l_One, l_Zero) + F(2.0f * Unskew3);
+        const F l_Y2 = l_Y0 - Select(l_J2, l_One, l_Zero) + F(2.0f * Unskew3);
+        const F l_Z2 = l_Z0 - Select(l_K2, l_One, l_Zero) + F(2.0f * Unskew3);
+        const F l_X3 = l_X0 + F(3.0f * Unskew3 - 1.0f);
+        const F l_Y3 = l_Y0 + F(3.0f * Unskew3 - 1.0f);
+        const F l_Z3 = l_Z0 + F(3.0f * Unskew3 - 1.0f);
+
+        const I l_Ip = l_I * I(PrimeX);
+        const I l_Jp = l_J * I(PrimeY);
+        const I l_Kp = l_K * I(PrimeZ);
+
+        const F l_N0 = SimplexCorner(F(0.6f), Hash(seed, l_Ip, l_Jp, l_Kp), l_X0, l_Y0, l_Z0);
+        const F l_N1 = SimplexCorner(F(0.6f), Hash(seed, l_Ip + (I(PrimeX) & l_I1), l_Jp + (I(PrimeY) & l_J1), l_Kp + (I(PrimeZ) & l_K1)), l_X1, l_Y1, l_Z1);
+        const F l_N2 = SimplexCorner(F(0.6f), Hash(seed, l_Ip + (I(PrimeX) & l_I2), l_Jp + (I(PrimeY) & l_J2), l_Kp + (I(PrimeZ) & l_K2)), l_X2, l_Y2, l_Z2);
+        const F l_N3 = SimplexCorner(F(0.6f), Hash(seed, l_Ip + I(PrimeX), l_Jp + I(PrimeY), l_Kp + I(PrimeZ)), l_X3, l_Y3, l_Z3);
+
+        return (l_N0 + l_N1 + l_N2 + l_N3) * F(Simplex3Scale);
+    }
+
+    template<typename F, typename I>
+    F EvaluateBase(const NoiseParameters& parameters, I seed, F x, F y)
+    {
+        return parameters.Type == NoiseType::Perlin ? Perlin(seed, x, y) : Simplex(seed, x, y);
+    }
+
+    template<typename F, typename I>
+    F EvaluateBase(const NoiseParameters& parameters, I seed, F x, F y, F z)
+    {
+        return parameters.Type == NoiseType::Perlin ? Perlin(seed, x, y, z) : Simplex(seed, x, y, z);
+    }
+
+    template<typename F, typename I>
+    F Evaluate(const NoiseParameters& parameters, F x, F z)
+    {
+        if (parameters.WarpAmplitude != 0.0f)
+        {
+            const F l_WarpX = x * F(parameters.WarpFrequency);
+            const F l_WarpZ = z * F(parameters.WarpFrequency);
+            const F l_OffsetX = EvaluateBase(parameters, I(parameters.WarpSeeds[0]), l_WarpX, l_WarpZ);
+            const F l_OffsetZ = EvaluateBase(parameters, I(parameters.WarpSeeds[2]), l_WarpX, l_WarpZ);
+            x = x + l_OffsetX * F(parameters.WarpAmplitude);
+            z = z + l_OffsetZ * F(parameters.WarpAmplitude);
+        }
+
+        F l_Sum(0.0f);
+        for (uint32_t it_Octave = 0; it_Octave < parameters.OctaveCount; ++it_Octave)
+        {
+            const F l_Frequency(parameters.OctaveFrequencies[it_Octave]);
+            F l_Noise = EvaluateBase(parameters, I(parameters.OctaveSeeds[it_Octave]), x * l_Frequency, z * l_Frequency);
+            if (parameters.Fractal == FractalType::Ridged)
+            {
+                l_Noise = F(1.0f) - Abs(l_Noise) * F(2.0f);
+            }
+
+            l_Sum = l_Sum + l_Noise * F(parameters.OctaveAmplitudes[it_Octave]);
+        }
+
+        return l_Sum * F(parameters.Normalization);
+    }
+
+    template<typename F, typename I>
+    F Evaluate(const NoiseParameters& parameters, F x, F y, F z)
+    {
+        if (parameters.WarpAmplitude != 0.0f)
+        {
+            const F l_WarpX = x * F(parameters.WarpFrequency);
+            const F l_WarpY = y * F(parameters.WarpFrequency);
+            const F l_WarpZ = z * F(parameters.WarpFrequency);
+            const F l_OffsetX = EvaluateBase(parameters, I(parameters.WarpSeeds[0]), l_WarpX, l_WarpY, l_WarpZ);
+            const F l_OffsetY = EvaluateBase(parameters, I(parameters.WarpSeeds[1]), l_WarpX, l_WarpY, l_WarpZ);
+            const F l_OffsetZ = EvaluateBase(parameters, I(parameters.WarpSeeds[2]), l_WarpX, l_WarpY, l_WarpZ);
+            x = x + l_OffsetX * F(parameters.WarpAmplitude);
+            y = y + l_OffsetY * F(parameters.WarpAmplitude);
+            z = z + l_OffsetZ * F(parameters.WarpAmplitude);
+        }
+
+        F l_Sum(0.0f);
+        for (uint32_t it_Octave = 0; it_Octave < parameters.OctaveCount; ++it_Octave)
+        {
+            const F l_Frequency(parameters.OctaveFrequencies[it_Octave]);
+            F l_Noise = EvaluateBase(parameters, I(parameters.OctaveSeeds[it_Octave]), x * l_Frequency, y * l_Frequency, z * l_Frequency);
+            if (parameters.Fractal == FractalType::Ridged)
+            {
+                l_Noise = F(1.0f) - Abs(l_Noise) * F(2.0f);
+            }
+
+            l_Sum = l_Sum + l_Noise * F(parameters.OctaveAmplitudes[it_Octave]);
+        }
+
+        return l_Sum * F(parameters.Normalization);
+    }
+
+    // Store a full vector, or only the leading lanes at the end of a row.
+    template<typename F>
+    void StoreRow(float* out, uint32_t remaining, F value)
+    {
+        if (remaining >= F::Width)
+        {
+            Store(out, value);
+
+            return;
+        }
+
+        float l_Lanes[F::Width];
+        Store(l_Lanes, value);
+        for (uint32_t i = 0; i < remaining; ++i)
+        {
+            out[i] = l_Lanes[i];
+        }
+    }
+
+    template<typename F, typename I>
+    void GenerateGrid2D(const NoiseParameters& parameters, const NoiseGridRegion& region, float* out)
+    {
+        const I l_LaneOffsets = I::LaneIndex() * I(region.Stride);
+        for (uint32_t z = 0; z < region.SizeZ; ++z)
+        {
+            const F l_Z = ToFloat(I(region.StartZ + static_cast<int32_t>(z) * region.Stride));
+            float* l_Row = out + static_cast<size_t>(z) * region.SizeX;
+            for (uint32_t x = 0; x < region.SizeX; x += F::Width)
+            {
+                const I l_X = I(region.StartX + static_cast<int32_t>(x) * region.Stride) + l_LaneOffsets;
+                StoreRow(l_Row + x, region.SizeX - x, Evaluate<F, I>(parameters, ToFloat(l_X), l_Z));
+            }
+        }
+    }
+
+    template<typename F, typename I>
+    void GenerateGrid3D(const NoiseParameters& parameters, const NoiseGridRegion& region, float* out)
+    {
+        const I l_LaneOffsets = I::LaneIndex() * I(region.Stride);
+        for (uint32_t y = 0; y < region.SizeY; ++y)
+        {
+            const F l_Y = ToFloat(I(region.StartY + static_cast<int32_t>(y) * region.Stride));
+            for (uint32_t z = 0; z < region.SizeZ; ++z)
+            {
+                const F l_Z = ToFloat(I(region.StartZ + static_cast<int32_t>(z) * region.Stride));
+                float* l_Row = out + (static_cast<size_t>(y) * region.SizeZ + z) * region.SizeX;
+                for (uint32_t x = 0; x < region.SizeX; x += F::Width)
+                {
+                    const I l_X = I(region.StartX + static_cast<int32_t>(x) * region.Stride) + l_LaneOffsets;
+                    StoreRow(l_Row + x, region.SizeX - x, Evaluate<F, I>(parameters, ToFloat(l_X), l_Y, l_Z));
+                }
+            }
+        }
+    }
+}
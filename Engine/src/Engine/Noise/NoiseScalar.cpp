@@ -0,0 +1,98 @@
+#include "Engine/Noise/NoiseKernels.h"
+
+#include <cstring>
+
+namespace Engine::NoiseScalar
+{
+    namespace
+    {
+        // One-lane vectors. Integer arithmetic runs on uint32_t so overflow wraps exactly like the SIMD lanes.
+        struct I
+        {
+            uint32_t Value;
+
+            explicit I(int32_t value) : Value(static_cast<uint32_t>(value)) {}
+            static I FromBits(uint32_t bits) { I l_Result(0); l_Result.Value = bits; return l_Result; }
+            static I LaneIndex() { return I(0); }
+        };
+
+        struct F
+        {
+            static constexpr uint32_t Width = 1;
+
+            float Value;
+
+            explicit F(float value) : Value(value) {}
+        };
+
+        inline I operator+(I a, I b) { return I::FromBits(a.Value + b.Value); }
+        inline I operator-(I a, I b) { return I::FromBits(a.Value - b.Value); }
+        inline I operator*(I a, I b) { return I::FromBits(a.Value * b.Value); }
+        inline I operator^(I a, I b) { return I::FromBits(a.Value ^ b.Value); }
+        inline I operator&(I a, I b) { return I::FromBits(a.Value & b.Value); }
+        inline I operator|(I a, I b) { return I::FromBits(a.Value | b.Value); }
+        inline I operator~(I a) { return I::FromBits(~a.Value); }
+        inline I operator<<(I a, int shift) { return I::FromBits(a.Value << shift); }
+        inline I operator>>(I a, int shift) { return I::FromBits(a.Value >> shift); }
+        inline I operator<(I a, I b) { return I::FromBits(static_cast<int32_t>(a.Value) < static_cast<int32_t>(b.Value) ? ~0u : 0u); }
+        inline I operator==(I a, I b) { return I::FromBits(a.Value == b.Value ? ~0u : 0u); }
+
+        inline F operator+(F a, F b) { return F(a.Value + b.Value); }
+        inline F operator-(F a, F b) { return F(a.Value - b.Value); }
+        inline F operator*(F a, F b) { return F(a.Value * b.Value); }
+
+        inline I CmpGt(F a, F b) { return I::FromBits(a.Value > b.Value ? ~0u : 0u); }
+        inline F Max(F a, F b) { return F(a.Value > b.Value ? a.Value : b.Value); }
+        inline F Select(I mask, F a, F b) { return mask.Value != 0 ? a : b; }
+        inline F ToFloat(I a) { return F(static_cast<float>(static_cast<int32_t>(a.Value))); }
+
+        inline F FromBits(uint32_t bits)
+        {
+            float l_Value;
+            std::memcpy(&l_Value, &bits, sizeof(l_Value));
+
+            return F(l_Value);
+        }
+
+        inline uint32_t ToBits(F a)
+        {
+            uint32_t l_Bits;
+            std::memcpy(&l_Bits, &a.Value, sizeof(l_Bits));
+
+            return l_Bits;
+        }
+
+        inline F Abs(F a) { return FromBits(ToBits(a) & 0x7FFFFFFFu); }
+        inline F FlipSign(F a, I signBits) { return FromBits(ToBits(a) ^ (signBits.Value & 0x80000000u)); }
+
+        // Truncate, then step down where truncation rounded up (negative non-integers).
+        inline I FloorToInt(F a)
+        {
+            const int32_t l_Truncated = static_cast<int32_t>(a.Value);
+
+            return I(static_cast<float>(l_Truncated) > a.Value ? l_Truncated - 1 : l_Truncated);
+        }
+
+        inline void Store(float* out, F value) { *out = value.Value; }
+    }
+
+    float Sample2D(const NoiseParameters& parameters, float x, float z)
+    {
+        return NoiseKernels::Evaluate<F, I>(parameters, F(x), F(z)).Value;
+    }
+
+    float Sample3D(const NoiseParameters& parameters, float x, float y, float z)
+    {
+        return NoiseKernels::Evaluate<F, I>(parameters, F(x), F(y), F(z)).Value;
+    }
+
+    void GenerateGrid2D(const NoiseParameters& parameters, const NoiseGridRegion& region, float* out)
+    {
+        NoiseKernels::GenerateGrid2D<F, I>(parameters, region, out);
+    }
+
+    void GenerateGrid3D(const NoiseParameters& parameters, const NoiseGridRegion& region, float* out)
+    {
+        NoiseKernels::GenerateGrid3D<F, I>(parameters, region, out);
+    }
+}
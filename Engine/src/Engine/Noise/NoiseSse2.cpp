@@ -0,0 +1,97 @@
+#include "Engine/Noise/NoiseKernels.h"
+
+#if ENGINE_NOISE_X86
+
+#include <emmintrin.h>
+
+namespace Engine::NoiseSse2
+{
+    namespace
+    {
+        struct I
+        {
+            __m128i Value;
+
+            explicit I(__m128i value) : Value(value) {}
+            explicit I(int32_t value) : Value(_mm_set1_epi32(value)) {}
+            static I LaneIndex() { return I(_mm_setr_epi32(0, 1, 2, 3)); }
+        };
+
+        struct F
+        {
+            static constexpr uint32_t Width = 4;
+
+            __m128 Value;
+
+            explicit F(__m128 value) : Value(value) {}
+            explicit F(float value) : Value(_mm_set1_ps(value)) {}
+        };
+
+        inline I operator+(I a, I b) { return I(_mm_add_epi32(a.Value, b.Value)); }
+        inline I operator-(I a, I b) { return I(_mm_sub_epi32(a.Value, b.Value)); }
+        inline I operator^(I a, I b) { return I(_mm_xor_si128(a.Value, b.Value)); }
+        inline I operator&(I a, I b) { return I(_mm_and_si128(a.Value, b.Value)); }
+        inline I operator|(I a, I b) { return I(_mm_or_si128(a.Value, b.Value)); }
+        inline I operator~(I a) { return I(_mm_xor_si128(a.Value, _mm_set1_epi32(-1))); }
+        inline I operator<<(I a, int shift) { return I(_mm_slli_epi32(a.Value, shift)); }
+        inline I operator>>(I a, int shift) { return I(_mm_srli_epi32(a.Value, shift)); }
+        inline I operator<(I a, I b) { return I(_mm_cmplt_epi32(a.Value, b.Value)); }
+        inline I operator==(I a, I b) { return I(_mm_cmpeq_epi32(a.Value, b.Value)); }
+
+        // SSE2 has no 32-bit low multiply; build it from the two even/odd 32x32->64 products.
+        inline I operator*(I a, I b)
+        {
+            const __m128i l_Even = _mm_mul_epu32(a.Value, b.Value);
+            const __m128i l_Odd = _mm_mul_epu32(_mm_srli_si128(a.Value, 4), _mm_srli_si128(b.Value, 4));
+
+            return I(_mm_unpacklo_epi32(_mm_shuffle_epi32(l_Even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(l_Odd, _MM_SHUFFLE(0, 0, 2, 0))));
+        }
+
+        inline F operator+(F a, F b) { return F(_mm_add_ps(a.Value, b.Value)); }
+        inline F operator-(F a, F b) { return F(_mm_sub_ps(a.Value, b.Value)); }
+        inline F operator*(F a, F b) { return F(_mm_mul_ps(a.Value, b.Value)); }
+
+        inline I CmpGt(F a, F b) { return I(_mm_castps_si128(_mm_cmpgt_ps(a.Value, b.Value))); }
+
+        // MAXPS computes a > b ? a : b, the same expression the scalar backend uses.
+        inline F Max(F a, F b) { return F(_mm_max_ps(a.Value, b.Value)); }
+
+        inline F Select(I mask, F a, F b)
+        {
+            const __m128 l_Mask = _mm_castsi128_ps(mask.Value);
+
+            return F(_mm_or_ps(_mm_and_ps(l_Mask, a.Value), _mm_andnot_ps(l_Mask, b.Value)));
+        }
+
+        inline F ToFloat(I a) { return F(_mm_cvtepi32_ps(a.Value)); }
+        inline F Abs(F a) { return F(_mm_and_ps(a.Value, _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF)))); }
+
+        inline F FlipSign(F a, I signBits)
+        {
+            return F(_mm_xor_ps(a.Value, _mm_castsi128_ps(_mm_and_si128(signBits.Value, _mm_set1_epi32(static_cast<int32_t>(0x80000000u))))));
+        }
+
+        // Truncate, then add the all-ones compare mask (-1) where truncation rounded up.
+        inline I FloorToInt(F a)
+        {
+            const __m128i l_Truncated = _mm_cvttps_epi32(a.Value);
+            const __m128 l_RoundedUp = _mm_cmpgt_ps(_mm_cvtepi32_ps(l_Truncated), a.Value);
+
+            return I(_mm_add_epi32(l_Truncated, _mm_castps_si128(l_RoundedUp)));
+        }
+
+        inline void Store(float* out, F value) { _mm_storeu_ps(out, value.Value); }
+    }
+
+    void GenerateGrid2D(const NoiseParameters& parameters, const NoiseGridRegion& region, float* out)
+    {
+        NoiseKernels::GenerateGrid2D<F, I>(parameters, region, out);
+    }
+
+    void GenerateGrid3D(const NoiseParameters& parameters, const NoiseGridRegion& region, float* out)
+    {
+        NoiseKernels::GenerateGrid3D<F, I>(parameters, region, out);
+    }
+}
+
+#endif
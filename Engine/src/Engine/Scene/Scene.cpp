@@ -0,0 +1,23 @@
+#include "Engine/Scene/Scene.h"
+
+#include <utility>
+
+namespace Engine
+{
+    Scene::Scene(JobSystem& jobSystem, const SystemSchedulerSettings& settings) : m_Scheduler(jobSystem, settings)
+    {
+
+    }
+
+    uint32_t Scene::AddSystem(std::string name, const SystemAccess& access, SystemFunction function)
+    {
+        access.PrepareStorage(m_Registry);
+
+        return m_Scheduler.AddSystem(std::move(name), access, std::move(function));
+    }
+
+    void Scene::Tick(const TickTiming& tickTiming)
+    {
+        m_Scheduler.Run(m_Registry, tickTiming);
+    }
+}
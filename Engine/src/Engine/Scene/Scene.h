@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/Core/Timestep.h"
+#include "Engine/Scene/SystemScheduler.h"
+
+#include <entt/entt.hpp>
+
+#include <cstdint>
+#include <string>
+
+namespace Engine
+{
+    class JobSystem;
+
+    // Entities (mobs, dropped items, projectiles) as plain components in an EnTT registry, simulated by systems
+    // once per fixed tick. Every component type lives in its own densely packed pool; systems walk views, or
+    // owning groups where several components are always read together, which keep those pools sorted so one
+    // index addresses all of them and the loop streams through memory.
+    //
+    // Systems declare what they read and write, and the scheduler runs the ones that do not conflict in
+    // parallel. Create owning groups before the first Tick: a group sorts its pools when it is first built,
+    // which must not happen while other systems run. Main thread only, apart from the systems Tick spreads
+    // over the job system.
+    class ENGINE_API Scene
+    {
+    public:
+        explicit Scene(JobSystem& jobSystem, const SystemSchedulerSettings& settings = SystemSchedulerSettings());
+
+        Scene(const Scene&) = delete;
+        Scene& operator=(const Scene&) = delete;
+
+        entt::registry& GetRegistry() { return m_Registry; }
+        const entt::registry& GetRegistry() const { return m_Registry; }
+
+        // Also creates the storage of every component the system declares. Returns the system's phase.
+        uint32_t AddSystem(std::string name, const SystemAccess& access, SystemFunction function);
+
+        // Run every system once.
+        void Tick(const TickTiming& tickTiming);
+
+        SystemScheduler& GetScheduler() { return m_Scheduler; }
+        const SystemScheduler& GetScheduler() const { return m_Scheduler; }
+
+    private:
+        entt::registry m_Registry;
+        SystemScheduler m_Scheduler;
+    };
+}
@@ -0,0 +1,154 @@
+#include "Engine/Scene/SystemScheduler.h"
+
+#include "Engine/Core/Profiler.h"
+#include "Engine/Jobs/JobSystem.h"
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+namespace Engine
+{
+    bool SystemAccess::ConflictsWith(const SystemAccess& other) const
+    {
+        if (m_IsStructural || other.m_IsStructural)
+        {
+            return true;
+        }
+
+        return Intersects(m_Writes, other.m_Writes) || Intersects(m_Writes, other.m_Reads) || Intersects(m_Reads, other.m_Writes);
+    }
+
+    void SystemAccess::PrepareStorage(entt::registry& registry) const
+    {
+        for (const PrepareFunction it_Prepare : m_Prepare)
+        {
+            it_Prepare(registry);
+        }
+    }
+
+    void SystemAccess::AddComponent(std::vector<entt::id_type>& components, entt::id_type component, PrepareFunction prepare)
+    {
+        const auto it_Position = std::lower_bound(components.begin(), components.end(), component);
+        if (it_Position == components.end() || *it_Position != component)
+        {
+            components.insert(it_Position, component);
+        }
+
+        if (std::find(m_Prepare.begin(), m_Prepare.end(), prepare) == m_Prepare.end())
+        {
+            m_Prepare.push_back(prepare);
+        }
+    }
+
+    bool SystemAccess::Intersects(const std::vector<entt::id_type>& a, const std::vector<entt::id_type>& b)
+    {
+        // Both sorted; a merge walk beats hashing for the handful of components a system declares.
+        auto it_A = a.begin();
+        auto it_B = b.begin();
+        while (it_A != a.end() && it_B != b.end())
+        {
+            if (*it_A == *it_B)
+            {
+                return true;
+            }
+
+            if (*it_A < *it_B)
+            {
+                ++it_A;
+            }
+            else
+            {
+                ++it_B;
+            }
+        }
+
+        return false;
+    }
+
+    SystemScheduler::SystemScheduler(JobSystem& jobSystem, const SystemSchedulerSettings& settings) : m_JobSystem(jobSystem), m_Settings(settings)
+    {
+
+    }
+
+    uint32_t SystemScheduler::AddSystem(std::string name, const SystemAccess& access, SystemFunction function)
+    {
+        uint32_t l_Phase = 0;
+        for (size_t i = 0; i < m_Systems.size(); ++i)
+        {
+            if (m_Systems[i].Access.ConflictsWith(access))
+            {
+                l_Phase = std::max(l_Phase, m_SystemStats[i].Phase + 1);
+            }
+        }
+
+        if (l_Phase >= m_Phases.size())
+        {
+            m_Phases.resize(l_Phase + 1);
+        }
+
+        const uint32_t l_SystemIndex = static_cast<uint32_t>(m_Systems.size());
+        m_Phases[l_Phase].push_back(l_SystemIndex);
+        m_Systems.push_back({ access, std::move(function) });
+
+        SystemStats l_Stats;
+        l_Stats.Name = std::move(name);
+        l_Stats.Phase = l_Phase;
+        m_SystemStats.push_back(std::move(l_Stats));
+
+        return l_Phase;
+    }
+
+    void SystemScheduler::Run(entt::registry& registry, const TickTiming& tickTiming)
+    {
+        ENGINE_PROFILE_SCOPE("SystemScheduler::Run");
+
+        const auto l_Start = std::chrono::steady_clock::now();
+        const SystemContext l_Context{ registry, m_JobSystem, tickTiming };
+
+        for (const std::vector<uint32_t>& it_Phase : m_Phases)
+        {
+            if (!m_Settings.RunInParallel || it_Phase.size() == 1)
+            {
+                for (const uint32_t it_SystemIndex : it_Phase)
+                {
+                    RunSystem(it_SystemIndex, l_Context);
+                }
+
+                continue;
+            }
+
+            // The rest of the phase goes to workers; this thread takes the first system, then helps.
+            JobCounter l_Counter;
+            for (size_t i = 1; i < it_Phase.size(); ++i)
+            {
+                const uint32_t l_SystemIndex = it_Phase[i];
+                m_JobSystem.Submit([this, l_SystemIndex, &l_Context]()
+                    {
+                        RunSystem(l_SystemIndex, l_Context);
+                    }, &l_Counter);
+            }
+
+            RunSystem(it_Phase.front(), l_Context);
+            m_JobSystem.WaitForCounter(l_Counter);
+        }
+
+        m_LastTickStats.SystemCount = static_cast<uint32_t>(m_Systems.size());
+        m_LastTickStats.PhaseCount = static_cast<uint32_t>(m_Phases.size());
+        m_LastTickStats.TickMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - l_Start).count();
+        m_LastTickStats.SystemMilliseconds = 0.0;
+        for (const SystemStats& it_Stats : m_SystemStats)
+        {
+            m_LastTickStats.SystemMilliseconds += it_Stats.Milliseconds;
+        }
+    }
+
+    void SystemScheduler::RunSystem(uint32_t systemIndex, const SystemContext& context)
+    {
+        const auto l_Start = std::chrono::steady_clock::now();
+        m_Systems[systemIndex].Function(context);
+
+        // Each system writes only its own entry, so jobs of the same phase never share one.
+        m_SystemStats[systemIndex].Milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - l_Start).count();
+    }
+}
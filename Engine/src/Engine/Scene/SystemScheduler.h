@@ -0,0 +1,160 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/Core/Timestep.h"
+
+#include <entt/entt.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Engine
+{
+    class JobSystem;
+
+    // The components a system touches. Two systems conflict when either writes a component the other reads or
+    // writes, or when either is structural; the scheduler never runs conflicting systems at the same time.
+    class ENGINE_API SystemAccess
+    {
+    public:
+        template<typename... T>
+        SystemAccess& Read()
+        {
+            (AddComponent(m_Reads, entt::type_hash<T>::value(), &CreateStorage<T>), ...);
+
+            return *this;
+        }
+
+        template<typename... T>
+        SystemAccess& Write()
+        {
+            (AddComponent(m_Writes, entt::type_hash<T>::value(), &CreateStorage<T>), ...);
+
+            return *this;
+        }
+
+        // Creates or destroys entities, or adds or removes components. Those change pools and groups other
+        // systems may be walking, so a structural system runs alone.
+        SystemAccess& Structural()
+        {
+            m_IsStructural = true;
+
+            return *this;
+        }
+
+        bool ConflictsWith(const SystemAccess& other) const;
+        bool IsStructural() const { return m_IsStructural; }
+
+        // Create the storage of every declared component, so no pool appears while systems run in parallel.
+        void PrepareStorage(entt::registry& registry) const;
+
+    private:
+        using PrepareFunction = void(*)(entt::registry&);
+
+        template<typename T>
+        static void CreateStorage(entt::registry& registry) { registry.storage<T>(); }
+
+        void AddComponent(std::vector<entt::id_type>& components, entt::id_type component, PrepareFunction prepare);
+
+        static bool Intersects(const std::vector<entt::id_type>& a, const std::vector<entt::id_type>& b);
+
+    private:
+        // Sorted type hashes.
+        std::vector<entt::id_type> m_Reads;
+        std::vector<entt::id_type> m_Writes;
+        std::vector<PrepareFunction> m_Prepare;
+        bool m_IsStructural = false;
+    };
+
+    // What a system gets for one tick. A system with a lot of entities may split its own loop over Jobs.
+    struct SystemContext
+    {
+        entt::registry& Registry;
+        JobSystem& Jobs;
+        const TickTiming& Timing;
+    };
+
+    using SystemFunction = std::function<void(const SystemContext& context)>;
+
+    // One system's share of the last tick.
+    struct SystemStats
+    {
+        std::string Name;
+        uint32_t Phase = 0;
+        double Milliseconds = 0.0;
+    };
+
+    // Counters for the last tick.
+    struct SystemSchedulerStats
+    {
+        uint32_t SystemCount = 0;
+        uint32_t PhaseCount = 0;
+
+        // Wall time of the whole tick, and the time its systems ran added up; their ratio is how many threads
+        // the tick kept busy on average.
+        double TickMilliseconds = 0.0;
+        double SystemMilliseconds = 0.0;
+    };
+
+    struct SystemSchedulerSettings
+    {
+        // Run the systems of a phase on the job system; false runs everything in order on the calling thread.
+        bool RunInParallel = true;
+    };
+
+    // Runs systems once per fixed tick. Systems are grouped into phases when they are added: a system goes into
+    // the phase after the last one holding a conflicting system added before it, so every pair of conflicting
+    // systems still runs in the order they were added, and systems sharing a phase run in parallel. The calling
+    // thread runs one system of each phase and helps with the others while it waits. Main thread only.
+    //
+    // Systems of one phase call registry.view and registry.group on the same registry at the same time. EnTT
+    // does not make that thread-safe in general: both create the storage or group they ask for if it is missing,
+    // which writes the registry's pool and group tables. It is only safe here because nothing is created during
+    // a tick: PrepareStorage has created every declared pool before the first Run, owning groups are built
+    // up front (see Scene), and only a structural system, which runs alone, may add or remove anything.
+    class ENGINE_API SystemScheduler
+    {
+    public:
+        explicit SystemScheduler(JobSystem& jobSystem, const SystemSchedulerSettings& settings = SystemSchedulerSettings());
+
+        SystemScheduler(const SystemScheduler&) = delete;
+        SystemScheduler& operator=(const SystemScheduler&) = delete;
+
+        // Returns the system's phase.
+        uint32_t AddSystem(std::string name, const SystemAccess& access, SystemFunction function);
+
+        void Run(entt::registry& registry, const TickTiming& tickTiming);
+
+        uint32_t GetPhaseCount() const { return static_cast<uint32_t>(m_Phases.size()); }
+
+        // Per-system results of the last Run, in the order the systems were added.
+        const std::vector<SystemStats>& GetSystemStats() const { return m_SystemStats; }
+        const SystemSchedulerStats& GetLastTickStats() const { return m_LastTickStats; }
+
+        const SystemSchedulerSettings& GetSettings() const { return m_Settings; }
+        void SetRunInParallel(bool runInParallel) { m_Settings.RunInParallel = runInParallel; }
+
+    private:
+        struct System
+        {
+            SystemAccess Access;
+            SystemFunction Function;
+        };
+
+        void RunSystem(uint32_t systemIndex, const SystemContext& context);
+
+    private:
+        JobSystem& m_JobSystem;
+        SystemSchedulerSettings m_Settings;
+
+        std::vector<System> m_Systems;
+
+        // System indices per phase, in the order they were added.
+        std::vector<std::vector<uint32_t>> m_Phases;
+
+        std::vector<SystemStats> m_SystemStats;
+        SystemSchedulerStats m_LastTickStats;
+    };
+}
@@ -7,16 +7,27 @@
 
 namespace Engine
 {
-    bool Window::Initialize()
+    bool Window::Initialize(const WindowSpecification& specification)
     {
-        ENGINE_INFO("Window initialization starting");
+        ENGINE_CHANNEL_INFO(Window, "Window initialization starting");
+
+        m_Specification = specification;
+        m_IsCloseRequested = false;
+
+        if (m_Specification.Headless)
+        {
+            // Headless runs have no display or GPU, so there is nothing to create beyond the bookkeeping above.
+            ENGINE_CHANNEL_INFO(Window, "Window initialized in headless mode ({}x{})", m_Specification.Width, m_Specification.Height);
+
+            return true;
+        }
 
         // Create the window and defer storing it until we know initialization succeeded.
-        m_Window = glfwCreateWindow(1920, 1080, "Minecraft-Clone", NULL, NULL);
+        m_Window = glfwCreateWindow(m_Specification.Width, m_Specification.Height, m_Specification.Title.c_str(), NULL, NULL);
         if (m_Window == NULL)
         {
             // Leave m_Window as NULL so the shutdown path knows nothing was created.
-            ENGINE_ERROR("Failed to create GLFW window");
+            ENGINE_CHANNEL_ERROR(Window, "Failed to create GLFW window");
             glfwTerminate();
 
             return false;
@@ -25,154 +36,144 @@ namespace Engine
         // Store the window pointer on the GLFW handle so callbacks can access engine state.
         glfwSetWindowUserPointer(m_Window, this);
 
-        // Register callbacks that translate GLFW events into engine events and forward them to the sink.
+        // Register callbacks that translate GLFW events into plain records queued for the current frame.
         // Use the framebuffer size callback so the renderer receives pixel-accurate dimensions for the viewport.
         glfwSetFramebufferSizeCallback(m_Window, [](GLFWwindow* windowHandle, int width, int height)
             {
                 Window* l_Window = static_cast<Window*>(glfwGetWindowUserPointer(windowHandle));
-                if (l_Window == nullptr || l_Window->m_EventCallback == nullptr)
+                if (l_Window == nullptr)
                 {
                     return;
                 }
 
-                WindowResizeEvent l_Event(width, height);
-                //ENGINE_TRACE("Framebuffer resized to {}x{}", width, height);
-                l_Window->m_EventCallback(l_Event);
+                l_Window->m_Specification.Width = width;
+                l_Window->m_Specification.Height = height;
+
+                ENGINE_CHANNEL_TRACE(Window, "Framebuffer resized to {}x{}", width, height);
+                l_Window->m_EventQueue.PushWindowResize(width, height);
             });
 
         glfwSetWindowCloseCallback(m_Window, [](GLFWwindow* windowHandle)
             {
                 Window* l_Window = static_cast<Window*>(glfwGetWindowUserPointer(windowHandle));
-                if (l_Window == nullptr || l_Window->m_EventCallback == nullptr)
+                if (l_Window == nullptr)
                 {
                     return;
                 }
 
-                WindowCloseEvent l_Event;
-                //ENGINE_TRACE("Window close requested");
-                l_Window->m_EventCallback(l_Event);
+                ENGINE_CHANNEL_TRACE(Window, "Window close requested");
+                l_Window->m_EventQueue.PushWindowClose();
             });
 
         glfwSetWindowFocusCallback(m_Window, [](GLFWwindow* windowHandle, int focused)
             {
                 Window* l_Window = static_cast<Window*>(glfwGetWindowUserPointer(windowHandle));
-                if (l_Window == nullptr || l_Window->m_EventCallback == nullptr)
+                if (l_Window == nullptr)
                 {
                     return;
                 }
 
-                const bool l_IsFocused = focused == GLFW_TRUE;
-                WindowFocusChangedEvent l_Event(l_IsFocused);
-                l_Window->m_EventCallback(l_Event);
+                l_Window->m_EventQueue.PushWindowFocusChanged(focused == GLFW_TRUE);
             });
 
         glfwSetWindowMaximizeCallback(m_Window, [](GLFWwindow* windowHandle, int maximized)
             {
                 Window* l_Window = static_cast<Window*>(glfwGetWindowUserPointer(windowHandle));
-                if (l_Window == nullptr || l_Window->m_EventCallback == nullptr)
+                if (l_Window == nullptr)
                 {
                     return;
                 }
 
-                const bool l_IsMaximized = maximized == GLFW_TRUE;
-                WindowMaximizeChangedEvent l_Event(l_IsMaximized);
-                l_Window->m_EventCallback(l_Event);
+                l_Window->m_EventQueue.PushWindowMaximizeChanged(maximized == GLFW_TRUE);
             });
 
         glfwSetKeyCallback(m_Window, [](GLFWwindow* windowHandle, int key, int, int action, int mods)
             {
                 (void)mods;
                 Window* l_Window = static_cast<Window*>(glfwGetWindowUserPointer(windowHandle));
-                if (l_Window == nullptr || l_Window->m_EventCallback == nullptr)
+                if (l_Window == nullptr)
                 {
                     return;
                 }
 
                 if (action == GLFW_PRESS)
                 {
-                    KeyPressedEvent l_Event(key, 0);
-                    //ENGINE_TRACE("Key {} pressed", key);
-                    l_Window->m_EventCallback(l_Event);
+                    ENGINE_CHANNEL_TRACE(Window, "Key {} pressed", key);
+                    l_Window->m_EventQueue.PushKeyPressed(key, 0);
                 }
                 else if (action == GLFW_RELEASE)
                 {
-                    KeyReleasedEvent l_Event(key);
-                    //ENGINE_TRACE("Key {} released", key);
-                    l_Window->m_EventCallback(l_Event);
+                    ENGINE_CHANNEL_TRACE(Window, "Key {} released", key);
+                    l_Window->m_EventQueue.PushKeyReleased(key);
                 }
                 else if (action == GLFW_REPEAT)
                 {
-                    KeyPressedEvent l_Event(key, 1);
-                    //ENGINE_TRACE("Key {} repeated", key);
-                    l_Window->m_EventCallback(l_Event);
+                    ENGINE_CHANNEL_TRACE(Window, "Key {} repeated", key);
+                    l_Window->m_EventQueue.PushKeyPressed(key, 1);
                 }
             });
 
         glfwSetCursorPosCallback(m_Window, [](GLFWwindow* windowHandle, double xPosition, double yPosition)
             {
                 Window* l_Window = static_cast<Window*>(glfwGetWindowUserPointer(windowHandle));
-                if (l_Window == nullptr || l_Window->m_EventCallback == nullptr)
+                if (l_Window == nullptr)
                 {
                     return;
                 }
 
-                MouseMovedEvent l_Event(static_cast<float>(xPosition), static_cast<float>(yPosition));
-                //ENGINE_TRACE("Mouse moved to ({}, {})", xPosition, yPosition);
-                l_Window->m_EventCallback(l_Event);
+                ENGINE_CHANNEL_TRACE(Window, "Mouse moved to ({}, {})", xPosition, yPosition);
+                l_Window->m_EventQueue.PushMouseMoved(static_cast<float>(xPosition), static_cast<float>(yPosition));
             });
 
         glfwSetMouseButtonCallback(m_Window, [](GLFWwindow* windowHandle, int button, int action, int)
             {
                 Window* l_Window = static_cast<Window*>(glfwGetWindowUserPointer(windowHandle));
-                if (l_Window == nullptr || l_Window->m_EventCallback == nullptr)
+                if (l_Window == nullptr)
                 {
                     return;
                 }
 
                 if (action == GLFW_PRESS)
                 {
-                    MouseButtonPressedEvent l_Event(button);
-                    //ENGINE_TRACE("Mouse button {} pressed", button);
-                    l_Window->m_EventCallback(l_Event);
+                    ENGINE_CHANNEL_TRACE(Window, "Mouse button {} pressed", button);
+                    l_Window->m_EventQueue.PushMouseButtonPressed(button);
                 }
                 else if (action == GLFW_RELEASE)
                 {
-                    MouseButtonReleasedEvent l_Event(button);
-                    //ENGINE_TRACE("Mouse button {} released", button);
-                    l_Window->m_EventCallback(l_Event);
+                    ENGINE_CHANNEL_TRACE(Window, "Mouse button {} released", button);
+                    l_Window->m_EventQueue.PushMouseButtonReleased(button);
                 }
             });
 
         glfwSetScrollCallback(m_Window, [](GLFWwindow* windowHandle, double xOffset, double yOffset)
             {
                 Window* l_Window = static_cast<Window*>(glfwGetWindowUserPointer(windowHandle));
-                if (l_Window == nullptr || l_Window->m_EventCallback == nullptr)
+                if (l_Window == nullptr)
                 {
                     return;
                 }
 
-                MouseScrolledEvent l_Event(static_cast<float>(xOffset), static_cast<float>(yOffset));
-                //ENGINE_TRACE("Mouse scrolled by ({}, {})", xOffset, yOffset);
-                l_Window->m_EventCallback(l_Event);
+                ENGINE_CHANNEL_TRACE(Window, "Mouse scrolled by ({}, {})", xOffset, yOffset);
+                l_Window->m_EventQueue.PushMouseScrolled(static_cast<float>(xOffset), static_cast<float>(yOffset));
             });
 
         glfwMakeContextCurrent(m_Window);
-        ENGINE_TRACE("Window initialized");
+        ENGINE_CHANNEL_TRACE(Window, "Window initialized");
 
         bool l_IsGladInitialized = gladLoadGLLoader((GLADloadproc)glfwGetProcAddress);
         if (!l_IsGladInitialized)
         {
             // GLAD failed, so destroy the window now and clear the pointer so shutdown never double-destroys it.
-            ENGINE_ERROR("Failed to initialize GLAD");
+            ENGINE_CHANNEL_ERROR(Window, "Failed to initialize GLAD");
             glfwDestroyWindow(m_Window);
             m_Window = nullptr;
 
             return false;
         }
 
-        ENGINE_TRACE("GLAD initialized");
+        ENGINE_CHANNEL_TRACE(Window, "GLAD initialized");
 
-        ENGINE_INFO("Window initialization completed");
+        ENGINE_CHANNEL_INFO(Window, "Window initialization completed");
 
         return true;
     }
@@ -185,12 +186,47 @@ namespace Engine
             glfwDestroyWindow(m_Window);
             m_Window = NULL;
 
-            ENGINE_TRACE("Window shutdown complete");
+            ENGINE_CHANNEL_TRACE(Window, "Window shutdown complete");
+        }
+    }
+
+    void Window::PollEvents()
+    {
+        if (m_Window != NULL)
+        {
+            glfwPollEvents();
+        }
+
+        // Synthetic events run after OS events so scripted input can override whatever the platform reported.
+        if (m_SyntheticEventSource != nullptr)
+        {
+            m_SyntheticEventSource([this](const Event& event)
+                {
+                    DispatchEvent(event);
+                });
+        }
+    }
+
+    void Window::SwapBuffers()
+    {
+        if (m_Window != NULL)
+        {
+            glfwSwapBuffers(m_Window);
         }
     }
 
     bool Window::ShouldWindowClose()
     {
+        if (m_IsCloseRequested)
+        {
+            return true;
+        }
+
+        if (m_Specification.Headless)
+        {
+            return false;
+        }
+
         // If m_Window is null, signal closure to avoid dereferencing a null pointer in the loop.
         if (m_Window == NULL)
         {
@@ -199,4 +235,27 @@ namespace Engine
 
         return glfwWindowShouldClose(m_Window);
     }
+
+    void Window::RequestClose()
+    {
+        m_IsCloseRequested = true;
+
+        if (m_Window != NULL)
+        {
+            glfwSetWindowShouldClose(m_Window, GLFW_TRUE);
+        }
+    }
+
+    void Window::DispatchEvent(const Event& event)
+    {
+        if (event.GetEventType() == EventType::WindowResize)
+        {
+            // Keep the cached size coherent for headless runs where no framebuffer callback exists.
+            const WindowResizeEvent& l_ResizeEvent = static_cast<const WindowResizeEvent&>(event);
+            m_Specification.Width = l_ResizeEvent.GetWidth();
+            m_Specification.Height = l_ResizeEvent.GetHeight();
+        }
+
+        m_EventQueue.Push(event);
+    }
 }
\ No newline at end of file
@@ -1,32 +1,76 @@
 #pragma once
 
 #include "Engine/Core/Core.h"
+#include "Engine/Events/EventQueue.h"
 #include "Engine/Events/Events.h"
 
 #include <functional>
+#include <string>
 
 struct GLFWwindow;
 
 namespace Engine
 {
+    // Describes how the window should be created; headless windows never touch GLFW or OpenGL.
+    struct WindowSpecification
+    {
+        std::string Title = "Minecraft-Clone";
+        int Width = 1920;
+        int Height = 1080;
+
+        // When true no native window or GL context is created and events come from the synthetic source only.
+        bool Headless = false;
+    };
+
     class ENGINE_API Window
     {
     public:
-        bool Initialize();
+        using EventCallbackFn = std::function<void(const Event&)>;
+
+        // A synthetic source is invoked once per PollEvents call and emits events through the supplied callback.
+        using SyntheticEventSourceFn = std::function<void(const EventCallbackFn&)>;
+
+        bool Initialize(const WindowSpecification& specification);
         void Shutdown();
 
+        // Pump OS events (when a native window exists) and then the synthetic source (when one is set).
+        void PollEvents();
+
+        // Present the back buffer; a no-op for headless windows.
+        void SwapBuffers();
+
         bool ShouldWindowClose();
 
+        // Ask the window to close at the end of the current frame, regardless of backend.
+        void RequestClose();
+
+        bool IsHeadless() const { return m_Specification.Headless; }
+        int GetWidth() const { return m_Specification.Width; }
+        int GetHeight() const { return m_Specification.Height; }
+
         GLFWwindow* GetNativeWindow() { return m_Window; }
 
-        // Allow callers to supply a sink for translated GLFW events.
-        void SetEventCallback(const std::function<void(const Event&)>& eventCallback) { m_EventCallback = eventCallback; }
+        // Events gathered by the last PollEvents; the application consumes and clears them once per frame.
+        EventQueue& GetEventQueue() { return m_EventQueue; }
+
+        // Install a source of engine-generated events, used by headless runs to drive input and window state.
+        void SetSyntheticEventSource(const SyntheticEventSourceFn& eventSource) { m_SyntheticEventSource = eventSource; }
+
+        // Queue an engine-generated event exactly as if it had come from GLFW.
+        void DispatchEvent(const Event& event);
 
     private:
+        WindowSpecification m_Specification;
+
         // Pointer to the GLFW window; initialized to nullptr for safe shutdown handling.
         GLFWwindow* m_Window = nullptr;
 
-        // Callback sink that receives translated GLFW events for the rest of the engine.
-        std::function<void(const Event&)> m_EventCallback;
+        // Headless windows have no GLFW close flag, so the request is tracked here instead.
+        bool m_IsCloseRequested = false;
+
+        // GLFW callbacks append plain records here instead of dispatching through the Event hierarchy.
+        EventQueue m_EventQueue;
+
+        SyntheticEventSourceFn m_SyntheticEventSource;
     };
 }
\ No newline at end of file
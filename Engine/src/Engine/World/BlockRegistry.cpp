@@ -0,0 +1,285 @@
+#include "Engine/World/BlockRegistry.h"
+
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Profiler.h"
+
+#include <yaml-cpp/yaml.h>
+
+#include <utility>
+
+namespace Engine
+{
+    namespace
+    {
+        bool ParseRenderLayer(const std::string& text, BlockRenderLayer& layer)
+        {
+            static const std::pair<const char*, BlockRenderLayer> s_Layers[] =
+            {
+                { "Invisible", BlockRenderLayer::Invisible },
+                { "Opaque", BlockRenderLayer::Opaque },
+                { "Cutout", BlockRenderLayer::Cutout },
+                { "Translucent", BlockRenderLayer::Translucent }
+            };
+
+            for (const auto& it_Layer : s_Layers)
+            {
+                if (text == it_Layer.first)
+                {
+                    layer = it_Layer.second;
+
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        bool ReadLightLevel(const YAML::Node& node, uint8_t& level)
+        {
+            const int32_t l_Value = node.as<int32_t>();
+            if (l_Value < 0 || l_Value > 15)
+            {
+                return false;
+            }
+            level = static_cast<uint8_t>(l_Value);
+
+            return true;
+        }
+
+        // A scalar applies to all six faces; a map assigns All, then Sides, then Top/Bottom and single faces.
+        bool ReadFaceTiles(const YAML::Node& node, std::array<uint16_t, 6>& tiles)
+        {
+            if (node.IsScalar())
+            {
+                tiles.fill(node.as<uint16_t>());
+
+                return true;
+            }
+
+            if (!node.IsMap())
+            {
+                return false;
+            }
+
+            static const char* const s_FaceKeys[] = { "PositiveX", "NegativeX", "Top", "Bottom", "PositiveZ", "NegativeZ" };
+            if (node["All"])
+            {
+                tiles.fill(node["All"].as<uint16_t>());
+            }
+
+            if (node["Sides"])
+            {
+                const uint16_t l_Tile = node["Sides"].as<uint16_t>();
+                tiles[static_cast<size_t>(BlockFace::PositiveX)] = l_Tile;
+                tiles[static_cast<size_t>(BlockFace::NegativeX)] = l_Tile;
+                tiles[static_cast<size_t>(BlockFace::PositiveZ)] = l_Tile;
+                tiles[static_cast<size_t>(BlockFace::NegativeZ)] = l_Tile;
+            }
+
+            for (size_t i = 0; i < tiles.size(); ++i)
+            {
+                if (node[s_FaceKeys[i]])
+                {
+                    tiles[i] = node[s_FaceKeys[i]].as<uint16_t>();
+                }
+            }
+
+            return true;
+        }
+
+        // Fills definition from one list entry; error names the offending field when it returns false.
+        bool ReadDefinition(const YAML::Node& node, BlockDefinition& definition, std::string& error)
+        {
+            if (!node.IsMap() || !node["Name"])
+            {
+                error = "entry has no Name";
+
+                return false;
+            }
+            definition.Name = node["Name"].as<std::string>();
+
+            if (node["Opaque"])
+            {
+                definition.Opaque = node["Opaque"].as<bool>();
+            }
+
+            if (node["Solid"])
+            {
+                definition.Solid = node["Solid"].as<bool>();
+            }
+
+            // Defaults follow opacity: see-through blocks let light pass and are alpha tested.
+            definition.LightOpacity = definition.Opaque ? 15 : 0;
+            definition.RenderLayer = definition.Opaque ? BlockRenderLayer::Opaque : BlockRenderLayer::Cutout;
+
+            if (node["LightOpacity"] && !ReadLightLevel(node["LightOpacity"], definition.LightOpacity))
+            {
+                error = "LightOpacity must be within 0..15";
+
+                return false;
+            }
+
+            if (node["LightEmission"] && !ReadLightLevel(node["LightEmission"], definition.LightEmission))
+            {
+                error = "LightEmission must be within 0..15";
+
+                return false;
+            }
+
+            if (node["RenderLayer"] && !ParseRenderLayer(node["RenderLayer"].as<std::string>(), definition.RenderLayer))
+            {
+                error = "RenderLayer must be Invisible, Opaque, Cutout or Translucent";
+
+                return false;
+            }
+
+            if (node["Tiles"] && !ReadFaceTiles(node["Tiles"], definition.FaceTiles))
+            {
+                error = "Tiles must be a tile index or a map of faces to tile indices";
+
+                return false;
+            }
+
+            return true;
+        }
+
+        // Registers the entries of a parsed definition document in file order.
+        bool RegisterAll(BlockRegistry& registry, const YAML::Node& root, std::string_view sourceName)
+        {
+            const YAML::Node l_Blocks = root.IsMap() ? root["Blocks"] : YAML::Node();
+            if (!l_Blocks || !l_Blocks.IsSequence())
+            {
+                ENGINE_CHANNEL_ERROR(World, "Block definitions {} have no Blocks list", sourceName);
+
+                return false;
+            }
+
+            const uint32_t l_FirstId = registry.GetBlockCount();
+            for (size_t i = 0; i < l_Blocks.size(); ++i)
+            {
+                BlockDefinition l_Definition;
+                std::string l_Error;
+                bool l_IsValid = false;
+                try
+                {
+                    l_IsValid = ReadDefinition(l_Blocks[i], l_Definition, l_Error);
+                }
+                catch (const YAML::Exception& exception)
+                {
+                    l_Error = exception.what();
+                }
+
+                if (!l_IsValid)
+                {
+                    ENGINE_CHANNEL_WARN(World, "Skipping block {} in {}: {}", i, sourceName, l_Error);
+                    continue;
+                }
+
+                if (registry.Register(l_Definition) == BlockRegistry::InvalidBlockId)
+                {
+                    ENGINE_CHANNEL_WARN(World, "Skipping block {} in {}: the name is taken or the registry is full", l_Definition.Name, sourceName);
+                }
+            }
+
+            ENGINE_CHANNEL_INFO(World, "Registered {} block types from {} ({} in total, {} bytes of tables)", registry.GetBlockCount() - l_FirstId, sourceName,
+                registry.GetBlockCount(), registry.GetTableSize());
+
+            return true;
+        }
+    }
+
+    BlockRegistry::BlockRegistry()
+    {
+        BlockDefinition l_Air;
+        l_Air.Name = "air";
+        l_Air.Opaque = false;
+        l_Air.Solid = false;
+        l_Air.LightOpacity = 0;
+        l_Air.RenderLayer = BlockRenderLayer::Invisible;
+        Register(l_Air);
+    }
+
+    BlockId BlockRegistry::Register(const BlockDefinition& definition)
+    {
+        if (definition.Name.empty() || GetBlockCount() >= MaxBlockCount || m_IdsByName.count(definition.Name) != 0)
+        {
+            return InvalidBlockId;
+        }
+
+        const BlockId l_Id = static_cast<BlockId>(GetBlockCount());
+
+        uint8_t l_Flags = 0;
+        l_Flags |= definition.RenderLayer != BlockRenderLayer::Invisible ? FlagVisible : 0;
+        l_Flags |= definition.Opaque ? FlagOpaque : 0;
+        l_Flags |= definition.Solid ? FlagSolid : 0;
+
+        m_MeshingTable.BlockFlags.push_back(l_Flags);
+        m_MeshingTable.FaceTiles.insert(m_MeshingTable.FaceTiles.end(), definition.FaceTiles.begin(), definition.FaceTiles.end());
+        m_LightOpacity.push_back(definition.LightOpacity);
+        m_LightEmission.push_back(definition.LightEmission);
+        m_RenderLayers.push_back(definition.RenderLayer);
+
+        m_Names.push_back(definition.Name);
+        m_IdsByName.emplace(definition.Name, l_Id);
+
+        return l_Id;
+    }
+
+    bool BlockRegistry::LoadFromFile(const std::filesystem::path& path)
+    {
+        ENGINE_PROFILE_SCOPE("BlockRegistry::LoadFromFile");
+
+        YAML::Node l_Root;
+        try
+        {
+            l_Root = YAML::LoadFile(path.string());
+        }
+        catch (const YAML::Exception& exception)
+        {
+            ENGINE_CHANNEL_ERROR(World, "Failed to read block definitions {}: {}", path.string(), exception.what());
+
+            return false;
+        }
+
+        return RegisterAll(*this, l_Root, path.string());
+    }
+
+    bool BlockRegistry::LoadFromString(const std::string& yaml, std::string_view sourceName)
+    {
+        ENGINE_PROFILE_SCOPE("BlockRegistry::LoadFromString");
+
+        YAML::Node l_Root;
+        try
+        {
+            l_Root = YAML::Load(yaml);
+        }
+        catch (const YAML::Exception& exception)
+        {
+            ENGINE_CHANNEL_ERROR(World, "Failed to parse block definitions {}: {}", sourceName, exception.what());
+
+            return false;
+        }
+
+        return RegisterAll(*this, l_Root, sourceName);
+    }
+
+    BlockId BlockRegistry::FindBlock(std::string_view name) const
+    {
+        const auto it_Block = m_IdsByName.find(std::string(name));
+
+        return it_Block != m_IdsByName.end() ? it_Block->second : InvalidBlockId;
+    }
+
+    const std::string& BlockRegistry::GetName(BlockId block) const
+    {
+        static const std::string s_Unknown = "unknown";
+
+        return block < m_Names.size() ? m_Names[block] : s_Unknown;
+    }
+
+    size_t BlockRegistry::GetTableSize() const
+    {
+        return m_MeshingTable.BlockFlags.size() + m_MeshingTable.FaceTiles.size() * sizeof(uint16_t) + m_LightOpacity.size() + m_LightEmission.size()
+            + m_RenderLayers.size() * sizeof(BlockRenderLayer);
+    }
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/World/ChunkMesher.h"
+#include "Engine/World/PaletteStorage.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine
+{
+    // Which pass draws a block's faces.
+    enum class BlockRenderLayer : uint8_t
+    {
+        Invisible = 0,  // No faces at all (air, barriers).
+        Opaque,         // Depth-tested and written, no blending.
+        Cutout,         // Alpha-tested (leaves, plants).
+        Translucent     // Blended back to front (water, stained glass).
+    };
+
+    // Everything known about a block type while it is being registered. Only the registry's flat tables are
+    // used at runtime; this struct, the YAML it came from and the name strings stay off every hot path.
+    struct BlockDefinition
+    {
+        std::string Name;
+
+        // Hides the faces of neighbouring blocks.
+        bool Opaque = true;
+
+        // Blocks movement.
+        bool Solid = true;
+
+        // Light levels (0..15) lost when light passes through; opaque blocks default to 15 and others to 0.
+        uint8_t LightOpacity = 15;
+
+        // Light level (0..15) the block emits.
+        uint8_t LightEmission = 0;
+
+        BlockRenderLayer RenderLayer = BlockRenderLayer::Opaque;
+
+        // Atlas tile per face, in BlockFace order.
+        std::array<uint16_t, 6> FaceTiles{};
+    };
+
+    // Block types with dense ids and their properties in struct-of-arrays tables indexed by BlockId.
+    // Every query is one byte (or one u16 tile) read from a contiguous array, so the mesher, lighting and
+    // physics never chase pointers: a pack with 4096 block types needs 4 KB per one-byte property, which
+    // stays in L1, plus 48 KB of face tiles for the mesher.
+    //
+    // Air is always id 0. Other ids are handed out in registration order, so the same definition files loaded
+    // in the same order always produce the same ids. Register everything at startup, before any table is
+    // shared with jobs; the tables are read-only afterwards and safe to read from any thread.
+    class ENGINE_API BlockRegistry
+    {
+    public:
+        static constexpr BlockId InvalidBlockId = 0xFFFF;
+        static constexpr uint32_t MaxBlockCount = InvalidBlockId;
+
+        // Flag bits shared with MeshingBlockTable; the mesher ignores the ones it does not know.
+        enum Flags : uint8_t
+        {
+            FlagVisible = MeshingBlockTable::FlagVisible,
+            FlagOpaque = MeshingBlockTable::FlagOpaque,
+            FlagSolid = 1 << 2
+        };
+
+        BlockRegistry();
+
+        // Assigns the next id, or returns InvalidBlockId when the name is empty, taken or the registry is full.
+        BlockId Register(const BlockDefinition& definition);
+
+        // Registers every entry of a YAML definition file (see Game/Assets/Blocks/Blocks.yaml for the schema).
+        // Malformed entries are reported and skipped; returns false when the file itself cannot be parsed.
+        bool LoadFromFile(const std::filesystem::path& path);
+        bool LoadFromString(const std::string& yaml, std::string_view sourceName);
+
+        BlockId FindBlock(std::string_view name) const;
+        const std::string& GetName(BlockId block) const;
+        uint32_t GetBlockCount() const { return static_cast<uint32_t>(m_LightOpacity.size()); }
+
+        // Hot-path queries. Ids outside the registry behave like an unknown opaque, solid block.
+        uint8_t GetFlags(BlockId block) const { return m_MeshingTable.GetFlags(block); }
+        bool IsVisible(BlockId block) const { return (GetFlags(block) & FlagVisible) != 0; }
+        bool IsOpaque(BlockId block) const { return (GetFlags(block) & FlagOpaque) != 0; }
+        bool IsSolid(BlockId block) const { return block < GetBlockCount() ? (m_MeshingTable.BlockFlags[block] & FlagSolid) != 0 : true; }
+        uint8_t GetLightOpacity(BlockId block) const { return block < GetBlockCount() ? m_LightOpacity[block] : uint8_t(15); }
+        uint8_t GetLightEmission(BlockId block) const { return block < GetBlockCount() ? m_LightEmission[block] : uint8_t(0); }
+        BlockRenderLayer GetRenderLayer(BlockId block) const { return block < GetBlockCount() ? m_RenderLayers[block] : BlockRenderLayer::Opaque; }
+        uint16_t GetFaceTile(BlockId block, BlockFace face) const { return m_MeshingTable.GetFaceTile(block, face); }
+
+        // Whole tables, for loops that index them directly; each holds GetBlockCount() entries.
+        const uint8_t* GetLightOpacityTable() const { return m_LightOpacity.data(); }
+        const uint8_t* GetLightEmissionTable() const { return m_LightEmission.data(); }
+
+        // The flag and face tile tables in the layout ChunkMesher reads; they are the registry's own storage.
+        const MeshingBlockTable& GetMeshingTable() const { return m_MeshingTable; }
+
+        // Bytes of runtime tables (everything but names), to check a content pack against cache sizes.
+        size_t GetTableSize() const;
+
+    private:
+        MeshingBlockTable m_MeshingTable;
+        std::vector<uint8_t> m_LightOpacity;
+        std::vector<uint8_t> m_LightEmission;
+        std::vector<BlockRenderLayer> m_RenderLayers;
+
+        // Cold data, only used by name lookups and diagnostics.
+        std::vector<std::string> m_Names;
+        std::unordered_map<std::string, BlockId> m_IdsByName;
+    };
+}
@@ -0,0 +1,42 @@
+#include "Engine/World/Chunk.h"
+
+namespace Engine
+{
+    Chunk::Chunk(const ChunkCoord& coord, BlockId fillValue) : m_Coord(coord), m_Blocks(Volume, fillValue)
+    {
+
+    }
+
+    BlockId Chunk::SetBlock(int32_t x, int32_t y, int32_t z, BlockId block)
+    {
+        return SetBlock(GetIndex(x, y, z), block);
+    }
+
+    BlockId Chunk::SetBlock(uint32_t index, BlockId block)
+    {
+        const BlockId l_Previous = m_Blocks.Set(index, block);
+        if (l_Previous != block)
+        {
+            ++m_Version;
+        }
+
+        return l_Previous;
+    }
+
+    void Chunk::Fill(BlockId block)
+    {
+        m_Blocks.Fill(block);
+        ++m_Version;
+    }
+
+    void Chunk::AssignBlocks(const BlockId* blocks)
+    {
+        m_Blocks.AssignDense(blocks);
+        ++m_Version;
+    }
+
+    size_t Chunk::GetMemoryUsage() const
+    {
+        return sizeof(Chunk) - sizeof(PaletteStorage) - sizeof(LightStorage) + m_Blocks.GetMemoryUsage() + m_Light.GetMemoryUsage();
+    }
+}
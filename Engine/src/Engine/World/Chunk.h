@@ -0,0 +1,97 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/World/LightStorage.h"
+#include "Engine/World/PaletteStorage.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace Engine
+{
+    // Integer chunk position; world block (x, y, z) lives in chunk (floor(x / 32), floor(y / 32), floor(z / 32)).
+    struct ChunkCoord
+    {
+        int32_t X = 0;
+        int32_t Y = 0;
+        int32_t Z = 0;
+
+        bool operator==(const ChunkCoord& other) const = default;
+    };
+
+    struct ChunkCoordHash
+    {
+        size_t operator()(const ChunkCoord& coord) const
+        {
+            // Large odd multipliers spread neighbouring coordinates across buckets.
+            uint64_t l_Hash = static_cast<uint32_t>(coord.X) * 0x9E3779B97F4A7C15ull;
+            l_Hash ^= static_cast<uint32_t>(coord.Y) * 0xC2B2AE3D27D4EB4Full;
+            l_Hash ^= static_cast<uint32_t>(coord.Z) * 0x165667B19E3779F9ull;
+
+            return static_cast<size_t>(l_Hash ^ (l_Hash >> 29));
+        }
+    };
+
+    // Cubic 32x32x32 block volume stored through a palette. Local coordinates are in [0, Size).
+    class ENGINE_API Chunk
+    {
+    public:
+        static constexpr int32_t SizeShift = 5;
+        static constexpr int32_t Size = 1 << SizeShift;
+        static constexpr int32_t SizeMask = Size - 1;
+        static constexpr uint32_t Volume = Size * Size * Size;
+
+        explicit Chunk(const ChunkCoord& coord, BlockId fillValue = AirBlockId);
+
+        // Index layout is x fastest, then z, then y, so a horizontal layer is contiguous.
+        static uint32_t GetIndex(int32_t x, int32_t y, int32_t z)
+        {
+            return static_cast<uint32_t>((y << (2 * SizeShift)) | (z << SizeShift) | x);
+        }
+
+        BlockId GetBlock(int32_t x, int32_t y, int32_t z) const { return m_Blocks.Get(GetIndex(x, y, z)); }
+        BlockId GetBlock(uint32_t index) const { return m_Blocks.Get(index); }
+
+        // Returns the previous block; bumps the version when the block actually changes.
+        BlockId SetBlock(int32_t x, int32_t y, int32_t z, BlockId block);
+        BlockId SetBlock(uint32_t index, BlockId block);
+
+        void Fill(BlockId block);
+
+        // Replace the whole volume from Volume ids in GetIndex order.
+        void AssignBlocks(const BlockId* blocks);
+
+        // Release unused palette entries; call after bulk edits or before serialization.
+        void Compact() { m_Blocks.Compact(); }
+
+        const ChunkCoord& GetCoord() const { return m_Coord; }
+
+        // Monotonic edit counter used to detect stale derived data such as meshes.
+        uint64_t GetVersion() const { return m_Version; }
+
+        bool IsUniform() const { return m_Blocks.IsUniform(); }
+        bool IsEmpty() const { return m_Blocks.IsUniform() && m_Blocks.Get(0) == AirBlockId; }
+
+        const PaletteStorage& GetStorage() const { return m_Blocks; }
+        PaletteStorage& GetStorage() { return m_Blocks; }
+
+        // Sky and block light, written by LightEngine only; block edits do not touch it or the version.
+        const LightStorage& GetLight() const { return m_Light; }
+        LightStorage& GetLight() { return m_Light; }
+
+        size_t GetMemoryUsage() const;
+
+    private:
+        ChunkCoord m_Coord;
+        PaletteStorage m_Blocks;
+        LightStorage m_Light;
+        uint64_t m_Version = 0;
+    };
+
+    static_assert(LightStorage::Volume == Chunk::Volume, "Light storage must cover a whole chunk");
+
+    // Split a world block coordinate into its chunk coordinate and local offset.
+    inline int32_t WorldToChunk(int32_t worldCoordinate) { return worldCoordinate >> Chunk::SizeShift; }
+    inline int32_t WorldToLocal(int32_t worldCoordinate) { return worldCoordinate & Chunk::SizeMask; }
+}
@@ -0,0 +1,151 @@
+#include "Engine/World/ChunkMap.h"
+
+#include <utility>
+
+namespace Engine
+{
+    ChunkMap::ChunkMap()
+    {
+        m_Keys.assign(s_InitialCapacity, s_EmptyKey);
+        m_Values.resize(s_InitialCapacity);
+        m_HashShift = 64 - 6;
+    }
+
+    ChunkMap::~ChunkMap() = default;
+
+    Chunk* ChunkMap::Find(const ChunkCoord& coord) const
+    {
+        const size_t l_Slot = FindSlot(coord);
+
+        return l_Slot != s_NotFound ? m_Values[l_Slot].get() : nullptr;
+    }
+
+    Chunk& ChunkMap::Insert(std::unique_ptr<Chunk> chunk)
+    {
+        const ChunkCoord l_Coord = chunk->GetCoord();
+        const size_t l_Existing = FindSlot(l_Coord);
+        if (l_Existing != s_NotFound)
+        {
+            m_Values[l_Existing] = std::move(chunk);
+
+            return *m_Values[l_Existing];
+        }
+
+        if ((m_Size + 1) * 10 > m_Keys.size() * 7)
+        {
+            Grow();
+        }
+
+        const size_t l_Mask = m_Keys.size() - 1;
+        size_t l_Slot = GetHomeSlot(l_Coord);
+        while (m_Values[l_Slot] != nullptr)
+        {
+            l_Slot = (l_Slot + 1) & l_Mask;
+        }
+
+        m_Keys[l_Slot] = l_Coord;
+        m_Values[l_Slot] = std::move(chunk);
+        ++m_Size;
+
+        return *m_Values[l_Slot];
+    }
+
+    std::unique_ptr<Chunk> ChunkMap::Extract(const ChunkCoord& coord)
+    {
+        size_t l_Hole = FindSlot(coord);
+        if (l_Hole == s_NotFound)
+        {
+            return nullptr;
+        }
+
+        std::unique_ptr<Chunk> l_Chunk = std::move(m_Values[l_Hole]);
+        --m_Size;
+
+        // Backward-shift deletion: pull every later entry of the run whose home lies at or before the hole.
+        const size_t l_Mask = m_Keys.size() - 1;
+        for (size_t l_Slot = (l_Hole + 1) & l_Mask; m_Values[l_Slot] != nullptr; l_Slot = (l_Slot + 1) & l_Mask)
+        {
+            const size_t l_Home = GetHomeSlot(m_Keys[l_Slot]);
+            if (((l_Slot - l_Home) & l_Mask) >= ((l_Slot - l_Hole) & l_Mask))
+            {
+                m_Keys[l_Hole] = m_Keys[l_Slot];
+                m_Values[l_Hole] = std::move(m_Values[l_Slot]);
+                l_Hole = l_Slot;
+            }
+        }
+        m_Keys[l_Hole] = s_EmptyKey;
+
+        return l_Chunk;
+    }
+
+    void ChunkMap::GetNeighbourhood(const ChunkCoord& coord, std::array<const Chunk*, 27>& outNeighbours) const
+    {
+        for (int32_t l_DY = -1; l_DY <= 1; ++l_DY)
+        {
+            for (int32_t l_DZ = -1; l_DZ <= 1; ++l_DZ)
+            {
+                for (int32_t l_DX = -1; l_DX <= 1; ++l_DX)
+                {
+                    outNeighbours[(l_DY + 1) * 9 + (l_DZ + 1) * 3 + (l_DX + 1)] = Find({ coord.X + l_DX, coord.Y + l_DY, coord.Z + l_DZ });
+                }
+            }
+        }
+    }
+
+    size_t ChunkMap::GetHomeSlot(const ChunkCoord& coord) const
+    {
+        // Fibonacci hashing: the top bits of the product depend on every bit of all three coordinates.
+        uint64_t l_Hash = static_cast<uint32_t>(coord.X) * 0x9E3779B97F4A7C15ull;
+        l_Hash ^= static_cast<uint32_t>(coord.Y) * 0xC2B2AE3D27D4EB4Full;
+        l_Hash ^= static_cast<uint32_t>(coord.Z) * 0x165667B19E3779F9ull;
+
+        return static_cast<size_t>((l_Hash * 0x9E3779B97F4A7C15ull) >> m_HashShift);
+    }
+
+    size_t ChunkMap::FindSlot(const ChunkCoord& coord) const
+    {
+        const size_t l_Mask = m_Keys.size() - 1;
+        for (size_t l_Slot = GetHomeSlot(coord);; l_Slot = (l_Slot + 1) & l_Mask)
+        {
+            const ChunkCoord& l_Key = m_Keys[l_Slot];
+            if (l_Key == coord)
+            {
+                return m_Values[l_Slot] != nullptr ? l_Slot : s_NotFound;
+            }
+
+            if (l_Key == s_EmptyKey)
+            {
+                return s_NotFound;
+            }
+        }
+    }
+
+    void ChunkMap::Grow()
+    {
+        std::vector<ChunkCoord> l_OldKeys = std::move(m_Keys);
+        std::vector<std::unique_ptr<Chunk>> l_OldValues = std::move(m_Values);
+
+        const size_t l_Capacity = l_OldKeys.size() * 2;
+        m_Keys.assign(l_Capacity, s_EmptyKey);
+        m_Values.clear();
+        m_Values.resize(l_Capacity);
+        --m_HashShift;
+
+        const size_t l_Mask = l_Capacity - 1;
+        for (size_t i = 0; i < l_OldKeys.size(); ++i)
+        {
+            if (l_OldValues[i] == nullptr)
+            {
+                continue;
+            }
+
+            size_t l_Slot = GetHomeSlot(l_OldKeys[i]);
+            while (m_Values[l_Slot] != nullptr)
+            {
+                l_Slot = (l_Slot + 1) & l_Mask;
+            }
+            m_Keys[l_Slot] = l_OldKeys[i];
+            m_Values[l_Slot] = std::move(l_OldValues[i]);
+        }
+    }
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/World/Chunk.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Engine
+{
+    // Open-addressed hash map from chunk coordinates to owned chunks, built for the world's lookup pattern:
+    // many finds (block access, meshing and lighting neighbours) and comparatively rare inserts and removals.
+    //   - Keys live in their own flat array with a sentinel for empty slots, so a probe walks 12-byte entries
+    //     without touching the chunk pointers.
+    //   - Linear probing over a power-of-two table at most 70% full; removal shifts later entries back
+    //     instead of leaving tombstones, so lookups never slow down as chunks stream in and out.
+    //   - A multiplicative hash of all three coordinates keeps neighbouring chunks in separate probe runs.
+    // Not thread-safe, like the World that owns it.
+    class ENGINE_API ChunkMap
+    {
+    public:
+        ChunkMap();
+        ~ChunkMap();
+
+        ChunkMap(const ChunkMap&) = delete;
+        ChunkMap& operator=(const ChunkMap&) = delete;
+
+        Chunk* Find(const ChunkCoord& coord) const;
+
+        // Takes ownership, replacing any chunk already stored at the same coordinate.
+        Chunk& Insert(std::unique_ptr<Chunk> chunk);
+
+        // Returns null when nothing is stored at the coordinate.
+        std::unique_ptr<Chunk> Extract(const ChunkCoord& coord);
+        bool Erase(const ChunkCoord& coord) { return Extract(coord) != nullptr; }
+
+        // The 3x3x3 block of chunks around coord in PaddedChunkView::Build order; missing chunks are null.
+        void GetNeighbourhood(const ChunkCoord& coord, std::array<const Chunk*, 27>& outNeighbours) const;
+
+        size_t GetSize() const { return m_Size; }
+        size_t GetCapacity() const { return m_Keys.size(); }
+
+        // Visits every chunk in table order; the map must not change during the walk.
+        template<typename F>
+        void ForEach(F&& function) const
+        {
+            for (const std::unique_ptr<Chunk>& it_Value : m_Values)
+            {
+                if (it_Value != nullptr)
+                {
+                    function(*it_Value);
+                }
+            }
+        }
+
+    private:
+        size_t GetHomeSlot(const ChunkCoord& coord) const;
+        size_t FindSlot(const ChunkCoord& coord) const;
+        void Grow();
+
+    private:
+        static constexpr size_t s_InitialCapacity = 64;
+        static constexpr size_t s_NotFound = SIZE_MAX;
+
+        // Far outside any reachable chunk coordinate (WorldToChunk of an int32 stays within +/-2^26).
+        static constexpr ChunkCoord s_EmptyKey{ INT32_MIN, INT32_MIN, INT32_MIN };
+
+        // Parallel arrays; an empty slot holds s_EmptyKey and a null chunk.
+        std::vector<ChunkCoord> m_Keys;
+        std::vector<std::unique_ptr<Chunk>> m_Values;
+        size_t m_Size = 0;
+        uint32_t m_HashShift = 0;
+    };
+}
@@ -0,0 +1,208 @@
+#include "Engine/World/ChunkMeshPipeline.h"
+
+#include "Engine/Jobs/JobSystem.h"
+
+#include <algorithm>
+
+namespace Engine
+{
+    // Everything a completing job touches. Jobs hold a shared reference, so the pipeline can be destroyed
+    // while meshes are still in flight; their results are then discarded on arrival.
+    struct ChunkMeshPipeline::SharedState
+    {
+        const ChunkProvider* Provider = nullptr;
+        const MeshingBlockTable* BlockTable = nullptr;
+        ChunkMesherSettings MesherSettings;
+        UploadCallback Upload;
+        bool IsAlive = true;
+
+        // Latest sequence submitted per chunk; older completions for the same chunk are stale.
+        std::unordered_map<ChunkCoord, uint64_t, ChunkCoordHash> LatestSequence;
+        uint64_t NextSequence = 1;
+        uint32_t InFlightCount = 0;
+
+        // Accumulated since the last Dispatch; rolled into the frame stats there.
+        ChunkMeshPipelineStats Current;
+        double LatencySumMilliseconds = 0.0;
+    };
+
+    ChunkMeshPipeline::ChunkMeshPipeline(JobSystem& jobSystem, const ChunkProvider& chunkProvider, const MeshingBlockTable& blockTable,
+        const ChunkMeshPipelineSettings& settings) : m_JobSystem(jobSystem), m_Settings(settings), m_State(std::make_shared<SharedState>())
+    {
+        m_State->Provider = &chunkProvider;
+        m_State->BlockTable = &blockTable;
+        m_State->MesherSettings = settings.Mesher;
+    }
+
+    ChunkMeshPipeline::~ChunkMeshPipeline()
+    {
+        // Jobs still running keep the state alive; flagging it stops them publishing into a dead owner.
+        m_State->IsAlive = false;
+        m_State->Upload = nullptr;
+    }
+
+    void ChunkMeshPipeline::SetUploadCallback(const UploadCallback& uploadCallback)
+    {
+        m_State->Upload = uploadCallback;
+    }
+
+    uint32_t ChunkMeshPipeline::GetInFlightCount() const
+    {
+        return m_State->InFlightCount;
+    }
+
+    void ChunkMeshPipeline::RequestRemesh(const ChunkCoord& coord)
+    {
+        if (!m_DirtyChunks.insert(coord).second)
+        {
+            ++m_State->Current.CoalescedCount;
+
+            return;
+        }
+
+        m_DispatchOrder.push_back(coord);
+    }
+
+    void ChunkMeshPipeline::NotifyBlockChanged(int32_t worldX, int32_t worldY, int32_t worldZ)
+    {
+        const ChunkCoord l_Coord{ WorldToChunk(worldX), WorldToChunk(worldY), WorldToChunk(worldZ) };
+        RequestRemesh(l_Coord);
+
+        // Blocks on a chunk border are part of the neighbour's padded view, so its faces may change too.
+        const int32_t l_LocalX = WorldToLocal(worldX);
+        const int32_t l_LocalY = WorldToLocal(worldY);
+        const int32_t l_LocalZ = WorldToLocal(worldZ);
+
+        if (l_LocalX == 0) { RequestRemesh({ l_Coord.X - 1, l_Coord.Y, l_Coord.Z }); }
+        if (l_LocalX == Chunk::SizeMask) { RequestRemesh({ l_Coord.X + 1, l_Coord.Y, l_Coord.Z }); }
+        if (l_LocalY == 0) { RequestRemesh({ l_Coord.X, l_Coord.Y - 1, l_Coord.Z }); }
+        if (l_LocalY == Chunk::SizeMask) { RequestRemesh({ l_Coord.X, l_Coord.Y + 1, l_Coord.Z }); }
+        if (l_LocalZ == 0) { RequestRemesh({ l_Coord.X, l_Coord.Y, l_Coord.Z - 1 }); }
+        if (l_LocalZ == Chunk::SizeMask) { RequestRemesh({ l_Coord.X, l_Coord.Y, l_Coord.Z + 1 }); }
+    }
+
+    void ChunkMeshPipeline::Dispatch()
+    {
+        SharedState& l_State = *m_State;
+
+        // Roll the previous frame's counters; completions were published during the main-thread drain.
+        l_State.Current.InFlightCount = l_State.InFlightCount;
+        l_State.Current.AverageLatencyMilliseconds = l_State.Current.UploadedCount > 0
+            ? l_State.LatencySumMilliseconds / l_State.Current.UploadedCount : 0.0;
+        m_LastFrameStats = l_State.Current;
+        l_State.Current = ChunkMeshPipelineStats();
+        l_State.LatencySumMilliseconds = 0.0;
+
+        const std::chrono::steady_clock::time_point l_Now = std::chrono::steady_clock::now();
+
+        uint32_t l_DispatchedCount = 0;
+        size_t l_OrderIndex = 0;
+        for (; l_OrderIndex < m_DispatchOrder.size() && l_DispatchedCount < m_Settings.MaxDispatchPerFrame; ++l_OrderIndex)
+        {
+            const ChunkCoord l_Coord = m_DispatchOrder[l_OrderIndex];
+            m_DirtyChunks.erase(l_Coord);
+
+            const Chunk* l_Chunk = l_State.Provider->FindChunk(l_Coord);
+            if (l_Chunk == nullptr)
+            {
+                // Unloaded since the request; nothing to mesh.
+                continue;
+            }
+
+            std::array<const Chunk*, 27> l_Neighbours{};
+            for (int32_t l_DY = -1; l_DY <= 1; ++l_DY)
+            {
+                for (int32_t l_DZ = -1; l_DZ <= 1; ++l_DZ)
+                {
+                    for (int32_t l_DX = -1; l_DX <= 1; ++l_DX)
+                    {
+                        const size_t l_Index = static_cast<size_t>((l_DY + 1) * 9 + (l_DZ + 1) * 3 + (l_DX + 1));
+                        l_Neighbours[l_Index] = l_State.Provider->FindChunk({ l_Coord.X + l_DX, l_Coord.Y + l_DY, l_Coord.Z + l_DZ });
+                    }
+                }
+            }
+
+            // The snapshot is taken here, on the main thread, so workers never read storage that gameplay mutates.
+            std::shared_ptr<MeshTask> l_Task = std::make_shared<MeshTask>();
+            l_Task->Coord = l_Coord;
+            l_Task->Sequence = l_State.NextSequence++;
+            l_Task->ChunkVersion = l_Chunk->GetVersion();
+            l_Task->SubmitTime = l_Now;
+            l_Task->View.Build(l_Neighbours);
+            l_Task->View.SetCoord(l_Coord);
+
+            l_State.LatestSequence[l_Coord] = l_Task->Sequence;
+            ++l_State.InFlightCount;
+            ++l_State.Current.SubmittedCount;
+            ++l_DispatchedCount;
+
+            std::shared_ptr<SharedState> l_SharedState = m_State;
+            JobSystem* l_JobSystem = &m_JobSystem;
+            ChunkMeshPipeline* l_Pipeline = this;
+            m_JobSystem.Submit([l_SharedState, l_JobSystem, l_Pipeline, l_Task]()
+            {
+                ChunkMesher l_Mesher(l_SharedState->MesherSettings);
+                l_Mesher.Mesh(l_Task->View, *l_SharedState->BlockTable, l_Task->Mesh);
+
+                // The padded copy is large; release it before the result waits in the queue.
+                l_Task->View = PaddedChunkView();
+
+                // Runs on the main thread, which also owns the pipeline, so the alive check cannot race destruction.
+                l_JobSystem->PostToMainThread([l_SharedState, l_Pipeline, l_Task]()
+                {
+                    --l_SharedState->InFlightCount;
+                    if (l_SharedState->IsAlive)
+                    {
+                        l_Pipeline->Publish(*l_Task);
+                    }
+                });
+            });
+        }
+
+        m_DispatchOrder.erase(m_DispatchOrder.begin(), m_DispatchOrder.begin() + static_cast<std::ptrdiff_t>(l_OrderIndex));
+    }
+
+    void ChunkMeshPipeline::Publish(MeshTask& task)
+    {
+        SharedState& l_State = *m_State;
+
+        // A newer snapshot of this chunk is already in flight; that one will publish instead.
+        std::unordered_map<ChunkCoord, uint64_t, ChunkCoordHash>::iterator l_Latest = l_State.LatestSequence.find(task.Coord);
+        if (l_Latest == l_State.LatestSequence.end() || l_Latest->second != task.Sequence)
+        {
+            ++l_State.Current.DroppedStaleCount;
+
+            return;
+        }
+
+        l_State.LatestSequence.erase(l_Latest);
+
+        const Chunk* l_Chunk = l_State.Provider->FindChunk(task.Coord);
+        if (l_Chunk == nullptr)
+        {
+            ++l_State.Current.DroppedStaleCount;
+
+            return;
+        }
+
+        // Edited after the snapshot: drop the result and mesh the current contents instead.
+        if (l_Chunk->GetVersion() != task.ChunkVersion)
+        {
+            ++l_State.Current.DroppedStaleCount;
+            RequestRemesh(task.Coord);
+
+            return;
+        }
+
+        const double l_LatencyMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - task.SubmitTime).count();
+        l_State.LatencySumMilliseconds += l_LatencyMilliseconds;
+        l_State.Current.MaxLatencyMilliseconds = std::max(l_State.Current.MaxLatencyMilliseconds, l_LatencyMilliseconds);
+        ++l_State.Current.UploadedCount;
+        l_State.Current.UploadedVertexCount += task.Mesh.Vertices.size();
+
+        if (l_State.Upload)
+        {
+            l_State.Upload(task.Coord, task.Mesh);
+        }
+    }
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/World/Chunk.h"
+#include "Engine/World/ChunkMesher.h"
+#include "Engine/World/ChunkProvider.h"
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace Engine
+{
+    class JobSystem;
+
+    // Counters for one frame of pipeline activity.
+    struct ChunkMeshPipelineStats
+    {
+        // Distinct chunks snapshotted and sent to workers.
+        uint32_t SubmittedCount = 0;
+
+        // Remesh requests folded into an already-dirty chunk.
+        uint32_t CoalescedCount = 0;
+
+        // Meshes handed to the upload callback.
+        uint32_t UploadedCount = 0;
+        uint64_t UploadedVertexCount = 0;
+
+        // Results discarded because the chunk (or a newer request for it) superseded them.
+        uint32_t DroppedStaleCount = 0;
+
+        // Jobs still running on workers when the stats were captured.
+        uint32_t InFlightCount = 0;
+
+        // Time from snapshot to publication on the main thread.
+        double AverageLatencyMilliseconds = 0.0;
+        double MaxLatencyMilliseconds = 0.0;
+    };
+
+    struct ChunkMeshPipelineSettings
+    {
+        // Upper bound on snapshots per Dispatch so a large edit cannot stall a single frame.
+        uint32_t MaxDispatchPerFrame = 64;
+
+        ChunkMesherSettings Mesher;
+    };
+
+    // Re-meshes dirty chunks on worker threads. The main thread snapshots each chunk with its neighbour
+    // borders, workers mesh the snapshot, and results come back through the job system's main-thread
+    // queue, where anything older than the chunk's latest edit or request is dropped.
+    class ENGINE_API ChunkMeshPipeline
+    {
+    public:
+        using UploadCallback = std::function<void(const ChunkCoord&, ChunkMesh&)>;
+
+        // The provider and block table must outlive the pipeline.
+        ChunkMeshPipeline(JobSystem& jobSystem, const ChunkProvider& chunkProvider, const MeshingBlockTable& blockTable,
+            const ChunkMeshPipelineSettings& settings = ChunkMeshPipelineSettings());
+        ~ChunkMeshPipeline();
+
+        ChunkMeshPipeline(const ChunkMeshPipeline&) = delete;
+        ChunkMeshPipeline& operator=(const ChunkMeshPipeline&) = delete;
+
+        // Called on the main thread for every fresh mesh; the mesh may be moved from.
+        void SetUploadCallback(const UploadCallback& uploadCallback);
+
+        // Mark a chunk for re-meshing; repeated requests before the next Dispatch collapse into one.
+        void RequestRemesh(const ChunkCoord& coord);
+
+        // Mark the chunk containing a world block, plus the face neighbours whose border it touches.
+        void NotifyBlockChanged(int32_t worldX, int32_t worldY, int32_t worldZ);
+
+        // Snapshot and submit dirty chunks. Call once per frame on the main thread.
+        void Dispatch();
+
+        // Stats for the most recently completed frame (between the last two Dispatch calls).
+        const ChunkMeshPipelineStats& GetLastFrameStats() const { return m_LastFrameStats; }
+
+        uint32_t GetPendingCount() const { return static_cast<uint32_t>(m_DirtyChunks.size()); }
+
+        // Snapshots on workers or waiting in the main-thread queue right now.
+        uint32_t GetInFlightCount() const;
+
+    private:
+        struct SharedState;
+
+        struct MeshTask
+        {
+            ChunkCoord Coord;
+            uint64_t Sequence = 0;
+            uint64_t ChunkVersion = 0;
+            std::chrono::steady_clock::time_point SubmitTime;
+            PaddedChunkView View;
+            ChunkMesh Mesh;
+        };
+
+        // Main thread only; hands a finished mesh to the upload callback unless it has been superseded.
+        void Publish(MeshTask& task);
+
+    private:
+        JobSystem& m_JobSystem;
+        ChunkMeshPipelineSettings m_Settings;
+
+        // State reachable from in-flight jobs; shared so late completions stay safe after destruction.
+        std::shared_ptr<SharedState> m_State;
+
+        std::unordered_set<ChunkCoord, ChunkCoordHash> m_DirtyChunks;
+        std::vector<ChunkCoord> m_DispatchOrder;
+        ChunkMeshPipelineStats m_LastFrameStats;
+    };
+}
@@ -0,0 +1,325 @@
+#include "Engine/World/ChunkMesher.h"
+
+namespace Engine
+{
+    namespace
+    {
+        constexpr int32_t s_Size = Chunk::Size;
+        constexpr int32_t s_PaddedSize = PaddedChunkView::PaddedSize;
+
+        // Index strides in Chunk::GetIndex order for the x, y and z axes.
+        constexpr uint32_t s_IndexStrides[3] = { 1, 1u << (2 * Chunk::SizeShift), 1u << Chunk::SizeShift };
+
+        // Index strides inside the padded view for the x, y and z axes.
+        constexpr int32_t s_AxisStrides[3] = { 1, s_PaddedSize * s_PaddedSize, s_PaddedSize };
+
+        // For each face axis, the two in-plane axes (u, v) chosen so that u x v points along the positive normal.
+        constexpr int32_t s_PlaneAxes[3][2] = { { 1, 2 }, { 2, 0 }, { 0, 1 } };
+    }
+
+    PaddedChunkView::PaddedChunkView() : m_Blocks(PaddedVolume, AirBlockId)
+    {
+
+    }
+
+    void PaddedChunkView::Build(const std::array<const Chunk*, 27>& neighbours, BlockId missingBlock)
+    {
+        m_Coord = neighbours[13]->GetCoord();
+
+        for (int32_t y = -1; y <= s_Size; ++y)
+        {
+            const int32_t l_ChunkY = y < 0 ? 0 : (y < s_Size ? 1 : 2);
+            const int32_t l_LocalY = y & Chunk::SizeMask;
+
+            for (int32_t z = -1; z <= s_Size; ++z)
+            {
+                const int32_t l_ChunkZ = z < 0 ? 0 : (z < s_Size ? 1 : 2);
+                const int32_t l_LocalZ = z & Chunk::SizeMask;
+                BlockId* l_Row = &m_Blocks[GetIndex(-1, y, z)];
+
+                // Each padded row spans at most three chunks: one border block, the interior, one border block.
+                const Chunk* l_RowChunks[3] =
+                {
+                    neighbours[l_ChunkY * 9 + l_ChunkZ * 3 + 0],
+                    neighbours[l_ChunkY * 9 + l_ChunkZ * 3 + 1],
+                    neighbours[l_ChunkY * 9 + l_ChunkZ * 3 + 2]
+                };
+
+                l_Row[0] = l_RowChunks[0] != nullptr ? l_RowChunks[0]->GetBlock(s_Size - 1, l_LocalY, l_LocalZ) : missingBlock;
+                l_Row[s_Size + 1] = l_RowChunks[2] != nullptr ? l_RowChunks[2]->GetBlock(0, l_LocalY, l_LocalZ) : missingBlock;
+
+                const Chunk* l_Middle = l_RowChunks[1];
+                if (l_Middle == nullptr || l_Middle->IsUniform())
+                {
+                    const BlockId l_Fill = l_Middle != nullptr ? l_Middle->GetBlock(0) : missingBlock;
+                    for (int32_t x = 0; x < s_Size; ++x)
+                    {
+                        l_Row[x + 1] = l_Fill;
+                    }
+                }
+                else
+                {
+                    const uint32_t l_RowStart = Chunk::GetIndex(0, l_LocalY, l_LocalZ);
+                    for (int32_t x = 0; x < s_Size; ++x)
+                    {
+                        l_Row[x + 1] = l_Middle->GetBlock(l_RowStart + static_cast<uint32_t>(x));
+                    }
+                }
+            }
+        }
+    }
+
+    void ChunkMesh::Clear()
+    {
+        Vertices.clear();
+        FaceQuadOffsets.fill(0);
+        FaceQuadCounts.fill(0);
+        Connectivity = ChunkFaceConnectivity();
+    }
+
+    ChunkMesher::ChunkMesher(const ChunkMesherSettings& settings) : m_Settings(settings)
+    {
+
+    }
+
+    void ChunkMesher::Mesh(const PaddedChunkView& view, const MeshingBlockTable& blockTable, ChunkMesh& outMesh)
+    {
+        outMesh.Clear();
+        outMesh.Coord = view.GetCoord();
+
+        for (uint32_t l_Face = 0; l_Face < static_cast<uint32_t>(BlockFace::Count); ++l_Face)
+        {
+            const uint32_t l_QuadOffset = outMesh.GetQuadCount();
+            MeshFace(view, blockTable, static_cast<BlockFace>(l_Face), outMesh);
+
+            outMesh.FaceQuadOffsets[l_Face] = l_QuadOffset;
+            outMesh.FaceQuadCounts[l_Face] = outMesh.GetQuadCount() - l_QuadOffset;
+        }
+
+        if (m_Settings.ComputeConnectivity)
+        {
+            outMesh.Connectivity = ComputeConnectivity(view, blockTable);
+        }
+    }
+
+    ChunkFaceConnectivity ChunkMesher::ComputeConnectivity(const PaddedChunkView& view, const MeshingBlockTable& blockTable)
+    {
+        uint32_t l_OpaqueCount = 0;
+        m_Closed.fill(0);
+        for (int32_t y = 0; y < s_Size; ++y)
+        {
+            for (int32_t z = 0; z < s_Size; ++z)
+            {
+                const BlockId* l_Row = &view.GetBlocks()[PaddedChunkView::GetIndex(0, y, z)];
+                for (int32_t x = 0; x < s_Size; ++x)
+                {
+                    if ((blockTable.GetFlags(l_Row[x]) & MeshingBlockTable::FlagOpaque) != 0)
+                    {
+                        const uint32_t l_Index = Chunk::GetIndex(x, y, z);
+                        m_Closed[l_Index >> 6] |= uint64_t{ 1 } << (l_Index & 63);
+                        ++l_OpaqueCount;
+                    }
+                }
+            }
+        }
+
+        // Solid rock and open air, by far the most common chunks, need no flood.
+        if (l_OpaqueCount == Chunk::Volume)
+        {
+            return ChunkFaceConnectivity();
+        }
+
+        if (l_OpaqueCount == 0)
+        {
+            return ChunkFaceConnectivity::All();
+        }
+
+        // Only regions touching the chunk's surface matter, so every flood starts from a boundary block.
+        ChunkFaceConnectivity l_Connectivity;
+        for (uint32_t l_Seed = 0; l_Seed < Chunk::Volume; ++l_Seed)
+        {
+            const int32_t l_SeedX = static_cast<int32_t>(l_Seed) & Chunk::SizeMask;
+            const int32_t l_SeedZ = static_cast<int32_t>(l_Seed >> Chunk::SizeShift) & Chunk::SizeMask;
+            const int32_t l_SeedY = static_cast<int32_t>(l_Seed >> (2 * Chunk::SizeShift));
+            const bool l_IsBoundary = l_SeedX == 0 || l_SeedX == s_Size - 1 || l_SeedY == 0 || l_SeedY == s_Size - 1 || l_SeedZ == 0 || l_SeedZ == s_Size - 1;
+            if (!l_IsBoundary || (m_Closed[l_Seed >> 6] >> (l_Seed & 63) & 1) != 0)
+            {
+                continue;
+            }
+
+            uint32_t l_Faces = 0;
+            m_FloodQueue.clear();
+            m_FloodQueue.push_back(static_cast<uint16_t>(l_Seed));
+            m_Closed[l_Seed >> 6] |= uint64_t{ 1 } << (l_Seed & 63);
+            for (size_t l_Head = 0; l_Head < m_FloodQueue.size(); ++l_Head)
+            {
+                const uint32_t l_Index = m_FloodQueue[l_Head];
+                const int32_t l_Coords[3] =
+                {
+                    static_cast<int32_t>(l_Index) & Chunk::SizeMask,
+                    static_cast<int32_t>(l_Index >> (2 * Chunk::SizeShift)),
+                    static_cast<int32_t>(l_Index >> Chunk::SizeShift) & Chunk::SizeMask
+                };
+
+                // Faces in BlockFace order; a step off the chunk marks that face instead.
+                for (uint32_t l_Face = 0; l_Face < static_cast<uint32_t>(BlockFace::Count); ++l_Face)
+                {
+                    const uint32_t l_Axis = l_Face / 2;
+                    const bool l_IsPositive = (l_Face & 1) == 0;
+                    if (l_Coords[l_Axis] == (l_IsPositive ? s_Size - 1 : 0))
+                    {
+                        l_Faces |= 1u << l_Face;
+                        continue;
+                    }
+
+                    const uint32_t l_Neighbour = l_IsPositive ? l_Index + s_IndexStrides[l_Axis] : l_Index - s_IndexStrides[l_Axis];
+                    uint64_t& l_Word = m_Closed[l_Neighbour >> 6];
+                    const uint64_t l_Bit = uint64_t{ 1 } << (l_Neighbour & 63);
+                    if ((l_Word & l_Bit) == 0)
+                    {
+                        l_Word |= l_Bit;
+                        m_FloodQueue.push_back(static_cast<uint16_t>(l_Neighbour));
+                    }
+                }
+            }
+
+            for (uint32_t a = 0; a < 6; ++a)
+            {
+                for (uint32_t b = 0; b < 6; ++b)
+                {
+                    if ((l_Faces >> a & 1) != 0 && (l_Faces >> b & 1) != 0)
+                    {
+                        l_Connectivity.Connect(static_cast<BlockFace>(a), static_cast<BlockFace>(b));
+                    }
+                }
+            }
+        }
+
+        return l_Connectivity;
+    }
+
+    void ChunkMesher::MeshFace(const PaddedChunkView& view, const MeshingBlockTable& blockTable, BlockFace face, ChunkMesh& outMesh)
+    {
+        const int32_t l_Axis = static_cast<int32_t>(face) / 2;
+        const bool l_IsPositive = (static_cast<int32_t>(face) & 1) == 0;
+        const int32_t l_AxisU = s_PlaneAxes[l_Axis][0];
+        const int32_t l_AxisV = s_PlaneAxes[l_Axis][1];
+        const int32_t l_NormalStride = l_IsPositive ? s_AxisStrides[l_Axis] : -s_AxisStrides[l_Axis];
+        const std::vector<BlockId>& l_Blocks = view.GetBlocks();
+
+        const int32_t l_StrideAxis = s_AxisStrides[l_Axis];
+        const int32_t l_StrideU = s_AxisStrides[l_AxisU];
+        const int32_t l_StrideV = s_AxisStrides[l_AxisV];
+        const int32_t l_Origin = static_cast<int32_t>(PaddedChunkView::GetIndex(0, 0, 0));
+
+        for (int32_t l_Slice = 0; l_Slice < s_Size; ++l_Slice)
+        {
+            // Build the slice mask: a face exists where a visible block meets a non-opaque neighbour.
+            bool l_HasFaces = false;
+            for (int32_t j = 0; j < s_Size; ++j)
+            {
+                const int32_t l_RowIndex = l_Origin + l_Slice * l_StrideAxis + j * l_StrideV;
+                for (int32_t i = 0; i < s_Size; ++i)
+                {
+                    const int32_t l_Index = l_RowIndex + i * l_StrideU;
+                    const BlockId l_Block = l_Blocks[l_Index];
+                    const BlockId l_Neighbour = l_Blocks[l_Index + l_NormalStride];
+
+                    uint32_t l_Key = 0;
+                    if ((blockTable.GetFlags(l_Block) & MeshingBlockTable::FlagVisible) != 0
+                        && (blockTable.GetFlags(l_Neighbour) & MeshingBlockTable::FlagOpaque) == 0
+                        && l_Neighbour != l_Block)
+                    {
+                        l_Key = static_cast<uint32_t>(blockTable.GetFaceTile(l_Block, face)) + 1;
+                        l_HasFaces = true;
+                    }
+
+                    m_Mask[j * s_Size + i] = l_Key;
+                }
+            }
+
+            if (!l_HasFaces)
+            {
+                continue;
+            }
+
+            const uint32_t l_Plane = static_cast<uint32_t>(l_IsPositive ? l_Slice + 1 : l_Slice);
+
+            // Greedily grow each unvisited face into the widest, then tallest, rectangle with the same key.
+            for (int32_t j = 0; j < s_Size; ++j)
+            {
+                for (int32_t i = 0; i < s_Size; )
+                {
+                    const uint32_t l_Key = m_Mask[j * s_Size + i];
+                    if (l_Key == 0)
+                    {
+                        ++i;
+
+                        continue;
+                    }
+
+                    int32_t l_Width = 1;
+                    int32_t l_Height = 1;
+                    if (m_Settings.Greedy)
+                    {
+                        while (i + l_Width < s_Size && m_Mask[j * s_Size + i + l_Width] == l_Key)
+                        {
+                            ++l_Width;
+                        }
+
+                        bool l_CanGrow = true;
+                        while (j + l_Height < s_Size && l_CanGrow)
+                        {
+                            for (int32_t k = 0; k < l_Width; ++k)
+                            {
+                                if (m_Mask[(j + l_Height) * s_Size + i + k] != l_Key)
+                                {
+                                    l_CanGrow = false;
+
+                                    break;
+                                }
+                            }
+
+                            if (l_CanGrow)
+                            {
+                                ++l_Height;
+                            }
+                        }
+                    }
+
+                    for (int32_t l_Row = 0; l_Row < l_Height; ++l_Row)
+                    {
+                        for (int32_t k = 0; k < l_Width; ++k)
+                        {
+                            m_Mask[(j + l_Row) * s_Size + i + k] = 0;
+                        }
+                    }
+
+                    // Corners in (u, v); negative faces reverse the order so every quad winds counter-clockwise from outside.
+                    const int32_t l_CornerU[4] = { 0, l_Width, l_Width, 0 };
+                    const int32_t l_CornerV[4] = { 0, 0, l_Height, l_Height };
+                    const int32_t l_Order[2][4] = { { 0, 1, 2, 3 }, { 0, 3, 2, 1 } };
+                    const uint16_t l_Tile = static_cast<uint16_t>(l_Key - 1);
+
+                    for (int32_t l_Corner : l_Order[l_IsPositive ? 0 : 1])
+                    {
+                        uint32_t l_Position[3];
+                        l_Position[l_Axis] = l_Plane;
+                        l_Position[l_AxisU] = static_cast<uint32_t>(i + l_CornerU[l_Corner]);
+                        l_Position[l_AxisV] = static_cast<uint32_t>(j + l_CornerV[l_Corner]);
+
+                        // Texture space: v follows world y on side faces; top and bottom faces use x and z.
+                        const uint32_t l_DeltaU = static_cast<uint32_t>(l_CornerU[l_Corner]);
+                        const uint32_t l_DeltaV = static_cast<uint32_t>(l_CornerV[l_Corner]);
+                        const uint32_t l_TextureU = l_Axis == 2 ? l_DeltaU : l_DeltaV;
+                        const uint32_t l_TextureV = l_Axis == 2 ? l_DeltaV : l_DeltaU;
+
+                        outMesh.Vertices.push_back(PackedChunkVertex::Pack(l_Position[0], l_Position[1], l_Position[2], face, l_Tile, l_TextureU, l_TextureV));
+                    }
+
+                    i += l_Width;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,163 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/World/Chunk.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace Engine
+{
+    // Face directions in the order the mesher emits them.
+    enum class BlockFace : uint8_t
+    {
+        PositiveX = 0,
+        NegativeX,
+        PositiveY,
+        NegativeY,
+        PositiveZ,
+        NegativeZ,
+        Count
+    };
+
+    // Which pairs of a chunk's six faces can see each other through connected non-opaque blocks. Bit a * 6 + b
+    // is set together with b * 6 + a when faces a and b (BlockFace order) are joined; cave culling walks it.
+    struct ChunkFaceConnectivity
+    {
+        uint64_t Bits = 0;
+
+        static ChunkFaceConnectivity All() { return { (uint64_t{ 1 } << 36) - 1 }; }
+
+        bool Connects(BlockFace a, BlockFace b) const { return (Bits >> (static_cast<uint32_t>(a) * 6 + static_cast<uint32_t>(b)) & 1) != 0; }
+
+        void Connect(BlockFace a, BlockFace b)
+        {
+            Bits |= uint64_t{ 1 } << (static_cast<uint32_t>(a) * 6 + static_cast<uint32_t>(b));
+            Bits |= uint64_t{ 1 } << (static_cast<uint32_t>(b) * 6 + static_cast<uint32_t>(a));
+        }
+    };
+
+    // Per-block data the mesher reads, indexed by BlockId. Ids outside the table mesh as opaque tile 0.
+    // BlockRegistry::GetMeshingTable provides one built from the block definitions; other flag bits are ignored.
+    struct MeshingBlockTable
+    {
+        enum Flags : uint8_t
+        {
+            FlagVisible = 1 << 0,   // Block produces faces at all (air does not).
+            FlagOpaque = 1 << 1     // Block hides the faces of its neighbours.
+        };
+
+        std::vector<uint8_t> BlockFlags;
+
+        // Six atlas tile indices per block, in BlockFace order.
+        std::vector<uint16_t> FaceTiles;
+
+        uint8_t GetFlags(BlockId block) const { return block < BlockFlags.size() ? BlockFlags[block] : uint8_t(FlagVisible | FlagOpaque); }
+
+        uint16_t GetFaceTile(BlockId block, BlockFace face) const
+        {
+            const size_t l_Index = static_cast<size_t>(block) * 6 + static_cast<size_t>(face);
+            return l_Index < FaceTiles.size() ? FaceTiles[l_Index] : 0;
+        }
+    };
+
+    // Copy of a chunk plus a one-block border from its 26 neighbours, so meshing never touches
+    // live chunk storage and border faces can be culled against the neighbouring chunks.
+    class ENGINE_API PaddedChunkView
+    {
+    public:
+        static constexpr int32_t PaddedSize = Chunk::Size + 2;
+        static constexpr uint32_t PaddedVolume = PaddedSize * PaddedSize * PaddedSize;
+
+        PaddedChunkView();
+
+        // neighbours is indexed by (dy + 1) * 9 + (dz + 1) * 3 + (dx + 1); the centre (index 13) must be set.
+        // Missing neighbours are filled with missingBlock.
+        void Build(const std::array<const Chunk*, 27>& neighbours, BlockId missingBlock = AirBlockId);
+
+        // Coordinates range over [-1, Chunk::Size].
+        static uint32_t GetIndex(int32_t x, int32_t y, int32_t z)
+        {
+            return static_cast<uint32_t>(((y + 1) * PaddedSize + (z + 1)) * PaddedSize + (x + 1));
+        }
+
+        BlockId Get(int32_t x, int32_t y, int32_t z) const { return m_Blocks[GetIndex(x, y, z)]; }
+        void Set(int32_t x, int32_t y, int32_t z, BlockId block) { m_Blocks[GetIndex(x, y, z)] = block; }
+
+        const ChunkCoord& GetCoord() const { return m_Coord; }
+        void SetCoord(const ChunkCoord& coord) { m_Coord = coord; }
+
+        const std::vector<BlockId>& GetBlocks() const { return m_Blocks; }
+
+    private:
+        ChunkCoord m_Coord;
+        std::vector<BlockId> m_Blocks;
+    };
+
+    // Eight-byte vertex. Word 0: x, y, z (6 bits each, 0..32), face (3 bits).
+    // Word 1: atlas tile index (16 bits), tiling texture coordinates u and v in blocks (6 bits each).
+    // Tile indices address Game/Assets/Textures/Atlas.png row-major in 16x16 tiles.
+    struct PackedChunkVertex
+    {
+        uint32_t PositionAndFace = 0;
+        uint32_t TextureData = 0;
+
+        static PackedChunkVertex Pack(uint32_t x, uint32_t y, uint32_t z, BlockFace face, uint16_t tile, uint32_t u, uint32_t v)
+        {
+            PackedChunkVertex l_Vertex;
+            l_Vertex.PositionAndFace = x | (y << 6) | (z << 12) | (static_cast<uint32_t>(face) << 18);
+            l_Vertex.TextureData = static_cast<uint32_t>(tile) | (u << 16) | (v << 22);
+
+            return l_Vertex;
+        }
+    };
+
+    // Quads are stored as four vertices each and share the index pattern 0, 1, 2, 2, 3, 0.
+    // Quads are grouped by face so renderers can skip whole directions facing away from the camera.
+    struct ChunkMesh
+    {
+        ChunkCoord Coord;
+        std::vector<PackedChunkVertex> Vertices;
+        std::array<uint32_t, 6> FaceQuadOffsets{};
+        std::array<uint32_t, 6> FaceQuadCounts{};
+
+        // Face-to-face visibility through the chunk, filled when ChunkMesherSettings::ComputeConnectivity is set.
+        ChunkFaceConnectivity Connectivity;
+
+        uint32_t GetQuadCount() const { return static_cast<uint32_t>(Vertices.size() / 4); }
+        void Clear();
+    };
+
+    struct ChunkMesherSettings
+    {
+        // Merge coplanar faces with the same tile into larger quads; false emits one quad per visible face.
+        bool Greedy = true;
+
+        // Flood the chunk's non-opaque blocks to record which faces see each other (ChunkMesh::Connectivity).
+        bool ComputeConnectivity = true;
+    };
+
+    // CPU mesher with neighbour-aware face culling. Holds scratch buffers, so use one instance per thread.
+    class ENGINE_API ChunkMesher
+    {
+    public:
+        explicit ChunkMesher(const ChunkMesherSettings& settings = ChunkMesherSettings());
+
+        void Mesh(const PaddedChunkView& view, const MeshingBlockTable& blockTable, ChunkMesh& outMesh);
+
+    private:
+        void MeshFace(const PaddedChunkView& view, const MeshingBlockTable& blockTable, BlockFace face, ChunkMesh& outMesh);
+        ChunkFaceConnectivity ComputeConnectivity(const PaddedChunkView& view, const MeshingBlockTable& blockTable);
+
+    private:
+        ChunkMesherSettings m_Settings;
+
+        // Per-slice face keys (tile + 1, zero when no face) reused between slices.
+        std::array<uint32_t, Chunk::Size * Chunk::Size> m_Mask{};
+
+        // One bit per block for the connectivity flood: set for opaque blocks and blocks already reached.
+        std::array<uint64_t, Chunk::Volume / 64> m_Closed{};
+        std::vector<uint16_t> m_FloodQueue;
+    };
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/World/Chunk.h"
+
+namespace Engine
+{
+    // Read access to loaded chunks by coordinate. Implemented by whatever container owns the world.
+    class ENGINE_API ChunkProvider
+    {
+    public:
+        virtual ~ChunkProvider() = default;
+
+        // Returns nullptr when the chunk is not loaded.
+        virtual const Chunk* FindChunk(const ChunkCoord& coord) const = 0;
+    };
+}
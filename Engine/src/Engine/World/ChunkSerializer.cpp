@@ -0,0 +1,92 @@
+#include "Engine/World/ChunkSerializer.h"
+
+#include "Engine/IO/Compression.h"
+
+#include <cstring>
+
+namespace Engine::ChunkSerializer
+{
+    namespace
+    {
+        constexpr size_t s_RawHeaderSize = 4;
+        constexpr size_t s_BlobHeaderSize = sizeof(uint32_t);
+
+        // Upper bound on a valid raw payload, used to reject corrupt size fields before allocating.
+        constexpr size_t s_MaximumRawSize = s_RawHeaderSize + Chunk::Volume * sizeof(BlockId)
+            + Chunk::Volume * sizeof(uint64_t) * 16 / 64 + sizeof(uint64_t);
+
+        // Scratch space reused across calls on the same thread; autosave encodes thousands of chunks per batch.
+        thread_local std::vector<uint8_t> s_RawBuffer;
+    }
+
+    void Encode(const Chunk& chunk, std::vector<uint8_t>& output)
+    {
+        const PaletteStorage& l_Storage = chunk.GetStorage();
+        const std::vector<BlockId>& l_Palette = l_Storage.GetPalette();
+        const std::vector<uint64_t>& l_Words = l_Storage.GetPackedIndices();
+
+        const size_t l_PaletteBytes = l_Palette.size() * sizeof(BlockId);
+        const size_t l_WordBytes = l_Words.size() * sizeof(uint64_t);
+        const size_t l_RawSize = s_RawHeaderSize + l_PaletteBytes + l_WordBytes;
+
+        s_RawBuffer.resize(l_RawSize);
+        uint8_t* l_Raw = s_RawBuffer.data();
+        const uint16_t l_PaletteSize = static_cast<uint16_t>(l_Palette.size());
+        l_Raw[0] = FormatVersion;
+        l_Raw[1] = static_cast<uint8_t>(l_Storage.GetBitsPerEntry());
+        std::memcpy(l_Raw + 2, &l_PaletteSize, sizeof(l_PaletteSize));
+        std::memcpy(l_Raw + s_RawHeaderSize, l_Palette.data(), l_PaletteBytes);
+        std::memcpy(l_Raw + s_RawHeaderSize + l_PaletteBytes, l_Words.data(), l_WordBytes);
+
+        const uint32_t l_RawSize32 = static_cast<uint32_t>(l_RawSize);
+        output.resize(s_BlobHeaderSize + Compression::GetMaxCompressedSize(l_RawSize));
+        std::memcpy(output.data(), &l_RawSize32, sizeof(l_RawSize32));
+
+        const size_t l_CompressedSize = Compression::Compress(l_Raw, l_RawSize, output.data() + s_BlobHeaderSize);
+        output.resize(s_BlobHeaderSize + l_CompressedSize);
+    }
+
+    bool Decode(const uint8_t* data, size_t size, Chunk& chunk)
+    {
+        if (size < s_BlobHeaderSize)
+        {
+            return false;
+        }
+
+        uint32_t l_RawSize = 0;
+        std::memcpy(&l_RawSize, data, sizeof(l_RawSize));
+        if (l_RawSize < s_RawHeaderSize || l_RawSize > s_MaximumRawSize)
+        {
+            return false;
+        }
+
+        s_RawBuffer.resize(l_RawSize);
+        uint8_t* l_Raw = s_RawBuffer.data();
+        if (!Compression::Decompress(data + s_BlobHeaderSize, size - s_BlobHeaderSize, l_Raw, l_RawSize))
+        {
+            return false;
+        }
+
+        uint16_t l_PaletteSize = 0;
+        std::memcpy(&l_PaletteSize, l_Raw + 2, sizeof(l_PaletteSize));
+        const uint32_t l_BitsPerEntry = l_Raw[1];
+        if (l_Raw[0] != FormatVersion || l_PaletteSize == 0 || PaletteStorage::GetBitsForPaletteSize(l_PaletteSize) != l_BitsPerEntry)
+        {
+            return false;
+        }
+
+        const size_t l_PaletteBytes = size_t{ l_PaletteSize } * sizeof(BlockId);
+        const size_t l_WordCount = PaletteStorage::GetWordCount(Chunk::Volume, l_BitsPerEntry);
+        if (s_RawHeaderSize + l_PaletteBytes + l_WordCount * sizeof(uint64_t) != l_RawSize)
+        {
+            return false;
+        }
+
+        std::vector<BlockId> l_Palette(l_PaletteSize);
+        std::vector<uint64_t> l_Words(l_WordCount);
+        std::memcpy(l_Palette.data(), l_Raw + s_RawHeaderSize, l_PaletteBytes);
+        std::memcpy(l_Words.data(), l_Raw + s_RawHeaderSize + l_PaletteBytes, l_WordCount * sizeof(uint64_t));
+
+        return chunk.GetStorage().Assign(std::move(l_Palette), std::move(l_Words));
+    }
+}
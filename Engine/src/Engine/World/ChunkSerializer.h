@@ -0,0 +1,22 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/World/Chunk.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Engine::ChunkSerializer
+{
+    // Blob layout: [u32 raw size][compressed payload]. The raw payload is the palette storage verbatim,
+    // [u8 format][u8 bits per entry][u16 palette size][u16 palette...][u64 packed indices...], so loading
+    // is a decompress plus two copies with no per-block work. Multi-byte values are little-endian.
+    constexpr uint8_t FormatVersion = 1;
+
+    // Replaces the contents of output. Compact the chunk first to keep unused palette entries off disk.
+    ENGINE_API void Encode(const Chunk& chunk, std::vector<uint8_t>& output);
+
+    // Returns false when the blob is truncated, corrupt or written by an unknown format.
+    ENGINE_API bool Decode(const uint8_t* data, size_t size, Chunk& chunk);
+}
@@ -0,0 +1,189 @@
+#include "Engine/World/ChunkStreamer.h"
+
+#include "Engine/Core/Profiler.h"
+#include "Engine/Memory/FrameAllocator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace Engine
+{
+    namespace
+    {
+        struct ResidentChunk
+        {
+            ChunkCoord Coord;
+            int64_t DistanceSquared = 0;
+            size_t Bytes = 0;
+        };
+    }
+
+    ChunkStreamer::ChunkStreamer(const World& world, const ChunkStreamerSettings& settings) : m_World(world), m_Settings(settings)
+    {
+        m_Settings.LoadRadius = std::max(m_Settings.LoadRadius, 0);
+        m_Settings.UnloadRadius = std::max(m_Settings.UnloadRadius, m_Settings.LoadRadius);
+        m_Settings.MaxChunkY = std::max(m_Settings.MaxChunkY, m_Settings.MinChunkY);
+    }
+
+    void ChunkStreamer::Update(const glm::vec3& focusPosition)
+    {
+        ENGINE_PROFILE_SCOPE("ChunkStreamer::Update");
+
+        m_FocusPosition = focusPosition;
+        const ChunkCoord l_FocusColumn{ WorldToChunk(static_cast<int32_t>(std::floor(focusPosition.x))), 0, WorldToChunk(static_cast<int32_t>(std::floor(focusPosition.z))) };
+        const bool l_HasMoved = !m_HasFocus || !(l_FocusColumn == m_FocusColumn);
+        m_FocusColumn = l_FocusColumn;
+        m_HasFocus = true;
+
+        const int64_t l_PreviousBudgetDistance = m_BudgetDistanceSquared;
+        CollectEvictions();
+
+        if (l_HasMoved || m_BudgetDistanceSquared != l_PreviousBudgetDistance)
+        {
+            RebuildPending();
+        }
+
+        m_FrameStats.PendingCount = static_cast<uint32_t>(m_Pending.size() - m_PendingHead);
+        m_FrameStats.InFlightCount = static_cast<uint32_t>(m_InFlight.size());
+        m_LastFrameStats = m_FrameStats;
+        m_FrameStats = ChunkStreamerStats();
+    }
+
+    std::vector<ChunkCoord> ChunkStreamer::TakeRequests(size_t maxCount)
+    {
+        std::vector<ChunkCoord> l_Requests;
+        while (l_Requests.size() < maxCount && m_PendingHead < m_Pending.size())
+        {
+            const ChunkCoord l_Coord = m_Pending[m_PendingHead++];
+
+            // Anything that arrived or was requested by an earlier list since this one was built is skipped.
+            if (m_World.IsLoaded(l_Coord) || !m_InFlight.insert(l_Coord).second)
+            {
+                continue;
+            }
+
+            l_Requests.push_back(l_Coord);
+        }
+        m_FrameStats.RequestedCount += static_cast<uint32_t>(l_Requests.size());
+
+        return l_Requests;
+    }
+
+    void ChunkStreamer::OnChunkLoaded(const ChunkCoord& coord)
+    {
+        if (m_InFlight.erase(coord) > 0)
+        {
+            ++m_FrameStats.LoadedCount;
+        }
+    }
+
+    int64_t ChunkStreamer::GetColumnDistanceSquared(const ChunkCoord& coord) const
+    {
+        const int64_t l_DX = static_cast<int64_t>(coord.X) - m_FocusColumn.X;
+        const int64_t l_DZ = static_cast<int64_t>(coord.Z) - m_FocusColumn.Z;
+
+        return l_DX * l_DX + l_DZ * l_DZ;
+    }
+
+    void ChunkStreamer::RebuildPending()
+    {
+        ENGINE_PROFILE_SCOPE("ChunkStreamer::RebuildPending");
+
+        m_Pending.clear();
+        m_PendingHead = 0;
+
+        const int32_t l_Radius = m_Settings.LoadRadius;
+        const int64_t l_LoadDistanceSquared = std::min(static_cast<int64_t>(l_Radius) * l_Radius, m_BudgetDistanceSquared - 1);
+        for (int32_t l_DZ = -l_Radius; l_DZ <= l_Radius; ++l_DZ)
+        {
+            for (int32_t l_DX = -l_Radius; l_DX <= l_Radius; ++l_DX)
+            {
+                if (static_cast<int64_t>(l_DX) * l_DX + static_cast<int64_t>(l_DZ) * l_DZ > l_LoadDistanceSquared)
+                {
+                    continue;
+                }
+
+                for (int32_t y = m_Settings.MinChunkY; y <= m_Settings.MaxChunkY; ++y)
+                {
+                    const ChunkCoord l_Coord{ m_FocusColumn.X + l_DX, y, m_FocusColumn.Z + l_DZ };
+                    if (!m_World.IsLoaded(l_Coord) && m_InFlight.count(l_Coord) == 0)
+                    {
+                        m_Pending.push_back(l_Coord);
+                    }
+                }
+            }
+        }
+
+        // Nearest to the focus itself first, so the chunks around the player's height beat the rest of the column.
+        const glm::vec3 l_Focus = m_FocusPosition;
+        const auto a_GetPriority = [&l_Focus](const ChunkCoord& coord)
+            {
+                const glm::vec3 l_Center = glm::vec3(static_cast<float>(coord.X), static_cast<float>(coord.Y), static_cast<float>(coord.Z)) * static_cast<float>(Chunk::Size)
+                    + glm::vec3(Chunk::Size * 0.5f);
+                const glm::vec3 l_Offset = l_Center - l_Focus;
+
+                return glm::dot(l_Offset, l_Offset);
+            };
+        std::sort(m_Pending.begin(), m_Pending.end(), [&a_GetPriority](const ChunkCoord& a, const ChunkCoord& b)
+            {
+                return a_GetPriority(a) < a_GetPriority(b);
+            });
+    }
+
+    void ChunkStreamer::CollectEvictions()
+    {
+        ENGINE_PROFILE_SCOPE("ChunkStreamer::CollectEvictions");
+
+        m_Evictions.clear();
+
+        const int64_t l_UnloadDistanceSquared = static_cast<int64_t>(m_Settings.UnloadRadius) * m_Settings.UnloadRadius;
+        // Rebuilt every frame from every resident chunk, so it lives in the frame arena instead of the heap.
+        std::pmr::vector<ResidentChunk> l_Kept = MakeFrameVector<ResidentChunk>(m_World.GetChunkCount());
+        size_t l_KeptBytes = 0;
+        m_World.ForEachChunk([&](const Chunk& chunk)
+            {
+                const ChunkCoord& l_Coord = chunk.GetCoord();
+                const int64_t l_DistanceSquared = GetColumnDistanceSquared(l_Coord);
+                if (l_DistanceSquared > l_UnloadDistanceSquared || l_Coord.Y < m_Settings.MinChunkY || l_Coord.Y > m_Settings.MaxChunkY)
+                {
+                    m_Evictions.push_back(l_Coord);
+                    return;
+                }
+
+                l_Kept.push_back({ l_Coord, l_DistanceSquared, chunk.GetMemoryUsage() });
+                l_KeptBytes += l_Kept.back().Bytes;
+            });
+        m_FrameStats.EvictedCount = static_cast<uint32_t>(m_Evictions.size());
+
+        if (l_KeptBytes > m_Settings.MemoryBudgetBytes)
+        {
+            // Whole rings go at once, so nothing at the new limit is requested again straight away.
+            std::sort(l_Kept.begin(), l_Kept.end(), [](const ResidentChunk& a, const ResidentChunk& b)
+                {
+                    return a.DistanceSquared > b.DistanceSquared;
+                });
+
+            size_t l_Index = 0;
+            while (l_Index < l_Kept.size() && l_KeptBytes > m_Settings.MemoryBudgetBytes)
+            {
+                const int64_t l_Ring = l_Kept[l_Index].DistanceSquared;
+                for (; l_Index < l_Kept.size() && l_Kept[l_Index].DistanceSquared == l_Ring; ++l_Index)
+                {
+                    m_Evictions.push_back(l_Kept[l_Index].Coord);
+                    l_KeptBytes -= l_Kept[l_Index].Bytes;
+                    ++m_FrameStats.BudgetEvictedCount;
+                }
+                m_BudgetDistanceSquared = l_Ring;
+            }
+            l_Kept.erase(l_Kept.begin(), l_Kept.begin() + static_cast<std::ptrdiff_t>(l_Index));
+        }
+        else if (l_KeptBytes < m_Settings.MemoryBudgetBytes / 4 * 3)
+        {
+            m_BudgetDistanceSquared = INT64_MAX;
+        }
+
+        m_FrameStats.ResidentCount = static_cast<uint32_t>(l_Kept.size());
+        m_FrameStats.ResidentBytes = l_KeptBytes;
+    }
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/World/Chunk.h"
+#include "Engine/World/World.h"
+
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+namespace Engine
+{
+    // Counters for one frame of streaming (between the last two Update calls).
+    struct ChunkStreamerStats
+    {
+        // Requests handed out by TakeRequests, and requested chunks reported back through OnChunkLoaded.
+        uint32_t RequestedCount = 0;
+        uint32_t LoadedCount = 0;
+
+        // Chunks Update told the caller to drop for being out of range, and for exceeding the memory budget.
+        uint32_t EvictedCount = 0;
+        uint32_t BudgetEvictedCount = 0;
+
+        // Chunks in range waiting to be requested, and requests not yet loaded.
+        uint32_t PendingCount = 0;
+        uint32_t InFlightCount = 0;
+
+        // World contents once the frame's evictions are removed.
+        uint32_t ResidentCount = 0;
+        size_t ResidentBytes = 0;
+    };
+
+    struct ChunkStreamerSettings
+    {
+        // Chunk columns whose horizontal distance from the focus column is at most LoadRadius are requested;
+        // resident ones farther than UnloadRadius are evicted. The band between them absorbs back-and-forth
+        // movement across a boundary without unloading and reloading the same chunks.
+        int32_t LoadRadius = 8;
+        int32_t UnloadRadius = 10;
+
+        // Chunk layers streamed in every column.
+        int32_t MinChunkY = 0;
+        int32_t MaxChunkY = 5;
+
+        // Upper bound on Chunk::GetMemoryUsage summed over the world; the farthest chunks go first.
+        size_t MemoryBudgetBytes = size_t{ 512 } << 20;
+    };
+
+    // Decides which chunks around a moving focus (the player) should be resident. Each Update:
+    //   - when the focus enters a new chunk column, rebuilds the list of missing chunks in load range, nearest
+    //     to the focus first;
+    //   - lists resident chunks outside the unload range, then, if the rest still exceed the memory budget,
+    //     the farthest remaining ones, and stops requesting chunks that far out until usage falls back under
+    //     three quarters of the budget.
+    // The caller does the actual work: it pulls requests with TakeRequests, generates or loads them however it
+    // likes, reports each arrival with OnChunkLoaded, and removes every chunk in GetEvictions from the world
+    // (saving it first if needed) before the next Update. Main thread only, like World.
+    class ENGINE_API ChunkStreamer
+    {
+    public:
+        ChunkStreamer(const World& world, const ChunkStreamerSettings& settings = ChunkStreamerSettings());
+
+        void Update(const glm::vec3& focusPosition);
+
+        // Up to maxCount chunks to load, nearest first; each is in flight until OnChunkLoaded.
+        std::vector<ChunkCoord> TakeRequests(size_t maxCount);
+
+        // A requested chunk is in the world now, or failed for good; either way it is no longer in flight.
+        void OnChunkLoaded(const ChunkCoord& coord);
+
+        // Chunks the last Update wants out of the world.
+        const std::vector<ChunkCoord>& GetEvictions() const { return m_Evictions; }
+
+        // Nothing left to request or waiting to arrive.
+        bool IsIdle() const { return m_PendingHead == m_Pending.size() && m_InFlight.empty(); }
+
+        const ChunkStreamerStats& GetLastFrameStats() const { return m_LastFrameStats; }
+        const ChunkStreamerSettings& GetSettings() const { return m_Settings; }
+
+    private:
+        // Squared horizontal distance in chunks from the focus column.
+        int64_t GetColumnDistanceSquared(const ChunkCoord& coord) const;
+
+        void RebuildPending();
+        void CollectEvictions();
+
+    private:
+        const World& m_World;
+        ChunkStreamerSettings m_Settings;
+
+        glm::vec3 m_FocusPosition{ 0.0f };
+        ChunkCoord m_FocusColumn;
+        bool m_HasFocus = false;
+
+        // Missing chunks in range, sorted by priority; entries before the head have been handed out.
+        std::vector<ChunkCoord> m_Pending;
+        size_t m_PendingHead = 0;
+        std::unordered_set<ChunkCoord, ChunkCoordHash> m_InFlight;
+
+        // Squared column distance from which nothing is requested while memory is tight.
+        int64_t m_BudgetDistanceSquared = INT64_MAX;
+        std::vector<ChunkCoord> m_Evictions;
+
+        ChunkStreamerStats m_FrameStats;
+        ChunkStreamerStats m_LastFrameStats;
+    };
+}
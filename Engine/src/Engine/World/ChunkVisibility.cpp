@@ -0,0 +1,248 @@
+#include "Engine/World/ChunkVisibility.h"
+
+#include "Engine/Core/Profiler.h"
+
+#include <algorithm>
+#include <cmath>
+
+// SSE2 is part of the x86-64 baseline, so the plane test needs no runtime dispatch.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define ENGINE_VISIBILITY_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define ENGINE_VISIBILITY_SSE2 0
+#endif
+
+namespace Engine
+{
+    namespace
+    {
+        // Section offsets in BlockFace order; face ^ 1 is the opposite face.
+        constexpr int32_t s_FaceX[6] = { 1, -1, 0, 0, 0, 0 };
+        constexpr int32_t s_FaceY[6] = { 0, 0, 1, -1, 0, 0 };
+        constexpr int32_t s_FaceZ[6] = { 0, 0, 0, 0, 1, -1 };
+
+        constexpr float s_HalfSection = static_cast<float>(Chunk::Size) * 0.5f;
+
+        glm::vec3 GetSectionCenter(const ChunkCoord& coord)
+        {
+            return glm::vec3(static_cast<float>(coord.X), static_cast<float>(coord.Y), static_cast<float>(coord.Z)) * static_cast<float>(Chunk::Size)
+                + glm::vec3(s_HalfSection);
+        }
+    }
+
+    ViewFrustum::ViewFrustum()
+    {
+        // Every slot starts as the always-passing plane 0 * p + 1 >= 0.
+        std::fill(std::begin(m_NormalX), std::end(m_NormalX), 0.0f);
+        std::fill(std::begin(m_NormalY), std::end(m_NormalY), 0.0f);
+        std::fill(std::begin(m_NormalZ), std::end(m_NormalZ), 0.0f);
+        std::fill(std::begin(m_Distance), std::end(m_Distance), 1.0f);
+    }
+
+    ViewFrustum ViewFrustum::FromMatrix(const glm::mat4& viewProjection)
+    {
+        // Gribb-Hartmann: each plane is the last row of the matrix plus or minus one of the others.
+        const glm::vec4 l_Rows[4] =
+        {
+            glm::vec4(viewProjection[0][0], viewProjection[1][0], viewProjection[2][0], viewProjection[3][0]),
+            glm::vec4(viewProjection[0][1], viewProjection[1][1], viewProjection[2][1], viewProjection[3][1]),
+            glm::vec4(viewProjection[0][2], viewProjection[1][2], viewProjection[2][2], viewProjection[3][2]),
+            glm::vec4(viewProjection[0][3], viewProjection[1][3], viewProjection[2][3], viewProjection[3][3])
+        };
+
+        ViewFrustum l_Frustum;
+        for (uint32_t i = 0; i < 6; ++i)
+        {
+            glm::vec4 l_Plane = (i & 1) == 0 ? l_Rows[3] + l_Rows[i / 2] : l_Rows[3] - l_Rows[i / 2];
+            const float l_Length = glm::length(glm::vec3(l_Plane));
+            if (l_Length > 0.0f)
+            {
+                l_Plane /= l_Length;
+            }
+
+            l_Frustum.m_NormalX[i] = l_Plane.x;
+            l_Frustum.m_NormalY[i] = l_Plane.y;
+            l_Frustum.m_NormalZ[i] = l_Plane.z;
+            l_Frustum.m_Distance[i] = l_Plane.w;
+        }
+
+        return l_Frustum;
+    }
+
+    bool ViewFrustum::IntersectsAabb(const glm::vec3& center, const glm::vec3& extents) const
+    {
+#if ENGINE_VISIBILITY_SSE2
+        // Signed distance of the box's most positive corner per plane; any negative one puts the box outside.
+        const __m128 l_CenterX = _mm_set1_ps(center.x);
+        const __m128 l_CenterY = _mm_set1_ps(center.y);
+        const __m128 l_CenterZ = _mm_set1_ps(center.z);
+        const __m128 l_ExtentX = _mm_set1_ps(extents.x);
+        const __m128 l_ExtentY = _mm_set1_ps(extents.y);
+        const __m128 l_ExtentZ = _mm_set1_ps(extents.z);
+        const __m128 l_SignMask = _mm_set1_ps(-0.0f);
+
+        int l_Outside = 0;
+        for (uint32_t l_Group = 0; l_Group < s_PlaneSlots; l_Group += 4)
+        {
+            const __m128 l_NormalX = _mm_load_ps(m_NormalX + l_Group);
+            const __m128 l_NormalY = _mm_load_ps(m_NormalY + l_Group);
+            const __m128 l_NormalZ = _mm_load_ps(m_NormalZ + l_Group);
+
+            __m128 l_Distance = _mm_add_ps(_mm_load_ps(m_Distance + l_Group), _mm_mul_ps(l_NormalX, l_CenterX));
+            l_Distance = _mm_add_ps(l_Distance, _mm_mul_ps(l_NormalY, l_CenterY));
+            l_Distance = _mm_add_ps(l_Distance, _mm_mul_ps(l_NormalZ, l_CenterZ));
+
+            __m128 l_Radius = _mm_mul_ps(_mm_andnot_ps(l_SignMask, l_NormalX), l_ExtentX);
+            l_Radius = _mm_add_ps(l_Radius, _mm_mul_ps(_mm_andnot_ps(l_SignMask, l_NormalY), l_ExtentY));
+            l_Radius = _mm_add_ps(l_Radius, _mm_mul_ps(_mm_andnot_ps(l_SignMask, l_NormalZ), l_ExtentZ));
+
+            l_Outside |= _mm_movemask_ps(_mm_cmplt_ps(_mm_add_ps(l_Distance, l_Radius), _mm_setzero_ps()));
+        }
+
+        return l_Outside == 0;
+#else
+        return IntersectsAabbScalar(center, extents);
+#endif
+    }
+
+    bool ViewFrustum::IntersectsAabbScalar(const glm::vec3& center, const glm::vec3& extents) const
+    {
+        for (uint32_t i = 0; i < s_PlaneSlots; ++i)
+        {
+            const float l_Distance = ((m_Distance[i] + m_NormalX[i] * center.x) + m_NormalY[i] * center.y) + m_NormalZ[i] * center.z;
+            const float l_Radius = (std::fabs(m_NormalX[i]) * extents.x + std::fabs(m_NormalY[i]) * extents.y) + std::fabs(m_NormalZ[i]) * extents.z;
+            if (l_Distance + l_Radius < 0.0f)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    ChunkVisibility::ChunkVisibility(const ChunkVisibilitySettings& settings) : m_Settings(settings)
+    {
+        m_Settings.ViewDistance = std::max(m_Settings.ViewDistance, 1);
+
+        const size_t l_Extent = static_cast<size_t>(m_Settings.ViewDistance) * 2 + 1;
+        m_VisitFrames.assign(l_Extent * l_Extent * l_Extent, 0);
+    }
+
+    void ChunkVisibility::SetSection(const ChunkMesh& mesh)
+    {
+        SetSection(mesh.Coord, mesh.Connectivity, mesh.GetQuadCount());
+    }
+
+    void ChunkVisibility::SetSection(const ChunkCoord& coord, ChunkFaceConnectivity connectivity, uint32_t quadCount)
+    {
+        Section& l_Section = m_Sections[coord];
+        l_Section.Connectivity = connectivity;
+        l_Section.QuadCount = quadCount;
+    }
+
+    void ChunkVisibility::RemoveSection(const ChunkCoord& coord)
+    {
+        m_Sections.erase(coord);
+    }
+
+    void ChunkVisibility::Update(const glm::mat4& viewProjection, const glm::vec3& cameraPosition)
+    {
+        ENGINE_PROFILE_SCOPE("ChunkVisibility::Update");
+
+        // Stamps survive between frames; only a wrap of the counter needs a real clear.
+        if (++m_Frame == 0)
+        {
+            std::fill(m_VisitFrames.begin(), m_VisitFrames.end(), 0);
+            m_Frame = 1;
+        }
+
+        const ViewFrustum l_Frustum = ViewFrustum::FromMatrix(viewProjection);
+        const glm::vec3 l_Extents(s_HalfSection);
+        m_CameraSection =
+        {
+            WorldToChunk(static_cast<int32_t>(std::floor(cameraPosition.x))),
+            WorldToChunk(static_cast<int32_t>(std::floor(cameraPosition.y))),
+            WorldToChunk(static_cast<int32_t>(std::floor(cameraPosition.z)))
+        };
+
+        ChunkVisibilityStats l_Stats;
+        l_Stats.SectionCount = static_cast<uint32_t>(m_Sections.size());
+        uint32_t l_ReachedCount = 0;
+
+        m_Queue.clear();
+        m_VisibleSections.clear();
+        m_Queue.push_back({ m_CameraSection, BlockFace::Count, 0 });
+        m_VisitFrames[GetGridIndex(m_CameraSection)] = m_Frame;
+
+        for (size_t l_Head = 0; l_Head < m_Queue.size(); ++l_Head)
+        {
+            const FloodEntry l_Entry = m_Queue[l_Head];
+            ++l_Stats.VisitedCount;
+
+            const auto it_Section = m_Sections.find(l_Entry.Coord);
+            const Section* l_Section = it_Section != m_Sections.end() ? &it_Section->second : nullptr;
+            if (l_Section != nullptr)
+            {
+                ++l_ReachedCount;
+                if (l_Section->QuadCount > 0)
+                {
+                    m_VisibleSections.push_back(l_Entry.Coord);
+                }
+            }
+
+            for (uint32_t l_Face = 0; l_Face < static_cast<uint32_t>(BlockFace::Count); ++l_Face)
+            {
+                if (m_Settings.OcclusionCulling)
+                {
+                    // Never turn back, and only leave through a face the way in can see.
+                    if ((l_Entry.Directions & (1u << (l_Face ^ 1))) != 0)
+                    {
+                        continue;
+                    }
+
+                    if (l_Section != nullptr && l_Entry.EnteredThrough != BlockFace::Count && !l_Section->Connectivity.Connects(l_Entry.EnteredThrough, static_cast<BlockFace>(l_Face)))
+                    {
+                        continue;
+                    }
+                }
+
+                const ChunkCoord l_Neighbour{ l_Entry.Coord.X + s_FaceX[l_Face], l_Entry.Coord.Y + s_FaceY[l_Face], l_Entry.Coord.Z + s_FaceZ[l_Face] };
+                const uint32_t l_GridIndex = GetGridIndex(l_Neighbour);
+                if (l_GridIndex == UINT32_MAX || m_VisitFrames[l_GridIndex] == m_Frame)
+                {
+                    continue;
+                }
+                m_VisitFrames[l_GridIndex] = m_Frame;
+
+                if (!l_Frustum.IntersectsAabb(GetSectionCenter(l_Neighbour), l_Extents))
+                {
+                    l_Stats.FrustumCulledCount += m_Sections.count(l_Neighbour) != 0 ? 1 : 0;
+                    continue;
+                }
+
+                m_Queue.push_back({ l_Neighbour, static_cast<BlockFace>(l_Face ^ 1), static_cast<uint8_t>(l_Entry.Directions | (1u << l_Face)) });
+            }
+        }
+
+        l_Stats.VisibleCount = static_cast<uint32_t>(m_VisibleSections.size());
+        l_Stats.OcclusionCulledCount = l_Stats.SectionCount - l_ReachedCount - l_Stats.FrustumCulledCount;
+        m_LastFrameStats = l_Stats;
+    }
+
+    uint32_t ChunkVisibility::GetGridIndex(const ChunkCoord& coord) const
+    {
+        const int32_t l_Radius = m_Settings.ViewDistance;
+        const int32_t l_Extent = l_Radius * 2 + 1;
+        const int32_t l_X = coord.X - m_CameraSection.X + l_Radius;
+        const int32_t l_Y = coord.Y - m_CameraSection.Y + l_Radius;
+        const int32_t l_Z = coord.Z - m_CameraSection.Z + l_Radius;
+        if (static_cast<uint32_t>(l_X) >= static_cast<uint32_t>(l_Extent) || static_cast<uint32_t>(l_Y) >= static_cast<uint32_t>(l_Extent)
+            || static_cast<uint32_t>(l_Z) >= static_cast<uint32_t>(l_Extent))
+        {
+            return UINT32_MAX;
+        }
+
+        return static_cast<uint32_t>((l_Y * l_Extent + l_Z) * l_Extent + l_X);
+    }
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/World/Chunk.h"
+#include "Engine/World/ChunkMesher.h"
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine
+{
+    // View frustum as six inward-facing planes, stored plane-major in groups of four so one SSE register tests
+    // a box against four planes at once. Slots 6 and 7 hold a plane every box passes.
+    class ENGINE_API ViewFrustum
+    {
+    public:
+        ViewFrustum();
+
+        // Planes of an OpenGL-style (clip z in [-w, w]) view-projection matrix.
+        static ViewFrustum FromMatrix(const glm::mat4& viewProjection);
+
+        // Conservative: boxes straddling a corner outside two planes at once may still pass.
+        bool IntersectsAabb(const glm::vec3& center, const glm::vec3& extents) const;
+
+        // Same test without SIMD; the reference IntersectsAabb must always agree with.
+        bool IntersectsAabbScalar(const glm::vec3& center, const glm::vec3& extents) const;
+
+    private:
+        static constexpr uint32_t s_PlaneSlots = 8;
+
+        alignas(16) float m_NormalX[s_PlaneSlots];
+        alignas(16) float m_NormalY[s_PlaneSlots];
+        alignas(16) float m_NormalZ[s_PlaneSlots];
+        alignas(16) float m_Distance[s_PlaneSlots];
+    };
+
+    // Counters for one ChunkVisibility::Update.
+    struct ChunkVisibilityStats
+    {
+        // Sections registered with geometry or connectivity.
+        uint32_t SectionCount = 0;
+
+        // Sections (registered or empty space) the flood fill entered.
+        uint32_t VisitedCount = 0;
+
+        // Registered sections reached but rejected by the frustum test.
+        uint32_t FrustumCulledCount = 0;
+
+        // Registered sections never reached: hidden behind opaque sections, beyond the view distance, or cut off
+        // by frustum-culled sections in between.
+        uint32_t OcclusionCulledCount = 0;
+
+        // Sections with geometry handed to the renderer.
+        uint32_t VisibleCount = 0;
+    };
+
+    struct ChunkVisibilitySettings
+    {
+        // Flood fill radius around the camera section, in sections along each axis.
+        int32_t ViewDistance = 12;
+
+        // Follow face connectivity; false visits every section inside the frustum and view distance.
+        bool OcclusionCulling = true;
+    };
+
+    // CPU visibility for chunk sections (one 32x32x32 chunk each). Every frame a breadth-first flood fill starts
+    // at the camera's section and steps to a neighbour only when the neighbour's box intersects the view
+    // frustum, the step never reverses a direction already taken, and the section being left connects the face
+    // it was entered through to the face it leaves through (ChunkFaceConnectivity from meshing). Underground
+    // views therefore stop at cave walls instead of drawing the whole surface above.
+    //
+    // Sections nobody registered count as open space, so unmeshed or ungenerated chunks never hide what lies
+    // behind them. The visible list is in flood order, roughly front to back. Main thread only.
+    class ENGINE_API ChunkVisibility
+    {
+    public:
+        explicit ChunkVisibility(const ChunkVisibilitySettings& settings = ChunkVisibilitySettings());
+
+        // Record a freshly meshed section; replaces what was known about it.
+        void SetSection(const ChunkMesh& mesh);
+        void SetSection(const ChunkCoord& coord, ChunkFaceConnectivity connectivity, uint32_t quadCount);
+        void RemoveSection(const ChunkCoord& coord);
+
+        size_t GetSectionCount() const { return m_Sections.size(); }
+
+        void Update(const glm::mat4& viewProjection, const glm::vec3& cameraPosition);
+
+        // Results of the last Update.
+        const std::vector<ChunkCoord>& GetVisibleSections() const { return m_VisibleSections; }
+        const ChunkVisibilityStats& GetLastFrameStats() const { return m_LastFrameStats; }
+
+    private:
+        struct Section
+        {
+            ChunkFaceConnectivity Connectivity;
+            uint32_t QuadCount = 0;
+        };
+
+        struct FloodEntry
+        {
+            ChunkCoord Coord;
+
+            // Face of this section the flood came in through, or BlockFace::Count for the camera section.
+            BlockFace EnteredThrough = BlockFace::Count;
+
+            // Bit per BlockFace direction already stepped along on the way here.
+            uint8_t Directions = 0;
+        };
+
+        uint32_t GetGridIndex(const ChunkCoord& coord) const;
+
+    private:
+        ChunkVisibilitySettings m_Settings;
+        std::unordered_map<ChunkCoord, Section, ChunkCoordHash> m_Sections;
+
+        // Visit stamps for the cube of sections around the camera, reset by bumping the frame number.
+        std::vector<uint32_t> m_VisitFrames;
+        uint32_t m_Frame = 0;
+        ChunkCoord m_CameraSection;
+
+        std::vector<FloodEntry> m_Queue;
+        std::vector<ChunkCoord> m_VisibleSections;
+        ChunkVisibilityStats m_LastFrameStats;
+    };
+}
@@ -0,0 +1,665 @@
+#include "Engine/World/LightEngine.h"
+
+#include "Engine/Core/Profiler.h"
+#include "Engine/Memory/LinearArena.h"
+
+#include <algorithm>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+namespace Engine
+{
+    namespace
+    {
+        constexpr uint32_t s_DirectionCount = 6;
+        constexpr uint32_t s_DownDirection = static_cast<uint32_t>(BlockFace::NegativeY);
+        constexpr uint32_t s_TopLayerStart = static_cast<uint32_t>(Chunk::Size - 1) << (2 * Chunk::SizeShift);
+
+        // Offsets in BlockFace order.
+        constexpr int32_t s_DirectionX[s_DirectionCount] = { 1, -1, 0, 0, 0, 0 };
+        constexpr int32_t s_DirectionY[s_DirectionCount] = { 0, 0, 1, -1, 0, 0 };
+        constexpr int32_t s_DirectionZ[s_DirectionCount] = { 0, 0, 0, 0, 1, -1 };
+
+        // Level left after entering a voxel of the given opacity; full sky light falls through clear air unchanged.
+        uint8_t Attenuate(uint8_t level, uint8_t opacity, bool isSkyFallingDown)
+        {
+            if (isSkyFallingDown && level == MaxLightLevel && opacity == 0)
+            {
+                return MaxLightLevel;
+            }
+
+            const uint8_t l_Step = std::max<uint8_t>(1, opacity);
+
+            return level > l_Step ? static_cast<uint8_t>(level - l_Step) : uint8_t(0);
+        }
+
+        // Flood fill confined to one chunk, over dense opacity and packed light arrays.
+        void FloodChunk(const uint8_t* opacity, std::vector<uint8_t>& light, std::pmr::vector<uint16_t>& queue)
+        {
+            for (size_t l_Head = 0; l_Head < queue.size(); ++l_Head)
+            {
+                const uint32_t l_Index = queue[l_Head];
+                const uint8_t l_Sky = light[l_Index] >> 4;
+                const uint8_t l_Block = light[l_Index] & 0x0F;
+
+                const int32_t l_X = static_cast<int32_t>(l_Index) & Chunk::SizeMask;
+                const int32_t l_Z = static_cast<int32_t>(l_Index >> Chunk::SizeShift) & Chunk::SizeMask;
+                const int32_t l_Y = static_cast<int32_t>(l_Index >> (2 * Chunk::SizeShift));
+
+                for (uint32_t l_Direction = 0; l_Direction < s_DirectionCount; ++l_Direction)
+                {
+                    const int32_t l_NeighbourX = l_X + s_DirectionX[l_Direction];
+                    const int32_t l_NeighbourY = l_Y + s_DirectionY[l_Direction];
+                    const int32_t l_NeighbourZ = l_Z + s_DirectionZ[l_Direction];
+                    if (static_cast<uint32_t>(l_NeighbourX | l_NeighbourY | l_NeighbourZ) >= static_cast<uint32_t>(Chunk::Size))
+                    {
+                        continue;
+                    }
+
+                    const uint32_t l_Neighbour = Chunk::GetIndex(l_NeighbourX, l_NeighbourY, l_NeighbourZ);
+                    const uint8_t l_Opacity = opacity[l_Neighbour];
+                    const uint8_t l_Current = light[l_Neighbour];
+                    const uint8_t l_NewSky = std::max<uint8_t>(l_Current >> 4, Attenuate(l_Sky, l_Opacity, l_Direction == s_DownDirection));
+                    const uint8_t l_NewBlock = std::max<uint8_t>(l_Current & 0x0F, Attenuate(l_Block, l_Opacity, false));
+                    const uint8_t l_New = LightStorage::Pack(l_NewSky, l_NewBlock);
+                    if (l_New != l_Current)
+                    {
+                        light[l_Neighbour] = l_New;
+                        queue.push_back(static_cast<uint16_t>(l_Neighbour));
+                    }
+                }
+            }
+        }
+    }
+
+    LightEngine::LightEngine(World& world, const BlockRegistry& registry) : m_World(world), m_Registry(registry)
+    {
+
+    }
+
+    void LightEngine::ComputeChunkLight(const PaletteStorage& blocks, const SkyLayer& skyAbove, const uint8_t* opacityTable, const uint8_t* emissionTable,
+        uint32_t tableSize, LightStorage& outLight)
+    {
+        ENGINE_PROFILE_SCOPE("LightEngine::ComputeChunkLight");
+
+        // Uniform chunks without emitters are dark, or fully sky lit when clear air sits under full sky.
+        if (blocks.IsUniform())
+        {
+            const BlockId l_Block = blocks.Get(0);
+            const uint8_t l_Opacity = l_Block < tableSize ? opacityTable[l_Block] : MaxLightLevel;
+            const uint8_t l_Emission = l_Block < tableSize ? emissionTable[l_Block] : uint8_t(0);
+            const bool l_IsDark = std::all_of(skyAbove.begin(), skyAbove.end(), [](uint8_t level) { return level <= 1; });
+            const bool l_IsFullSky = std::all_of(skyAbove.begin(), skyAbove.end(), [](uint8_t level) { return level == MaxLightLevel; });
+            if (l_Emission == 0 && (l_IsDark || l_Opacity >= MaxLightLevel || (l_Opacity == 0 && l_IsFullSky)))
+            {
+                outLight.Fill(l_IsFullSky && l_Opacity == 0 ? LightStorage::FullSky : uint8_t(0));
+
+                return;
+            }
+        }
+
+        // Opacity and the flood queue die with this call; only the light array outlives it.
+        ScratchScope l_Scratch;
+        uint8_t* l_Opacity = l_Scratch.GetArena().AllocateArray<uint8_t>(Chunk::Volume);
+        std::vector<uint8_t> l_Light(Chunk::Volume, 0);
+        std::pmr::vector<uint16_t> l_Queue(l_Scratch.GetMemoryResource());
+        l_Queue.reserve(Chunk::Volume);
+
+        for (uint32_t i = 0; i < Chunk::Volume; ++i)
+        {
+            const BlockId l_Block = blocks.Get(i);
+            const uint8_t l_Emission = l_Block < tableSize ? emissionTable[l_Block] : uint8_t(0);
+            l_Opacity[i] = l_Block < tableSize ? opacityTable[l_Block] : MaxLightLevel;
+            if (l_Emission > 0)
+            {
+                l_Light[i] = l_Emission;
+                l_Queue.push_back(static_cast<uint16_t>(i));
+            }
+        }
+
+        for (uint32_t l_Column = 0; l_Column < skyAbove.size(); ++l_Column)
+        {
+            const uint32_t l_Index = s_TopLayerStart + l_Column;
+            const uint8_t l_Sky = Attenuate(skyAbove[l_Column], l_Opacity[l_Index], true);
+            if (l_Sky > 0)
+            {
+                l_Light[l_Index] = LightStorage::Pack(l_Sky, l_Light[l_Index] & 0x0F);
+                l_Queue.push_back(static_cast<uint16_t>(l_Index));
+            }
+        }
+
+        FloodChunk(l_Opacity, l_Light, l_Queue);
+        outLight.Assign(std::move(l_Light));
+    }
+
+    const SkyLayer& LightEngine::GetOpenSkyLayer()
+    {
+        static const SkyLayer s_OpenSky = []()
+            {
+                SkyLayer l_Layer;
+                l_Layer.fill(MaxLightLevel);
+
+                return l_Layer;
+            }();
+
+        return s_OpenSky;
+    }
+
+    std::shared_ptr<LightBatch> LightEngine::LightChunksAsync(JobSystem& jobSystem, const std::vector<ChunkCoord>& coords) const
+    {
+        ENGINE_PROFILE_SCOPE("LightEngine::LightChunksAsync");
+
+        std::shared_ptr<LightBatch> l_Batch = std::make_shared<LightBatch>();
+        l_Batch->m_Opacity.assign(m_Registry.GetLightOpacityTable(), m_Registry.GetLightOpacityTable() + m_Registry.GetBlockCount());
+        l_Batch->m_Emission.assign(m_Registry.GetLightEmissionTable(), m_Registry.GetLightEmissionTable() + m_Registry.GetBlockCount());
+
+        std::unordered_map<ChunkCoord, LightBatch::ChunkTask*, ChunkCoordHash> l_Requested;
+        for (const ChunkCoord& it_Coord : coords)
+        {
+            const Chunk* l_Chunk = m_World.FindChunk(it_Coord);
+            if (l_Chunk == nullptr || l_Chunk->GetLight().IsLit() || l_Requested.count(it_Coord) != 0)
+            {
+                continue;
+            }
+
+            l_Batch->m_Tasks.push_back(std::make_unique<LightBatch::ChunkTask>(*l_Chunk));
+            l_Requested.emplace(it_Coord, l_Batch->m_Tasks.back().get());
+        }
+
+        // Top down, so each chunk above is scheduled and merged before the chunk below it, then in a fixed order for determinism.
+        std::sort(l_Batch->m_Tasks.begin(), l_Batch->m_Tasks.end(), [](const std::unique_ptr<LightBatch::ChunkTask>& a, const std::unique_ptr<LightBatch::ChunkTask>& b)
+            {
+                return std::make_tuple(-a->Coord.Y, a->Coord.Z, a->Coord.X) < std::make_tuple(-b->Coord.Y, b->Coord.Z, b->Coord.X);
+            });
+
+        for (const std::unique_ptr<LightBatch::ChunkTask>& it_Task : l_Batch->m_Tasks)
+        {
+            const ChunkCoord l_Above{ it_Task->Coord.X, it_Task->Coord.Y + 1, it_Task->Coord.Z };
+            const auto it_Above = l_Requested.find(l_Above);
+            if (it_Above != l_Requested.end())
+            {
+                it_Task->Above = it_Above->second;
+                it_Task->Above->HasTaskBelow = true;
+            }
+            else
+            {
+                it_Task->SkyAbove = GetSkyAbove(it_Task->Coord);
+            }
+        }
+
+        for (const std::unique_ptr<LightBatch::ChunkTask>& it_Task : l_Batch->m_Tasks)
+        {
+            // Only the bottom of each column reports to the batch; it cannot finish before the tasks above it.
+            LightBatch::ChunkTask* l_Task = it_Task.get();
+            JobCounter* l_Counter = l_Task->HasTaskBelow ? &l_Task->Counter : &l_Batch->m_Counter;
+            auto a_Light = [l_Batch, l_Task]()
+                {
+                    if (l_Task->Above != nullptr)
+                    {
+                        l_Task->SkyAbove = l_Task->Above->SkyBelow;
+                    }
+
+                    ComputeChunkLight(l_Task->Blocks, l_Task->SkyAbove, l_Batch->m_Opacity.data(), l_Batch->m_Emission.data(),
+                        static_cast<uint32_t>(l_Batch->m_Opacity.size()), l_Task->Light);
+
+                    if (l_Task->HasTaskBelow)
+                    {
+                        for (uint32_t l_Column = 0; l_Column < l_Task->SkyBelow.size(); ++l_Column)
+                        {
+                            l_Task->SkyBelow[l_Column] = l_Task->Light.GetSky(l_Column);
+                        }
+                    }
+                };
+
+            if (l_Task->Above != nullptr)
+            {
+                jobSystem.SubmitAfter(l_Task->Above->Counter, std::move(a_Light), l_Counter);
+            }
+            else
+            {
+                jobSystem.Submit(std::move(a_Light), l_Counter);
+            }
+        }
+
+        return l_Batch;
+    }
+
+    LightPropagationStats LightEngine::Merge(LightBatch& batch)
+    {
+        ENGINE_PROFILE_SCOPE("LightEngine::Merge");
+
+        LightPropagationStats l_Stats;
+        for (const std::unique_ptr<LightBatch::ChunkTask>& it_Task : batch.m_Tasks)
+        {
+            Chunk* l_Chunk = m_World.FindChunk(it_Task->Coord);
+            if (l_Chunk == nullptr || l_Chunk->GetLight().IsLit())
+            {
+                continue;
+            }
+
+            // The worker's light is a safe starting point as long as it never assumed more sky than now enters from
+            // above (the chunk above may have been edited, unloaded or lit since) and the chunk itself is unchanged.
+            const SkyLayer l_SkyAbove = GetSkyAbove(it_Task->Coord);
+            bool l_IsStale = l_Chunk->GetVersion() != it_Task->Version;
+            for (uint32_t l_Column = 0; l_Column < l_SkyAbove.size() && !l_IsStale; ++l_Column)
+            {
+                l_IsStale = it_Task->SkyAbove[l_Column] > l_SkyAbove[l_Column];
+            }
+
+            if (l_IsStale)
+            {
+                ComputeChunkLight(l_Chunk->GetStorage(), l_SkyAbove, batch.m_Opacity.data(), batch.m_Emission.data(),
+                    static_cast<uint32_t>(batch.m_Opacity.size()), it_Task->Light);
+                ++l_Stats.ChunksRelit;
+            }
+
+            MergeChunk(*l_Chunk, std::move(it_Task->Light));
+        }
+
+        const LightPropagationStats l_Propagation = Propagate();
+        l_Stats.VoxelsVisited += l_Propagation.VoxelsVisited;
+        l_Stats.VoxelsChanged += l_Propagation.VoxelsChanged;
+
+        return l_Stats;
+    }
+
+    LightPropagationStats LightEngine::LightChunk(const ChunkCoord& coord)
+    {
+        Chunk* l_Chunk = m_World.FindChunk(coord);
+        if (l_Chunk == nullptr || l_Chunk->GetLight().IsLit())
+        {
+            return LightPropagationStats();
+        }
+
+        LightStorage l_Light;
+        ComputeChunkLight(l_Chunk->GetStorage(), GetSkyAbove(coord), m_Registry.GetLightOpacityTable(), m_Registry.GetLightEmissionTable(),
+            m_Registry.GetBlockCount(), l_Light);
+        MergeChunk(*l_Chunk, std::move(l_Light));
+
+        return Propagate();
+    }
+
+    void LightEngine::MergeChunk(Chunk& chunk, LightStorage&& light)
+    {
+        const ChunkCoord& l_Coord = chunk.GetCoord();
+        const Chunk* l_Above = FindLitChunk({ l_Coord.X, l_Coord.Y + 1, l_Coord.Z });
+
+        LightStorage& l_Light = chunk.GetLight();
+        l_Light = std::move(light);
+        l_Light.SetLit(true);
+        l_Light.SetOpenSky(l_Above == nullptr);
+        m_ChangedChunks.insert(l_Coord);
+
+        // Light computed from less than the open sky (its column above was dropped) is topped up here.
+        if (l_Above == nullptr)
+        {
+            for (uint32_t i = s_TopLayerStart; i < Chunk::Volume; ++i)
+            {
+                if (l_Light.GetSky(i) < Attenuate(MaxLightLevel, m_Registry.GetLightOpacity(chunk.GetBlock(i)), true))
+                {
+                    SeedOpenSky(chunk, i);
+                }
+            }
+        }
+
+        Chunk* l_Below = FindLitChunk({ l_Coord.X, l_Coord.Y - 1, l_Coord.Z });
+        if (l_Below != nullptr && l_Below->GetLight().HasOpenSky())
+        {
+            CloseOpenSky(*l_Below);
+        }
+
+        SeedBorders(chunk);
+    }
+
+    void LightEngine::CloseOpenSky(Chunk& chunk)
+    {
+        chunk.GetLight().SetOpenSky(false);
+
+        const ChunkCoord& l_Coord = chunk.GetCoord();
+        const Chunk* l_Above = FindLitChunk({ l_Coord.X, l_Coord.Y + 1, l_Coord.Z });
+        for (uint32_t l_Column = 0; l_Column < Chunk::Size * Chunk::Size; ++l_Column)
+        {
+            const uint32_t l_Index = s_TopLayerStart + l_Column;
+            const uint8_t l_Sky = chunk.GetLight().GetSky(l_Index);
+            if (l_Sky == 0)
+            {
+                continue;
+            }
+
+            // Only levels the open sky could have produced are suspect; the layer above may still supply them.
+            const uint8_t l_Opacity = m_Registry.GetLightOpacity(chunk.GetBlock(l_Index));
+            const uint8_t l_FromAbove = l_Above != nullptr ? Attenuate(l_Above->GetLight().GetSky(l_Column), l_Opacity, true) : uint8_t(0);
+            if (l_Sky != Attenuate(MaxLightLevel, l_Opacity, true) || l_FromAbove >= l_Sky)
+            {
+                continue;
+            }
+
+            SetLevel(chunk, l_Index, SkyChannel, 0);
+            m_RemovalQueues[SkyChannel].push_back({ &chunk, static_cast<uint16_t>(l_Index), l_Sky });
+        }
+    }
+
+    void LightEngine::SeedBorders(Chunk& chunk)
+    {
+        const ChunkCoord& l_Coord = chunk.GetCoord();
+        for (uint32_t l_Direction = 0; l_Direction < s_DirectionCount; ++l_Direction)
+        {
+            Chunk* l_Neighbour = FindLitChunk({ l_Coord.X + s_DirectionX[l_Direction], l_Coord.Y + s_DirectionY[l_Direction], l_Coord.Z + s_DirectionZ[l_Direction] });
+            if (l_Neighbour == nullptr)
+            {
+                continue;
+            }
+
+            // Walk the shared face: the fixed axis sits on the far side here and the near side in the neighbour.
+            const int32_t l_Far = (l_Direction % 2 == 0) ? Chunk::SizeMask : 0;
+            const int32_t l_Near = Chunk::SizeMask - l_Far;
+            for (int32_t l_U = 0; l_U < Chunk::Size; ++l_U)
+            {
+                for (int32_t l_V = 0; l_V < Chunk::Size; ++l_V)
+                {
+                    uint32_t l_Inside = 0;
+                    uint32_t l_Outside = 0;
+                    if (s_DirectionX[l_Direction] != 0)
+                    {
+                        l_Inside = Chunk::GetIndex(l_Far, l_U, l_V);
+                        l_Outside = Chunk::GetIndex(l_Near, l_U, l_V);
+                    }
+                    else if (s_DirectionY[l_Direction] != 0)
+                    {
+                        l_Inside = Chunk::GetIndex(l_U, l_Far, l_V);
+                        l_Outside = Chunk::GetIndex(l_U, l_Near, l_V);
+                    }
+                    else
+                    {
+                        l_Inside = Chunk::GetIndex(l_U, l_V, l_Far);
+                        l_Outside = Chunk::GetIndex(l_U, l_V, l_Near);
+                    }
+
+                    // Only pairs where light would actually cross are queued; most borders already agree.
+                    const uint8_t l_InsideOpacity = m_Registry.GetLightOpacity(chunk.GetBlock(l_Inside));
+                    const uint8_t l_OutsideOpacity = m_Registry.GetLightOpacity(l_Neighbour->GetBlock(l_Outside));
+                    for (uint32_t l_Channel = 0; l_Channel < ChannelCount; ++l_Channel)
+                    {
+                        const Channel l_Type = static_cast<Channel>(l_Channel);
+                        const bool l_IsFallingSky = l_Type == SkyChannel && s_DirectionY[l_Direction] != 0;
+                        const uint8_t l_InsideLevel = GetLevel(chunk, l_Inside, l_Type);
+                        const uint8_t l_OutsideLevel = GetLevel(*l_Neighbour, l_Outside, l_Type);
+                        if (Attenuate(l_InsideLevel, l_OutsideOpacity, l_IsFallingSky && l_Direction == s_DownDirection) > l_OutsideLevel)
+                        {
+                            m_AdditionQueues[l_Channel].push_back({ &chunk, static_cast<uint16_t>(l_Inside), 0 });
+                        }
+                        if (Attenuate(l_OutsideLevel, l_InsideOpacity, l_IsFallingSky && l_Direction != s_DownDirection) > l_InsideLevel)
+                        {
+                            m_AdditionQueues[l_Channel].push_back({ l_Neighbour, static_cast<uint16_t>(l_Outside), 0 });
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    void LightEngine::OnBlockChanged(int32_t worldX, int32_t worldY, int32_t worldZ)
+    {
+        Chunk* l_Chunk = FindLitChunk({ WorldToChunk(worldX), WorldToChunk(worldY), WorldToChunk(worldZ) });
+        if (l_Chunk == nullptr)
+        {
+            return;
+        }
+
+        const uint32_t l_Index = Chunk::GetIndex(WorldToLocal(worldX), WorldToLocal(worldY), WorldToLocal(worldZ));
+
+        // Whatever the old block let through goes; the refill below brings back what still reaches it.
+        for (uint32_t l_Channel = 0; l_Channel < ChannelCount; ++l_Channel)
+        {
+            const uint8_t l_Level = GetLevel(*l_Chunk, l_Index, static_cast<Channel>(l_Channel));
+            if (l_Level > 0)
+            {
+                SetLevel(*l_Chunk, l_Index, static_cast<Channel>(l_Channel), 0);
+                m_RemovalQueues[l_Channel].push_back({ l_Chunk, static_cast<uint16_t>(l_Index), l_Level });
+            }
+        }
+
+        const uint8_t l_Emission = m_Registry.GetLightEmission(l_Chunk->GetBlock(l_Index));
+        if (l_Emission > 0)
+        {
+            SetLevel(*l_Chunk, l_Index, BlockChannel, l_Emission);
+            m_AdditionQueues[BlockChannel].push_back({ l_Chunk, static_cast<uint16_t>(l_Index), l_Emission });
+        }
+
+        if (l_Index >= s_TopLayerStart && l_Chunk->GetLight().HasOpenSky())
+        {
+            SeedOpenSky(*l_Chunk, l_Index);
+        }
+
+        for (uint32_t l_Direction = 0; l_Direction < s_DirectionCount; ++l_Direction)
+        {
+            uint32_t l_NeighbourIndex = 0;
+            Chunk* l_Neighbour = FindNeighbour(*l_Chunk, l_Index, l_Direction, l_NeighbourIndex);
+            if (l_Neighbour == nullptr)
+            {
+                continue;
+            }
+
+            for (uint32_t l_Channel = 0; l_Channel < ChannelCount; ++l_Channel)
+            {
+                if (GetLevel(*l_Neighbour, l_NeighbourIndex, static_cast<Channel>(l_Channel)) > 0)
+                {
+                    m_AdditionQueues[l_Channel].push_back({ l_Neighbour, static_cast<uint16_t>(l_NeighbourIndex), 0 });
+                }
+            }
+        }
+    }
+
+    LightPropagationStats LightEngine::Propagate()
+    {
+        ENGINE_PROFILE_SCOPE("LightEngine::Propagate");
+
+        LightPropagationStats l_Stats;
+        for (uint32_t l_Channel = 0; l_Channel < ChannelCount; ++l_Channel)
+        {
+            // Removal runs to completion first: it refills the addition queue with the light that survives.
+            PropagateRemoval(static_cast<Channel>(l_Channel), l_Stats);
+            PropagateAddition(static_cast<Channel>(l_Channel), l_Stats);
+        }
+        m_LastChangedChunk = nullptr;
+
+        return l_Stats;
+    }
+
+    void LightEngine::PropagateRemoval(Channel channel, LightPropagationStats& stats)
+    {
+        std::vector<QueueEntry>& l_Queue = m_RemovalQueues[channel];
+        std::vector<QueueEntry>& l_Additions = m_AdditionQueues[channel];
+        for (size_t l_Head = 0; l_Head < l_Queue.size(); ++l_Head)
+        {
+            const QueueEntry l_Entry = l_Queue[l_Head];
+            ++stats.VoxelsVisited;
+
+            for (uint32_t l_Direction = 0; l_Direction < s_DirectionCount; ++l_Direction)
+            {
+                uint32_t l_NeighbourIndex = 0;
+                Chunk* l_Neighbour = FindNeighbour(*l_Entry.Target, l_Entry.Index, l_Direction, l_NeighbourIndex);
+                if (l_Neighbour == nullptr)
+                {
+                    continue;
+                }
+
+                const uint8_t l_Level = GetLevel(*l_Neighbour, l_NeighbourIndex, channel);
+                if (l_Level == 0)
+                {
+                    continue;
+                }
+
+                // Anything dimmer may have been lit through the removed voxel, as may full sky directly below it.
+                const bool l_IsFallingSky = channel == SkyChannel && l_Direction == s_DownDirection && l_Entry.Level == MaxLightLevel && l_Level == MaxLightLevel;
+                if (l_Level >= l_Entry.Level && !l_IsFallingSky)
+                {
+                    l_Additions.push_back({ l_Neighbour, static_cast<uint16_t>(l_NeighbourIndex), 0 });
+                    continue;
+                }
+
+                SetLevel(*l_Neighbour, l_NeighbourIndex, channel, 0);
+                ++stats.VoxelsChanged;
+                l_Queue.push_back({ l_Neighbour, static_cast<uint16_t>(l_NeighbourIndex), l_Level });
+
+                // Sources survive any removal; they are re-lit and flood back out in the addition pass.
+                if (channel == BlockChannel)
+                {
+                    const uint8_t l_Emission = m_Registry.GetLightEmission(l_Neighbour->GetBlock(l_NeighbourIndex));
+                    if (l_Emission > 0)
+                    {
+                        SetLevel(*l_Neighbour, l_NeighbourIndex, channel, l_Emission);
+                        l_Additions.push_back({ l_Neighbour, static_cast<uint16_t>(l_NeighbourIndex), l_Emission });
+                    }
+                }
+                else if (l_NeighbourIndex >= s_TopLayerStart && l_Neighbour->GetLight().HasOpenSky())
+                {
+                    SeedOpenSky(*l_Neighbour, l_NeighbourIndex);
+                }
+            }
+        }
+        l_Queue.clear();
+    }
+
+    void LightEngine::PropagateAddition(Channel channel, LightPropagationStats& stats)
+    {
+        std::vector<QueueEntry>& l_Queue = m_AdditionQueues[channel];
+        for (size_t l_Head = 0; l_Head < l_Queue.size(); ++l_Head)
+        {
+            const QueueEntry l_Entry = l_Queue[l_Head];
+            ++stats.VoxelsVisited;
+
+            // The level may have risen or been removed since the entry was queued; spread what is there now.
+            const uint8_t l_Level = GetLevel(*l_Entry.Target, l_Entry.Index, channel);
+            if (l_Level <= 1)
+            {
+                continue;
+            }
+
+            for (uint32_t l_Direction = 0; l_Direction < s_DirectionCount; ++l_Direction)
+            {
+                uint32_t l_NeighbourIndex = 0;
+                Chunk* l_Neighbour = FindNeighbour(*l_Entry.Target, l_Entry.Index, l_Direction, l_NeighbourIndex);
+                if (l_Neighbour == nullptr)
+                {
+                    continue;
+                }
+
+                const uint8_t l_Opacity = m_Registry.GetLightOpacity(l_Neighbour->GetBlock(l_NeighbourIndex));
+                const uint8_t l_NewLevel = Attenuate(l_Level, l_Opacity, channel == SkyChannel && l_Direction == s_DownDirection);
+                if (l_NewLevel <= GetLevel(*l_Neighbour, l_NeighbourIndex, channel))
+                {
+                    continue;
+                }
+
+                SetLevel(*l_Neighbour, l_NeighbourIndex, channel, l_NewLevel);
+                ++stats.VoxelsChanged;
+                l_Queue.push_back({ l_Neighbour, static_cast<uint16_t>(l_NeighbourIndex), l_NewLevel });
+            }
+        }
+        l_Queue.clear();
+    }
+
+    void LightEngine::SeedOpenSky(Chunk& chunk, uint32_t index)
+    {
+        const uint8_t l_Sky = Attenuate(MaxLightLevel, m_Registry.GetLightOpacity(chunk.GetBlock(index)), true);
+        if (l_Sky > GetLevel(chunk, index, SkyChannel))
+        {
+            SetLevel(chunk, index, SkyChannel, l_Sky);
+        }
+
+        if (l_Sky > 0)
+        {
+            m_AdditionQueues[SkyChannel].push_back({ &chunk, static_cast<uint16_t>(index), l_Sky });
+        }
+    }
+
+    SkyLayer LightEngine::GetSkyAbove(const ChunkCoord& coord) const
+    {
+        const Chunk* l_Above = FindLitChunk({ coord.X, coord.Y + 1, coord.Z });
+        if (l_Above == nullptr)
+        {
+            return GetOpenSkyLayer();
+        }
+
+        SkyLayer l_Layer;
+        for (uint32_t l_Column = 0; l_Column < l_Layer.size(); ++l_Column)
+        {
+            l_Layer[l_Column] = l_Above->GetLight().GetSky(l_Column);
+        }
+
+        return l_Layer;
+    }
+
+    uint8_t LightEngine::GetSkyLight(int32_t worldX, int32_t worldY, int32_t worldZ) const
+    {
+        const Chunk* l_Chunk = FindLitChunk({ WorldToChunk(worldX), WorldToChunk(worldY), WorldToChunk(worldZ) });
+
+        return l_Chunk != nullptr ? l_Chunk->GetLight().GetSky(Chunk::GetIndex(WorldToLocal(worldX), WorldToLocal(worldY), WorldToLocal(worldZ))) : uint8_t(0);
+    }
+
+    uint8_t LightEngine::GetBlockLight(int32_t worldX, int32_t worldY, int32_t worldZ) const
+    {
+        const Chunk* l_Chunk = FindLitChunk({ WorldToChunk(worldX), WorldToChunk(worldY), WorldToChunk(worldZ) });
+
+        return l_Chunk != nullptr ? l_Chunk->GetLight().GetBlock(Chunk::GetIndex(WorldToLocal(worldX), WorldToLocal(worldY), WorldToLocal(worldZ))) : uint8_t(0);
+    }
+
+    std::vector<ChunkCoord> LightEngine::TakeChangedChunks()
+    {
+        std::vector<ChunkCoord> l_Changed(m_ChangedChunks.begin(), m_ChangedChunks.end());
+        m_ChangedChunks.clear();
+        m_LastChangedChunk = nullptr;
+
+        return l_Changed;
+    }
+
+    uint8_t LightEngine::GetLevel(const Chunk& chunk, uint32_t index, Channel channel) const
+    {
+        return channel == SkyChannel ? chunk.GetLight().GetSky(index) : chunk.GetLight().GetBlock(index);
+    }
+
+    void LightEngine::SetLevel(Chunk& chunk, uint32_t index, Channel channel, uint8_t level)
+    {
+        if (channel == SkyChannel)
+        {
+            chunk.GetLight().SetSky(index, level);
+        }
+        else
+        {
+            chunk.GetLight().SetBlock(index, level);
+        }
+
+        // Consecutive writes nearly always land in the same chunk, so skip the set lookup for those.
+        if (&chunk != m_LastChangedChunk)
+        {
+            m_ChangedChunks.insert(chunk.GetCoord());
+            m_LastChangedChunk = &chunk;
+        }
+    }
+
+    Chunk* LightEngine::FindNeighbour(Chunk& chunk, uint32_t index, uint32_t direction, uint32_t& outIndex) const
+    {
+        const int32_t l_X = static_cast<int32_t>(index & Chunk::SizeMask) + s_DirectionX[direction];
+        const int32_t l_Z = static_cast<int32_t>((index >> Chunk::SizeShift) & Chunk::SizeMask) + s_DirectionZ[direction];
+        const int32_t l_Y = static_cast<int32_t>(index >> (2 * Chunk::SizeShift)) + s_DirectionY[direction];
+
+        outIndex = Chunk::GetIndex(l_X & Chunk::SizeMask, l_Y & Chunk::SizeMask, l_Z & Chunk::SizeMask);
+        if (static_cast<uint32_t>(l_X | l_Y | l_Z) < static_cast<uint32_t>(Chunk::Size))
+        {
+            return &chunk;
+        }
+
+        const ChunkCoord& l_Coord = chunk.GetCoord();
+
+        return FindLitChunk({ l_Coord.X + s_DirectionX[direction], l_Coord.Y + s_DirectionY[direction], l_Coord.Z + s_DirectionZ[direction] });
+    }
+
+    Chunk* LightEngine::FindLitChunk(const ChunkCoord& coord) const
+    {
+        Chunk* l_Chunk = m_World.FindChunk(coord);
+
+        return l_Chunk != nullptr && l_Chunk->GetLight().IsLit() ? l_Chunk : nullptr;
+    }
+}
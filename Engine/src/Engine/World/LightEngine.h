@@ -0,0 +1,179 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/Jobs/JobSystem.h"
+#include "Engine/World/BlockRegistry.h"
+#include "Engine/World/Chunk.h"
+#include "Engine/World/LightStorage.h"
+#include "Engine/World/World.h"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+namespace Engine
+{
+    // Work done by one LightEngine::Propagate call (or a merge, which ends in one).
+    struct LightPropagationStats
+    {
+        // Queue entries processed; proportional to the volume whose light was reconsidered.
+        uint32_t VoxelsVisited = 0;
+
+        // Voxels whose sky or block level actually changed.
+        uint32_t VoxelsChanged = 0;
+
+        // Chunks of a batch lit again on the main thread because they or the chunk above changed after the snapshot.
+        uint32_t ChunksRelit = 0;
+    };
+
+    // Sky levels of one horizontal layer of a chunk, x fastest then z, like the low bits of Chunk::GetIndex.
+    using SkyLayer = std::array<uint8_t, Chunk::Size * Chunk::Size>;
+
+    class LightEngine;
+
+    // Initial lighting for a set of chunks. Keep the handle until IsComplete, then pass it to
+    // LightEngine::Merge on the main thread. Dropping the handle early is safe; in-flight jobs keep the batch alive.
+    class ENGINE_API LightBatch
+    {
+    public:
+        bool IsComplete() const { return m_Counter.IsComplete(); }
+        JobCounter& GetCounter() { return m_Counter; }
+
+        size_t GetChunkCount() const { return m_Tasks.size(); }
+
+    private:
+        friend class LightEngine;
+
+        // Workers only see the snapshot; Version tells the merge whether the chunk was edited meanwhile.
+        // A chunk directly below another one of the batch waits for it and starts from its bottom layer,
+        // so sky light falls through a whole column of new chunks before the merge.
+        struct ChunkTask
+        {
+            explicit ChunkTask(const Chunk& chunk) : Coord(chunk.GetCoord()), Version(chunk.GetVersion()), Blocks(chunk.GetStorage()) {}
+
+            ChunkCoord Coord;
+            uint64_t Version = 0;
+            PaletteStorage Blocks;
+            LightStorage Light;
+
+            ChunkTask* Above = nullptr;
+            bool HasTaskBelow = false;
+            JobCounter Counter;
+
+            // Sky entering through the top face, and leaving through the bottom face once lit.
+            SkyLayer SkyAbove{};
+            SkyLayer SkyBelow{};
+        };
+
+        std::vector<std::unique_ptr<ChunkTask>> m_Tasks;
+
+        // Copies of the registry tables, so jobs never reach back into the engine.
+        std::vector<uint8_t> m_Opacity;
+        std::vector<uint8_t> m_Emission;
+        JobCounter m_Counter;
+    };
+
+    // Flood-fill voxel lighting with two 4-bit channels per voxel, stored in each chunk's LightStorage:
+    //   - Sky light enters the top layer of every chunk with no lit chunk above it at level 15 and keeps
+    //     level 15 straight down through fully transparent blocks.
+    //   - Block light starts at every block's LightEmission.
+    // Each step to a neighbour costs max(1, LightOpacity) levels, so a voxel's level is the best path from
+    // any source and the result does not depend on the order in which chunks or edits arrive.
+    //
+    // Freshly loaded chunks are lit in isolation on workers (LightChunksAsync) and stitched together on the
+    // main thread (Merge), which seeds the flood fill along every border shared with an already lit chunk.
+    // Block edits go through OnBlockChanged, which queues a removal pass for light that depended on the old
+    // block and a refill from the surviving neighbours, so an edit costs time in the size of the region whose
+    // light changes rather than in the size of the world.
+    //
+    // Main thread only, like World. The registry must outlive the engine.
+    class ENGINE_API LightEngine
+    {
+    public:
+        LightEngine(World& world, const BlockRegistry& registry);
+
+        // Snapshot the given chunks and light each one on the job system. Chunks that are missing or already
+        // lit are left out; the returned batch may be empty.
+        std::shared_ptr<LightBatch> LightChunksAsync(JobSystem& jobSystem, const std::vector<ChunkCoord>& coords) const;
+
+        // Move finished light into the world and propagate it across chunk borders. Chunks unloaded since the
+        // snapshot are skipped and chunks edited since are relit here. Results are independent of worker count.
+        LightPropagationStats Merge(LightBatch& batch);
+
+        // Light a single chunk on the calling thread and merge it; the synchronous form of the two calls above.
+        LightPropagationStats LightChunk(const ChunkCoord& coord);
+
+        // Queue the light changes caused by an edit at a world block position. Call after World::SetBlock,
+        // then call Propagate once per batch of edits, before any chunk is removed from the world.
+        void OnBlockChanged(int32_t worldX, int32_t worldY, int32_t worldZ);
+
+        // Drain the queues filled by OnBlockChanged.
+        LightPropagationStats Propagate();
+
+        // Unloaded or unlit positions read as dark.
+        uint8_t GetSkyLight(int32_t worldX, int32_t worldY, int32_t worldZ) const;
+        uint8_t GetBlockLight(int32_t worldX, int32_t worldY, int32_t worldZ) const;
+
+        // Chunks whose light changed since the last call, for rebuilding meshes.
+        std::vector<ChunkCoord> TakeChangedChunks();
+
+        // Light a chunk in isolation: sky light falling in from the layer above, block light from emitters and
+        // nothing from the sides. Tables hold tableSize entries; ids past the end are treated as opaque and dark.
+        static void ComputeChunkLight(const PaletteStorage& blocks, const SkyLayer& skyAbove, const uint8_t* opacityTable, const uint8_t* emissionTable,
+            uint32_t tableSize, LightStorage& outLight);
+
+        // What the open sky shines into the top of a chunk with nothing lit above it: level 15 everywhere.
+        static const SkyLayer& GetOpenSkyLayer();
+
+    private:
+        enum Channel : uint32_t
+        {
+            SkyChannel = 0,
+            BlockChannel = 1,
+            ChannelCount = 2
+        };
+
+        struct QueueEntry
+        {
+            Chunk* Target = nullptr;
+            uint16_t Index = 0;
+            uint8_t Level = 0;
+        };
+
+        uint8_t GetLevel(const Chunk& chunk, uint32_t index, Channel channel) const;
+        void SetLevel(Chunk& chunk, uint32_t index, Channel channel, uint8_t level);
+
+        // Neighbour in direction (0..5 in BlockFace order) across chunk borders; null when it is not lit.
+        Chunk* FindNeighbour(Chunk& chunk, uint32_t index, uint32_t direction, uint32_t& outIndex) const;
+        Chunk* FindLitChunk(const ChunkCoord& coord) const;
+
+        // Give a top-layer voxel of an open-sky chunk the level sky light reaches it with, and queue it.
+        void SeedOpenSky(Chunk& chunk, uint32_t index);
+
+        // The sky a chunk receives from above right now: the bottom layer of a lit chunk, or the open sky.
+        SkyLayer GetSkyAbove(const ChunkCoord& coord) const;
+
+        // A chunk above has been lit, so the top layer below stops being open sky.
+        void CloseOpenSky(Chunk& chunk);
+
+        // Queue the brighter side of every voxel pair across the borders between chunk and its lit neighbours.
+        void SeedBorders(Chunk& chunk);
+
+        void MergeChunk(Chunk& chunk, LightStorage&& light);
+
+        void PropagateRemoval(Channel channel, LightPropagationStats& stats);
+        void PropagateAddition(Channel channel, LightPropagationStats& stats);
+
+    private:
+        World& m_World;
+        const BlockRegistry& m_Registry;
+
+        std::array<std::vector<QueueEntry>, ChannelCount> m_RemovalQueues;
+        std::array<std::vector<QueueEntry>, ChannelCount> m_AdditionQueues;
+
+        std::unordered_set<ChunkCoord, ChunkCoordHash> m_ChangedChunks;
+        const Chunk* m_LastChangedChunk = nullptr;
+    };
+}
@@ -0,0 +1,38 @@
+#include "Engine/World/LightStorage.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace Engine
+{
+    void LightStorage::Fill(uint8_t packed)
+    {
+        std::vector<uint8_t>().swap(m_Values);
+        m_UniformValue = packed;
+    }
+
+    void LightStorage::Assign(std::vector<uint8_t> values)
+    {
+        m_Values = std::move(values);
+        Compact();
+    }
+
+    void LightStorage::Compact()
+    {
+        if (m_Values.empty())
+        {
+            return;
+        }
+
+        const uint8_t l_First = m_Values[0];
+        if (std::all_of(m_Values.begin(), m_Values.end(), [l_First](uint8_t value) { return value == l_First; }))
+        {
+            Fill(l_First);
+        }
+    }
+
+    void LightStorage::Expand()
+    {
+        m_Values.assign(Volume, m_UniformValue);
+    }
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Engine
+{
+    constexpr uint8_t MaxLightLevel = 15;
+
+    // Light of every voxel in a chunk, one byte each: sky light in the high nibble, block light in the low one.
+    // Storage stays a single value until a voxel differs, so sealed rock (all dark) and open air above the
+    // terrain (all full sky) cost a few bytes instead of 32 KB. Indexed like Chunk::GetIndex.
+    class ENGINE_API LightStorage
+    {
+    public:
+        static constexpr uint32_t Volume = 32 * 32 * 32;
+        static constexpr uint8_t FullSky = MaxLightLevel << 4;
+
+        static uint8_t Pack(uint8_t sky, uint8_t block) { return static_cast<uint8_t>((sky << 4) | block); }
+
+        uint8_t Get(uint32_t index) const { return m_Values.empty() ? m_UniformValue : m_Values[index]; }
+        uint8_t GetSky(uint32_t index) const { return Get(index) >> 4; }
+        uint8_t GetBlock(uint32_t index) const { return Get(index) & 0x0F; }
+
+        void Set(uint32_t index, uint8_t packed)
+        {
+            if (m_Values.empty())
+            {
+                if (packed == m_UniformValue)
+                {
+                    return;
+                }
+                Expand();
+            }
+            m_Values[index] = packed;
+        }
+
+        void SetSky(uint32_t index, uint8_t level) { Set(index, static_cast<uint8_t>((Get(index) & 0x0F) | (level << 4))); }
+        void SetBlock(uint32_t index, uint8_t level) { Set(index, static_cast<uint8_t>((Get(index) & 0xF0) | level)); }
+
+        // Every voxel takes the same packed value and the dense array is released.
+        void Fill(uint8_t packed);
+
+        // Takes Volume packed values in Chunk::GetIndex order, collapsing to a single value when they all match.
+        void Assign(std::vector<uint8_t> values);
+
+        // Collapses back to a single value when every voxel matches.
+        void Compact();
+
+        bool IsUniform() const { return m_Values.empty(); }
+        size_t GetMemoryUsage() const { return sizeof(LightStorage) + m_Values.capacity(); }
+
+        // Set once the light engine has merged this chunk; unlit chunks neither receive nor pass on light.
+        bool IsLit() const { return m_IsLit; }
+        void SetLit(bool isLit) { m_IsLit = isLit; }
+
+        // True while no chunk above has been lit, so the top layer is treated as lying under open sky.
+        bool HasOpenSky() const { return m_HasOpenSky; }
+        void SetOpenSky(bool hasOpenSky) { m_HasOpenSky = hasOpenSky; }
+
+    private:
+        void Expand();
+
+    private:
+        std::vector<uint8_t> m_Values;
+        uint8_t m_UniformValue = 0;
+        bool m_IsLit = false;
+        bool m_HasOpenSky = false;
+    };
+}
@@ -0,0 +1,374 @@
+#include "Engine/World/PaletteStorage.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace Engine
+{
+    namespace
+    {
+        // Palettes up to this size are searched linearly; beyond it a hash table is built on demand.
+        constexpr size_t s_LinearLookupLimit = 16;
+        constexpr uint32_t s_EmptyLookupSlot = 0xFFFFFFFFu;
+        constexpr uint32_t s_MissingPaletteIndex = 0xFFFFFFFFu;
+
+        uint32_t HashBlockId(BlockId value)
+        {
+            return (static_cast<uint32_t>(value) * 0x9E3779B1u) >> 7;
+        }
+
+        uint32_t ReadPacked(const std::vector<uint64_t>& words, uint32_t bitsPerEntry, uint32_t index)
+        {
+            if (bitsPerEntry == 0)
+            {
+                return 0;
+            }
+
+            const uint64_t l_BitIndex = static_cast<uint64_t>(index) * bitsPerEntry;
+            const uint64_t l_WordIndex = l_BitIndex >> 6;
+            const uint32_t l_BitOffset = static_cast<uint32_t>(l_BitIndex & 63);
+            const uint64_t l_Mask = (uint64_t{ 1 } << bitsPerEntry) - 1;
+
+            uint64_t l_Value = words[l_WordIndex] >> l_BitOffset;
+            if (l_BitOffset + bitsPerEntry > 64)
+            {
+                l_Value |= words[l_WordIndex + 1] << (64 - l_BitOffset);
+            }
+
+            return static_cast<uint32_t>(l_Value & l_Mask);
+        }
+
+        void WritePacked(std::vector<uint64_t>& words, uint32_t bitsPerEntry, uint32_t index, uint32_t value)
+        {
+            const uint64_t l_BitIndex = static_cast<uint64_t>(index) * bitsPerEntry;
+            const uint64_t l_WordIndex = l_BitIndex >> 6;
+            const uint32_t l_BitOffset = static_cast<uint32_t>(l_BitIndex & 63);
+            const uint64_t l_Mask = (uint64_t{ 1 } << bitsPerEntry) - 1;
+
+            words[l_WordIndex] = (words[l_WordIndex] & ~(l_Mask << l_BitOffset)) | (static_cast<uint64_t>(value) << l_BitOffset);
+            if (l_BitOffset + bitsPerEntry > 64)
+            {
+                // The high bits of this entry spill into the next word.
+                const uint32_t l_SpilledBits = l_BitOffset + bitsPerEntry - 64;
+                const uint64_t l_SpillMask = (uint64_t{ 1 } << l_SpilledBits) - 1;
+                words[l_WordIndex + 1] = (words[l_WordIndex + 1] & ~l_SpillMask) | (static_cast<uint64_t>(value) >> (64 - l_BitOffset));
+            }
+        }
+    }
+
+    PaletteStorage::PaletteStorage(uint32_t entryCount, BlockId fillValue) : m_EntryCount(entryCount)
+    {
+        m_Palette.push_back(fillValue);
+    }
+
+    PaletteStorage::PaletteStorage(const PaletteStorage& other)
+        : m_EntryCount(other.m_EntryCount), m_BitsPerEntry(other.m_BitsPerEntry), m_Palette(other.m_Palette), m_Words(other.m_Words)
+    {
+        RebuildLookup();
+    }
+
+    PaletteStorage& PaletteStorage::operator=(const PaletteStorage& other)
+    {
+        if (this != &other)
+        {
+            m_EntryCount = other.m_EntryCount;
+            m_BitsPerEntry = other.m_BitsPerEntry;
+            m_Palette = other.m_Palette;
+            m_Words = other.m_Words;
+            RebuildLookup();
+        }
+
+        return *this;
+    }
+
+    BlockId PaletteStorage::Set(uint32_t index, BlockId value)
+    {
+        if (m_BitsPerEntry == 0 && m_Palette[0] == value)
+        {
+            return value;
+        }
+
+        const uint32_t l_PaletteIndex = FindOrAddPaletteIndex(value);
+        const uint32_t l_PreviousIndex = ReadIndex(index);
+        if (l_PreviousIndex != l_PaletteIndex)
+        {
+            WriteIndex(index, l_PaletteIndex);
+        }
+
+        return m_Palette[l_PreviousIndex];
+    }
+
+    void PaletteStorage::Fill(BlockId value)
+    {
+        m_Palette.assign(1, value);
+        m_Words.clear();
+        m_Words.shrink_to_fit();
+        m_BitsPerEntry = 0;
+        m_Lookup.clear();
+        m_Lookup.shrink_to_fit();
+    }
+
+    void PaletteStorage::Compact()
+    {
+        if (m_BitsPerEntry == 0)
+        {
+            return;
+        }
+
+        std::vector<uint32_t> l_UseCounts(m_Palette.size(), 0);
+        for (uint32_t i = 0; i < m_EntryCount; ++i)
+        {
+            ++l_UseCounts[ReadIndex(i)];
+        }
+
+        // Keep surviving entries in their original order so output stays deterministic.
+        std::vector<uint32_t> l_Remap(m_Palette.size(), 0);
+        std::vector<BlockId> l_Palette;
+        for (size_t i = 0; i < m_Palette.size(); ++i)
+        {
+            if (l_UseCounts[i] > 0)
+            {
+                l_Remap[i] = static_cast<uint32_t>(l_Palette.size());
+                l_Palette.push_back(m_Palette[i]);
+            }
+        }
+
+        if (l_Palette.size() == m_Palette.size())
+        {
+            return;
+        }
+
+        if (l_Palette.size() == 1)
+        {
+            Fill(l_Palette[0]);
+
+            return;
+        }
+
+        Repack(GetBitsForPaletteSize(l_Palette.size()), &l_Remap);
+        m_Palette = std::move(l_Palette);
+        RebuildLookup();
+    }
+
+    bool PaletteStorage::Assign(std::vector<BlockId> palette, std::vector<uint64_t> packedIndices)
+    {
+        if (palette.empty())
+        {
+            return false;
+        }
+
+        const uint32_t l_BitsPerEntry = GetBitsForPaletteSize(palette.size());
+        if (packedIndices.size() != GetWordCount(m_EntryCount, l_BitsPerEntry))
+        {
+            return false;
+        }
+
+        m_Palette = std::move(palette);
+        m_Words = std::move(packedIndices);
+        m_BitsPerEntry = l_BitsPerEntry;
+        RebuildLookup();
+
+        return true;
+    }
+
+    void PaletteStorage::AssignDense(const BlockId* values)
+    {
+        Fill(values[0]);
+
+        // Palette indices are resolved first and packed once at the final width, instead of repacking as the
+        // palette grows. Runs of equal ids are common (layers, air), so the last hit is cached.
+        std::vector<uint32_t> l_Indices(m_EntryCount, 0);
+        BlockId l_LastValue = values[0];
+        uint32_t l_LastIndex = 0;
+        for (uint32_t i = 1; i < m_EntryCount; ++i)
+        {
+            if (values[i] != l_LastValue)
+            {
+                l_LastValue = values[i];
+                l_LastIndex = FindPaletteIndex(l_LastValue);
+                if (l_LastIndex == s_MissingPaletteIndex)
+                {
+                    m_Palette.push_back(l_LastValue);
+                    l_LastIndex = static_cast<uint32_t>(m_Palette.size() - 1);
+                    UpdateLookupForNewEntry(l_LastValue, l_LastIndex);
+                }
+            }
+
+            l_Indices[i] = l_LastIndex;
+        }
+
+        m_BitsPerEntry = GetBitsForPaletteSize(m_Palette.size());
+        if (m_BitsPerEntry == 0)
+        {
+            return;
+        }
+
+        m_Words.assign(GetWordCount(m_EntryCount, m_BitsPerEntry), 0);
+        for (uint32_t i = 0; i < m_EntryCount; ++i)
+        {
+            if (l_Indices[i] != 0)
+            {
+                WritePacked(m_Words, m_BitsPerEntry, i, l_Indices[i]);
+            }
+        }
+    }
+
+    size_t PaletteStorage::GetMemoryUsage() const
+    {
+        size_t l_Bytes = sizeof(PaletteStorage);
+        l_Bytes += m_Palette.capacity() * sizeof(BlockId);
+        l_Bytes += m_Words.capacity() * sizeof(uint64_t);
+        l_Bytes += m_Lookup.capacity() * sizeof(uint32_t);
+
+        return l_Bytes;
+    }
+
+    uint32_t PaletteStorage::GetBitsForPaletteSize(size_t paletteSize)
+    {
+        if (paletteSize <= 1)
+        {
+            return 0;
+        }
+
+        return static_cast<uint32_t>(std::bit_width(paletteSize - 1));
+    }
+
+    size_t PaletteStorage::GetWordCount(uint32_t entryCount, uint32_t bitsPerEntry)
+    {
+        return (static_cast<size_t>(entryCount) * bitsPerEntry + 63) / 64;
+    }
+
+    void PaletteStorage::WriteIndex(uint32_t index, uint32_t paletteIndex)
+    {
+        WritePacked(m_Words, m_BitsPerEntry, index, paletteIndex);
+    }
+
+    uint32_t PaletteStorage::FindPaletteIndex(BlockId value) const
+    {
+        if (!m_Lookup.empty())
+        {
+            const uint32_t l_Mask = static_cast<uint32_t>(m_Lookup.size() - 1);
+            for (uint32_t l_Slot = HashBlockId(value) & l_Mask; m_Lookup[l_Slot] != s_EmptyLookupSlot; l_Slot = (l_Slot + 1) & l_Mask)
+            {
+                if ((m_Lookup[l_Slot] >> 16) == value)
+                {
+                    return m_Lookup[l_Slot] & 0xFFFFu;
+                }
+            }
+
+            return s_MissingPaletteIndex;
+        }
+
+        for (size_t i = 0; i < m_Palette.size(); ++i)
+        {
+            if (m_Palette[i] == value)
+            {
+                return static_cast<uint32_t>(i);
+            }
+        }
+
+        return s_MissingPaletteIndex;
+    }
+
+    uint32_t PaletteStorage::FindOrAddPaletteIndex(BlockId value)
+    {
+        const uint32_t l_ExistingIndex = FindPaletteIndex(value);
+        if (l_ExistingIndex != s_MissingPaletteIndex)
+        {
+            return l_ExistingIndex;
+        }
+
+        const uint32_t l_RequiredBits = GetBitsForPaletteSize(m_Palette.size() + 1);
+        if (l_RequiredBits > m_BitsPerEntry && m_BitsPerEntry > 0)
+        {
+            // Before widening every index, try reclaiming palette slots that edits have orphaned.
+            Compact();
+        }
+
+        m_Palette.push_back(value);
+        const uint32_t l_NewBits = GetBitsForPaletteSize(m_Palette.size());
+        if (l_NewBits > m_BitsPerEntry)
+        {
+            Repack(l_NewBits, nullptr);
+        }
+
+        const uint32_t l_PaletteIndex = static_cast<uint32_t>(m_Palette.size() - 1);
+        UpdateLookupForNewEntry(value, l_PaletteIndex);
+
+        return l_PaletteIndex;
+    }
+
+    void PaletteStorage::UpdateLookupForNewEntry(BlockId value, uint32_t paletteIndex)
+    {
+        if (m_Palette.size() <= s_LinearLookupLimit)
+        {
+            return;
+        }
+
+        // Keep the table at most half full so probe sequences stay short.
+        if (m_Lookup.size() < m_Palette.size() * 2)
+        {
+            RebuildLookup();
+        }
+        else
+        {
+            InsertLookup(value, paletteIndex);
+        }
+    }
+
+    void PaletteStorage::Repack(uint32_t newBitsPerEntry, const std::vector<uint32_t>* remap)
+    {
+        std::vector<uint64_t> l_Words(GetWordCount(m_EntryCount, newBitsPerEntry), 0);
+        for (uint32_t i = 0; i < m_EntryCount; ++i)
+        {
+            uint32_t l_Index = ReadPacked(m_Words, m_BitsPerEntry, i);
+            if (remap != nullptr)
+            {
+                l_Index = (*remap)[l_Index];
+            }
+
+            if (l_Index != 0)
+            {
+                WritePacked(l_Words, newBitsPerEntry, i, l_Index);
+            }
+        }
+
+        m_Words = std::move(l_Words);
+        m_BitsPerEntry = newBitsPerEntry;
+    }
+
+    void PaletteStorage::InsertLookup(BlockId value, uint32_t paletteIndex)
+    {
+        const uint32_t l_Mask = static_cast<uint32_t>(m_Lookup.size() - 1);
+        uint32_t l_Slot = HashBlockId(value) & l_Mask;
+        while (m_Lookup[l_Slot] != s_EmptyLookupSlot)
+        {
+            l_Slot = (l_Slot + 1) & l_Mask;
+        }
+
+        m_Lookup[l_Slot] = (static_cast<uint32_t>(value) << 16) | paletteIndex;
+    }
+
+    void PaletteStorage::RebuildLookup()
+    {
+        m_Lookup.clear();
+        if (m_Palette.size() <= s_LinearLookupLimit)
+        {
+            m_Lookup.shrink_to_fit();
+
+            return;
+        }
+
+        size_t l_Capacity = 64;
+        while (l_Capacity < m_Palette.size() * 4)
+        {
+            l_Capacity <<= 1;
+        }
+
+        m_Lookup.assign(l_Capacity, s_EmptyLookupSlot);
+        for (size_t i = 0; i < m_Palette.size(); ++i)
+        {
+            InsertLookup(m_Palette[i], static_cast<uint32_t>(i));
+        }
+    }
+}
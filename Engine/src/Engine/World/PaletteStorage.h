@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Engine
+{
+    using BlockId = uint16_t;
+
+    // Block id zero is always air so freshly created storage is empty space.
+    constexpr BlockId AirBlockId = 0;
+
+    // Fixed-length array of block ids compressed through a palette. Each entry stores a palette index
+    // packed at the minimum bit width for the current palette size; a palette of one entry uses no
+    // index storage at all, which keeps uniform (all-air, all-stone) sections down to a few bytes.
+    class ENGINE_API PaletteStorage
+    {
+    public:
+        explicit PaletteStorage(uint32_t entryCount, BlockId fillValue = AirBlockId);
+
+        PaletteStorage(const PaletteStorage& other);
+        PaletteStorage& operator=(const PaletteStorage& other);
+        PaletteStorage(PaletteStorage&&) noexcept = default;
+        PaletteStorage& operator=(PaletteStorage&&) noexcept = default;
+
+        BlockId Get(uint32_t index) const
+        {
+            if (m_BitsPerEntry == 0)
+            {
+                return m_Palette[0];
+            }
+
+            return m_Palette[ReadIndex(index)];
+        }
+
+        // Returns the previous value. Grows the palette (and the index width) when needed.
+        BlockId Set(uint32_t index, BlockId value);
+
+        // Replace every entry with a single value, collapsing to the single-value representation.
+        void Fill(BlockId value);
+
+        // Drop palette entries that are no longer referenced and repack at the narrowest width.
+        void Compact();
+
+        bool IsUniform() const { return m_BitsPerEntry == 0; }
+        uint32_t GetEntryCount() const { return m_EntryCount; }
+        uint32_t GetBitsPerEntry() const { return m_BitsPerEntry; }
+        const std::vector<BlockId>& GetPalette() const { return m_Palette; }
+        const std::vector<uint64_t>& GetPackedIndices() const { return m_Words; }
+
+        // Replace every entry from a dense array of GetEntryCount() ids, e.g. a freshly generated volume.
+        void AssignDense(const BlockId* values);
+
+        // Rebuild from serialized parts; returns false when the packed words do not match the palette width.
+        bool Assign(std::vector<BlockId> palette, std::vector<uint64_t> packedIndices);
+
+        // Heap plus inline bytes held by this storage.
+        size_t GetMemoryUsage() const;
+
+        static uint32_t GetBitsForPaletteSize(size_t paletteSize);
+        static size_t GetWordCount(uint32_t entryCount, uint32_t bitsPerEntry);
+
+    private:
+        uint32_t ReadIndex(uint32_t index) const
+        {
+            // Entries may straddle two words, which keeps the width minimal (e.g. 3 or 5 bits).
+            const uint64_t l_BitIndex = static_cast<uint64_t>(index) * m_BitsPerEntry;
+            const uint64_t l_WordIndex = l_BitIndex >> 6;
+            const uint32_t l_BitOffset = static_cast<uint32_t>(l_BitIndex & 63);
+            const uint64_t l_Mask = (uint64_t{ 1 } << m_BitsPerEntry) - 1;
+
+            uint64_t l_Value = m_Words[l_WordIndex] >> l_BitOffset;
+            if (l_BitOffset + m_BitsPerEntry > 64)
+            {
+                l_Value |= m_Words[l_WordIndex + 1] << (64 - l_BitOffset);
+            }
+
+            return static_cast<uint32_t>(l_Value & l_Mask);
+        }
+
+        void WriteIndex(uint32_t index, uint32_t paletteIndex);
+        uint32_t FindPaletteIndex(BlockId value) const;
+        uint32_t FindOrAddPaletteIndex(BlockId value);
+        void UpdateLookupForNewEntry(BlockId value, uint32_t paletteIndex);
+        void InsertLookup(BlockId value, uint32_t paletteIndex);
+        void Repack(uint32_t newBitsPerEntry, const std::vector<uint32_t>* remap);
+        void RebuildLookup();
+
+    private:
+        uint32_t m_EntryCount = 0;
+        uint32_t m_BitsPerEntry = 0;
+        std::vector<BlockId> m_Palette;
+        std::vector<uint64_t> m_Words;
+
+        // Open-addressed reverse lookup for large palettes, packed as (block id << 16) | palette index.
+        // Small palettes leave it empty and are scanned linearly because that is faster.
+        std::vector<uint32_t> m_Lookup;
+    };
+}
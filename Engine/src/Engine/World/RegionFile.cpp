@@ -0,0 +1,463 @@
+#include "Engine/World/RegionFile.h"
+
+#include "Engine/Core/Log.h"
+#include "Engine/IO/Compression.h"
+
+#include <cstring>
+#include <system_error>
+
+namespace Engine
+{
+    namespace
+    {
+        constexpr uint32_t s_FileMagic = 0x4752434Du;  // "MCRG"
+        constexpr uint32_t s_TableMagic = 0x5452434Du; // "MCRT"
+        constexpr uint16_t s_FormatVersion = 1;
+
+        struct FileHeader
+        {
+            uint32_t Magic = 0;
+            uint16_t Version = 0;
+            uint16_t SectorSize = 0;
+            uint32_t EntryCount = 0;
+            int32_t RegionX = 0;
+            int32_t RegionY = 0;
+            int32_t RegionZ = 0;
+        };
+
+        // The CRC covers the generation and every entry, so a torn table write is always detected.
+        struct TableHeader
+        {
+            uint32_t Magic = 0;
+            uint32_t Crc = 0;
+            uint64_t Generation = 0;
+        };
+
+        static_assert(sizeof(FileHeader) == 24 && sizeof(TableHeader) == 16, "Region headers must have no padding");
+
+        constexpr uint64_t AlignToSector(uint64_t value)
+        {
+            return (value + RegionFile::SectorSize - 1) / RegionFile::SectorSize * RegionFile::SectorSize;
+        }
+
+        constexpr uint64_t s_EntryBytes = uint64_t{ RegionFile::EntryCount } * 2 * sizeof(uint32_t);
+        constexpr uint64_t s_TableBytes = AlignToSector(sizeof(TableHeader) + s_EntryBytes);
+        constexpr uint64_t s_TableOffsets[2] = { RegionFile::SectorSize, RegionFile::SectorSize + s_TableBytes };
+        constexpr uint64_t s_DataOffset = RegionFile::SectorSize + 2 * s_TableBytes;
+        constexpr size_t s_RecordHeaderSize = sizeof(uint32_t);
+
+        // Compaction streams records through a buffer of this size instead of staging the whole file.
+        constexpr size_t s_CopyBufferSize = 1 << 20;
+
+        uint64_t GetRecordBytes(uint32_t length)
+        {
+            return AlignToSector(s_RecordHeaderSize + uint64_t{ length });
+        }
+
+        uint32_t ComputeTableCrc(uint64_t generation, const void* entries)
+        {
+            const uint32_t l_Crc = Compression::ComputeCrc32(&generation, sizeof(generation));
+
+            return Compression::ComputeCrc32(entries, s_EntryBytes, l_Crc);
+        }
+
+        std::vector<uint8_t> BuildTable(uint64_t generation, const void* entries)
+        {
+            std::vector<uint8_t> l_Table(s_TableBytes, 0);
+
+            TableHeader l_Header;
+            l_Header.Magic = s_TableMagic;
+            l_Header.Crc = ComputeTableCrc(generation, entries);
+            l_Header.Generation = generation;
+            std::memcpy(l_Table.data(), &l_Header, sizeof(l_Header));
+            std::memcpy(l_Table.data() + sizeof(l_Header), entries, s_EntryBytes);
+
+            return l_Table;
+        }
+    }
+
+    bool RegionFile::Open(const std::filesystem::path& path, const ChunkCoord& regionCoord, bool createIfMissing)
+    {
+        Close();
+
+        m_Path = path;
+        m_RegionCoord = regionCoord;
+        m_Entries.assign(EntryCount, Entry{});
+
+        std::error_code l_Error;
+        if (!std::filesystem::exists(path, l_Error))
+        {
+            if (!createIfMissing)
+            {
+                return false;
+            }
+
+            // New files are assembled under a temporary name, so a crash never leaves a half-written header behind.
+            std::filesystem::path l_StagingPath = path;
+            l_StagingPath += ".tmp";
+            if (!WriteFreshFile(l_StagingPath, m_Entries, 1))
+            {
+                return false;
+            }
+
+            std::filesystem::rename(l_StagingPath, path, l_Error);
+            if (l_Error)
+            {
+                ENGINE_CHANNEL_ERROR(World, "Failed to create region file {} ({})", path.string(), l_Error.message());
+                std::filesystem::remove(l_StagingPath, l_Error);
+
+                return false;
+            }
+        }
+
+        if (!m_File.Open(path, false) || !m_Mapping.Open(path) || !LoadTables())
+        {
+            Close();
+
+            return false;
+        }
+
+        return true;
+    }
+
+    void RegionFile::Close()
+    {
+        m_Mapping.Close();
+        m_File.Close();
+        m_Entries.clear();
+        m_Generation = 0;
+        m_ActiveSlot = 0;
+        m_FileSize = 0;
+        m_LiveBytes = 0;
+        m_ChunkCount = 0;
+    }
+
+    bool RegionFile::LoadTables()
+    {
+        const uint8_t* l_Data = m_Mapping.GetData();
+        m_FileSize = m_Mapping.GetSize();
+        if (m_FileSize < s_DataOffset)
+        {
+            ENGINE_CHANNEL_ERROR(World, "Region file {} is truncated", m_Path.string());
+
+            return false;
+        }
+
+        FileHeader l_Header;
+        std::memcpy(&l_Header, l_Data, sizeof(l_Header));
+        if (l_Header.Magic != s_FileMagic || l_Header.Version != s_FormatVersion || l_Header.SectorSize != SectorSize || l_Header.EntryCount != EntryCount)
+        {
+            ENGINE_CHANNEL_ERROR(World, "Region file {} has an unsupported header", m_Path.string());
+
+            return false;
+        }
+
+        if (l_Header.RegionX != m_RegionCoord.X || l_Header.RegionY != m_RegionCoord.Y || l_Header.RegionZ != m_RegionCoord.Z)
+        {
+            ENGINE_CHANNEL_ERROR(World, "Region file {} belongs to region ({}, {}, {})", m_Path.string(), l_Header.RegionX, l_Header.RegionY, l_Header.RegionZ);
+
+            return false;
+        }
+
+        // Pick the newest table copy that survived intact.
+        bool l_HasTable = false;
+        for (uint32_t it_Slot = 0; it_Slot < 2; ++it_Slot)
+        {
+            TableHeader l_Table;
+            const uint8_t* l_TableData = l_Data + s_TableOffsets[it_Slot];
+            std::memcpy(&l_Table, l_TableData, sizeof(l_Table));
+            if (l_Table.Magic != s_TableMagic || l_Table.Crc != ComputeTableCrc(l_Table.Generation, l_TableData + sizeof(l_Table)))
+            {
+                continue;
+            }
+
+            if (!l_HasTable || l_Table.Generation > m_Generation)
+            {
+                std::memcpy(m_Entries.data(), l_TableData + sizeof(l_Table), s_EntryBytes);
+                m_Generation = l_Table.Generation;
+                m_ActiveSlot = it_Slot;
+                l_HasTable = true;
+            }
+        }
+
+        if (!l_HasTable)
+        {
+            ENGINE_CHANNEL_ERROR(World, "Region file {} has no valid allocation table", m_Path.string());
+
+            return false;
+        }
+
+        // A table can only reference synced data, so out-of-range entries mean the file was truncated externally.
+        uint32_t l_DroppedCount = 0;
+        for (Entry& it_Entry : m_Entries)
+        {
+            const uint64_t l_Offset = uint64_t{ it_Entry.Sector } * SectorSize;
+            if (it_Entry.Length != 0 && (l_Offset < s_DataOffset || l_Offset + s_RecordHeaderSize + it_Entry.Length > m_FileSize))
+            {
+                it_Entry = Entry{};
+                ++l_DroppedCount;
+            }
+        }
+
+        if (l_DroppedCount > 0)
+        {
+            ENGINE_CHANNEL_WARN(World, "Region file {}: dropped {} entries pointing past the end of the file", m_Path.string(), l_DroppedCount);
+        }
+
+        UpdateUsage();
+
+        return true;
+    }
+
+    bool RegionFile::Read(uint32_t entryIndex, const uint8_t*& data, size_t& size) const
+    {
+        const Entry& l_Entry = m_Entries[entryIndex];
+        if (l_Entry.Length == 0)
+        {
+            return false;
+        }
+
+        const uint8_t* l_Record = m_Mapping.GetData() + uint64_t{ l_Entry.Sector } * SectorSize;
+        uint32_t l_Crc = 0;
+        std::memcpy(&l_Crc, l_Record, sizeof(l_Crc));
+        if (l_Crc != Compression::ComputeCrc32(l_Record + s_RecordHeaderSize, l_Entry.Length))
+        {
+            ENGINE_CHANNEL_WARN(World, "Region file {}: entry {} failed its checksum", m_Path.string(), entryIndex);
+
+            return false;
+        }
+
+        data = l_Record + s_RecordHeaderSize;
+        size = l_Entry.Length;
+
+        return true;
+    }
+
+    bool RegionFile::Write(const std::vector<RegionBlob>& blobs)
+    {
+        if (!IsOpen())
+        {
+            return false;
+        }
+
+        if (blobs.empty())
+        {
+            return true;
+        }
+
+        // Records go after everything the file holds, including any torn tail left by an earlier crash.
+        const uint64_t l_AppendOffset = AlignToSector(m_FileSize);
+
+        uint64_t l_AppendBytes = 0;
+        for (const RegionBlob& it_Blob : blobs)
+        {
+            l_AppendBytes += GetRecordBytes(static_cast<uint32_t>(it_Blob.Size));
+        }
+
+        if ((l_AppendOffset + l_AppendBytes) / SectorSize > UINT32_MAX)
+        {
+            ENGINE_CHANNEL_ERROR(World, "Region file {} exceeds the addressable size; compact it first", m_Path.string());
+
+            return false;
+        }
+
+        std::vector<uint8_t> l_Buffer(l_AppendBytes, 0);
+        std::vector<Entry> l_Entries = m_Entries;
+        uint64_t l_Cursor = 0;
+        for (const RegionBlob& it_Blob : blobs)
+        {
+            const uint32_t l_Length = static_cast<uint32_t>(it_Blob.Size);
+            const uint32_t l_Crc = Compression::ComputeCrc32(it_Blob.Data, it_Blob.Size);
+            std::memcpy(l_Buffer.data() + l_Cursor, &l_Crc, sizeof(l_Crc));
+            std::memcpy(l_Buffer.data() + l_Cursor + s_RecordHeaderSize, it_Blob.Data, it_Blob.Size);
+
+            l_Entries[it_Blob.EntryIndex] = { static_cast<uint32_t>((l_AppendOffset + l_Cursor) / SectorSize), l_Length };
+            l_Cursor += GetRecordBytes(l_Length);
+        }
+
+        // The data must be durable before any table points at it.
+        if (!m_File.WriteAt(l_AppendOffset, l_Buffer.data(), l_Buffer.size()) || !m_File.Sync())
+        {
+            ENGINE_CHANNEL_ERROR(World, "Region file {}: failed to append {} records", m_Path.string(), blobs.size());
+
+            return false;
+        }
+
+        const uint32_t l_Slot = m_ActiveSlot ^ 1u;
+        if (!WriteTable(l_Slot, m_Generation + 1, l_Entries))
+        {
+            ENGINE_CHANNEL_ERROR(World, "Region file {}: failed to publish the allocation table", m_Path.string());
+
+            return false;
+        }
+
+        m_Entries = std::move(l_Entries);
+        m_Generation += 1;
+        m_ActiveSlot = l_Slot;
+        m_FileSize = l_AppendOffset + l_AppendBytes;
+        UpdateUsage();
+
+        // Remap so readers see the new records; views handed out before this call are invalidated.
+        if (!m_Mapping.Open(m_Path))
+        {
+            ENGINE_CHANNEL_ERROR(World, "Region file {}: failed to remap after writing", m_Path.string());
+            Close();
+
+            return false;
+        }
+
+        return true;
+    }
+
+    bool RegionFile::WriteTable(uint32_t slot, uint64_t generation, const std::vector<Entry>& entries)
+    {
+        const std::vector<uint8_t> l_Table = BuildTable(generation, entries.data());
+
+        return m_File.WriteAt(s_TableOffsets[slot], l_Table.data(), l_Table.size()) && m_File.Sync();
+    }
+
+    bool RegionFile::Compact()
+    {
+        if (!IsOpen())
+        {
+            return false;
+        }
+
+        // Lay the live records out back to back in entry order, then build the file beside the original.
+        std::vector<Entry> l_Entries(EntryCount);
+        uint64_t l_Offset = s_DataOffset;
+        for (uint32_t i = 0; i < EntryCount; ++i)
+        {
+            if (m_Entries[i].Length == 0)
+            {
+                continue;
+            }
+
+            l_Entries[i] = { static_cast<uint32_t>(l_Offset / SectorSize), m_Entries[i].Length };
+            l_Offset += GetRecordBytes(m_Entries[i].Length);
+        }
+
+        std::filesystem::path l_TemporaryPath = m_Path;
+        l_TemporaryPath += ".compact";
+        if (!WriteFreshFile(l_TemporaryPath, l_Entries, m_Generation + 1))
+        {
+            return false;
+        }
+
+        WritableFile l_Temporary;
+        bool l_Succeeded = l_Temporary.Open(l_TemporaryPath, false);
+        std::vector<uint8_t> l_Buffer;
+        l_Buffer.reserve(s_CopyBufferSize);
+        uint64_t l_BufferOffset = s_DataOffset;
+        for (uint32_t i = 0; i < EntryCount && l_Succeeded; ++i)
+        {
+            if (m_Entries[i].Length == 0)
+            {
+                continue;
+            }
+
+            // Records are copied whole, CRC included; they are byte-identical apart from their position.
+            const uint64_t l_RecordBytes = GetRecordBytes(m_Entries[i].Length);
+            if (l_Buffer.size() + l_RecordBytes > s_CopyBufferSize && !l_Buffer.empty())
+            {
+                l_Succeeded = l_Temporary.WriteAt(l_BufferOffset, l_Buffer.data(), l_Buffer.size());
+                l_BufferOffset += l_Buffer.size();
+                l_Buffer.clear();
+            }
+
+            const uint8_t* l_Record = m_Mapping.GetData() + uint64_t{ m_Entries[i].Sector } * SectorSize;
+            const size_t l_Start = l_Buffer.size();
+            l_Buffer.resize(l_Start + l_RecordBytes, 0);
+            std::memcpy(l_Buffer.data() + l_Start, l_Record, s_RecordHeaderSize + m_Entries[i].Length);
+        }
+
+        if (l_Succeeded && !l_Buffer.empty())
+        {
+            l_Succeeded = l_Temporary.WriteAt(l_BufferOffset, l_Buffer.data(), l_Buffer.size());
+        }
+
+        l_Succeeded = l_Succeeded && l_Temporary.Sync();
+        l_Temporary.Close();
+
+        std::error_code l_Error;
+        if (!l_Succeeded)
+        {
+            std::filesystem::remove(l_TemporaryPath, l_Error);
+            ENGINE_CHANNEL_ERROR(World, "Region file {}: compaction failed while writing", m_Path.string());
+
+            return false;
+        }
+
+        // Handles must be released before the rename on Windows. The rename is atomic, so a crash leaves
+        // either the old or the compacted file in place, and both are complete.
+        const std::filesystem::path l_Path = m_Path;
+        const ChunkCoord l_RegionCoord = m_RegionCoord;
+        Close();
+
+        std::filesystem::rename(l_TemporaryPath, l_Path, l_Error);
+        if (l_Error)
+        {
+            ENGINE_CHANNEL_ERROR(World, "Region file {}: failed to replace with compacted copy ({})", l_Path.string(), l_Error.message());
+            std::filesystem::remove(l_TemporaryPath, l_Error);
+            Open(l_Path, l_RegionCoord, false);
+
+            return false;
+        }
+
+        return Open(l_Path, l_RegionCoord, false);
+    }
+
+    bool RegionFile::WriteFreshFile(const std::filesystem::path& path, const std::vector<Entry>& entries, uint64_t generation) const
+    {
+        std::error_code l_Error;
+        std::filesystem::remove(path, l_Error);
+
+        std::vector<uint8_t> l_Prefix(s_DataOffset, 0);
+        FileHeader l_Header;
+        l_Header.Magic = s_FileMagic;
+        l_Header.Version = s_FormatVersion;
+        l_Header.SectorSize = SectorSize;
+        l_Header.EntryCount = EntryCount;
+        l_Header.RegionX = m_RegionCoord.X;
+        l_Header.RegionY = m_RegionCoord.Y;
+        l_Header.RegionZ = m_RegionCoord.Z;
+        std::memcpy(l_Prefix.data(), &l_Header, sizeof(l_Header));
+
+        // Only table A is valid in a fresh file; table B stays zeroed until the first write targets it.
+        const std::vector<uint8_t> l_Table = BuildTable(generation, entries.data());
+        std::memcpy(l_Prefix.data() + s_TableOffsets[0], l_Table.data(), l_Table.size());
+
+        WritableFile l_File;
+        const bool l_Succeeded = l_File.Open(path, true) && l_File.WriteAt(0, l_Prefix.data(), l_Prefix.size()) && l_File.Sync();
+        l_File.Close();
+
+        if (!l_Succeeded)
+        {
+            std::filesystem::remove(path, l_Error);
+            ENGINE_CHANNEL_ERROR(World, "Failed to write region file {}", path.string());
+        }
+
+        return l_Succeeded;
+    }
+
+    void RegionFile::UpdateUsage()
+    {
+        m_LiveBytes = 0;
+        m_ChunkCount = 0;
+        for (const Entry& it_Entry : m_Entries)
+        {
+            if (it_Entry.Length != 0)
+            {
+                m_LiveBytes += GetRecordBytes(it_Entry.Length);
+                ++m_ChunkCount;
+            }
+        }
+    }
+
+    uint64_t RegionFile::GetDeadBytes() const
+    {
+        const uint64_t l_DataBytes = m_FileSize > s_DataOffset ? AlignToSector(m_FileSize) - s_DataOffset : 0;
+
+        return l_DataBytes > m_LiveBytes ? l_DataBytes - m_LiveBytes : 0;
+    }
+}
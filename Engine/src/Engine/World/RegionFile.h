@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/IO/MappedFile.h"
+#include "Engine/IO/WritableFile.h"
+#include "Engine/World/Chunk.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace Engine
+{
+    // A chunk blob queued for a region write; Data must stay valid until RegionFile::Write returns.
+    struct RegionBlob
+    {
+        uint32_t EntryIndex = 0;
+        const uint8_t* Data = nullptr;
+        size_t Size = 0;
+    };
+
+    // One file holding a 32x8x32 block of chunks. Layout, in 256-byte sectors:
+    //   sector 0        file header
+    //   sectors 1..514  two copies of the allocation table (A and B), each stamped with a generation and CRC
+    //   sectors 515..   chunk records, [u32 CRC][blob] padded to whole sectors
+    // Writes only ever append records, then publish them by rewriting the older table copy with a newer
+    // generation. A crash at any point leaves the previous table intact, so the file always opens to the
+    // last completed write. Superseded records become dead space that Compact reclaims.
+    // Not thread-safe; RegionStore serializes access per file.
+    class ENGINE_API RegionFile
+    {
+    public:
+        static constexpr int32_t SizeShiftX = 5;
+        static constexpr int32_t SizeShiftY = 3;
+        static constexpr int32_t SizeShiftZ = 5;
+        static constexpr uint32_t EntryCount = 1u << (SizeShiftX + SizeShiftY + SizeShiftZ);
+        static constexpr uint32_t SectorSize = 256;
+
+        RegionFile() = default;
+        RegionFile(const RegionFile&) = delete;
+        RegionFile& operator=(const RegionFile&) = delete;
+
+        static ChunkCoord GetRegionCoord(const ChunkCoord& chunkCoord)
+        {
+            return { chunkCoord.X >> SizeShiftX, chunkCoord.Y >> SizeShiftY, chunkCoord.Z >> SizeShiftZ };
+        }
+
+        static uint32_t GetEntryIndex(const ChunkCoord& chunkCoord)
+        {
+            const uint32_t l_X = static_cast<uint32_t>(chunkCoord.X) & ((1u << SizeShiftX) - 1);
+            const uint32_t l_Y = static_cast<uint32_t>(chunkCoord.Y) & ((1u << SizeShiftY) - 1);
+            const uint32_t l_Z = static_cast<uint32_t>(chunkCoord.Z) & ((1u << SizeShiftZ) - 1);
+
+            return (((l_Y << SizeShiftZ) | l_Z) << SizeShiftX) | l_X;
+        }
+
+        // Opens the region stored at path, or creates an empty one. Fails on a file for another region or format.
+        bool Open(const std::filesystem::path& path, const ChunkCoord& regionCoord, bool createIfMissing);
+        void Close();
+
+        bool IsOpen() const { return m_File.IsOpen(); }
+        bool Contains(uint32_t entryIndex) const { return m_Entries[entryIndex].Length != 0; }
+
+        // Zero-copy view of a stored blob. The pointer aims into the mapping and stays valid until the next
+        // Write, Compact or Close. Returns false when the entry is empty or its record fails the CRC check.
+        bool Read(uint32_t entryIndex, const uint8_t*& data, size_t& size) const;
+
+        // Appends the blobs and atomically publishes them; later blobs win when an entry repeats.
+        bool Write(const std::vector<RegionBlob>& blobs);
+
+        // Rewrites the file with only live records and swaps it in place of the original.
+        bool Compact();
+
+        const ChunkCoord& GetRegionCoord() const { return m_RegionCoord; }
+        uint32_t GetChunkCount() const { return m_ChunkCount; }
+        uint64_t GetFileSize() const { return m_FileSize; }
+        uint64_t GetLiveBytes() const { return m_LiveBytes; }
+        uint64_t GetDeadBytes() const;
+
+    private:
+        struct Entry
+        {
+            uint32_t Sector = 0;
+            uint32_t Length = 0;
+        };
+
+        bool LoadTables();
+        bool WriteTable(uint32_t slot, uint64_t generation, const std::vector<Entry>& entries);
+        // Writes header and table A for the given entries to path, replacing any existing file.
+        bool WriteFreshFile(const std::filesystem::path& path, const std::vector<Entry>& entries, uint64_t generation) const;
+        void UpdateUsage();
+
+    private:
+        std::filesystem::path m_Path;
+        ChunkCoord m_RegionCoord;
+
+        WritableFile m_File;
+        MappedFile m_Mapping;
+
+        std::vector<Entry> m_Entries;
+        uint64_t m_Generation = 0;
+        uint32_t m_ActiveSlot = 0;
+
+        uint64_t m_FileSize = 0;
+        uint64_t m_LiveBytes = 0;
+        uint32_t m_ChunkCount = 0;
+    };
+}
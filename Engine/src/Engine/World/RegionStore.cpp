@@ -0,0 +1,246 @@
+#include "Engine/World/RegionStore.h"
+
+#include "Engine/Core/Log.h"
+#include "Engine/World/ChunkSerializer.h"
+
+#include <string>
+#include <system_error>
+
+namespace Engine
+{
+    namespace
+    {
+        // Chunks per encode or load job; large enough to amortize scheduling, small enough to spread across workers.
+        constexpr uint32_t s_ChunksPerJob = 16;
+    }
+
+    RegionStore::RegionStore(std::filesystem::path directory) : m_Directory(std::move(directory))
+    {
+        std::error_code l_Error;
+        std::filesystem::create_directories(m_Directory, l_Error);
+        if (l_Error)
+        {
+            ENGINE_CHANNEL_ERROR(World, "Failed to create save directory {} ({})", m_Directory.string(), l_Error.message());
+        }
+    }
+
+    std::filesystem::path RegionStore::GetRegionPath(const ChunkCoord& regionCoord) const
+    {
+        return m_Directory / ("r." + std::to_string(regionCoord.X) + "." + std::to_string(regionCoord.Y) + "." + std::to_string(regionCoord.Z) + ".mcr");
+    }
+
+    RegionStore::Region& RegionStore::AcquireRegion(const ChunkCoord& regionCoord)
+    {
+        std::lock_guard<std::mutex> l_Lock(m_RegionMapMutex);
+
+        std::unique_ptr<Region>& l_Region = m_Regions[regionCoord];
+        if (l_Region == nullptr)
+        {
+            // Existing files are opened once here; missing ones are only created by the first write.
+            l_Region = std::make_unique<Region>();
+            const std::filesystem::path l_Path = GetRegionPath(regionCoord);
+            std::error_code l_Error;
+            if (std::filesystem::exists(l_Path, l_Error))
+            {
+                l_Region->File.Open(l_Path, regionCoord, false);
+            }
+        }
+
+        return *l_Region;
+    }
+
+    bool RegionStore::HasChunk(const ChunkCoord& coord)
+    {
+        Region& l_Region = AcquireRegion(RegionFile::GetRegionCoord(coord));
+        std::shared_lock<std::shared_mutex> l_Lock(l_Region.Mutex);
+
+        return l_Region.File.IsOpen() && l_Region.File.Contains(RegionFile::GetEntryIndex(coord));
+    }
+
+    std::unique_ptr<Chunk> RegionStore::LoadChunk(const ChunkCoord& coord)
+    {
+        Region& l_Region = AcquireRegion(RegionFile::GetRegionCoord(coord));
+        std::shared_lock<std::shared_mutex> l_Lock(l_Region.Mutex);
+        if (!l_Region.File.IsOpen())
+        {
+            return nullptr;
+        }
+
+        // Decoding reads straight out of the mapping; the shared lock keeps writers from remapping underneath.
+        const uint8_t* l_Data = nullptr;
+        size_t l_Size = 0;
+        if (!l_Region.File.Read(RegionFile::GetEntryIndex(coord), l_Data, l_Size))
+        {
+            return nullptr;
+        }
+
+        std::unique_ptr<Chunk> l_Chunk = std::make_unique<Chunk>(coord);
+        if (!ChunkSerializer::Decode(l_Data, l_Size, *l_Chunk))
+        {
+            ENGINE_CHANNEL_WARN(World, "Chunk ({}, {}, {}) has an unreadable record", coord.X, coord.Y, coord.Z);
+
+            return nullptr;
+        }
+
+        return l_Chunk;
+    }
+
+    bool RegionStore::WriteRegion(const ChunkCoord& regionCoord, const std::vector<RegionBlob>& blobs)
+    {
+        Region& l_Region = AcquireRegion(regionCoord);
+        std::unique_lock<std::shared_mutex> l_Lock(l_Region.Mutex);
+        if (!l_Region.File.IsOpen() && !l_Region.File.Open(GetRegionPath(regionCoord), regionCoord, true))
+        {
+            return false;
+        }
+
+        return l_Region.File.Write(blobs);
+    }
+
+    bool RegionStore::SaveChunks(const std::vector<const Chunk*>& chunks)
+    {
+        std::unordered_map<ChunkCoord, std::vector<uint32_t>, ChunkCoordHash> l_Groups;
+        for (uint32_t i = 0; i < chunks.size(); ++i)
+        {
+            l_Groups[RegionFile::GetRegionCoord(chunks[i]->GetCoord())].push_back(i);
+        }
+
+        bool l_Succeeded = true;
+        std::vector<std::vector<uint8_t>> l_Blobs(chunks.size());
+        for (const auto& [it_RegionCoord, it_Indices] : l_Groups)
+        {
+            std::vector<RegionBlob> l_RegionBlobs;
+            l_RegionBlobs.reserve(it_Indices.size());
+            for (const uint32_t it_Index : it_Indices)
+            {
+                ChunkSerializer::Encode(*chunks[it_Index], l_Blobs[it_Index]);
+                l_RegionBlobs.push_back({ RegionFile::GetEntryIndex(chunks[it_Index]->GetCoord()), l_Blobs[it_Index].data(), l_Blobs[it_Index].size() });
+            }
+
+            l_Succeeded = WriteRegion(it_RegionCoord, l_RegionBlobs) && l_Succeeded;
+        }
+
+        return l_Succeeded;
+    }
+
+    std::shared_ptr<RegionSaveBatch> RegionStore::SaveAsync(JobSystem& jobSystem, const std::vector<const Chunk*>& chunks)
+    {
+        std::shared_ptr<RegionSaveBatch> l_Batch = std::make_shared<RegionSaveBatch>();
+        l_Batch->m_Snapshots.reserve(chunks.size());
+        l_Batch->m_Blobs.resize(chunks.size());
+
+        std::unordered_map<ChunkCoord, uint32_t, ChunkCoordHash> l_GroupLookup;
+        for (const Chunk* it_Chunk : chunks)
+        {
+            const ChunkCoord l_RegionCoord = RegionFile::GetRegionCoord(it_Chunk->GetCoord());
+            const auto [it_Group, l_Inserted] = l_GroupLookup.try_emplace(l_RegionCoord, static_cast<uint32_t>(l_Batch->m_Regions.size()));
+            if (l_Inserted)
+            {
+                l_Batch->m_Regions.push_back({ l_RegionCoord, {} });
+            }
+
+            l_Batch->m_Regions[it_Group->second].SnapshotIndices.push_back(static_cast<uint32_t>(l_Batch->m_Snapshots.size()));
+            l_Batch->m_Snapshots.push_back(*it_Chunk);
+        }
+
+        RegionSaveBatch* l_BatchPointer = l_Batch.get();
+        jobSystem.ParallelFor(static_cast<uint32_t>(chunks.size()), s_ChunksPerJob, [l_Batch](uint32_t begin, uint32_t end)
+            {
+                for (uint32_t i = begin; i < end; ++i)
+                {
+                    // Snapshots are private to the batch, so dropping orphaned palette entries here is free of races.
+                    Chunk& l_Snapshot = l_Batch->m_Snapshots[i];
+                    l_Snapshot.Compact();
+                    ChunkSerializer::Encode(l_Snapshot, l_Batch->m_Blobs[i]);
+                    l_Batch->m_EncodedBytes.fetch_add(l_Batch->m_Blobs[i].size(), std::memory_order_relaxed);
+                }
+            }, &l_BatchPointer->m_EncodeCounter);
+
+        // Eviction and autosave both save asynchronously; chaining on the region's previous batch keeps their writes in order.
+        std::lock_guard<std::mutex> l_OrderLock(m_SaveOrderMutex);
+        for (uint32_t it_Group = 0; it_Group < l_BatchPointer->m_Regions.size(); ++it_Group)
+        {
+            std::weak_ptr<RegionSaveBatch>& l_LastSave = m_LastSaves[l_BatchPointer->m_Regions[it_Group].RegionCoord];
+            std::vector<JobCounter*> l_Dependencies{ &l_BatchPointer->m_EncodeCounter };
+            if (const std::shared_ptr<RegionSaveBatch> l_Previous = l_LastSave.lock())
+            {
+                l_Dependencies.push_back(&l_Previous->m_Counter);
+            }
+            l_LastSave = l_Batch;
+
+            jobSystem.SubmitAfterAll(l_Dependencies, [this, l_Batch, it_Group]()
+                {
+                    const RegionSaveBatch::RegionGroup& l_Group = l_Batch->m_Regions[it_Group];
+
+                    std::vector<RegionBlob> l_Blobs;
+                    l_Blobs.reserve(l_Group.SnapshotIndices.size());
+                    for (const uint32_t it_Index : l_Group.SnapshotIndices)
+                    {
+                        const std::vector<uint8_t>& l_Blob = l_Batch->m_Blobs[it_Index];
+                        l_Blobs.push_back({ RegionFile::GetEntryIndex(l_Batch->m_Snapshots[it_Index].GetCoord()), l_Blob.data(), l_Blob.size() });
+                    }
+
+                    if (!WriteRegion(l_Group.RegionCoord, l_Blobs))
+                    {
+                        l_Batch->m_FailedRegionCount.fetch_add(1, std::memory_order_release);
+                    }
+                }, &l_BatchPointer->m_Counter);
+        }
+
+        return l_Batch;
+    }
+
+    std::shared_ptr<RegionLoadBatch> RegionStore::LoadAsync(JobSystem& jobSystem, const std::vector<ChunkCoord>& coords)
+    {
+        std::shared_ptr<RegionLoadBatch> l_Batch = std::make_shared<RegionLoadBatch>();
+        l_Batch->m_Coords = coords;
+        l_Batch->m_Results.resize(coords.size());
+
+        RegionLoadBatch* l_BatchPointer = l_Batch.get();
+        jobSystem.ParallelFor(static_cast<uint32_t>(coords.size()), s_ChunksPerJob, [this, l_Batch](uint32_t begin, uint32_t end)
+            {
+                for (uint32_t i = begin; i < end; ++i)
+                {
+                    l_Batch->m_Results[i] = LoadChunk(l_Batch->m_Coords[i]);
+                }
+            }, &l_BatchPointer->m_Counter);
+
+        return l_Batch;
+    }
+
+    uint32_t RegionStore::CompactRegions(float minimumDeadRatio)
+    {
+        std::vector<Region*> l_Regions;
+        {
+            std::lock_guard<std::mutex> l_Lock(m_RegionMapMutex);
+            for (auto& [it_Coord, it_Region] : m_Regions)
+            {
+                l_Regions.push_back(it_Region.get());
+            }
+        }
+
+        uint32_t l_CompactedCount = 0;
+        for (Region* it_Region : l_Regions)
+        {
+            std::unique_lock<std::shared_mutex> l_Lock(it_Region->Mutex);
+            const RegionFile& l_File = it_Region->File;
+            if (!l_File.IsOpen() || l_File.GetFileSize() == 0)
+            {
+                continue;
+            }
+
+            const uint64_t l_DeadBytes = l_File.GetDeadBytes();
+            if (static_cast<double>(l_DeadBytes) <= static_cast<double>(l_File.GetFileSize()) * minimumDeadRatio)
+            {
+                continue;
+            }
+
+            if (it_Region->File.Compact())
+            {
+                ++l_CompactedCount;
+            }
+        }
+
+        return l_CompactedCount;
+    }
+}
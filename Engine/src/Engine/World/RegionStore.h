@@ -0,0 +1,121 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/Jobs/JobSystem.h"
+#include "Engine/World/Chunk.h"
+#include "Engine/World/RegionFile.h"
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine
+{
+    // An autosave in flight. The chunks were snapshotted on submission, so the world may keep changing.
+    class ENGINE_API RegionSaveBatch
+    {
+    public:
+        bool IsComplete() const { return m_Counter.IsComplete(); }
+        JobCounter& GetCounter() { return m_Counter; }
+
+        // Only meaningful once IsComplete returns true.
+        bool HasSucceeded() const { return m_FailedRegionCount.load(std::memory_order_acquire) == 0; }
+        size_t GetChunkCount() const { return m_Snapshots.size(); }
+        uint64_t GetEncodedBytes() const { return m_EncodedBytes.load(std::memory_order_acquire); }
+
+    private:
+        friend class RegionStore;
+
+        struct RegionGroup
+        {
+            ChunkCoord RegionCoord;
+            std::vector<uint32_t> SnapshotIndices;
+        };
+
+        std::vector<Chunk> m_Snapshots;
+        std::vector<std::vector<uint8_t>> m_Blobs;
+        std::vector<RegionGroup> m_Regions;
+
+        JobCounter m_EncodeCounter;
+        JobCounter m_Counter;
+        std::atomic<uint32_t> m_FailedRegionCount{ 0 };
+        std::atomic<uint64_t> m_EncodedBytes{ 0 };
+    };
+
+    class ENGINE_API RegionLoadBatch
+    {
+    public:
+        bool IsComplete() const { return m_Counter.IsComplete(); }
+        JobCounter& GetCounter() { return m_Counter; }
+
+        const std::vector<ChunkCoord>& GetCoords() const { return m_Coords; }
+
+        // Loaded chunks in request order; null where nothing is stored or the record is unreadable.
+        // Only valid once IsComplete returns true.
+        std::vector<std::unique_ptr<Chunk>>& GetChunks() { return m_Results; }
+
+    private:
+        friend class RegionStore;
+
+        std::vector<ChunkCoord> m_Coords;
+        std::vector<std::unique_ptr<Chunk>> m_Results;
+        JobCounter m_Counter;
+    };
+
+    // Chunk persistence over a directory of region files named r.<x>.<y>.<z>.mcr. Every method is
+    // thread-safe: reads of one region run concurrently, writes to it are exclusive. Batches reference
+    // the store, so it must outlive any batch still running. Async saves touching the same region are
+    // written in submission order, so an older snapshot never overwrites a newer one.
+    class ENGINE_API RegionStore
+    {
+    public:
+        explicit RegionStore(std::filesystem::path directory);
+
+        RegionStore(const RegionStore&) = delete;
+        RegionStore& operator=(const RegionStore&) = delete;
+
+        bool HasChunk(const ChunkCoord& coord);
+
+        // Returns null when the chunk was never saved or its record is damaged.
+        std::unique_ptr<Chunk> LoadChunk(const ChunkCoord& coord);
+
+        // Encodes and writes on the calling thread; grouped so each region publishes one table update.
+        bool SaveChunks(const std::vector<const Chunk*>& chunks);
+
+        // Copies the chunks (the only main-thread cost), then encodes in parallel and writes each region on a worker.
+        // A region's write waits for the previous async save that wrote the same region.
+        std::shared_ptr<RegionSaveBatch> SaveAsync(JobSystem& jobSystem, const std::vector<const Chunk*>& chunks);
+        std::shared_ptr<RegionLoadBatch> LoadAsync(JobSystem& jobSystem, const std::vector<ChunkCoord>& coords);
+
+        // Compacts every open region whose dead space exceeds the given fraction of its file; returns how many were rewritten.
+        uint32_t CompactRegions(float minimumDeadRatio = 0.5f);
+
+        const std::filesystem::path& GetDirectory() const { return m_Directory; }
+
+    private:
+        struct Region
+        {
+            std::shared_mutex Mutex;
+            RegionFile File;
+        };
+
+        Region& AcquireRegion(const ChunkCoord& regionCoord);
+        bool WriteRegion(const ChunkCoord& regionCoord, const std::vector<RegionBlob>& blobs);
+        std::filesystem::path GetRegionPath(const ChunkCoord& regionCoord) const;
+
+    private:
+        std::filesystem::path m_Directory;
+
+        std::mutex m_RegionMapMutex;
+        std::unordered_map<ChunkCoord, std::unique_ptr<Region>, ChunkCoordHash> m_Regions;
+
+        // Latest async save per region; expired once that batch has finished and been released.
+        std::mutex m_SaveOrderMutex;
+        std::unordered_map<ChunkCoord, std::weak_ptr<RegionSaveBatch>, ChunkCoordHash> m_LastSaves;
+    };
+}
@@ -0,0 +1,773 @@
+#include "Engine/World/TerrainLod.h"
+
+#include "Engine/Core/Profiler.h"
+#include "Engine/Jobs/JobSystem.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <tuple>
+#include <utility>
+
+namespace Engine
+{
+    // One round of worker filtering. The owner waits for it before going away, so jobs may use its tables.
+    struct TerrainLod::DownsampleBatch
+    {
+        struct Entry
+        {
+            ChunkCoord Coord;
+            PaletteStorage Blocks;
+
+            // Levels that want the source (bit k - 1 for level k), and those seeing it for the first time; edits
+            // of a known source do not count towards a section's completeness.
+            uint32_t LevelMask = 0;
+            uint32_t NewMask = 0;
+
+            // Every level's cells, back to back (see GetCellOffset).
+            std::vector<BlockId> Cells;
+        };
+
+        std::vector<Entry> Entries;
+        uint32_t LevelCount = 0;
+        LodFilter Filter = LodFilter::Majority;
+        std::vector<uint8_t> Priorities;
+        const MeshingBlockTable* BlockTable = nullptr;
+
+        std::atomic<int64_t> WorkerNanoseconds{ 0 };
+        JobCounter Counter;
+    };
+
+    TerrainLod::TerrainLod(JobSystem& jobSystem, const MeshingBlockTable& blockTable, const TerrainLodSettings& settings)
+        : m_JobSystem(jobSystem), m_BlockTable(blockTable), m_Settings(settings)
+    {
+        m_Settings.LevelCount = std::min(m_Settings.LevelCount, TerrainLodMaxLevels);
+        m_Settings.DetailRadius = std::max(m_Settings.DetailRadius, 0);
+        m_Settings.RingSections = std::max(m_Settings.RingSections, 1);
+        m_Settings.MaxChunkY = std::max(m_Settings.MaxChunkY, m_Settings.MinChunkY);
+        m_Settings.MaxDownsamplePerFrame = std::max(m_Settings.MaxDownsamplePerFrame, 1u);
+
+        for (uint32_t l_Level = 1; l_Level <= m_Settings.LevelCount; ++l_Level)
+        {
+            std::unique_ptr<Level> l_LevelState = std::make_unique<Level>();
+            l_LevelState->Pipeline = std::make_unique<ChunkMeshPipeline>(m_JobSystem, l_LevelState->Provider, m_BlockTable, m_Settings.Pipeline);
+            l_LevelState->Pipeline->SetUploadCallback([this, l_Level](const ChunkCoord& coord, ChunkMesh& mesh)
+                {
+                    Level& l_Owner = *m_Levels[l_Level - 1];
+                    SectionMap::iterator l_Section = l_Owner.Sections.find(coord);
+                    if (l_Section != l_Owner.Sections.end())
+                    {
+                        l_Owner.VertexCount -= l_Section->second.VertexCount;
+                        l_Section->second.VertexCount = static_cast<uint32_t>(mesh.Vertices.size());
+                        l_Owner.VertexCount += l_Section->second.VertexCount;
+                    }
+
+                    if (m_Upload)
+                    {
+                        m_Upload(l_Level, mesh);
+                    }
+                });
+            m_Levels.push_back(std::move(l_LevelState));
+        }
+    }
+
+    TerrainLod::~TerrainLod()
+    {
+        // Workers read the block table and settings through the batch; neither may go before they finish.
+        if (m_Batch != nullptr)
+        {
+            m_JobSystem.WaitForCounter(m_Batch->Counter);
+        }
+    }
+
+    const Chunk* TerrainLod::LevelProvider::FindChunk(const ChunkCoord& coord) const
+    {
+        const SectionMap::const_iterator l_Section = m_Sections.find(coord);
+        if (l_Section == m_Sections.end() || !l_Section->second.IsActive || !l_Section->second.IsComplete())
+        {
+            return nullptr;
+        }
+
+        return l_Section->second.Grid.get();
+    }
+
+    void TerrainLod::OnChunkChanged(const Chunk& chunk)
+    {
+        const ChunkCoord& l_Coord = chunk.GetCoord();
+        if (m_Settings.LevelCount == 0 || l_Coord.Y < m_Settings.MinChunkY || l_Coord.Y > m_Settings.MaxChunkY)
+        {
+            return;
+        }
+
+        m_Requested.erase(l_Coord);
+
+        const std::unordered_map<ChunkCoord, size_t, ChunkCoordHash>::iterator l_Queued = m_QueueIndex.find(l_Coord);
+        if (l_Queued != m_QueueIndex.end())
+        {
+            m_Queue[l_Queued->second].Blocks = chunk.GetStorage();
+
+            return;
+        }
+
+        m_QueueIndex.emplace(l_Coord, m_Queue.size());
+        m_Queue.push_back({ l_Coord, chunk.GetStorage() });
+    }
+
+    void TerrainLod::Update(const glm::vec3& focusPosition)
+    {
+        ENGINE_PROFILE_SCOPE("TerrainLod::Update");
+
+        if (m_Batch != nullptr && m_Batch->Counter.IsComplete())
+        {
+            MergeDownsampled();
+        }
+
+        m_FocusPosition = focusPosition;
+        const ChunkCoord l_FocusColumn{ WorldToChunk(static_cast<int32_t>(std::floor(focusPosition.x))), 0, WorldToChunk(static_cast<int32_t>(std::floor(focusPosition.z))) };
+        if (!m_HasFocus || !(l_FocusColumn == m_FocusColumn))
+        {
+            m_FocusColumn = l_FocusColumn;
+            m_HasFocus = true;
+            RebuildRings();
+        }
+
+        StartDownsampling();
+
+        for (size_t i = 0; i < m_Levels.size(); ++i)
+        {
+            Level& l_Level = *m_Levels[i];
+            l_Level.Pipeline->Dispatch();
+
+            TerrainLodLevelStats& l_Stats = m_FrameStats.Levels[i];
+            l_Stats.SectionCount = static_cast<uint32_t>(l_Level.Sections.size());
+            l_Stats.ActiveCount = static_cast<uint32_t>(l_Level.Active.size());
+            l_Stats.VertexCount = l_Level.VertexCount;
+            for (const auto& [l_Coord, l_Section] : l_Level.Sections)
+            {
+                l_Stats.MemoryBytes += l_Section.Grid != nullptr ? l_Section.Grid->GetMemoryUsage() : 0;
+            }
+
+            const ChunkMeshPipelineStats& l_PipelineStats = l_Level.Pipeline->GetLastFrameStats();
+            l_Stats.MeshedCount = l_PipelineStats.UploadedCount;
+            l_Stats.AverageMeshLatencyMilliseconds = l_PipelineStats.AverageLatencyMilliseconds;
+        }
+
+        m_FrameStats.MissingSourceCount = static_cast<uint32_t>(m_Missing.size() - m_MissingHead + m_Requested.size());
+        m_FrameStats.DetailColumnCount = static_cast<uint32_t>(m_DetailColumns.size());
+        m_LastFrameStats = m_FrameStats;
+        m_FrameStats = TerrainLodStats();
+    }
+
+    std::vector<ChunkCoord> TerrainLod::TakeMissingSources(size_t maxCount)
+    {
+        std::vector<ChunkCoord> l_Sources;
+        while (l_Sources.size() < maxCount && m_MissingHead < m_Missing.size())
+        {
+            const ChunkCoord l_Coord = m_Missing[m_MissingHead++];
+
+            // Fed through OnChunkChanged since the list was built, e.g. by streaming.
+            bool l_IsNeeded = false;
+            for (uint32_t l_Level = 1; l_Level <= m_Levels.size() && !l_IsNeeded; ++l_Level)
+            {
+                l_IsNeeded = IsWanted(l_Level, l_Coord) && m_Levels[l_Level - 1]->KnownSources.count(l_Coord) == 0;
+            }
+
+            if (!l_IsNeeded || m_QueueIndex.count(l_Coord) > 0 || !m_Requested.insert(l_Coord).second)
+            {
+                continue;
+            }
+
+            l_Sources.push_back(l_Coord);
+        }
+
+        return l_Sources;
+    }
+
+    bool TerrainLod::IsDetailColumn(const ChunkCoord& chunkCoord) const
+    {
+        return m_DetailColumns.count({ chunkCoord.X, 0, chunkCoord.Z }) > 0;
+    }
+
+    const Chunk* TerrainLod::FindSection(uint32_t level, const ChunkCoord& sectionCoord) const
+    {
+        if (level == 0 || level > m_Levels.size())
+        {
+            return nullptr;
+        }
+
+        const SectionMap& l_Sections = m_Levels[level - 1]->Sections;
+        const SectionMap::const_iterator l_Section = l_Sections.find(sectionCoord);
+
+        return l_Section != l_Sections.end() ? l_Section->second.Grid.get() : nullptr;
+    }
+
+    const std::vector<ChunkCoord>& TerrainLod::GetActiveSections(uint32_t level) const
+    {
+        static const std::vector<ChunkCoord> s_None;
+
+        return level > 0 && level <= m_Levels.size() ? m_Levels[level - 1]->Active : s_None;
+    }
+
+    int32_t TerrainLod::GetReach(uint32_t level) const
+    {
+        // Ring k is RingSections sections of 2^k columns wide: 2 + 4 + ... + 2^level = 2^(level + 1) - 2.
+        return m_Settings.DetailRadius + m_Settings.RingSections * ((2 << level) - 2);
+    }
+
+    bool TerrainLod::IsIdle() const
+    {
+        if (m_MissingHead < m_Missing.size() || !m_Requested.empty() || !m_Queue.empty() || m_Batch != nullptr)
+        {
+            return false;
+        }
+
+        for (const std::unique_ptr<Level>& it_Level : m_Levels)
+        {
+            if (it_Level->Pipeline->GetPendingCount() > 0 || it_Level->Pipeline->GetInFlightCount() > 0)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void TerrainLod::Downsample(const BlockId* blocks, uint32_t level, LodFilter filter, const MeshingBlockTable& blockTable,
+        const std::vector<uint8_t>& priorities, BlockId* outCells)
+    {
+        const int32_t l_Scale = GetScale(level);
+        const int32_t l_CellsPerAxis = Chunk::Size >> level;
+        const uint32_t l_CellVolume = static_cast<uint32_t>(l_Scale * l_Scale * l_Scale);
+
+        // Distinct blocks under the current cell and how often each occurs; a cell rarely holds more than a few.
+        std::vector<std::pair<BlockId, uint32_t>> l_Counts;
+        l_Counts.reserve(16);
+
+        for (int32_t l_CellY = 0; l_CellY < l_CellsPerAxis; ++l_CellY)
+        {
+            for (int32_t l_CellZ = 0; l_CellZ < l_CellsPerAxis; ++l_CellZ)
+            {
+                for (int32_t l_CellX = 0; l_CellX < l_CellsPerAxis; ++l_CellX)
+                {
+                    l_Counts.clear();
+                    for (int32_t y = l_CellY * l_Scale; y < (l_CellY + 1) * l_Scale; ++y)
+                    {
+                        for (int32_t z = l_CellZ * l_Scale; z < (l_CellZ + 1) * l_Scale; ++z)
+                        {
+                            const BlockId* l_Row = blocks + Chunk::GetIndex(l_CellX * l_Scale, y, z);
+                            for (int32_t x = 0; x < l_Scale; ++x)
+                            {
+                                const BlockId l_Block = l_Row[x];
+                                std::vector<std::pair<BlockId, uint32_t>>::iterator it_Count = l_Counts.begin();
+                                while (it_Count != l_Counts.end() && it_Count->first != l_Block)
+                                {
+                                    ++it_Count;
+                                }
+
+                                if (it_Count == l_Counts.end())
+                                {
+                                    l_Counts.emplace_back(l_Block, 1u);
+                                }
+                                else
+                                {
+                                    ++it_Count->second;
+                                }
+                            }
+                        }
+                    }
+
+                    // Candidates compare on a tuple; the id is negated so equal candidates resolve to the lower id.
+                    BlockId l_Best = AirBlockId;
+                    std::tuple<uint32_t, uint32_t, uint32_t, int32_t> l_BestKey{ 0, 0, 0, INT32_MIN };
+                    uint32_t l_VisibleCount = 0;
+                    for (const std::pair<BlockId, uint32_t>& it_Count : l_Counts)
+                    {
+                        const uint32_t l_IsVisible = (blockTable.GetFlags(it_Count.first) & MeshingBlockTable::FlagVisible) != 0 ? 1 : 0;
+                        const uint32_t l_Priority = it_Count.first < priorities.size() ? priorities[it_Count.first] : 0;
+
+                        std::tuple<uint32_t, uint32_t, uint32_t, int32_t> l_Key;
+                        if (filter == LodFilter::Majority)
+                        {
+                            l_Key = { it_Count.second, l_IsVisible, l_Priority, -static_cast<int32_t>(it_Count.first) };
+                        }
+                        else
+                        {
+                            if (l_IsVisible == 0)
+                            {
+                                continue;
+                            }
+
+                            l_VisibleCount += it_Count.second;
+                            l_Key = { 1, l_Priority, it_Count.second, -static_cast<int32_t>(it_Count.first) };
+                        }
+
+                        if (l_Key > l_BestKey)
+                        {
+                            l_BestKey = l_Key;
+                            l_Best = it_Count.first;
+                        }
+                    }
+
+                    if (filter == LodFilter::MaterialPriority && l_VisibleCount * 2 < l_CellVolume)
+                    {
+                        l_Best = AirBlockId;
+                    }
+
+                    outCells[(l_CellY * l_CellsPerAxis + l_CellZ) * l_CellsPerAxis + l_CellX] = l_Best;
+                }
+            }
+        }
+    }
+
+    size_t TerrainLod::GetCellOffset(uint32_t level)
+    {
+        size_t l_Offset = 0;
+        for (uint32_t l_Level = 1; l_Level < level; ++l_Level)
+        {
+            const size_t l_CellsPerAxis = static_cast<size_t>(Chunk::Size >> l_Level);
+            l_Offset += l_CellsPerAxis * l_CellsPerAxis * l_CellsPerAxis;
+        }
+
+        return l_Offset;
+    }
+
+    int64_t TerrainLod::GetNearestDistanceSquared(uint32_t level, int32_t sectionX, int32_t sectionZ) const
+    {
+        const int32_t l_Scale = GetScale(level);
+        const int64_t l_DX = std::clamp(m_FocusColumn.X, sectionX * l_Scale, sectionX * l_Scale + l_Scale - 1) - static_cast<int64_t>(m_FocusColumn.X);
+        const int64_t l_DZ = std::clamp(m_FocusColumn.Z, sectionZ * l_Scale, sectionZ * l_Scale + l_Scale - 1) - static_cast<int64_t>(m_FocusColumn.Z);
+
+        return l_DX * l_DX + l_DZ * l_DZ;
+    }
+
+    int64_t TerrainLod::GetCentreDistanceSquared(uint32_t level, int32_t sectionX, int32_t sectionZ) const
+    {
+        // In half columns, so the centre of an even-sized section stays on the integer grid.
+        const int32_t l_Scale = GetScale(level);
+        const int64_t l_DX = static_cast<int64_t>(sectionX) * l_Scale * 2 + l_Scale - 1 - static_cast<int64_t>(m_FocusColumn.X) * 2;
+        const int64_t l_DZ = static_cast<int64_t>(sectionZ) * l_Scale * 2 + l_Scale - 1 - static_cast<int64_t>(m_FocusColumn.Z) * 2;
+
+        return l_DX * l_DX + l_DZ * l_DZ;
+    }
+
+    int64_t TerrainLod::GetFarthestDistanceSquared(uint32_t level, int32_t sectionX, int32_t sectionZ) const
+    {
+        const int32_t l_Scale = GetScale(level);
+        const int64_t l_DX = std::max(std::abs(static_cast<int64_t>(sectionX) * l_Scale - m_FocusColumn.X),
+            std::abs(static_cast<int64_t>(sectionX) * l_Scale + l_Scale - 1 - m_FocusColumn.X));
+        const int64_t l_DZ = std::max(std::abs(static_cast<int64_t>(sectionZ) * l_Scale - m_FocusColumn.Z),
+            std::abs(static_cast<int64_t>(sectionZ) * l_Scale + l_Scale - 1 - m_FocusColumn.Z));
+
+        return l_DX * l_DX + l_DZ * l_DZ;
+    }
+
+    uint32_t TerrainLod::GetExpectedSourceCount(uint32_t level, int32_t sectionY) const
+    {
+        const int32_t l_Scale = GetScale(level);
+        const int32_t l_MinY = std::max(m_Settings.MinChunkY, sectionY * l_Scale);
+        const int32_t l_MaxY = std::min(m_Settings.MaxChunkY, sectionY * l_Scale + l_Scale - 1);
+
+        return static_cast<uint32_t>(l_Scale * l_Scale * std::max(l_MaxY - l_MinY + 1, 0));
+    }
+
+    int32_t TerrainLod::GetKeepReach(uint32_t level) const
+    {
+        // Children of a split section reach up to its diagonal past the finer reach.
+        return GetReach(level) + GetScale(level + 1) * 2;
+    }
+
+    bool TerrainLod::IsWanted(uint32_t level, const ChunkCoord& sourceCoord) const
+    {
+        const ChunkCoord l_SectionCoord = GetSectionCoord(level, sourceCoord);
+        const SectionMap& l_Sections = m_Levels[level - 1]->Sections;
+        const SectionMap::const_iterator l_Section = l_Sections.find(l_SectionCoord);
+        if (l_Section != l_Sections.end() && l_Section->second.IsActive)
+        {
+            return true;
+        }
+
+        const int64_t l_KeepReach = GetKeepReach(level);
+
+        return GetNearestDistanceSquared(level, l_SectionCoord.X, l_SectionCoord.Z) <= l_KeepReach * l_KeepReach;
+    }
+
+    void TerrainLod::StartDownsampling()
+    {
+        if (m_Batch != nullptr || m_Queue.empty())
+        {
+            return;
+        }
+
+        ENGINE_PROFILE_SCOPE("TerrainLod::StartDownsampling");
+
+        std::shared_ptr<DownsampleBatch> l_Batch = std::make_shared<DownsampleBatch>();
+        l_Batch->LevelCount = m_Settings.LevelCount;
+        l_Batch->Filter = m_Settings.Filter;
+        l_Batch->Priorities = m_Settings.MaterialPriorities;
+        l_Batch->BlockTable = &m_BlockTable;
+
+        const size_t l_Count = std::min<size_t>(m_Queue.size(), m_Settings.MaxDownsamplePerFrame);
+        l_Batch->Entries.reserve(l_Count);
+        for (size_t i = 0; i < l_Count; ++i)
+        {
+            m_QueueIndex.erase(m_Queue[i].Coord);
+
+            // Known from here on, so the missing list and a second snapshot arriving mid-batch both see it.
+            uint32_t l_LevelMask = 0;
+            uint32_t l_NewMask = 0;
+            for (uint32_t l_Level = 1; l_Level <= m_Levels.size(); ++l_Level)
+            {
+                if (IsWanted(l_Level, m_Queue[i].Coord))
+                {
+                    l_LevelMask |= 1u << (l_Level - 1);
+                    l_NewMask |= m_Levels[l_Level - 1]->KnownSources.insert(m_Queue[i].Coord).second ? 1u << (l_Level - 1) : 0u;
+                }
+            }
+
+            if (l_LevelMask != 0)
+            {
+                l_Batch->Entries.push_back({ m_Queue[i].Coord, std::move(m_Queue[i].Blocks), l_LevelMask, l_NewMask, {} });
+            }
+        }
+        m_Queue.erase(m_Queue.begin(), m_Queue.begin() + static_cast<std::ptrdiff_t>(l_Count));
+        for (size_t i = 0; i < m_Queue.size(); ++i)
+        {
+            m_QueueIndex[m_Queue[i].Coord] = i;
+        }
+
+        if (l_Batch->Entries.empty())
+        {
+            return;
+        }
+
+        m_JobSystem.ParallelFor(static_cast<uint32_t>(l_Batch->Entries.size()), 1, [l_Batch](uint32_t begin, uint32_t end)
+            {
+                const std::chrono::steady_clock::time_point l_Start = std::chrono::steady_clock::now();
+
+                std::vector<BlockId> l_Blocks(Chunk::Volume);
+                for (uint32_t i = begin; i < end; ++i)
+                {
+                    DownsampleBatch::Entry& l_Entry = l_Batch->Entries[i];
+                    l_Entry.Cells.resize(GetCellOffset(l_Batch->LevelCount + 1));
+
+                    // Solid rock and open sky are most of the world; a single-value chunk filters to itself.
+                    if (l_Entry.Blocks.IsUniform())
+                    {
+                        const BlockId l_Block = l_Entry.Blocks.Get(0);
+                        const bool l_IsVisible = (l_Batch->BlockTable->GetFlags(l_Block) & MeshingBlockTable::FlagVisible) != 0;
+                        std::fill(l_Entry.Cells.begin(), l_Entry.Cells.end(),
+                            l_Batch->Filter == LodFilter::MaterialPriority && !l_IsVisible ? AirBlockId : l_Block);
+                        continue;
+                    }
+
+                    for (uint32_t l_Index = 0; l_Index < Chunk::Volume; ++l_Index)
+                    {
+                        l_Blocks[l_Index] = l_Entry.Blocks.Get(l_Index);
+                    }
+
+                    for (uint32_t l_Level = 1; l_Level <= l_Batch->LevelCount; ++l_Level)
+                    {
+                        if ((l_Entry.LevelMask >> (l_Level - 1) & 1) != 0)
+                        {
+                            Downsample(l_Blocks.data(), l_Level, l_Batch->Filter, *l_Batch->BlockTable, l_Batch->Priorities, l_Entry.Cells.data() + GetCellOffset(l_Level));
+                        }
+                    }
+                }
+
+                l_Batch->WorkerNanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - l_Start).count();
+            }, &l_Batch->Counter);
+
+        m_Batch = std::move(l_Batch);
+    }
+
+    void TerrainLod::MergeDownsampled()
+    {
+        ENGINE_PROFILE_SCOPE("TerrainLod::MergeDownsampled");
+
+        std::shared_ptr<DownsampleBatch> l_Batch = std::move(m_Batch);
+        m_FrameStats.DownsampleMilliseconds += l_Batch->WorkerNanoseconds.load() / 1.0e6;
+
+        for (const DownsampleBatch::Entry& it_Entry : l_Batch->Entries)
+        {
+            ++m_FrameStats.DownsampledCount;
+
+            for (uint32_t l_Level = 1; l_Level <= m_Levels.size(); ++l_Level)
+            {
+                // Not wanted by the level, or pruned while on the workers because the ring moved away from it.
+                if ((it_Entry.LevelMask >> (l_Level - 1) & 1) == 0 || m_Levels[l_Level - 1]->KnownSources.count(it_Entry.Coord) == 0)
+                {
+                    continue;
+                }
+
+                const ChunkCoord l_SectionCoord = GetSectionCoord(l_Level, it_Entry.Coord);
+                const auto [it_Section, l_Inserted] = m_Levels[l_Level - 1]->Sections.try_emplace(l_SectionCoord);
+                Section& l_Section = it_Section->second;
+                if (l_Inserted)
+                {
+                    l_Section.ExpectedSourceCount = GetExpectedSourceCount(l_Level, l_SectionCoord.Y);
+                }
+
+                if (l_Section.Grid == nullptr)
+                {
+                    l_Section.Grid = std::make_unique<Chunk>(l_SectionCoord);
+                }
+
+                const bool l_WasComplete = l_Section.IsComplete();
+                if ((it_Entry.NewMask >> (l_Level - 1) & 1) != 0)
+                {
+                    ++l_Section.SourceCount;
+                }
+
+                // The source's cube of cells inside the section.
+                const int32_t l_Scale = GetScale(l_Level);
+                const int32_t l_CellsPerAxis = Chunk::Size >> l_Level;
+                const int32_t l_LocalX = it_Entry.Coord.X - l_SectionCoord.X * l_Scale;
+                const int32_t l_LocalY = it_Entry.Coord.Y - l_SectionCoord.Y * l_Scale;
+                const int32_t l_LocalZ = it_Entry.Coord.Z - l_SectionCoord.Z * l_Scale;
+                const BlockId* l_Cells = it_Entry.Cells.data() + GetCellOffset(l_Level);
+
+                bool l_HasChanged = false;
+                for (int32_t y = 0; y < l_CellsPerAxis; ++y)
+                {
+                    for (int32_t z = 0; z < l_CellsPerAxis; ++z)
+                    {
+                        for (int32_t x = 0; x < l_CellsPerAxis; ++x)
+                        {
+                            const BlockId l_Cell = l_Cells[(y * l_CellsPerAxis + z) * l_CellsPerAxis + x];
+                            const int32_t l_GridX = l_LocalX * l_CellsPerAxis + x;
+                            const int32_t l_GridY = l_LocalY * l_CellsPerAxis + y;
+                            const int32_t l_GridZ = l_LocalZ * l_CellsPerAxis + z;
+                            if (l_Section.Grid->GetBlock(l_GridX, l_GridY, l_GridZ) != l_Cell)
+                            {
+                                l_Section.Grid->SetBlock(l_GridX, l_GridY, l_GridZ, l_Cell);
+                                l_HasChanged = true;
+                            }
+                        }
+                    }
+                }
+
+                if (!l_Section.IsComplete())
+                {
+                    continue;
+                }
+
+                if (!l_WasComplete)
+                {
+                    // Its neighbours were showing skirt faces against it until now.
+                    l_Section.Grid->Compact();
+                    RequestSectionMesh(l_Level, l_SectionCoord);
+                    RequestNeighbourMeshes(l_Level, l_SectionCoord);
+                    continue;
+                }
+
+                if (!l_HasChanged)
+                {
+                    continue;
+                }
+
+                // An edit: the section, plus the neighbours across whichever section borders the source lies on.
+                RequestSectionMesh(l_Level, l_SectionCoord);
+                if (l_LocalX == 0) { RequestSectionMesh(l_Level, { l_SectionCoord.X - 1, l_SectionCoord.Y, l_SectionCoord.Z }); }
+                if (l_LocalX == l_Scale - 1) { RequestSectionMesh(l_Level, { l_SectionCoord.X + 1, l_SectionCoord.Y, l_SectionCoord.Z }); }
+                if (l_LocalY == 0) { RequestSectionMesh(l_Level, { l_SectionCoord.X, l_SectionCoord.Y - 1, l_SectionCoord.Z }); }
+                if (l_LocalY == l_Scale - 1) { RequestSectionMesh(l_Level, { l_SectionCoord.X, l_SectionCoord.Y + 1, l_SectionCoord.Z }); }
+                if (l_LocalZ == 0) { RequestSectionMesh(l_Level, { l_SectionCoord.X, l_SectionCoord.Y, l_SectionCoord.Z - 1 }); }
+                if (l_LocalZ == l_Scale - 1) { RequestSectionMesh(l_Level, { l_SectionCoord.X, l_SectionCoord.Y, l_SectionCoord.Z + 1 }); }
+            }
+        }
+    }
+
+    void TerrainLod::RebuildRings()
+    {
+        ENGINE_PROFILE_SCOPE("TerrainLod::RebuildRings");
+
+        const uint32_t l_TopLevel = m_Settings.LevelCount;
+        const int64_t l_Reach = GetReach(l_TopLevel);
+
+        // Index 0 collects the detail columns, index k the shown columns of level k.
+        std::vector<std::vector<ChunkCoord>> l_Columns(l_TopLevel + 1);
+        const int32_t l_MinX = static_cast<int32_t>((m_FocusColumn.X - l_Reach) >> l_TopLevel);
+        const int32_t l_MaxX = static_cast<int32_t>((m_FocusColumn.X + l_Reach) >> l_TopLevel);
+        const int32_t l_MinZ = static_cast<int32_t>((m_FocusColumn.Z - l_Reach) >> l_TopLevel);
+        const int32_t l_MaxZ = static_cast<int32_t>((m_FocusColumn.Z + l_Reach) >> l_TopLevel);
+        for (int32_t l_SectionZ = l_MinZ; l_SectionZ <= l_MaxZ; ++l_SectionZ)
+        {
+            for (int32_t l_SectionX = l_MinX; l_SectionX <= l_MaxX; ++l_SectionX)
+            {
+                if (GetNearestDistanceSquared(l_TopLevel, l_SectionX, l_SectionZ) <= l_Reach * l_Reach)
+                {
+                    CollectRing(l_TopLevel, l_SectionX, l_SectionZ, l_Columns);
+                }
+            }
+        }
+
+        m_DetailColumns.clear();
+        m_DetailColumns.insert(l_Columns[0].begin(), l_Columns[0].end());
+
+        for (uint32_t l_Level = 1; l_Level <= l_TopLevel; ++l_Level)
+        {
+            Level& l_LevelState = *m_Levels[l_Level - 1];
+
+            std::vector<ChunkCoord> l_Active;
+            for (const ChunkCoord& it_Column : l_Columns[l_Level])
+            {
+                for (int32_t l_SectionY = m_Settings.MinChunkY >> l_Level; l_SectionY <= m_Settings.MaxChunkY >> l_Level; ++l_SectionY)
+                {
+                    l_Active.push_back({ it_Column.X, l_SectionY, it_Column.Z });
+                }
+            }
+            const std::unordered_set<ChunkCoord, ChunkCoordHash> l_ActiveSet(l_Active.begin(), l_Active.end());
+
+            // Leaving sections first, so the neighbours re-meshed below already see them gone.
+            for (const ChunkCoord& it_Coord : l_LevelState.Active)
+            {
+                if (l_ActiveSet.count(it_Coord) > 0)
+                {
+                    continue;
+                }
+
+                Section& l_Section = l_LevelState.Sections[it_Coord];
+                l_Section.IsActive = false;
+                l_LevelState.VertexCount -= l_Section.VertexCount;
+                l_Section.VertexCount = 0;
+                if (m_Remove)
+                {
+                    m_Remove(l_Level, it_Coord);
+                }
+                RequestNeighbourMeshes(l_Level, it_Coord);
+            }
+
+            for (const ChunkCoord& it_Coord : l_Active)
+            {
+                const auto [it_Section, l_Inserted] = l_LevelState.Sections.try_emplace(it_Coord);
+                if (l_Inserted)
+                {
+                    it_Section->second.ExpectedSourceCount = GetExpectedSourceCount(l_Level, it_Coord.Y);
+                }
+
+                if (!it_Section->second.IsActive)
+                {
+                    it_Section->second.IsActive = true;
+                    RequestSectionMesh(l_Level, it_Coord);
+                    RequestNeighbourMeshes(l_Level, it_Coord);
+                }
+            }
+
+            l_LevelState.Active = std::move(l_Active);
+        }
+
+        PruneSections();
+        RebuildMissing();
+    }
+
+    void TerrainLod::CollectRing(uint32_t level, int32_t sectionX, int32_t sectionZ, std::vector<std::vector<ChunkCoord>>& outColumns)
+    {
+        if (level > 0)
+        {
+            // Split once the section's centre is within the finer level's reach, so the rings follow the reaches
+            // on average. Full detail is the exception: it needs every column streamed in, so level 1 only splits
+            // when its farthest column is in range.
+            const int64_t l_FinerReach = GetReach(level - 1);
+            if (level == 1 ? GetFarthestDistanceSquared(level, sectionX, sectionZ) <= l_FinerReach * l_FinerReach
+                : GetCentreDistanceSquared(level, sectionX, sectionZ) <= l_FinerReach * l_FinerReach * 4)
+            {
+                for (int32_t l_ChildZ = 0; l_ChildZ < 2; ++l_ChildZ)
+                {
+                    for (int32_t l_ChildX = 0; l_ChildX < 2; ++l_ChildX)
+                    {
+                        CollectRing(level - 1, sectionX * 2 + l_ChildX, sectionZ * 2 + l_ChildZ, outColumns);
+                    }
+                }
+
+                return;
+            }
+        }
+
+        outColumns[level].push_back({ sectionX, 0, sectionZ });
+    }
+
+    void TerrainLod::PruneSections()
+    {
+        // A section goes together with its sources' entries in the level's known set, so the counts of the
+        // sections that stay are exact and a returning focus fetches the dropped ones again.
+        for (uint32_t l_Level = 1; l_Level <= m_Levels.size(); ++l_Level)
+        {
+            Level& l_LevelState = *m_Levels[l_Level - 1];
+            std::erase_if(l_LevelState.Sections, [this, l_Level](const std::pair<const ChunkCoord, Section>& section)
+                {
+                    const int64_t l_KeepReach = GetKeepReach(l_Level);
+
+                    return !section.second.IsActive && GetNearestDistanceSquared(l_Level, section.first.X, section.first.Z) > l_KeepReach * l_KeepReach;
+                });
+            std::erase_if(l_LevelState.KnownSources, [this, l_Level, &l_LevelState](const ChunkCoord& coord)
+                {
+                    return l_LevelState.Sections.count(GetSectionCoord(l_Level, coord)) == 0;
+                });
+        }
+    }
+
+    void TerrainLod::RebuildMissing()
+    {
+        m_Missing.clear();
+        m_MissingHead = 0;
+
+        for (uint32_t l_Level = 1; l_Level <= m_Levels.size(); ++l_Level)
+        {
+            const int32_t l_Scale = GetScale(l_Level);
+            for (const ChunkCoord& it_Section : m_Levels[l_Level - 1]->Active)
+            {
+                const int32_t l_MinY = std::max(m_Settings.MinChunkY, it_Section.Y * l_Scale);
+                const int32_t l_MaxY = std::min(m_Settings.MaxChunkY, it_Section.Y * l_Scale + l_Scale - 1);
+                for (int32_t y = l_MinY; y <= l_MaxY; ++y)
+                {
+                    for (int32_t z = 0; z < l_Scale; ++z)
+                    {
+                        for (int32_t x = 0; x < l_Scale; ++x)
+                        {
+                            const ChunkCoord l_Coord{ it_Section.X * l_Scale + x, y, it_Section.Z * l_Scale + z };
+                            if (m_Levels[l_Level - 1]->KnownSources.count(l_Coord) == 0 && m_QueueIndex.count(l_Coord) == 0 && m_Requested.count(l_Coord) == 0)
+                            {
+                                m_Missing.push_back(l_Coord);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        // Same order as chunk streaming: nearest to the focus itself first.
+        const glm::vec3 l_Focus = m_FocusPosition;
+        const auto a_GetPriority = [&l_Focus](const ChunkCoord& coord)
+            {
+                const glm::vec3 l_Center = glm::vec3(static_cast<float>(coord.X), static_cast<float>(coord.Y), static_cast<float>(coord.Z)) * static_cast<float>(Chunk::Size)
+                    + glm::vec3(Chunk::Size * 0.5f);
+                const glm::vec3 l_Offset = l_Center - l_Focus;
+
+                return glm::dot(l_Offset, l_Offset);
+            };
+        std::sort(m_Missing.begin(), m_Missing.end(), [&a_GetPriority](const ChunkCoord& a, const ChunkCoord& b)
+            {
+                return a_GetPriority(a) < a_GetPriority(b);
+            });
+    }
+
+    void TerrainLod::RequestSectionMesh(uint32_t level, const ChunkCoord& sectionCoord)
+    {
+        Level& l_Level = *m_Levels[level - 1];
+        if (l_Level.Provider.FindChunk(sectionCoord) != nullptr)
+        {
+            l_Level.Pipeline->RequestRemesh(sectionCoord);
+        }
+    }
+
+    void TerrainLod::RequestNeighbourMeshes(uint32_t level, const ChunkCoord& sectionCoord)
+    {
+        RequestSectionMesh(level, { sectionCoord.X - 1, sectionCoord.Y, sectionCoord.Z });
+        RequestSectionMesh(level, { sectionCoord.X + 1, sectionCoord.Y, sectionCoord.Z });
+        RequestSectionMesh(level, { sectionCoord.X, sectionCoord.Y - 1, sectionCoord.Z });
+        RequestSectionMesh(level, { sectionCoord.X, sectionCoord.Y + 1, sectionCoord.Z });
+        RequestSectionMesh(level, { sectionCoord.X, sectionCoord.Y, sectionCoord.Z - 1 });
+        RequestSectionMesh(level, { sectionCoord.X, sectionCoord.Y, sectionCoord.Z + 1 });
+    }
+}
@@ -0,0 +1,285 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/World/Chunk.h"
+#include "Engine/World/ChunkMeshPipeline.h"
+#include "Engine/World/ChunkMesher.h"
+#include "Engine/World/ChunkProvider.h"
+
+#include <glm/glm.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace Engine
+{
+    class JobSystem;
+
+    // Coarsest level TerrainLod supports: one cell per 8x8x8 blocks.
+    constexpr uint32_t TerrainLodMaxLevels = 3;
+
+    // How the blocks under one downsampled cell decide the cell's block.
+    enum class LodFilter : uint8_t
+    {
+        // The most common block, air included; ties go to visible blocks, then to higher priority.
+        Majority = 0,
+
+        // Solid when at least half the blocks are visible, then the highest-priority visible block present
+        // (the most common among equals), so a one-block grass or snow surface still shows from afar.
+        MaterialPriority
+    };
+
+    // One level's share of a frame.
+    struct TerrainLodLevelStats
+    {
+        // Sections holding downsampled cells, the ones currently shown, and the bytes their cells take.
+        uint32_t SectionCount = 0;
+        uint32_t ActiveCount = 0;
+        size_t MemoryBytes = 0;
+
+        // Vertices in the latest mesh of every shown section.
+        uint64_t VertexCount = 0;
+
+        // Meshes the level's pipeline published last frame, and their snapshot-to-publication time.
+        uint32_t MeshedCount = 0;
+        double AverageMeshLatencyMilliseconds = 0.0;
+    };
+
+    // Counters for one frame (between the last two Update calls).
+    struct TerrainLodStats
+    {
+        // Source chunks merged into every level, and the worker time spent filtering them.
+        uint32_t DownsampledCount = 0;
+        double DownsampleMilliseconds = 0.0;
+
+        // Source chunks shown sections still wait for (requested ones included).
+        uint32_t MissingSourceCount = 0;
+
+        // Chunk columns left to full-detail chunks.
+        uint32_t DetailColumnCount = 0;
+
+        // Levels[k - 1] describes level k.
+        std::array<TerrainLodLevelStats, TerrainLodMaxLevels> Levels{};
+    };
+
+    struct TerrainLodSettings
+    {
+        // Levels beyond full detail, at most TerrainLodMaxLevels. Level k merges 2^k blocks per axis into one cell.
+        uint32_t LevelCount = 3;
+
+        // Columns within DetailRadius of the focus column (the streamer's load test) stay full detail; level k
+        // then reaches RingSections of its own sections further, i.e. DetailRadius + RingSections * (2 + ... + 2^k)
+        // columns: 8, 12, 20 and 36 with the defaults, four and a half times the detail distance.
+        int32_t DetailRadius = 8;
+        int32_t RingSections = 2;
+
+        // Chunk layers that feed the levels.
+        int32_t MinChunkY = 0;
+        int32_t MaxChunkY = 5;
+
+        LodFilter Filter = LodFilter::MaterialPriority;
+
+        // Per-BlockId rank for LodFilter::MaterialPriority; ids past the end rank 0.
+        std::vector<uint8_t> MaterialPriorities;
+
+        // Source chunks handed to workers per Update, at most.
+        uint32_t MaxDownsamplePerFrame = 64;
+
+        // Meshing of every level; far sections are not cave-culled, so connectivity is skipped.
+        ChunkMeshPipelineSettings Pipeline = { 64, { true, false } };
+    };
+
+    // Coarse copies of the terrain for the rings beyond the full-detail chunks. For each level k, a section of
+    // 2^k x 2^k x 2^k chunks is a 32^3 grid of cells, each the filtered 2^k cube of blocks under it, kept in an
+    // ordinary Chunk, so the regular mesher and mesh pipeline build it (renderers scale its vertices by 2^k).
+    //
+    // Rings nest like a quadtree around the focus column: a section gives way to its four children once its
+    // centre is within the next finer level's reach. Level 1 gives way to full-detail chunks only where all its
+    // columns are within DetailRadius, the streamed area.
+    // Each level meshes against its own shown sections only, so where two rings meet both sides keep their
+    // border faces; the overlapping walls skirt the seam instead of leaving cracks.
+    //
+    // The caller feeds every source chunk it has through OnChunkChanged (generated, loaded and edited ones),
+    // and generates or loads the far chunks listed by TakeMissingSources without keeping them in the world.
+    // Filtering runs on workers. A section is meshed once all its sources have arrived and again after each
+    // later change, along with the neighbours whose border the change touched. Main thread only.
+    class ENGINE_API TerrainLod
+    {
+    public:
+        // Meshes are in cells of the level; the mesh may be moved from.
+        using UploadCallback = std::function<void(uint32_t level, ChunkMesh& mesh)>;
+        using RemoveCallback = std::function<void(uint32_t level, const ChunkCoord& sectionCoord)>;
+
+        // The block table must outlive this object.
+        TerrainLod(JobSystem& jobSystem, const MeshingBlockTable& blockTable, const TerrainLodSettings& settings = TerrainLodSettings());
+        ~TerrainLod();
+
+        TerrainLod(const TerrainLod&) = delete;
+        TerrainLod& operator=(const TerrainLod&) = delete;
+
+        void SetUploadCallback(const UploadCallback& uploadCallback) { m_Upload = uploadCallback; }
+
+        // A shown section left its ring; its mesh should go.
+        void SetRemoveCallback(const RemoveCallback& removeCallback) { m_Remove = removeCallback; }
+
+        // Snapshot a source chunk for downsampling; a newer snapshot replaces one still queued.
+        void OnChunkChanged(const Chunk& chunk);
+
+        // Merge finished downsampling, start the next batch, re-ring when the focus changed column, and
+        // dispatch every level's meshing. Call once per frame.
+        void Update(const glm::vec3& focusPosition);
+
+        // Up to maxCount source chunks that shown sections lack, nearest first; each counts as requested until
+        // it comes back through OnChunkChanged.
+        std::vector<ChunkCoord> TakeMissingSources(size_t maxCount);
+
+        // Whether the chunk's column is left to full-detail chunks.
+        bool IsDetailColumn(const ChunkCoord& chunkCoord) const;
+
+        // A section's cells, or nullptr when nothing has been downsampled into it.
+        const Chunk* FindSection(uint32_t level, const ChunkCoord& sectionCoord) const;
+
+        // Sections of a level currently shown (level 1 and up).
+        const std::vector<ChunkCoord>& GetActiveSections(uint32_t level) const;
+
+        // Columns from the focus column that the level covers; level 0 is the detail radius.
+        int32_t GetReach(uint32_t level) const;
+
+        // Nothing missing, requested, queued, downsampling or meshing.
+        bool IsIdle() const;
+
+        const TerrainLodStats& GetLastFrameStats() const { return m_LastFrameStats; }
+        const TerrainLodSettings& GetSettings() const { return m_Settings; }
+
+        static int32_t GetScale(uint32_t level) { return 1 << level; }
+
+        // The level's section containing a chunk.
+        static ChunkCoord GetSectionCoord(uint32_t level, const ChunkCoord& chunkCoord)
+        {
+            return { chunkCoord.X >> level, chunkCoord.Y >> level, chunkCoord.Z >> level };
+        }
+
+        // Filter a chunk's blocks (Chunk::GetIndex order) down to one level: n = 32 / 2^level cells per axis,
+        // written to outCells at (y * n + z) * n + x.
+        static void Downsample(const BlockId* blocks, uint32_t level, LodFilter filter, const MeshingBlockTable& blockTable,
+            const std::vector<uint8_t>& priorities, BlockId* outCells);
+
+    private:
+        struct Section
+        {
+            std::unique_ptr<Chunk> Grid;
+
+            // Distinct sources merged so far, out of the ones in the section's layers.
+            uint32_t SourceCount = 0;
+            uint32_t ExpectedSourceCount = 0;
+
+            uint32_t VertexCount = 0;
+            bool IsActive = false;
+
+            bool IsComplete() const { return Grid != nullptr && SourceCount >= ExpectedSourceCount; }
+        };
+
+        using SectionMap = std::unordered_map<ChunkCoord, Section, ChunkCoordHash>;
+
+        // What a level's mesher sees: shown sections that have all their sources. Anything else reads as air,
+        // which is what gives ring borders their skirt faces.
+        class LevelProvider : public ChunkProvider
+        {
+        public:
+            explicit LevelProvider(const SectionMap& sections) : m_Sections(sections) {}
+
+            const Chunk* FindChunk(const ChunkCoord& coord) const override;
+
+        private:
+            const SectionMap& m_Sections;
+        };
+
+        struct Level
+        {
+            Level() : Provider(Sections) {}
+
+            SectionMap Sections;
+            std::vector<ChunkCoord> Active;
+            LevelProvider Provider;
+            std::unique_ptr<ChunkMeshPipeline> Pipeline;
+            uint64_t VertexCount = 0;
+
+            // Sources handed to workers for this level; a later snapshot of one is an edit and leaves the counts alone.
+            std::unordered_set<ChunkCoord, ChunkCoordHash> KnownSources;
+        };
+
+        struct SourceSnapshot
+        {
+            ChunkCoord Coord;
+            PaletteStorage Blocks;
+        };
+
+        struct DownsampleBatch;
+
+        // Offset of a level's cells in a downsampled source, levels 1..LevelCount back to back.
+        static size_t GetCellOffset(uint32_t level);
+
+        // Squared horizontal distance from the focus column to the nearest and farthest column of a section.
+        int64_t GetNearestDistanceSquared(uint32_t level, int32_t sectionX, int32_t sectionZ) const;
+        int64_t GetFarthestDistanceSquared(uint32_t level, int32_t sectionX, int32_t sectionZ) const;
+
+        // Squared horizontal distance from the focus column to a section's centre, in half columns.
+        int64_t GetCentreDistanceSquared(uint32_t level, int32_t sectionX, int32_t sectionZ) const;
+
+        // Sources from the level's section layers that fall into the chunk layers being fed.
+        uint32_t GetExpectedSourceCount(uint32_t level, int32_t sectionY) const;
+
+        // Columns out to which a level keeps cells: its reach, plus the children of split coarser sections and
+        // some slack so moving back and forth does not refetch the edge.
+        int32_t GetKeepReach(uint32_t level) const;
+
+        // Whether a level keeps the section a source chunk falls into.
+        bool IsWanted(uint32_t level, const ChunkCoord& sourceCoord) const;
+
+        void StartDownsampling();
+        void MergeDownsampled();
+        void RebuildRings();
+        void CollectRing(uint32_t level, int32_t sectionX, int32_t sectionZ, std::vector<std::vector<ChunkCoord>>& outActive);
+        void PruneSections();
+        void RebuildMissing();
+
+        // Queue a section for meshing if it is shown and has all its sources.
+        void RequestSectionMesh(uint32_t level, const ChunkCoord& sectionCoord);
+        void RequestNeighbourMeshes(uint32_t level, const ChunkCoord& sectionCoord);
+
+    private:
+        JobSystem& m_JobSystem;
+        const MeshingBlockTable& m_BlockTable;
+        TerrainLodSettings m_Settings;
+
+        UploadCallback m_Upload;
+        RemoveCallback m_Remove;
+
+        // Index k - 1 holds level k.
+        std::vector<std::unique_ptr<Level>> m_Levels;
+
+        glm::vec3 m_FocusPosition{ 0.0f };
+        ChunkCoord m_FocusColumn;
+        bool m_HasFocus = false;
+        std::unordered_set<ChunkCoord, ChunkCoordHash> m_DetailColumns;
+
+        // Snapshots waiting for a worker, in arrival order, and where each source sits in the queue.
+        std::vector<SourceSnapshot> m_Queue;
+        std::unordered_map<ChunkCoord, size_t, ChunkCoordHash> m_QueueIndex;
+        std::shared_ptr<DownsampleBatch> m_Batch;
+
+        // Sources shown sections lack, nearest first; entries before the head have been handed out.
+        std::vector<ChunkCoord> m_Missing;
+        size_t m_MissingHead = 0;
+        std::unordered_set<ChunkCoord, ChunkCoordHash> m_Requested;
+
+        TerrainLodStats m_FrameStats;
+        TerrainLodStats m_LastFrameStats;
+    };
+}
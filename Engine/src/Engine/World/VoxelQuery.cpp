@@ -0,0 +1,283 @@
+#include "Engine/World/VoxelQuery.h"
+
+#include "Engine/Core/Profiler.h"
+#include "Engine/Jobs/JobSystem.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Engine
+{
+    namespace
+    {
+        // Queries per job; a job costs about as much to schedule as a few short rays.
+        constexpr uint32_t s_QueriesPerJob = 64;
+
+        // Slack when deciding which blocks a box face touches, so a box resting exactly on a boundary (give or
+        // take float rounding) does not count the blocks on the far side of it.
+        constexpr float s_Skin = 1.0e-3f;
+
+        // Face a ray enters through when it steps along an axis in the positive and negative direction.
+        constexpr BlockFace s_EnteredFaces[3][2] =
+        {
+            { BlockFace::NegativeX, BlockFace::PositiveX },
+            { BlockFace::NegativeY, BlockFace::PositiveY },
+            { BlockFace::NegativeZ, BlockFace::PositiveZ }
+        };
+
+        int32_t FloorToBlock(float value)
+        {
+            return static_cast<int32_t>(std::floor(value));
+        }
+    }
+
+    BlockCursor::BlockCursor(const ChunkProvider& provider, BlockId missingBlock) : m_Provider(provider), m_MissingBlock(missingBlock)
+    {
+
+    }
+
+    void BlockCursor::Load(Slot& slot, const ChunkCoord& coord)
+    {
+        ++m_LookupCount;
+
+        const Chunk* l_Chunk = m_Provider.FindChunk(coord);
+        slot.Coord = coord;
+        if (l_Chunk == nullptr)
+        {
+            slot.Storage = nullptr;
+            slot.UniformBlock = m_MissingBlock;
+
+            return;
+        }
+
+        const PaletteStorage& l_Storage = l_Chunk->GetStorage();
+        slot.Storage = l_Storage.IsUniform() ? nullptr : &l_Storage;
+        slot.UniformBlock = l_Storage.Get(0);
+    }
+
+    VoxelQuery::VoxelQuery(const ChunkProvider& provider, const BlockRegistry& registry) : m_Provider(provider),
+        m_Flags(registry.GetMeshingTable().BlockFlags.data()), m_BlockCount(registry.GetBlockCount())
+    {
+
+    }
+
+    VoxelRayHit VoxelQuery::Raycast(const VoxelRay& ray, uint8_t hitFlags) const
+    {
+        BlockCursor l_Cursor(m_Provider);
+
+        return Raycast(ray, l_Cursor, hitFlags);
+    }
+
+    VoxelRayHit VoxelQuery::Raycast(const VoxelRay& ray, BlockCursor& cursor, uint8_t hitFlags) const
+    {
+        VoxelRayHit l_Hit;
+
+        const float l_Length = glm::length(ray.Direction);
+        if (!(l_Length > 0.0f))
+        {
+            return l_Hit;
+        }
+
+        // Per axis: the block the ray is in, which way it steps, the distance at which it next crosses a
+        // boundary, and the distance between two crossings.
+        int32_t l_Cell[3];
+        int32_t l_Step[3];
+        float l_Next[3];
+        float l_Delta[3];
+        for (int32_t l_Axis = 0; l_Axis < 3; ++l_Axis)
+        {
+            const float l_Origin = ray.Origin[l_Axis];
+            const float l_Direction = ray.Direction[l_Axis] / l_Length;
+            l_Cell[l_Axis] = FloorToBlock(l_Origin);
+
+            if (l_Direction > 0.0f)
+            {
+                l_Step[l_Axis] = 1;
+                l_Delta[l_Axis] = 1.0f / l_Direction;
+                l_Next[l_Axis] = (static_cast<float>(l_Cell[l_Axis]) + 1.0f - l_Origin) * l_Delta[l_Axis];
+            }
+            else if (l_Direction < 0.0f)
+            {
+                l_Step[l_Axis] = -1;
+                l_Delta[l_Axis] = -1.0f / l_Direction;
+                l_Next[l_Axis] = (l_Origin - static_cast<float>(l_Cell[l_Axis])) * l_Delta[l_Axis];
+            }
+            else
+            {
+                l_Step[l_Axis] = 0;
+                l_Delta[l_Axis] = std::numeric_limits<float>::infinity();
+                l_Next[l_Axis] = std::numeric_limits<float>::infinity();
+            }
+        }
+
+        BlockFace l_Face = BlockFace::Count;
+        float l_Distance = 0.0f;
+        while (true)
+        {
+            ++l_Hit.StepCount;
+
+            const BlockId l_Block = cursor.GetBlock(l_Cell[0], l_Cell[1], l_Cell[2]);
+            if ((GetFlags(l_Block) & hitFlags) != 0)
+            {
+                l_Hit.IsHit = true;
+                l_Hit.Position = glm::ivec3(l_Cell[0], l_Cell[1], l_Cell[2]);
+                l_Hit.Block = l_Block;
+                l_Hit.Face = l_Face;
+                l_Hit.Distance = l_Distance;
+
+                return l_Hit;
+            }
+
+            const int32_t l_Axis = l_Next[0] < l_Next[1] ? (l_Next[0] < l_Next[2] ? 0 : 2) : (l_Next[1] < l_Next[2] ? 1 : 2);
+            l_Distance = l_Next[l_Axis];
+            if (l_Distance > ray.MaxDistance)
+            {
+                return l_Hit;
+            }
+
+            l_Cell[l_Axis] += l_Step[l_Axis];
+            l_Next[l_Axis] += l_Delta[l_Axis];
+            l_Face = s_EnteredFaces[l_Axis][l_Step[l_Axis] > 0 ? 0 : 1];
+        }
+    }
+
+    VoxelSweepResult VoxelQuery::SweepBox(const VoxelSweep& sweep) const
+    {
+        BlockCursor l_Cursor = CreateCollisionCursor();
+
+        return SweepBox(sweep, l_Cursor);
+    }
+
+    VoxelSweepResult VoxelQuery::SweepBox(const VoxelSweep& sweep, BlockCursor& cursor) const
+    {
+        VoxelSweepResult l_Result;
+        VoxelBox l_Box = sweep.Box;
+
+        for (const int32_t l_Axis : { 1, 0, 2 })
+        {
+            float l_Motion = sweep.Motion[l_Axis];
+            if (l_Motion > 0.0f)
+            {
+                // Layers of blocks the leading face crosses, nearest first; the first solid one stops the box
+                // against its near side.
+                const int32_t l_First = FloorToBlock(l_Box.Max[l_Axis] - s_Skin) + 1;
+                const int32_t l_Last = FloorToBlock(l_Box.Max[l_Axis] + l_Motion - s_Skin);
+                for (int32_t l_Layer = l_First; l_Layer <= l_Last; ++l_Layer)
+                {
+                    if (IsLayerBlocked(cursor, static_cast<uint32_t>(l_Axis), l_Layer, l_Box))
+                    {
+                        l_Motion = std::max(static_cast<float>(l_Layer) - l_Box.Max[l_Axis], 0.0f);
+                        l_Result.BlockedAxes |= static_cast<uint8_t>(1u << l_Axis);
+                        break;
+                    }
+                }
+            }
+            else if (l_Motion < 0.0f)
+            {
+                const int32_t l_First = FloorToBlock(l_Box.Min[l_Axis] + s_Skin) - 1;
+                const int32_t l_Last = FloorToBlock(l_Box.Min[l_Axis] + l_Motion + s_Skin);
+                for (int32_t l_Layer = l_First; l_Layer >= l_Last; --l_Layer)
+                {
+                    if (IsLayerBlocked(cursor, static_cast<uint32_t>(l_Axis), l_Layer, l_Box))
+                    {
+                        l_Motion = std::min(static_cast<float>(l_Layer + 1) - l_Box.Min[l_Axis], 0.0f);
+                        l_Result.BlockedAxes |= static_cast<uint8_t>(1u << l_Axis);
+                        l_Result.IsOnGround = l_Result.IsOnGround || l_Axis == 1;
+                        break;
+                    }
+                }
+            }
+
+            l_Box.Min[l_Axis] += l_Motion;
+            l_Box.Max[l_Axis] += l_Motion;
+            l_Result.Motion[l_Axis] = l_Motion;
+        }
+
+        return l_Result;
+    }
+
+    bool VoxelQuery::IsLayerBlocked(BlockCursor& cursor, uint32_t axis, int32_t layer, const VoxelBox& box) const
+    {
+        const int32_t l_U = static_cast<int32_t>((axis + 1) % 3);
+        const int32_t l_V = static_cast<int32_t>((axis + 2) % 3);
+        const int32_t l_MinU = FloorToBlock(box.Min[l_U] + s_Skin);
+        const int32_t l_MaxU = FloorToBlock(box.Max[l_U] - s_Skin);
+        const int32_t l_MinV = FloorToBlock(box.Min[l_V] + s_Skin);
+        const int32_t l_MaxV = FloorToBlock(box.Max[l_V] - s_Skin);
+
+        int32_t l_Position[3];
+        l_Position[axis] = layer;
+        for (int32_t v = l_MinV; v <= l_MaxV; ++v)
+        {
+            l_Position[l_V] = v;
+            for (int32_t u = l_MinU; u <= l_MaxU; ++u)
+            {
+                l_Position[l_U] = u;
+                if ((GetFlags(cursor.GetBlock(l_Position[0], l_Position[1], l_Position[2])) & BlockRegistry::FlagSolid) != 0)
+                {
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+    void VoxelQuery::RaycastBatch(JobSystem& jobSystem, const std::vector<VoxelRay>& rays, std::vector<VoxelRayHit>& outHits, uint8_t hitFlags) const
+    {
+        ENGINE_PROFILE_SCOPE("VoxelQuery::RaycastBatch");
+
+        outHits.resize(rays.size());
+
+        const auto a_Run = [this, &rays, &outHits, hitFlags](uint32_t begin, uint32_t end)
+            {
+                BlockCursor l_Cursor(m_Provider);
+                for (uint32_t i = begin; i < end; ++i)
+                {
+                    outHits[i] = Raycast(rays[i], l_Cursor, hitFlags);
+                }
+            };
+
+        // A single job's worth is cheaper to run here than to schedule.
+        const uint32_t l_Count = static_cast<uint32_t>(rays.size());
+        if (l_Count <= s_QueriesPerJob)
+        {
+            a_Run(0, l_Count);
+
+            return;
+        }
+
+        JobCounter l_Counter;
+        jobSystem.ParallelFor(l_Count, s_QueriesPerJob, a_Run, &l_Counter);
+        jobSystem.WaitForCounter(l_Counter);
+    }
+
+    void VoxelQuery::SweepBatch(JobSystem& jobSystem, const std::vector<VoxelSweep>& sweeps, std::vector<VoxelSweepResult>& outResults) const
+    {
+        ENGINE_PROFILE_SCOPE("VoxelQuery::SweepBatch");
+
+        outResults.resize(sweeps.size());
+
+        const auto a_Run = [this, &sweeps, &outResults](uint32_t begin, uint32_t end)
+            {
+                BlockCursor l_Cursor = CreateCollisionCursor();
+                for (uint32_t i = begin; i < end; ++i)
+                {
+                    outResults[i] = SweepBox(sweeps[i], l_Cursor);
+                }
+            };
+
+        const uint32_t l_Count = static_cast<uint32_t>(sweeps.size());
+        if (l_Count <= s_QueriesPerJob)
+        {
+            a_Run(0, l_Count);
+
+            return;
+        }
+
+        JobCounter l_Counter;
+        jobSystem.ParallelFor(l_Count, s_QueriesPerJob, a_Run, &l_Counter);
+        jobSystem.WaitForCounter(l_Counter);
+    }
+}
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/World/BlockRegistry.h"
+#include "Engine/World/Chunk.h"
+#include "Engine/World/ChunkMesher.h"
+#include "Engine/World/ChunkProvider.h"
+
+#include <glm/glm.hpp>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace Engine
+{
+    class JobSystem;
+
+    // Block reads for queries that walk from block to block. Keeps the last chunk seen in each of eight slots,
+    // picked by the parity of the chunk coordinate, so a path or a box spanning up to two chunks per axis pays
+    // one provider lookup per chunk it enters instead of one per block. Uniform chunks answer without touching
+    // their palette. Not thread-safe; give each worker its own cursor.
+    class ENGINE_API BlockCursor
+    {
+    public:
+        // Blocks of chunks the provider does not have read as missingBlock.
+        explicit BlockCursor(const ChunkProvider& provider, BlockId missingBlock = AirBlockId);
+
+        BlockId GetBlock(int32_t worldX, int32_t worldY, int32_t worldZ)
+        {
+            const ChunkCoord l_Coord{ WorldToChunk(worldX), WorldToChunk(worldY), WorldToChunk(worldZ) };
+            Slot& l_Slot = m_Slots[(l_Coord.X & 1) | ((l_Coord.Y & 1) << 1) | ((l_Coord.Z & 1) << 2)];
+            if (!(l_Slot.Coord == l_Coord))
+            {
+                Load(l_Slot, l_Coord);
+            }
+
+            if (l_Slot.Storage == nullptr)
+            {
+                return l_Slot.UniformBlock;
+            }
+
+            return l_Slot.Storage->Get(Chunk::GetIndex(WorldToLocal(worldX), WorldToLocal(worldY), WorldToLocal(worldZ)));
+        }
+
+        // Provider lookups so far; each one is a chunk entered that no slot held.
+        uint32_t GetLookupCount() const { return m_LookupCount; }
+
+    private:
+        struct Slot
+        {
+            // Never a reachable chunk coordinate, so a fresh slot always misses.
+            ChunkCoord Coord{ INT32_MIN, INT32_MIN, INT32_MIN };
+
+            // Null for missing and uniform chunks, which read as UniformBlock.
+            const PaletteStorage* Storage = nullptr;
+            BlockId UniformBlock = AirBlockId;
+        };
+
+        void Load(Slot& slot, const ChunkCoord& coord);
+
+    private:
+        const ChunkProvider& m_Provider;
+        BlockId m_MissingBlock;
+        std::array<Slot, 8> m_Slots;
+        uint32_t m_LookupCount = 0;
+    };
+
+    struct VoxelRay
+    {
+        glm::vec3 Origin{ 0.0f };
+
+        // Need not be normalized; distances are measured along the normalized direction.
+        glm::vec3 Direction{ 0.0f, 0.0f, 1.0f };
+        float MaxDistance = 8.0f;
+    };
+
+    struct VoxelRayHit
+    {
+        bool IsHit = false;
+
+        // World coordinate and id of the block hit.
+        glm::ivec3 Position{ 0 };
+        BlockId Block = AirBlockId;
+
+        // Face of the hit block the ray entered through, or BlockFace::Count when the origin is inside it.
+        // Placing against the hit goes to Position plus that face's normal.
+        BlockFace Face = BlockFace::Count;
+
+        // Distance from the origin to the entry point.
+        float Distance = 0.0f;
+
+        // Blocks visited, the hit included.
+        uint32_t StepCount = 0;
+    };
+
+    // Axis-aligned box in world units; blocks occupy [x, x + 1) on each axis.
+    struct VoxelBox
+    {
+        glm::vec3 Min{ 0.0f };
+        glm::vec3 Max{ 0.0f };
+    };
+
+    struct VoxelSweep
+    {
+        VoxelBox Box;
+        glm::vec3 Motion{ 0.0f };
+    };
+
+    struct VoxelSweepResult
+    {
+        // The part of the motion that can be applied; the box ends at Box + Motion.
+        glm::vec3 Motion{ 0.0f };
+
+        // Bit per axis (x = 1, y = 2, z = 4) whose motion a block cut short.
+        uint8_t BlockedAxes = 0;
+
+        // Downward motion was stopped by a block.
+        bool IsOnGround = false;
+
+        bool IsBlocked(uint32_t axis) const { return (BlockedAxes >> axis & 1) != 0; }
+    };
+
+    // Picking and collision against the blocks of a chunk provider. Both read chunk storage through a
+    // BlockCursor and use the registry's flag table directly, so the inner loops never hash a coordinate or
+    // look up a block by name.
+    //
+    // Raycast is the Amanatides-Woo traversal: it steps to whichever block boundary along the ray is nearest,
+    // so every block the ray touches is visited once, in order, with no sampling gaps. SweepBox moves a box
+    // one axis at a time (y first, so walking off a ledge still lands on it) and stops each axis at the first
+    // layer of blocks in its way; boxes resting exactly against a block neither stick nor sink into it.
+    //
+    // Queries only read. Any thread may run them, as long as nothing changes the provider's chunks meanwhile;
+    // the batch calls rely on that to spread work over the job system.
+    class ENGINE_API VoxelQuery
+    {
+    public:
+        // Both must outlive the query.
+        VoxelQuery(const ChunkProvider& provider, const BlockRegistry& registry);
+
+        // First block along the ray whose registry flags share a bit with hitFlags. Rays pass through chunks the
+        // provider does not have.
+        VoxelRayHit Raycast(const VoxelRay& ray, uint8_t hitFlags = BlockRegistry::FlagSolid) const;
+        VoxelRayHit Raycast(const VoxelRay& ray, BlockCursor& cursor, uint8_t hitFlags = BlockRegistry::FlagSolid) const;
+
+        // How far the box can move towards Motion through non-solid blocks. Chunks the provider does not have
+        // count as solid, so nothing falls out of the loaded world.
+        VoxelSweepResult SweepBox(const VoxelSweep& sweep) const;
+        VoxelSweepResult SweepBox(const VoxelSweep& sweep, BlockCursor& cursor) const;
+
+        // Run many queries across the job system's workers and this thread; returns once all are done.
+        // Each batch of queries shares a cursor, so nearby queries also share chunk lookups.
+        void RaycastBatch(JobSystem& jobSystem, const std::vector<VoxelRay>& rays, std::vector<VoxelRayHit>& outHits,
+            uint8_t hitFlags = BlockRegistry::FlagSolid) const;
+        void SweepBatch(JobSystem& jobSystem, const std::vector<VoxelSweep>& sweeps, std::vector<VoxelSweepResult>& outResults) const;
+
+        // A cursor that reads missing chunks the way SweepBox needs them read.
+        BlockCursor CreateCollisionCursor() const { return BlockCursor(m_Provider, BlockRegistry::InvalidBlockId); }
+
+    private:
+        // Flags as queries see them: ids outside the registry are visible, opaque and solid.
+        uint8_t GetFlags(BlockId block) const
+        {
+            return block < m_BlockCount ? m_Flags[block] : uint8_t(BlockRegistry::FlagVisible | BlockRegistry::FlagOpaque | BlockRegistry::FlagSolid);
+        }
+
+        // Whether any solid block lies in the layer at the given coordinate of an axis, within the box's extent
+        // along the other two axes.
+        bool IsLayerBlocked(BlockCursor& cursor, uint32_t axis, int32_t layer, const VoxelBox& box) const;
+
+    private:
+        const ChunkProvider& m_Provider;
+        const uint8_t* m_Flags = nullptr;
+        uint32_t m_BlockCount = 0;
+    };
+}
@@ -0,0 +1,53 @@
+#include "Engine/World/World.h"
+
+namespace Engine
+{
+    const Chunk* World::FindChunk(const ChunkCoord& coord) const
+    {
+        return m_Chunks.Find(coord);
+    }
+
+    Chunk* World::FindChunk(const ChunkCoord& coord)
+    {
+        return m_Chunks.Find(coord);
+    }
+
+    Chunk& World::InsertChunk(std::unique_ptr<Chunk> chunk)
+    {
+        return m_Chunks.Insert(std::move(chunk));
+    }
+
+    bool World::RemoveChunk(const ChunkCoord& coord)
+    {
+        return m_Chunks.Erase(coord);
+    }
+
+    std::unique_ptr<Chunk> World::TakeChunk(const ChunkCoord& coord)
+    {
+        return m_Chunks.Extract(coord);
+    }
+
+    BlockId World::GetBlock(int32_t worldX, int32_t worldY, int32_t worldZ) const
+    {
+        const Chunk* l_Chunk = FindChunk({ WorldToChunk(worldX), WorldToChunk(worldY), WorldToChunk(worldZ) });
+        if (l_Chunk == nullptr)
+        {
+            return AirBlockId;
+        }
+
+        return l_Chunk->GetBlock(WorldToLocal(worldX), WorldToLocal(worldY), WorldToLocal(worldZ));
+    }
+
+    bool World::SetBlock(int32_t worldX, int32_t worldY, int32_t worldZ, BlockId block)
+    {
+        Chunk* l_Chunk = FindChunk({ WorldToChunk(worldX), WorldToChunk(worldY), WorldToChunk(worldZ) });
+        if (l_Chunk == nullptr)
+        {
+            return false;
+        }
+
+        l_Chunk->SetBlock(WorldToLocal(worldX), WorldToLocal(worldY), WorldToLocal(worldZ), block);
+
+        return true;
+    }
+}
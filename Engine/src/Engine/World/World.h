@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/World/Chunk.h"
+#include "Engine/World/ChunkMap.h"
+#include "Engine/World/ChunkProvider.h"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace Engine
+{
+    // Owns the loaded chunks. Main thread only; workers receive snapshots or finished chunks instead.
+    class ENGINE_API World : public ChunkProvider
+    {
+    public:
+        const Chunk* FindChunk(const ChunkCoord& coord) const override;
+        Chunk* FindChunk(const ChunkCoord& coord);
+
+        // Takes ownership, replacing any chunk already stored at the same coordinate.
+        Chunk& InsertChunk(std::unique_ptr<Chunk> chunk);
+        bool RemoveChunk(const ChunkCoord& coord);
+
+        // Removes the chunk and hands it to the caller; null when it is not loaded.
+        std::unique_ptr<Chunk> TakeChunk(const ChunkCoord& coord);
+
+        bool IsLoaded(const ChunkCoord& coord) const { return m_Chunks.Find(coord) != nullptr; }
+        size_t GetChunkCount() const { return m_Chunks.GetSize(); }
+
+        // The 3x3x3 chunks around coord in PaddedChunkView::Build order; unloaded ones are null.
+        void GetNeighbourhood(const ChunkCoord& coord, std::array<const Chunk*, 27>& outNeighbours) const { m_Chunks.GetNeighbourhood(coord, outNeighbours); }
+
+        // Visits every loaded chunk; the world must not gain or lose chunks during the walk.
+        template<typename F>
+        void ForEachChunk(F&& function) const { m_Chunks.ForEach(std::forward<F>(function)); }
+
+        // World block access; unloaded chunks read as air and reject writes.
+        BlockId GetBlock(int32_t worldX, int32_t worldY, int32_t worldZ) const;
+        bool SetBlock(int32_t worldX, int32_t worldY, int32_t worldZ, BlockId block);
+
+    private:
+        ChunkMap m_Chunks;
+    };
+}
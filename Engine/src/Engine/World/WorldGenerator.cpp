@@ -0,0 +1,505 @@
+#include "Engine/World/WorldGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Engine
+{
+    namespace
+    {
+        // Salts keep the independent noise fields and hashes derived from one seed uncorrelated.
+        constexpr uint32_t s_MountainMaskSalt = 0x2545F491u;
+        constexpr uint32_t s_MountainSalt = 0x9E3779B9u;
+        constexpr uint32_t s_TemperatureSalt = 0x7F4A7C15u;
+        constexpr uint32_t s_HumiditySalt = 0xBF58476Du;
+        constexpr uint32_t s_CaveSalt = 0x94D049BBu;
+        constexpr uint32_t s_TreeSalt = 0xD6E8FEB8u;
+
+        // Cave noise is sampled every CaveCellSize blocks and interpolated in between.
+        constexpr int32_t s_CaveCellSize = 4;
+        constexpr int32_t s_CaveSampleCount = Chunk::Size / s_CaveCellSize + 1;
+
+        int32_t SaltSeed(int32_t seed, uint32_t salt)
+        {
+            return static_cast<int32_t>(static_cast<uint32_t>(seed) ^ salt);
+        }
+
+        uint32_t HashPosition(int32_t seed, int32_t x, int32_t z, uint32_t salt)
+        {
+            uint32_t l_Hash = static_cast<uint32_t>(seed) * 0x9E3779B1u;
+            l_Hash ^= static_cast<uint32_t>(x) * 0x85EBCA77u;
+            l_Hash ^= static_cast<uint32_t>(z) * 0xC2B2AE3Du;
+            l_Hash ^= salt;
+            l_Hash ^= l_Hash >> 15;
+            l_Hash *= 0x2C1B3C6Du;
+            l_Hash ^= l_Hash >> 12;
+            l_Hash *= 0x297A2D39u;
+            l_Hash ^= l_Hash >> 15;
+
+            return l_Hash;
+        }
+
+        NoiseSettings MakeNoiseSettings(NoiseType type, FractalType fractal, int32_t seed, float frequency, uint32_t octaves)
+        {
+            NoiseSettings l_Settings;
+            l_Settings.Type = type;
+            l_Settings.Fractal = fractal;
+            l_Settings.Seed = seed;
+            l_Settings.Frequency = frequency;
+            l_Settings.Octaves = octaves;
+
+            return l_Settings;
+        }
+    }
+
+    WorldGenerator::WorldGenerator(const WorldGeneratorSettings& settings) : m_Settings(settings),
+        m_ContinentNoise(MakeNoiseSettings(NoiseType::Simplex, FractalType::FBm, settings.Seed, 0.003f, 5)),
+        m_MountainNoise(MakeNoiseSettings(NoiseType::Simplex, FractalType::Ridged, SaltSeed(settings.Seed, s_MountainSalt), 0.006f, 4)),
+        m_MountainMaskNoise(MakeNoiseSettings(NoiseType::Simplex, FractalType::FBm, SaltSeed(settings.Seed, s_MountainMaskSalt), 0.0015f, 3)),
+        m_TemperatureNoise(MakeNoiseSettings(NoiseType::Simplex, FractalType::FBm, SaltSeed(settings.Seed, s_TemperatureSalt), 0.0015f, 2)),
+        m_HumidityNoise(MakeNoiseSettings(NoiseType::Simplex, FractalType::FBm, SaltSeed(settings.Seed, s_HumiditySalt), 0.0018f, 2)),
+        m_CaveNoise(MakeNoiseSettings(NoiseType::Perlin, FractalType::FBm, SaltSeed(settings.Seed, s_CaveSalt), 0.03f, 2))
+    {
+
+    }
+
+    void WorldGenerator::GenerateColumn(int32_t columnX, int32_t columnZ, WorldColumn& outColumn) const
+    {
+        outColumn.X = columnX;
+        outColumn.Z = columnZ;
+        outColumn.Trees.clear();
+
+        const int32_t l_BaseX = columnX * Chunk::Size;
+        const int32_t l_BaseZ = columnZ * Chunk::Size;
+
+        std::array<float, WorldColumn::Area> l_Continent;
+        std::array<float, WorldColumn::Area> l_Mountain;
+        std::array<float, WorldColumn::Area> l_MountainMask;
+        std::array<float, WorldColumn::Area> l_Temperature;
+        std::array<float, WorldColumn::Area> l_Humidity;
+        m_ContinentNoise.GenerateGrid2D(l_Continent.data(), l_BaseX, l_BaseZ, Chunk::Size, Chunk::Size);
+        m_MountainNoise.GenerateGrid2D(l_Mountain.data(), l_BaseX, l_BaseZ, Chunk::Size, Chunk::Size);
+        m_MountainMaskNoise.GenerateGrid2D(l_MountainMask.data(), l_BaseX, l_BaseZ, Chunk::Size, Chunk::Size);
+        m_TemperatureNoise.GenerateGrid2D(l_Temperature.data(), l_BaseX, l_BaseZ, Chunk::Size, Chunk::Size);
+        m_HumidityNoise.GenerateGrid2D(l_Humidity.data(), l_BaseX, l_BaseZ, Chunk::Size, Chunk::Size);
+
+        int32_t l_MinHeight = INT32_MAX;
+        int32_t l_MaxHeight = INT32_MIN;
+        for (uint32_t i = 0; i < WorldColumn::Area; ++i)
+        {
+            // Mountains only rise where the low-frequency mask allows, blending smoothly into the hills.
+            const float l_MountainWeight = std::clamp((l_MountainMask[i] - 0.1f) * 2.5f, 0.0f, 1.0f);
+            const float l_Ridge = (l_Mountain[i] + 1.0f) * 0.5f;
+            const float l_Height = static_cast<float>(m_Settings.BaseHeight) + l_Continent[i] * m_Settings.HillAmplitude
+                + l_MountainWeight * l_Ridge * m_Settings.MountainAmplitude;
+            const int32_t l_Top = static_cast<int32_t>(std::floor(l_Height));
+
+            Biome l_Biome = Biome::Plains;
+            if (l_Top < m_Settings.SeaLevel - 1)
+            {
+                l_Biome = Biome::Ocean;
+            }
+            else if (l_Top <= m_Settings.SeaLevel + 1)
+            {
+                l_Biome = Biome::Beach;
+            }
+            else if (l_MountainWeight > 0.6f && l_Top > m_Settings.SeaLevel + 30)
+            {
+                l_Biome = Biome::Mountains;
+            }
+            else if (l_Temperature[i] > 0.3f && l_Humidity[i] < 0.0f)
+            {
+                l_Biome = Biome::Desert;
+            }
+            else if (l_Humidity[i] > 0.05f)
+            {
+                l_Biome = Biome::Forest;
+            }
+
+            outColumn.Heights[i] = static_cast<int16_t>(l_Top);
+            outColumn.Biomes[i] = l_Biome;
+            l_MinHeight = std::min(l_MinHeight, l_Top);
+            l_MaxHeight = std::max(l_MaxHeight, l_Top);
+        }
+
+        outColumn.MinHeight = l_MinHeight;
+        outColumn.MaxHeight = l_MaxHeight;
+
+        if (!m_Settings.EnableStructures)
+        {
+            return;
+        }
+
+        for (int32_t z = 0; z < Chunk::Size; ++z)
+        {
+            for (int32_t x = 0; x < Chunk::Size; ++x)
+            {
+                const Biome l_Biome = outColumn.GetBiome(x, z);
+                if (l_Biome != Biome::Forest && l_Biome != Biome::Plains)
+                {
+                    continue;
+                }
+
+                const uint32_t l_Hash = HashPosition(m_Settings.Seed, l_BaseX + x, l_BaseZ + z, s_TreeSalt);
+                const uint32_t l_Density = l_Biome == Biome::Forest ? 40 : 320;
+                if (l_Hash % l_Density != 0)
+                {
+                    continue;
+                }
+
+                TreePlacement l_Tree;
+                l_Tree.WorldX = l_BaseX + x;
+                l_Tree.BaseY = outColumn.GetHeight(x, z);
+                l_Tree.WorldZ = l_BaseZ + z;
+                l_Tree.TrunkHeight = 4 + static_cast<int32_t>((l_Hash >> 16) % 3);
+                outColumn.Trees.push_back(l_Tree);
+            }
+        }
+    }
+
+    void WorldGenerator::GenerateTerrain(const ChunkCoord& coord, const WorldColumn& column, BlockId* outBlocks) const
+    {
+        const WorldGenBlockIds& l_Blocks = m_Settings.Blocks;
+        const int32_t l_BaseY = coord.Y * Chunk::Size;
+
+        // Whole-chunk shortcuts for open sky and deep rock, which are most of the world.
+        if (l_BaseY > column.MaxHeight && l_BaseY > m_Settings.SeaLevel)
+        {
+            std::fill(outBlocks, outBlocks + Chunk::Volume, AirBlockId);
+
+            return;
+        }
+
+        if (l_BaseY + Chunk::Size - 1 <= column.MinHeight)
+        {
+            std::fill(outBlocks, outBlocks + Chunk::Volume, l_Blocks.Stone);
+        }
+        else
+        {
+            for (int32_t y = 0; y < Chunk::Size; ++y)
+            {
+                const int32_t l_WorldY = l_BaseY + y;
+                const BlockId l_Fluid = l_WorldY <= m_Settings.SeaLevel ? l_Blocks.Water : AirBlockId;
+                for (int32_t z = 0; z < Chunk::Size; ++z)
+                {
+                    BlockId* l_Row = outBlocks + Chunk::GetIndex(0, y, z);
+                    for (int32_t x = 0; x < Chunk::Size; ++x)
+                    {
+                        l_Row[x] = l_WorldY <= column.GetHeight(x, z) ? l_Blocks.Stone : l_Fluid;
+                    }
+                }
+            }
+        }
+
+        if (m_Settings.EnableCaves)
+        {
+            CarveCaves(coord, column, outBlocks);
+        }
+    }
+
+    void WorldGenerator::CarveCaves(const ChunkCoord& coord, const WorldColumn& column, BlockId* blocks) const
+    {
+        const int32_t l_BaseY = coord.Y * Chunk::Size;
+        if (l_BaseY > column.MaxHeight - m_Settings.CaveSurfaceMargin)
+        {
+            return;
+        }
+
+        // Sample on a coarse lattice and interpolate; caves are smooth, so full-resolution noise would be wasted.
+        std::array<float, s_CaveSampleCount * s_CaveSampleCount * s_CaveSampleCount> l_Samples;
+        m_CaveNoise.GenerateGrid3D(l_Samples.data(), coord.X * Chunk::Size, l_BaseY, coord.Z * Chunk::Size,
+            s_CaveSampleCount, s_CaveSampleCount, s_CaveSampleCount, s_CaveCellSize);
+
+        const auto a_Sample = [&l_Samples](int32_t x, int32_t y, int32_t z)
+        {
+            return l_Samples[static_cast<size_t>((y * s_CaveSampleCount + z) * s_CaveSampleCount + x)];
+        };
+
+        constexpr float l_CellScale = 1.0f / s_CaveCellSize;
+        for (int32_t y = 0; y < Chunk::Size; ++y)
+        {
+            const int32_t l_WorldY = l_BaseY + y;
+            const int32_t l_CellY = y / s_CaveCellSize;
+            const float l_Ty = static_cast<float>(y % s_CaveCellSize) * l_CellScale;
+            for (int32_t z = 0; z < Chunk::Size; ++z)
+            {
+                const int32_t l_CellZ = z / s_CaveCellSize;
+                const float l_Tz = static_cast<float>(z % s_CaveCellSize) * l_CellScale;
+                for (int32_t x = 0; x < Chunk::Size; ++x)
+                {
+                    if (l_WorldY > column.GetHeight(x, z) - m_Settings.CaveSurfaceMargin)
+                    {
+                        continue;
+                    }
+
+                    const int32_t l_CellX = x / s_CaveCellSize;
+                    const float l_Tx = static_cast<float>(x % s_CaveCellSize) * l_CellScale;
+
+                    const float l_C00 = a_Sample(l_CellX, l_CellY, l_CellZ) + l_Tx * (a_Sample(l_CellX + 1, l_CellY, l_CellZ) - a_Sample(l_CellX, l_CellY, l_CellZ));
+                    const float l_C10 = a_Sample(l_CellX, l_CellY + 1, l_CellZ) + l_Tx * (a_Sample(l_CellX + 1, l_CellY + 1, l_CellZ) - a_Sample(l_CellX, l_CellY + 1, l_CellZ));
+                    const float l_C01 = a_Sample(l_CellX, l_CellY, l_CellZ + 1) + l_Tx * (a_Sample(l_CellX + 1, l_CellY, l_CellZ + 1) - a_Sample(l_CellX, l_CellY, l_CellZ + 1));
+                    const float l_C11 = a_Sample(l_CellX, l_CellY + 1, l_CellZ + 1) + l_Tx * (a_Sample(l_CellX + 1, l_CellY + 1, l_CellZ + 1) - a_Sample(l_CellX, l_CellY + 1, l_CellZ + 1));
+                    const float l_C0 = l_C00 + l_Ty * (l_C10 - l_C00);
+                    const float l_C1 = l_C01 + l_Ty * (l_C11 - l_C01);
+                    const float l_Density = l_C0 + l_Tz * (l_C1 - l_C0);
+
+                    if (l_Density > m_Settings.CaveThreshold)
+                    {
+                        blocks[Chunk::GetIndex(x, y, z)] = AirBlockId;
+                    }
+                }
+            }
+        }
+    }
+
+    void WorldGenerator::DecorateSurface(const ChunkCoord& coord, const WorldColumn& column, BlockId* blocks) const
+    {
+        const WorldGenBlockIds& l_Blocks = m_Settings.Blocks;
+        const int32_t l_BaseY = coord.Y * Chunk::Size;
+
+        // Only the top four blocks of each column change.
+        if (l_BaseY > column.MaxHeight || l_BaseY + Chunk::Size - 1 < column.MinHeight - 3)
+        {
+            return;
+        }
+
+        for (int32_t z = 0; z < Chunk::Size; ++z)
+        {
+            for (int32_t x = 0; x < Chunk::Size; ++x)
+            {
+                const int32_t l_Top = column.GetHeight(x, z);
+                const Biome l_Biome = column.GetBiome(x, z);
+                const int32_t l_FirstY = std::max(l_Top - 3, l_BaseY);
+                const int32_t l_LastY = std::min(l_Top, l_BaseY + Chunk::Size - 1);
+                for (int32_t l_WorldY = l_FirstY; l_WorldY <= l_LastY; ++l_WorldY)
+                {
+                    BlockId& l_Block = blocks[Chunk::GetIndex(x, l_WorldY - l_BaseY, z)];
+                    if (l_Block != l_Blocks.Stone)
+                    {
+                        continue;
+                    }
+
+                    const int32_t l_Depth = l_Top - l_WorldY;
+                    switch (l_Biome)
+                    {
+                        case Biome::Ocean:
+                        case Biome::Beach:
+                        case Biome::Desert:
+                            l_Block = l_Blocks.Sand;
+                            break;
+                        case Biome::Mountains:
+                            if (l_Depth == 0 && l_Top >= m_Settings.SnowLine)
+                            {
+                                l_Block = l_Blocks.Snow;
+                            }
+                            break;
+                        case Biome::Plains:
+                        case Biome::Forest:
+                            if (l_Depth > 0)
+                            {
+                                l_Block = l_Blocks.Dirt;
+                            }
+                            else
+                            {
+                                l_Block = l_Top >= m_Settings.SnowLine ? l_Blocks.Snow : l_Blocks.Grass;
+                            }
+                            break;
+                    }
+                }
+            }
+        }
+    }
+
+    void WorldGenerator::PlaceStructures(const ChunkCoord& coord, const std::array<const WorldColumn*, 9>& columns, BlockId* blocks) const
+    {
+        if (!m_Settings.EnableStructures)
+        {
+            return;
+        }
+
+        const WorldGenBlockIds& l_Blocks = m_Settings.Blocks;
+        const int32_t l_BaseX = coord.X * Chunk::Size;
+        const int32_t l_BaseY = coord.Y * Chunk::Size;
+        const int32_t l_BaseZ = coord.Z * Chunk::Size;
+
+        // Logs replace air and leaves, leaves only replace air. Both rules commute, so overlapping trees give
+        // the same result whichever is applied first.
+        const auto a_Place = [&](int32_t worldX, int32_t worldY, int32_t worldZ, BlockId block, bool replaceLeaves)
+        {
+            const int32_t l_X = worldX - l_BaseX;
+            const int32_t l_Y = worldY - l_BaseY;
+            const int32_t l_Z = worldZ - l_BaseZ;
+            if (l_X < 0 || l_X >= Chunk::Size || l_Y < 0 || l_Y >= Chunk::Size || l_Z < 0 || l_Z >= Chunk::Size)
+            {
+                return;
+            }
+
+            BlockId& l_Block = blocks[Chunk::GetIndex(l_X, l_Y, l_Z)];
+            if (l_Block == AirBlockId || (replaceLeaves && l_Block == l_Blocks.Leaves))
+            {
+                l_Block = block;
+            }
+        };
+
+        for (const WorldColumn* it_Column : columns)
+        {
+            if (it_Column == nullptr)
+            {
+                continue;
+            }
+
+            for (const TreePlacement& it_Tree : it_Column->Trees)
+            {
+                const int32_t l_Top = it_Tree.BaseY + it_Tree.TrunkHeight;
+                const bool l_Overlaps = it_Tree.WorldX + StructureReach >= l_BaseX && it_Tree.WorldX - StructureReach < l_BaseX + Chunk::Size
+                    && it_Tree.WorldZ + StructureReach >= l_BaseZ && it_Tree.WorldZ - StructureReach < l_BaseZ + Chunk::Size
+                    && l_Top + 1 >= l_BaseY && it_Tree.BaseY + 1 < l_BaseY + Chunk::Size;
+                if (!l_Overlaps)
+                {
+                    continue;
+                }
+
+                // Canopy: two wide layers below the trunk top, two narrow layers above, corners trimmed.
+                for (int32_t l_Y = l_Top - 2; l_Y <= l_Top + 1; ++l_Y)
+                {
+                    const int32_t l_Radius = l_Y < l_Top ? StructureReach : 1;
+                    for (int32_t l_Dz = -l_Radius; l_Dz <= l_Radius; ++l_Dz)
+                    {
+                        for (int32_t l_Dx = -l_Radius; l_Dx <= l_Radius; ++l_Dx)
+                        {
+                            if (std::abs(l_Dx) == l_Radius && std::abs(l_Dz) == l_Radius)
+                            {
+                                continue;
+                            }
+
+                            a_Place(it_Tree.WorldX + l_Dx, l_Y, it_Tree.WorldZ + l_Dz, l_Blocks.Leaves, false);
+                        }
+                    }
+                }
+
+                for (int32_t l_Y = it_Tree.BaseY + 1; l_Y <= l_Top; ++l_Y)
+                {
+                    a_Place(it_Tree.WorldX, l_Y, it_Tree.WorldZ, l_Blocks.Log, true);
+                }
+            }
+        }
+    }
+
+    std::unique_ptr<Chunk> WorldGenerator::GenerateChunk(const ChunkCoord& coord) const
+    {
+        std::array<WorldColumn, 9> l_Columns;
+        std::array<const WorldColumn*, 9> l_ColumnPointers{};
+        for (int32_t l_Dz = -1; l_Dz <= 1; ++l_Dz)
+        {
+            for (int32_t l_Dx = -1; l_Dx <= 1; ++l_Dx)
+            {
+                const size_t l_Index = static_cast<size_t>((l_Dz + 1) * 3 + (l_Dx + 1));
+                if (l_Index != 4 && !m_Settings.EnableStructures)
+                {
+                    continue;
+                }
+
+                GenerateColumn(coord.X + l_Dx, coord.Z + l_Dz, l_Columns[l_Index]);
+                l_ColumnPointers[l_Index] = &l_Columns[l_Index];
+            }
+        }
+
+        std::vector<BlockId> l_Blocks(Chunk::Volume);
+        GenerateTerrain(coord, l_Columns[4], l_Blocks.data());
+        DecorateSurface(coord, l_Columns[4], l_Blocks.data());
+        PlaceStructures(coord, l_ColumnPointers, l_Blocks.data());
+
+        std::unique_ptr<Chunk> l_Chunk = std::make_unique<Chunk>(coord);
+        l_Chunk->AssignBlocks(l_Blocks.data());
+
+        return l_Chunk;
+    }
+
+    std::shared_ptr<WorldGenerationBatch> WorldGenerator::GenerateAsync(JobSystem& jobSystem, const std::vector<ChunkCoord>& coords) const
+    {
+        std::shared_ptr<WorldGenerationBatch> l_Batch = std::make_shared<WorldGenerationBatch>();
+        l_Batch->m_Results.resize(coords.size());
+
+        // Structures need the ring of columns around each chunk; terrain only needs its own.
+        const int32_t l_ColumnRadius = m_Settings.EnableStructures ? 1 : 0;
+        for (const ChunkCoord& it_Coord : coords)
+        {
+            for (int32_t l_Dz = -l_ColumnRadius; l_Dz <= l_ColumnRadius; ++l_Dz)
+            {
+                for (int32_t l_Dx = -l_ColumnRadius; l_Dx <= l_ColumnRadius; ++l_Dx)
+                {
+                    std::unique_ptr<WorldGenerationBatch::ColumnTask>& l_Task = l_Batch->m_Columns[WorldGenerationBatch::GetColumnKey(it_Coord.X + l_Dx, it_Coord.Z + l_Dz)];
+                    if (l_Task == nullptr)
+                    {
+                        l_Task = std::make_unique<WorldGenerationBatch::ColumnTask>();
+                        l_Task->Column.X = it_Coord.X + l_Dx;
+                        l_Task->Column.Z = it_Coord.Z + l_Dz;
+                    }
+                }
+            }
+        }
+
+        // Stage 1 is submitted first so every column counter is pending before later stages attach to it.
+        for (auto& [l_Key, l_Task] : l_Batch->m_Columns)
+        {
+            WorldGenerationBatch::ColumnTask* l_ColumnTask = l_Task.get();
+            jobSystem.Submit([this, l_Batch, l_ColumnTask]()
+                {
+                    GenerateColumn(l_ColumnTask->Column.X, l_ColumnTask->Column.Z, l_ColumnTask->Column);
+                }, &l_ColumnTask->Counter);
+        }
+
+        l_Batch->m_Chunks.reserve(coords.size());
+        for (size_t i = 0; i < coords.size(); ++i)
+        {
+            const ChunkCoord l_Coord = coords[i];
+            l_Batch->m_Chunks.push_back(std::make_unique<WorldGenerationBatch::ChunkTask>());
+            WorldGenerationBatch::ChunkTask* l_ChunkTask = l_Batch->m_Chunks.back().get();
+            l_ChunkTask->Coord = l_Coord;
+
+            std::array<WorldGenerationBatch::ColumnTask*, 9> l_Columns{};
+            std::vector<JobCounter*> l_StructureDependencies{ &l_ChunkTask->TerrainCounter };
+            for (int32_t l_Dz = -l_ColumnRadius; l_Dz <= l_ColumnRadius; ++l_Dz)
+            {
+                for (int32_t l_Dx = -l_ColumnRadius; l_Dx <= l_ColumnRadius; ++l_Dx)
+                {
+                    const size_t l_Index = static_cast<size_t>((l_Dz + 1) * 3 + (l_Dx + 1));
+                    l_Columns[l_Index] = l_Batch->m_Columns[WorldGenerationBatch::GetColumnKey(l_Coord.X + l_Dx, l_Coord.Z + l_Dz)].get();
+                    if (l_Index != 4)
+                    {
+                        l_StructureDependencies.push_back(&l_Columns[l_Index]->Counter);
+                    }
+                }
+            }
+
+            // Stages 2 and 3 share the same single-column dependency, so they run back to back in one job.
+            const WorldColumn* l_OwnColumn = &l_Columns[4]->Column;
+            jobSystem.SubmitAfter(l_Columns[4]->Counter, [this, l_Batch, l_ChunkTask, l_OwnColumn]()
+                {
+                    l_ChunkTask->Blocks.resize(Chunk::Volume);
+                    GenerateTerrain(l_ChunkTask->Coord, *l_OwnColumn, l_ChunkTask->Blocks.data());
+                    DecorateSurface(l_ChunkTask->Coord, *l_OwnColumn, l_ChunkTask->Blocks.data());
+                }, &l_ChunkTask->TerrainCounter);
+
+            jobSystem.SubmitAfterAll(l_StructureDependencies, [this, l_Batch, l_ChunkTask, l_Columns, i]()
+                {
+                    std::array<const WorldColumn*, 9> l_ColumnPointers{};
+                    for (size_t it_Index = 0; it_Index < l_Columns.size(); ++it_Index)
+                    {
+                        l_ColumnPointers[it_Index] = l_Columns[it_Index] != nullptr ? &l_Columns[it_Index]->Column : nullptr;
+                    }
+
+                    PlaceStructures(l_ChunkTask->Coord, l_ColumnPointers, l_ChunkTask->Blocks.data());
+
+                    std::unique_ptr<Chunk> l_Chunk = std::make_unique<Chunk>(l_ChunkTask->Coord);
+                    l_Chunk->AssignBlocks(l_ChunkTask->Blocks.data());
+                    l_Batch->m_Results[i] = std::move(l_Chunk);
+
+                    // The dense copy is 64 KiB per chunk; release it as soon as the packed chunk exists.
+                    std::vector<BlockId>().swap(l_ChunkTask->Blocks);
+                }, &l_Batch->m_Counter);
+        }
+
+        return l_Batch;
+    }
+}
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "Engine/Core/Core.h"
+#include "Engine/Jobs/JobSystem.h"
+#include "Engine/Noise/NoiseGenerator.h"
+#include "Engine/World/Chunk.h"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace Engine
+{
+    enum class Biome : uint8_t
+    {
+        Ocean = 0,
+        Beach,
+        Plains,
+        Forest,
+        Desert,
+        Mountains
+    };
+
+    // Block ids the generator writes. Defaults match the ids used by the benchmarks until a registry assigns them.
+    struct WorldGenBlockIds
+    {
+        BlockId Stone = 1;
+        BlockId Dirt = 2;
+        BlockId Grass = 3;
+        BlockId Sand = 4;
+        BlockId Water = 5;
+        BlockId Log = 6;
+        BlockId Leaves = 7;
+        BlockId Snow = 8;
+    };
+
+    struct WorldGeneratorSettings
+    {
+        int32_t Seed = 1337;
+
+        int32_t SeaLevel = 62;
+        int32_t BaseHeight = 64;
+        float HillAmplitude = 24.0f;
+        float MountainAmplitude = 72.0f;
+        int32_t SnowLine = 120;
+
+        // Caves never open within this many blocks of the surface, so surface decoration and structures stand on solid ground.
+        bool EnableCaves = true;
+        float CaveThreshold = 0.28f;
+        int32_t CaveSurfaceMargin = 6;
+
+        bool EnableStructures = true;
+
+        WorldGenBlockIds Blocks;
+    };
+
+    // A tree rooted at (WorldX, BaseY, WorldZ); BaseY is the grass block under the trunk.
+    struct TreePlacement
+    {
+        int32_t WorldX = 0;
+        int32_t BaseY = 0;
+        int32_t WorldZ = 0;
+        int32_t TrunkHeight = 0;
+    };
+
+    // Output of the column stage: everything later stages need about one 32x32 column of chunks.
+    struct WorldColumn
+    {
+        static constexpr uint32_t Area = Chunk::Size * Chunk::Size;
+
+        int32_t X = 0;
+        int32_t Z = 0;
+
+        // Indexed z * Chunk::Size + x; heights are the world y of the topmost solid block.
+        std::array<int16_t, Area> Heights{};
+        std::array<Biome, Area> Biomes{};
+        int32_t MinHeight = 0;
+        int32_t MaxHeight = 0;
+
+        // Structures rooted inside this column; they may extend into neighbouring columns.
+        std::vector<TreePlacement> Trees;
+
+        int32_t GetHeight(int32_t localX, int32_t localZ) const { return Heights[static_cast<size_t>(localZ * Chunk::Size + localX)]; }
+        Biome GetBiome(int32_t localX, int32_t localZ) const { return Biomes[static_cast<size_t>(localZ * Chunk::Size + localX)]; }
+    };
+
+    class WorldGenerator;
+
+    // One scheduled generation request. Keep the handle until IsComplete, then take the chunks on the
+    // main thread. Dropping the handle early is safe; in-flight jobs keep the batch alive.
+    class ENGINE_API WorldGenerationBatch
+    {
+    public:
+        bool IsComplete() const { return m_Counter.IsComplete(); }
+        JobCounter& GetCounter() { return m_Counter; }
+
+        // Generated chunks in request order. Only valid once IsComplete returns true.
+        std::vector<std::unique_ptr<Chunk>>& GetChunks() { return m_Results; }
+
+    private:
+        friend class WorldGenerator;
+
+        struct ColumnTask
+        {
+            WorldColumn Column;
+            JobCounter Counter;
+        };
+
+        struct ChunkTask
+        {
+            ChunkCoord Coord;
+            std::vector<BlockId> Blocks;
+            JobCounter TerrainCounter;
+        };
+
+        static uint64_t GetColumnKey(int32_t columnX, int32_t columnZ)
+        {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(columnX)) << 32) | static_cast<uint32_t>(columnZ);
+        }
+
+        std::unordered_map<uint64_t, std::unique_ptr<ColumnTask>> m_Columns;
+        std::vector<std::unique_ptr<ChunkTask>> m_Chunks;
+        std::vector<std::unique_ptr<Chunk>> m_Results;
+        JobCounter m_Counter;
+    };
+
+    // Seed-deterministic terrain in four stages:
+    //   1. Column: heightmap, biomes and structure placement for a 32x32 column (no dependencies).
+    //   2. Terrain and caves for one chunk (its own column).
+    //   3. Surface decoration for one chunk (its own column).
+    //   4. Structures for one chunk, gathered from its own and the eight surrounding columns, so trees
+    //      rooted next door still spill across the border.
+    // Every stage is a pure function of the seed and coordinates, so output is bit-identical no matter
+    // how many threads run it or in which order chunks are requested.
+    class ENGINE_API WorldGenerator
+    {
+    public:
+        // Horizontal distance a structure may extend from its root; must stay below Chunk::Size.
+        static constexpr int32_t StructureReach = 2;
+
+        explicit WorldGenerator(const WorldGeneratorSettings& settings = WorldGeneratorSettings());
+
+        const WorldGeneratorSettings& GetSettings() const { return m_Settings; }
+
+        void GenerateColumn(int32_t columnX, int32_t columnZ, WorldColumn& outColumn) const;
+
+        // Stages 2 and 3 into a dense Chunk::Volume array in Chunk::GetIndex order.
+        void GenerateTerrain(const ChunkCoord& coord, const WorldColumn& column, BlockId* outBlocks) const;
+        void DecorateSurface(const ChunkCoord& coord, const WorldColumn& column, BlockId* blocks) const;
+
+        // columns is indexed (dz + 1) * 3 + (dx + 1) around the chunk's column.
+        void PlaceStructures(const ChunkCoord& coord, const std::array<const WorldColumn*, 9>& columns, BlockId* blocks) const;
+
+        // Run every stage for one chunk on the calling thread.
+        std::unique_ptr<Chunk> GenerateChunk(const ChunkCoord& coord) const;
+
+        // Schedule every stage for a set of chunks on the job system. Column work is shared between
+        // chunks of the same batch. The generator must outlive the returned batch's jobs.
+        std::shared_ptr<WorldGenerationBatch> GenerateAsync(JobSystem& jobSystem, const std::vector<ChunkCoord>& coords) const;
+
+    private:
+        void CarveCaves(const ChunkCoord& coord, const WorldColumn& column, BlockId* blocks) const;
+
+    private:
+        WorldGeneratorSettings m_Settings;
+
+        NoiseGenerator m_ContinentNoise;
+        NoiseGenerator m_MountainNoise;
+        NoiseGenerator m_MountainMaskNoise;
+        NoiseGenerator m_TemperatureNoise;
+        NoiseGenerator m_HumidityNoise;
+        NoiseGenerator m_CaveNoise;
+    };
+}
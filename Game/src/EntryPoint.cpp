@@ -2,11 +2,52 @@
 #include "Engine/Core/Log.h"
 #include "GameLayer.h"
 
+#include <cstdlib>
+#include <cstring>
 #include <memory>
 
-int main()
+int main(int argc, char** argv)
 {
-    Engine::Application l_Application;
+    Engine::ApplicationSpecification l_Specification;
+
+    // Command line switches let build farms and dedicated servers run the game without a display.
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--headless") == 0)
+        {
+            l_Specification.Headless = true;
+        }
+        else if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+        {
+            l_Specification.MaxFrames = std::strtoull(argv[++i], nullptr, 10);
+        }
+        else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc)
+        {
+            l_Specification.InputRecordPath = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc)
+        {
+            l_Specification.InputReplayPath = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--timings") == 0 && i + 1 < argc)
+        {
+            l_Specification.FrameTimingPath = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--profile") == 0 && i + 1 < argc)
+        {
+            l_Specification.ProfileCapturePath = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--log-levels") == 0 && i + 1 < argc)
+        {
+            l_Specification.Logging.Levels = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--sync-log") == 0)
+        {
+            l_Specification.Logging.Async = false;
+        }
+    }
+
+    Engine::Application l_Application(l_Specification);
 
     GAME_INFO("-------STARTING GAME-------");
 
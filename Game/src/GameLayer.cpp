@@ -6,6 +6,7 @@
 #include <chrono>
 #include <limits>
 #include <array>
+#include <utility>
 
 #include "Engine/Events/Events.h"
 #include "Engine/Core/Log.h"
@@ -14,28 +15,590 @@
 #include <GLFW/glfw3.h>
 #include <glm/gtc/matrix_transform.hpp>
 
+namespace
+{
+    // Chunk columns kept around the camera, and the chunk layers from y = 0 streamed in each of them. Columns
+    // load within the load radius and unload beyond the unload radius, so small moves never reload anything.
+    constexpr int32_t s_LoadRadius = 8;
+    constexpr int32_t s_UnloadRadius = 10;
+    constexpr int32_t s_ChunkLayerCount = 6;
+
+    // Resident chunk memory (blocks and light) above which the farthest chunks are evicted.
+    constexpr size_t s_ChunkMemoryBudget = size_t{ 256 } << 20;
+
+    // Downsampled rings past the load radius, two sections wide per level: 2x out to 12 columns, 4x to 20,
+    // 8x to 36. Surface blocks win the coarse cells so far hills keep their grass, sand and snow.
+    constexpr uint32_t s_TerrainLodLevels = 3;
+    constexpr int32_t s_TerrainLodRingSections = 2;
+
+    // Chunks handed to the job system per batch; small enough that results start arriving within a few ticks.
+    constexpr size_t s_GenerationBatchSize = 64;
+
+    // Simulated seconds between autosaves, and where region files are kept relative to the working directory.
+    constexpr double s_AutosaveInterval = 30.0;
+    const char* s_SaveDirectory = "Saves/World";
+
+    // Block definitions, loaded once at startup; ids follow file order, which saved chunks rely on.
+    const char* s_BlockDefinitionPath = "Assets/Blocks/Blocks.yaml";
+
+    // Looks up every block the generator places; false names the first one the definitions lack.
+    bool ResolveWorldGenBlocks(const Engine::BlockRegistry& registry, Engine::WorldGenBlockIds& blocks)
+    {
+        const std::pair<const char*, Engine::BlockId*> l_Blocks[] =
+        {
+            { "stone", &blocks.Stone }, { "dirt", &blocks.Dirt }, { "grass", &blocks.Grass }, { "sand", &blocks.Sand },
+            { "water", &blocks.Water }, { "log", &blocks.Log }, { "leaves", &blocks.Leaves }, { "snow", &blocks.Snow }
+        };
+
+        for (const auto& it_Block : l_Blocks)
+        {
+            *it_Block.second = registry.FindBlock(it_Block.first);
+            if (*it_Block.second == Engine::BlockRegistry::InvalidBlockId)
+            {
+                GAME_ERROR("Block definitions lack '{}', which world generation needs", it_Block.first);
+
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Fixed camera over spawn until the player exists: eye height above the default terrain, looking along +x.
+    const glm::vec3 s_SpawnCameraPosition(0.5f, 96.0f, 0.5f);
+    const glm::vec3 s_SpawnCameraTarget(64.0f, 72.0f, 16.0f);
+
+    // The hand-made block atlas, relative to the asset directory; the built-in importer cuts it into 16x16 tiles.
+    const char* s_AtlasPath = "Textures/Atlas.png";
+}
+
 bool GameLayer::Initialize()
 {
+    // Cooks in the background on the first run, maps the cache on later ones; Render picks it up when ready.
+    m_AtlasHandle = GetAssetManager().Load(s_AtlasPath, "TextureAtlas");
+
+    Engine::WorldGeneratorSettings l_GeneratorSettings;
+    if (!m_BlockRegistry.LoadFromFile(s_BlockDefinitionPath) || !ResolveWorldGenBlocks(m_BlockRegistry, l_GeneratorSettings.Blocks))
+    {
+        return false;
+    }
+
+    m_WorldGenerator = std::make_unique<Engine::WorldGenerator>(l_GeneratorSettings);
+    m_LightEngine = std::make_unique<Engine::LightEngine>(m_World, m_BlockRegistry);
+    m_RegionStore = std::make_unique<Engine::RegionStore>(s_SaveDirectory);
+
+    Engine::ChunkStreamerSettings l_StreamerSettings;
+    l_StreamerSettings.LoadRadius = s_LoadRadius;
+    l_StreamerSettings.UnloadRadius = s_UnloadRadius;
+    l_StreamerSettings.MinChunkY = 0;
+    l_StreamerSettings.MaxChunkY = s_ChunkLayerCount - 1;
+    l_StreamerSettings.MemoryBudgetBytes = s_ChunkMemoryBudget;
+    m_ChunkStreamer = std::make_unique<Engine::ChunkStreamer>(m_World, l_StreamerSettings);
+
+    Engine::TerrainLodSettings l_LodSettings;
+    l_LodSettings.LevelCount = s_TerrainLodLevels;
+    l_LodSettings.DetailRadius = s_LoadRadius;
+    l_LodSettings.RingSections = s_TerrainLodRingSections;
+    l_LodSettings.MinChunkY = 0;
+    l_LodSettings.MaxChunkY = s_ChunkLayerCount - 1;
+    l_LodSettings.MaterialPriorities.assign(m_BlockRegistry.GetBlockCount(), 1);
+    for (Engine::BlockId it_Block : { l_GeneratorSettings.Blocks.Grass, l_GeneratorSettings.Blocks.Sand, l_GeneratorSettings.Blocks.Snow })
+    {
+        l_LodSettings.MaterialPriorities[it_Block] = 2;
+    }
+    m_TerrainLod = std::make_unique<Engine::TerrainLod>(GetJobSystem(), m_BlockRegistry.GetMeshingTable(), l_LodSettings);
+
+    m_MeshPipeline = std::make_unique<Engine::ChunkMeshPipeline>(GetJobSystem(), m_World, m_BlockRegistry.GetMeshingTable());
+    m_MeshPipeline->SetUploadCallback([this](const Engine::ChunkCoord&, Engine::ChunkMesh& mesh)
+        {
+            // Streamed columns outside the detail rings are drawn by the first terrain level instead.
+            if (!m_TerrainLod->IsDetailColumn(mesh.Coord))
+            {
+                return;
+            }
+
+            m_ChunkVisibility.SetSection(mesh);
+            m_IsVisibilityDirty = true;
+        });
+    m_NextAutosaveTime = s_AutosaveInterval;
+
+    m_GenerationStartTime = std::chrono::steady_clock::now();
+
     return true;
 }
 
-void GameLayer::Update()
+void GameLayer::Update(const Engine::TickTiming& tickTiming)
+{
+    UpdateStreaming();
+    UpdateWorldGeneration();
+    UpdateLighting();
+    UpdateTerrainLod();
+    m_MeshPipeline->Dispatch();
+    UpdateAutosave(tickTiming);
+}
+
+void GameLayer::UpdateStreaming()
+{
+    m_ChunkStreamer->Update(s_SpawnCameraPosition);
+
+    const std::vector<Engine::ChunkCoord>& l_Evictions = m_ChunkStreamer->GetEvictions();
+    if (!l_Evictions.empty())
+    {
+        // Unsaved chunks are snapshotted by the save batch, so they can leave the world right away.
+        std::vector<const Engine::Chunk*> l_Unsaved;
+        for (const Engine::ChunkCoord& it_Coord : l_Evictions)
+        {
+            if (m_UnsavedChunks.erase(it_Coord) > 0)
+            {
+                l_Unsaved.push_back(m_World.FindChunk(it_Coord));
+            }
+        }
+
+        if (!l_Unsaved.empty())
+        {
+            m_EvictionSaveBatches.push_back(m_RegionStore->SaveAsync(GetJobSystem(), l_Unsaved));
+        }
+
+        for (const Engine::ChunkCoord& it_Coord : l_Evictions)
+        {
+            m_World.RemoveChunk(it_Coord);
+            m_ChunkVisibility.RemoveSection(it_Coord);
+        }
+        m_IsVisibilityDirty = true;
+    }
+
+    std::erase_if(m_EvictionSaveBatches, [](const std::shared_ptr<Engine::RegionSaveBatch>& batch)
+        {
+            if (!batch->IsComplete())
+            {
+                return false;
+            }
+
+            if (!batch->HasSucceeded())
+            {
+                GAME_ERROR("Saving {} evicted chunks failed; their changes are lost", batch->GetChunkCount());
+            }
+
+            return true;
+        });
+
+    const Engine::ChunkStreamerStats& l_Stats = m_ChunkStreamer->GetLastFrameStats();
+    if (l_Stats.EvictedCount + l_Stats.BudgetEvictedCount > 0)
+    {
+        GAME_INFO("Streaming evicted {} chunks ({} over the memory budget); {} resident, {:.1f} MB", l_Stats.EvictedCount + l_Stats.BudgetEvictedCount,
+            l_Stats.BudgetEvictedCount, l_Stats.ResidentCount, l_Stats.ResidentBytes / (1024.0 * 1024.0));
+    }
+}
+
+bool GameLayer::IsWorldIdle() const
+{
+    return m_GenerationBatch == nullptr && m_LoadBatch == nullptr && m_RegenerateQueue.empty() && m_ChunkStreamer->IsIdle();
+}
+
+void GameLayer::UpdateWorldGeneration()
+{
+    const bool l_GenerationBusy = m_GenerationBatch != nullptr && !m_GenerationBatch->IsComplete();
+    const bool l_LoadBusy = m_LoadBatch != nullptr && !m_LoadBatch->IsComplete();
+    if (l_GenerationBusy || l_LoadBusy)
+    {
+        return;
+    }
+
+    const bool l_HadWork = m_GenerationBatch != nullptr || m_LoadBatch != nullptr;
+    if (m_GenerationBatch != nullptr)
+    {
+        for (std::unique_ptr<Engine::Chunk>& it_Chunk : m_GenerationBatch->GetChunks())
+        {
+            const Engine::ChunkCoord l_Coord = it_Chunk->GetCoord();
+            m_UnsavedChunks.insert(l_Coord);
+            m_LightQueue.push_back(l_Coord);
+            m_TerrainLod->OnChunkChanged(m_World.InsertChunk(std::move(it_Chunk)));
+            m_ChunkStreamer->OnChunkLoaded(l_Coord);
+            RequestChunkMeshes(l_Coord);
+        }
+        m_GenerationBatch.reset();
+    }
+
+    if (m_LoadBatch != nullptr)
+    {
+        std::vector<std::unique_ptr<Engine::Chunk>>& l_Chunks = m_LoadBatch->GetChunks();
+        for (size_t i = 0; i < l_Chunks.size(); ++i)
+        {
+            if (l_Chunks[i] == nullptr)
+            {
+                GAME_WARN("Saved chunk ({}, {}, {}) could not be read; regenerating it", m_LoadBatch->GetCoords()[i].X, m_LoadBatch->GetCoords()[i].Y, m_LoadBatch->GetCoords()[i].Z);
+                m_RegenerateQueue.push_back(m_LoadBatch->GetCoords()[i]);
+                continue;
+            }
+
+            const Engine::ChunkCoord l_Coord = l_Chunks[i]->GetCoord();
+            m_LightQueue.push_back(l_Coord);
+            m_TerrainLod->OnChunkChanged(m_World.InsertChunk(std::move(l_Chunks[i])));
+            m_ChunkStreamer->OnChunkLoaded(l_Coord);
+            RequestChunkMeshes(l_Coord);
+        }
+        m_LoadBatch.reset();
+    }
+
+    // Split the next requests into chunks already on disk and chunks that need generating.
+    std::vector<Engine::ChunkCoord> l_Generate = std::move(m_RegenerateQueue);
+    std::vector<Engine::ChunkCoord> l_Load;
+    m_RegenerateQueue.clear();
+
+    for (const Engine::ChunkCoord& it_Coord : m_ChunkStreamer->TakeRequests(s_GenerationBatchSize))
+    {
+        if (m_RegionStore->HasChunk(it_Coord))
+        {
+            l_Load.push_back(it_Coord);
+        }
+        else
+        {
+            l_Generate.push_back(it_Coord);
+        }
+    }
+
+    if (l_Generate.empty() && l_Load.empty())
+    {
+        if (l_HadWork)
+        {
+            const double l_Milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_GenerationStartTime).count();
+            GAME_INFO("Spawn area ready: {} chunks in {:.1f} ms", m_World.GetChunkCount(), l_Milliseconds);
+        }
+
+        return;
+    }
+
+    if (!l_Generate.empty())
+    {
+        m_GenerationBatch = m_WorldGenerator->GenerateAsync(GetJobSystem(), l_Generate);
+    }
+
+    if (!l_Load.empty())
+    {
+        m_LoadBatch = m_RegionStore->LoadAsync(GetJobSystem(), l_Load);
+    }
+}
+
+void GameLayer::UpdateLighting()
 {
+    if (m_LightBatch != nullptr)
+    {
+        if (!m_LightBatch->IsComplete())
+        {
+            return;
+        }
 
+        const Engine::LightPropagationStats l_Stats = m_LightEngine->Merge(*m_LightBatch);
+        const size_t l_ChunkCount = m_LightBatch->GetChunkCount();
+        m_LightBatch.reset();
+
+        if (m_LightQueue.empty() && IsWorldIdle())
+        {
+            const double l_Milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - m_GenerationStartTime).count();
+            GAME_INFO("Spawn area lit after {:.1f} ms (last batch: {} chunks, {} relit, {} voxels propagated)", l_Milliseconds, l_ChunkCount, l_Stats.ChunksRelit,
+                l_Stats.VoxelsVisited);
+        }
+    }
+
+    if (m_LightQueue.empty())
+    {
+        return;
+    }
+
+    m_LightBatch = m_LightEngine->LightChunksAsync(GetJobSystem(), m_LightQueue);
+    m_LightQueue.clear();
+}
+
+void GameLayer::UpdateAutosave(const Engine::TickTiming& tickTiming)
+{
+    if (m_SaveBatch != nullptr)
+    {
+        if (!m_SaveBatch->IsComplete())
+        {
+            return;
+        }
+
+        if (!m_SaveBatch->HasSucceeded())
+        {
+            GAME_ERROR("Autosave failed; {} chunks may be missing from {}", m_SaveBatch->GetChunkCount(), s_SaveDirectory);
+        }
+        m_SaveBatch.reset();
+    }
+
+    if (tickTiming.SimulationTime < m_NextAutosaveTime || m_UnsavedChunks.empty())
+    {
+        return;
+    }
+    m_NextAutosaveTime = tickTiming.SimulationTime + s_AutosaveInterval;
+
+    std::vector<const Engine::Chunk*> l_Chunks;
+    l_Chunks.reserve(m_UnsavedChunks.size());
+    for (const Engine::ChunkCoord& it_Coord : m_UnsavedChunks)
+    {
+        if (const Engine::Chunk* l_Chunk = m_World.FindChunk(it_Coord))
+        {
+            l_Chunks.push_back(l_Chunk);
+        }
+    }
+    m_UnsavedChunks.clear();
+
+    m_SaveBatch = m_RegionStore->SaveAsync(GetJobSystem(), l_Chunks);
+}
+
+void GameLayer::RequestChunkMeshes(const Engine::ChunkCoord& coord)
+{
+    static constexpr int32_t s_Offsets[6][3] = { { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 } };
+
+    m_MeshPipeline->RequestRemesh(coord);
+    for (const auto& it_Offset : s_Offsets)
+    {
+        const Engine::ChunkCoord l_Neighbour{ coord.X + it_Offset[0], coord.Y + it_Offset[1], coord.Z + it_Offset[2] };
+        if (m_World.FindChunk(l_Neighbour) != nullptr)
+        {
+            m_MeshPipeline->RequestRemesh(l_Neighbour);
+        }
+    }
+}
+
+void GameLayer::UpdateVisibility()
+{
+    // The camera never moves yet, so only new section data can change the result.
+    if (m_IsVisibilityDirty)
+    {
+        const glm::mat4 l_Projection = glm::perspective(glm::radians(70.0f), 16.0f / 9.0f, 0.1f, 1000.0f);
+        const glm::mat4 l_View = glm::lookAt(s_SpawnCameraPosition, s_SpawnCameraTarget, glm::vec3(0.0f, 1.0f, 0.0f));
+        m_ChunkVisibility.Update(l_Projection * l_View, s_SpawnCameraPosition);
+        m_IsVisibilityDirty = false;
+    }
+
+    if (m_HasReportedVisibility || m_ChunkVisibility.GetSectionCount() == 0)
+    {
+        return;
+    }
+
+    const bool l_MeshingIdle = m_MeshPipeline->GetPendingCount() == 0 && m_MeshPipeline->GetLastFrameStats().InFlightCount == 0;
+    if (IsWorldIdle() && l_MeshingIdle)
+    {
+        const Engine::ChunkVisibilityStats& l_Stats = m_ChunkVisibility.GetLastFrameStats();
+        GAME_INFO("Spawn camera sees {} of {} sections ({} visited, {} frustum culled, {} occlusion culled)", l_Stats.VisibleCount, l_Stats.SectionCount,
+            l_Stats.VisitedCount, l_Stats.FrustumCulledCount, l_Stats.OcclusionCulledCount);
+
+        // What a click at the centre of the screen would pick, once there is a player to click.
+        const Engine::VoxelQuery l_Query(m_World, m_BlockRegistry);
+        const Engine::VoxelRayHit l_Hit = l_Query.Raycast({ s_SpawnCameraPosition, s_SpawnCameraTarget - s_SpawnCameraPosition, 256.0f });
+        if (l_Hit.IsHit)
+        {
+            GAME_INFO("Spawn camera looks at {} at ({}, {}, {}), {:.1f} blocks away", m_BlockRegistry.GetName(l_Hit.Block), l_Hit.Position.x, l_Hit.Position.y,
+                l_Hit.Position.z, l_Hit.Distance);
+        }
+        m_HasReportedVisibility = true;
+    }
+}
+
+void GameLayer::UpdateTerrainLod()
+{
+    m_TerrainLod->Update(s_SpawnCameraPosition);
+
+    if (m_LodGenerationBatch != nullptr && m_LodGenerationBatch->IsComplete())
+    {
+        for (const std::unique_ptr<Engine::Chunk>& it_Chunk : m_LodGenerationBatch->GetChunks())
+        {
+            m_TerrainLod->OnChunkChanged(*it_Chunk);
+        }
+        m_LodGenerationBatch.reset();
+    }
+
+    if (m_LodLoadBatch != nullptr && m_LodLoadBatch->IsComplete())
+    {
+        std::vector<std::unique_ptr<Engine::Chunk>>& l_Chunks = m_LodLoadBatch->GetChunks();
+        for (size_t i = 0; i < l_Chunks.size(); ++i)
+        {
+            if (l_Chunks[i] == nullptr)
+            {
+                m_LodRegenerateQueue.push_back(m_LodLoadBatch->GetCoords()[i]);
+                continue;
+            }
+
+            m_TerrainLod->OnChunkChanged(*l_Chunks[i]);
+        }
+        m_LodLoadBatch.reset();
+    }
+
+    // The streamed area always comes first; far sources only use the workers it leaves idle.
+    if (m_LodGenerationBatch == nullptr && m_LodLoadBatch == nullptr && IsWorldIdle())
+    {
+        std::vector<Engine::ChunkCoord> l_Generate = std::move(m_LodRegenerateQueue);
+        std::vector<Engine::ChunkCoord> l_Load;
+        m_LodRegenerateQueue.clear();
+
+        for (const Engine::ChunkCoord& it_Coord : m_TerrainLod->TakeMissingSources(s_GenerationBatchSize))
+        {
+            if (const Engine::Chunk* l_Chunk = m_World.FindChunk(it_Coord))
+            {
+                m_TerrainLod->OnChunkChanged(*l_Chunk);
+            }
+            else if (m_RegionStore->HasChunk(it_Coord))
+            {
+                l_Load.push_back(it_Coord);
+            }
+            else
+            {
+                l_Generate.push_back(it_Coord);
+            }
+        }
+
+        if (!l_Generate.empty())
+        {
+            m_LodGenerationBatch = m_WorldGenerator->GenerateAsync(GetJobSystem(), l_Generate);
+        }
+
+        if (!l_Load.empty())
+        {
+            m_LodLoadBatch = m_RegionStore->LoadAsync(GetJobSystem(), l_Load);
+        }
+    }
+
+    if (m_HasReportedTerrainLod || !IsWorldIdle() || m_LodGenerationBatch != nullptr || m_LodLoadBatch != nullptr || !m_TerrainLod->IsIdle())
+    {
+        return;
+    }
+
+    const Engine::TerrainLodStats& l_Stats = m_TerrainLod->GetLastFrameStats();
+    for (uint32_t l_Level = 1; l_Level <= s_TerrainLodLevels; ++l_Level)
+    {
+        const Engine::TerrainLodLevelStats& l_LevelStats = l_Stats.Levels[l_Level - 1];
+        GAME_INFO("Terrain level {} ({}x, out to {} columns): {} sections shown of {} held, {} vertices, {:.1f} MB of cells", l_Level,
+            Engine::TerrainLod::GetScale(l_Level), m_TerrainLod->GetReach(l_Level), l_LevelStats.ActiveCount, l_LevelStats.SectionCount, l_LevelStats.VertexCount,
+            l_LevelStats.MemoryBytes / (1024.0 * 1024.0));
+    }
+    m_HasReportedTerrainLod = true;
 }
 
-void GameLayer::Render()
+void GameLayer::UpdateTextureAtlas()
 {
+    Engine::AssetManager& l_Assets = GetAssetManager();
+    if (l_Assets.GetState(m_AtlasHandle) == Engine::AssetState::Failed)
+    {
+        if (!m_HasReportedAtlasFailure)
+        {
+            GAME_ERROR("Texture atlas unavailable; blocks will render untextured");
+            m_HasReportedAtlasFailure = true;
+        }
 
+        return;
+    }
+
+    const uint32_t l_Version = l_Assets.GetVersion(m_AtlasHandle);
+    if (l_Version == 0 || l_Version == m_AtlasVersion)
+    {
+        return;
+    }
+    m_AtlasVersion = l_Version;
+
+    std::shared_ptr<const Engine::AssetData> l_Data = l_Assets.GetData(m_AtlasHandle);
+    if (!m_TextureAtlas.Attach(l_Data->GetData(), l_Data->GetSize()))
+    {
+        GAME_ERROR("Texture atlas version {} is unusable", l_Version);
+        m_AtlasData.reset();
+
+        return;
+    }
+
+    m_AtlasData = std::move(l_Data);
+    m_HasReportedAtlasFailure = false;
+    GAME_INFO("Texture atlas version {}: {} tiles in {} layers, {} mip levels", l_Version, m_TextureAtlas.GetSourceTileCount(), m_TextureAtlas.GetLayerCount(), m_TextureAtlas.GetMipLevelCount());
 }
 
+void GameLayer::Render(const Engine::FrameTiming&)
+{
+    UpdateTextureAtlas();
+    UpdateVisibility();
+}
 
-void GameLayer::OnEvent(const Engine::Event& event)
+
+void GameLayer::OnEvent(const Engine::Event&)
 {
 
 }
 
 void GameLayer::Shutdown()
 {
+    // In-flight generation and load jobs reference the generator and the store, so let them finish first.
+    if (m_GenerationBatch != nullptr)
+    {
+        GetJobSystem().WaitForCounter(m_GenerationBatch->GetCounter());
+        m_GenerationBatch.reset();
+    }
+
+    if (m_LoadBatch != nullptr)
+    {
+        GetJobSystem().WaitForCounter(m_LoadBatch->GetCounter());
+        m_LoadBatch.reset();
+    }
+
+    if (m_LodGenerationBatch != nullptr)
+    {
+        GetJobSystem().WaitForCounter(m_LodGenerationBatch->GetCounter());
+        m_LodGenerationBatch.reset();
+    }
+
+    if (m_LodLoadBatch != nullptr)
+    {
+        GetJobSystem().WaitForCounter(m_LodLoadBatch->GetCounter());
+        m_LodLoadBatch.reset();
+    }
+
+    // Light jobs only touch their batch's snapshots, but none should still be running once the layer is gone.
+    if (m_LightBatch != nullptr)
+    {
+        GetJobSystem().WaitForCounter(m_LightBatch->GetCounter());
+        m_LightBatch.reset();
+    }
+
+    if (m_SaveBatch != nullptr)
+    {
+        GetJobSystem().WaitForCounter(m_SaveBatch->GetCounter());
+        m_SaveBatch.reset();
+    }
+
+    for (const std::shared_ptr<Engine::RegionSaveBatch>& it_Batch : m_EvictionSaveBatches)
+    {
+        GetJobSystem().WaitForCounter(it_Batch->GetCounter());
+    }
+    m_EvictionSaveBatches.clear();
+
+    // Mesh jobs only hold snapshots, but their results must not reach the visibility set after this point.
+    m_MeshPipeline.reset();
+    m_TerrainLod.reset();
+
+    // Final save of everything generated since the last autosave.
+    if (m_RegionStore != nullptr && !m_UnsavedChunks.empty())
+    {
+        std::vector<const Engine::Chunk*> l_Chunks;
+        for (const Engine::ChunkCoord& it_Coord : m_UnsavedChunks)
+        {
+            if (const Engine::Chunk* l_Chunk = m_World.FindChunk(it_Coord))
+            {
+                l_Chunks.push_back(l_Chunk);
+            }
+        }
+        m_UnsavedChunks.clear();
+
+        std::shared_ptr<Engine::RegionSaveBatch> l_Save = m_RegionStore->SaveAsync(GetJobSystem(), l_Chunks);
+        GetJobSystem().WaitForCounter(l_Save->GetCounter());
+        if (l_Save->HasSucceeded())
+        {
+            GAME_INFO("Saved {} chunks to {}", l_Save->GetChunkCount(), s_SaveDirectory);
+        }
+        else
+        {
+            GAME_ERROR("Final save to {} failed", s_SaveDirectory);
+        }
+    }
+
+    m_TextureAtlas.Close();
+    m_AtlasData.reset();
+    GetAssetManager().Release(m_AtlasHandle);
+
     GAME_INFO("GameLayer shutdown complete");
 }
\ No newline at end of file
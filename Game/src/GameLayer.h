@@ -1,13 +1,27 @@
 #pragma once
 
 #include "Engine/Application.h"
+#include "Engine/Assets/AssetManager.h"
+#include "Engine/Assets/TextureAtlas.h"
 #include "Engine/Layer/Layer.h"
+#include "Engine/World/BlockRegistry.h"
+#include "Engine/World/ChunkMeshPipeline.h"
+#include "Engine/World/ChunkStreamer.h"
+#include "Engine/World/ChunkVisibility.h"
+#include "Engine/World/LightEngine.h"
+#include "Engine/World/RegionStore.h"
+#include "Engine/World/TerrainLod.h"
+#include "Engine/World/VoxelQuery.h"
+#include "Engine/World/World.h"
+#include "Engine/World/WorldGenerator.h"
 
 #include <glm/glm.hpp>
 
 #include <memory>
 #include <chrono>
 #include <limits>
+#include <unordered_set>
+#include <vector>
 
 // GameLayer drives gameplay logic and rendering owned by the Game target.
 class GameLayer : public Engine::Layer
@@ -19,15 +33,94 @@ public:
     // Prepare gameplay systems and resources.
     bool Initialize() override;
 
-    // Advance simulation for the current frame.
-    void Update() override;
+    // Advance simulation by one fixed tick.
+    void Update(const Engine::TickTiming& tickTiming) override;
 
     // React to incoming engine events (keyboard, mouse, window, etc.).
     void OnEvent(const Engine::Event& event) override;
 
-    // Draw the current frame.
-    void Render() override;
+    // Draw the current frame, interpolating between the last two ticks.
+    void Render(const Engine::FrameTiming& frameTiming) override;
 
     // Release resources when shutting down.
     void Shutdown() override;
+
+private:
+    // Move the streaming focus and drop the chunks it evicts, saving unsaved ones in the background.
+    void UpdateStreaming();
+
+    // No chunk requested, generating, loading or waiting to be regenerated.
+    bool IsWorldIdle() const;
+
+    // Collect finished generation work and schedule the next batch; never blocks the tick.
+    void UpdateWorldGeneration();
+
+    // Merge finished light into the world and light the chunks that arrived since; never blocks the tick.
+    void UpdateLighting();
+
+    // Queue chunks generated since the last autosave for a background write; never blocks the tick.
+    void UpdateAutosave(const Engine::TickTiming& tickTiming);
+
+    // Point the atlas at the newest cooked version once the asset manager publishes one.
+    void UpdateTextureAtlas();
+
+    // Mesh a freshly inserted chunk and re-mesh the loaded neighbours whose borders it closes.
+    void RequestChunkMeshes(const Engine::ChunkCoord& coord);
+
+    // Cull sections against the spawn camera whenever meshing changed what is known about them.
+    void UpdateVisibility();
+
+    // Feed far chunks to the terrain levels once streaming is idle: saved ones are loaded, the rest generated,
+    // and none of them enter the world.
+    void UpdateTerrainLod();
+
+private:
+    // Block textures, cooked from Assets/Textures/Atlas.png on first run and memory-mapped afterwards.
+    // The atlas reads straight from the asset data, which is held until the next version replaces it.
+    Engine::AssetHandle m_AtlasHandle;
+    std::shared_ptr<const Engine::AssetData> m_AtlasData;
+    Engine::TextureAtlas m_TextureAtlas;
+    uint32_t m_AtlasVersion = 0;
+    bool m_HasReportedAtlasFailure = false;
+
+    // Block types from Assets/Blocks/Blocks.yaml; read once here, then only its flat tables are used.
+    Engine::BlockRegistry m_BlockRegistry;
+
+    Engine::World m_World;
+    std::unique_ptr<Engine::WorldGenerator> m_WorldGenerator;
+
+    // Decides which chunks around the camera should be loaded; generation and loading serve its requests.
+    std::unique_ptr<Engine::ChunkStreamer> m_ChunkStreamer;
+
+    // The generation batch currently running on the job system.
+    std::shared_ptr<Engine::WorldGenerationBatch> m_GenerationBatch;
+    std::chrono::steady_clock::time_point m_GenerationStartTime;
+
+    // Chunks inserted but not lit yet, and the lighting batch currently running on the job system.
+    std::unique_ptr<Engine::LightEngine> m_LightEngine;
+    std::vector<Engine::ChunkCoord> m_LightQueue;
+    std::shared_ptr<Engine::LightBatch> m_LightBatch;
+
+    // Chunks saved by an earlier session are loaded instead of generated; unreadable ones fall back to generation.
+    std::unique_ptr<Engine::RegionStore> m_RegionStore;
+    std::shared_ptr<Engine::RegionLoadBatch> m_LoadBatch;
+    std::vector<Engine::ChunkCoord> m_RegenerateQueue;
+
+    // Meshes are built on workers; until they are uploaded only their section connectivity is kept, for culling.
+    std::unique_ptr<Engine::ChunkMeshPipeline> m_MeshPipeline;
+    Engine::ChunkVisibility m_ChunkVisibility;
+    bool m_IsVisibilityDirty = false;
+    bool m_HasReportedVisibility = false;
+
+    // Downsampled rings beyond the streamed area, and the batches producing their far source chunks.
+    std::unique_ptr<Engine::TerrainLod> m_TerrainLod;
+    std::shared_ptr<Engine::WorldGenerationBatch> m_LodGenerationBatch;
+    std::shared_ptr<Engine::RegionLoadBatch> m_LodLoadBatch;
+    std::vector<Engine::ChunkCoord> m_LodRegenerateQueue;
+    bool m_HasReportedTerrainLod = false;
+
+    std::unordered_set<Engine::ChunkCoord, Engine::ChunkCoordHash> m_UnsavedChunks;
+    std::shared_ptr<Engine::RegionSaveBatch> m_SaveBatch;
+    std::vector<std::shared_ptr<Engine::RegionSaveBatch>> m_EvictionSaveBatches;
+    double m_NextAutosaveTime = 0.0;
 };
\ No newline at end of file